@@ -70,7 +70,7 @@ namespace ramses_internal
 
     bool ClientApplicationLogic::flush(SceneId sceneId, const FlushTimeInformation& timeInfo, SceneVersionTag versionTag)
     {
-        PlatformGuard guard(m_frameworkLock);
+        // no framework lock, scene logic locks per scene and takes framework lock only for sending
         return m_scenegraphProviderComponent->handleFlush(sceneId, timeInfo, versionTag);
     }
 
@@ -89,43 +89,36 @@ namespace ramses_internal
 
     ramses_internal::ManagedResource ClientApplicationLogic::addResource(const IResource* resource)
     {
-        PlatformGuard guard(m_frameworkLock);
         return m_resourceComponent->manageResource(*resource);
     }
 
     ramses_internal::ManagedResource ClientApplicationLogic::getResource(ResourceContentHash hash) const
     {
-        PlatformGuard guard(m_frameworkLock);
         return m_resourceComponent->getResource(hash);
     }
 
     ramses_internal::ResourceHashUsage ClientApplicationLogic::getHashUsage(const ResourceContentHash& hash) const
     {
-        PlatformGuard guard(m_frameworkLock);
         return m_resourceComponent->getResourceHashUsage(hash);
     }
 
     void ClientApplicationLogic::addResourceFile(ResourceFileInputStreamSPtr resourceFileInputStream, const ResourceTableOfContents& toc)
     {
-        PlatformGuard guard(m_frameworkLock);
         m_resourceComponent->addResourceFile(std::move(resourceFileInputStream), toc);
     }
 
     void ClientApplicationLogic::removeResourceFile(const String& resourceFileName)
     {
-        PlatformGuard guard(m_frameworkLock);
         m_resourceComponent->removeResourceFile(resourceFileName);
     }
 
     void ClientApplicationLogic::loadResourceFromFile(const String& resourceFileName)
     {
-        PlatformGuard guard(m_frameworkLock);
         m_resourceComponent->loadResourceFromFile(resourceFileName);
     }
 
     bool ClientApplicationLogic::hasResourceFile(const String& resourceFileName) const
     {
-        PlatformGuard guard(m_frameworkLock);
         return m_resourceComponent->hasResourceFile(resourceFileName);
     }
 
@@ -149,7 +142,6 @@ namespace ramses_internal
 
     ManagedResource ClientApplicationLogic::loadResource(const ResourceContentHash& hash) const
     {
-        PlatformGuard guard(m_frameworkLock);
         auto mr = m_resourceComponent->loadResource(hash);
         if (!mr)
             LOG_WARN(CONTEXT_FRAMEWORK, "ResourceComponent::loadResource: Could not find or load requested resource: " << hash);
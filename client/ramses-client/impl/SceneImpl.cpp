@@ -112,6 +112,7 @@
 #include "Components/FlushTimeInformation.h"
 #include "PlatformAbstraction/PlatformMath.h"
 #include "Utils/TextureMathUtils.h"
+#include "Utils/TraceRecorder.h"
 #include "ResourceDataPoolImpl.h"
 
 #include <array>
@@ -1415,6 +1416,7 @@ namespace ramses
 
     status_t SceneImpl::flush(sceneVersionTag_t sceneVersion)
     {
+        ramses_internal::TraceScope traceScope("client", "flush", getSceneId().getValue());
         if (m_nextSceneVersion != InvalidSceneVersionTag && sceneVersion == InvalidSceneVersionTag)
         {
             sceneVersion = m_nextSceneVersion;
@@ -99,7 +99,7 @@ namespace ramses
         }
 
         const FontInstanceId fontInstanceId = reserveFontInstanceId();
-        registerFontInstance(fontInstanceId, std::unique_ptr<IFontInstance>{ new Freetype2FontInstance(fontInstanceId, fontIt->second->getFace(), size, forceAutohinting) });
+        registerFontInstance(fontInstanceId, std::unique_ptr<IFontInstance>{ new Freetype2FontInstance(fontInstanceId, *fontIt->second, size, forceAutohinting) });
 
         return fontInstanceId;
     }
@@ -114,7 +114,7 @@ namespace ramses
         }
 
         const FontInstanceId fontInstanceId = reserveFontInstanceId();
-        registerFontInstance(fontInstanceId, std::unique_ptr<IFontInstance>{ new HarfbuzzFontInstance(fontInstanceId, fontIt->second->getFace(), size, forceAutohinting) });
+        registerFontInstance(fontInstanceId, std::unique_ptr<IFontInstance>{ new HarfbuzzFontInstance(fontInstanceId, *fontIt->second, size, forceAutohinting) });
 
         return fontInstanceId;
     }
@@ -7,17 +7,24 @@
 //  -------------------------------------------------------------------------
 
 #include "ramses-text/Freetype2FontInstance.h"
+#include "ramses-text/FreetypeFontFace.h"
 #include "ramses-text/Quad.h"
 #include "Utils/LogMacros.h"
 #include "RamsesFrameworkTypesImpl.h"
 #include "ramses-text/TextTypesImpl.h"
+#include "TaskFramework/ThreadedTaskExecutor.h"
 #include <assert.h>
+#include <thread>
+#include <algorithm>
+#include <system_error>
 
 namespace ramses
 {
-    Freetype2FontInstance::Freetype2FontInstance(FontInstanceId id, FT_Face fontFace, uint32_t pixelSize, bool forceAutohinting)
+    Freetype2FontInstance::Freetype2FontInstance(FontInstanceId id, FreetypeFontFace& fontFace, uint32_t pixelSize, bool forceAutohinting)
         : m_id(id)
-        , m_face(fontFace)
+        , m_fontFace(fontFace)
+        , m_face(fontFace.getFace())
+        , m_pixelSize(pixelSize)
         , m_forceAutohinting(forceAutohinting)
     {
         int error = FT_New_Size(m_face, &m_size);
@@ -39,6 +46,8 @@ namespace ramses
 
     Freetype2FontInstance::~Freetype2FontInstance()
     {
+        // worker threads release the rasterizers after executing them, they must be gone before the rasterizers are destroyed
+        m_rasterizerExecutor.reset();
         if (m_size)
             FT_Done_Size(m_size);
     }
@@ -90,6 +99,94 @@ namespace ramses
         return data->data;
     }
 
+    void Freetype2FontInstance::prefetchGlyphBitmapData(const std::vector<GlyphId>& glyphIds)
+    {
+        std::vector<GlyphId> glyphsToRasterize;
+        glyphsToRasterize.reserve(glyphIds.size());
+        std::unordered_set<GlyphId> uniqueGlyphs;
+        for (const auto glyphId : glyphIds)
+        {
+            if (glyphId.getValue() != 0 && m_glyphBitmapCache.count(glyphId) == 0 && uniqueGlyphs.insert(glyphId).second)
+                glyphsToRasterize.push_back(glyphId);
+        }
+
+        const size_t numThreads = getNumberOfRasterizerThreads(glyphsToRasterize.size());
+        if (numThreads < 2u)
+        {
+            // not worth the thread overhead, glyphs are rasterized on demand in loadGlyphBitmapData
+            return;
+        }
+
+        // distribute glyphs round robin so that expensive glyphs (usually neighbours in a script) are spread
+        std::vector<std::vector<GlyphId>> glyphsPerThread(numThreads);
+        for (size_t i = 0u; i < glyphsToRasterize.size(); ++i)
+            glyphsPerThread[i % numThreads].push_back(glyphsToRasterize[i]);
+
+        m_rasterizationBatch.start(numThreads);
+        for (size_t i = 0u; i < numThreads; ++i)
+        {
+            m_rasterizers[i]->setGlyphs(std::move(glyphsPerThread[i]));
+            m_rasterizerExecutor->enqueue(*m_rasterizers[i]);
+        }
+        m_rasterizationBatch.wait();
+
+        for (size_t i = 0u; i < numThreads; ++i)
+        {
+            for (auto& result : m_rasterizers[i]->getResults())
+                m_glyphBitmapCache.insert({ result.first, std::move(result.second) });
+            m_rasterizers[i]->setGlyphs({});
+        }
+    }
+
+    size_t Freetype2FontInstance::getNumberOfRasterizerThreads(size_t numGlyphs)
+    {
+        const size_t hardwareThreads = std::max<size_t>(std::thread::hardware_concurrency(), 1u);
+        const size_t numThreads = std::min({ MaxRasterizerThreads, hardwareThreads, numGlyphs / MinGlyphsPerRasterizerThread });
+        if (numThreads < 2u)
+            return numThreads;
+
+        while (!m_rasterizerCreationFailed && m_rasterizers.size() < numThreads)
+        {
+            std::unique_ptr<Freetype2GlyphRasterizer> rasterizer{ new Freetype2GlyphRasterizer(m_fontFace.getFontPath(), m_pixelSize, m_forceAutohinting, m_rasterizationBatch) };
+            if (!rasterizer->isValid())
+            {
+                LOG_WARN(CONTEXT_TEXT, "Freetype2FontInstance: Failed to create glyph rasterizer for font instance " << m_id << ", using " << m_rasterizers.size() << " rasterizer threads from now on");
+                m_rasterizerCreationFailed = true;
+                break;
+            }
+            m_rasterizers.push_back(std::move(rasterizer));
+        }
+
+        if (!m_rasterizerExecutor && m_rasterizers.size() >= 2u)
+        {
+            try
+            {
+                m_rasterizerExecutor = std::make_unique<ramses_internal::ThreadedTaskExecutor>(static_cast<uint16_t>(std::min(MaxRasterizerThreads, hardwareThreads)));
+            }
+            catch (const std::system_error& e)
+            {
+                LOG_WARN(CONTEXT_TEXT, "Freetype2FontInstance: Failed to create rasterizer threads for font instance " << m_id << " (" << e.what() << "), rasterizing glyphs on calling thread from now on");
+                m_rasterizers.clear();
+                m_rasterizerCreationFailed = true;
+            }
+        }
+
+        return std::min(numThreads, m_rasterizers.size());
+    }
+
+    uint64_t Freetype2FontInstance::getGlyphCacheIdentifier() const
+    {
+        const uint64_t contentHash = m_fontFace.getContentHash();
+        if (contentHash == 0u)
+            return 0u;
+
+        // combine font data with all parameters which influence the rasterized bitmaps
+        uint64_t identifier = contentHash;
+        identifier ^= (uint64_t(m_pixelSize) << 1u) + 0x9e3779b97f4a7c15u + (identifier << 6u) + (identifier >> 2u);
+        identifier ^= (m_forceAutohinting ? 1u : 2u) + 0x9e3779b97f4a7c15u + (identifier << 6u) + (identifier >> 2u);
+        return identifier != 0u ? identifier : 1u;
+    }
+
     bool Freetype2FontInstance::supportsCharacter(char32_t charcode) const
     {
         const auto it = m_supportedCharacters.find(charcode);
@@ -135,37 +232,8 @@ namespace ramses
             return nullptr;
 
         GlyphBitmapData data;
-        FT_Glyph ftGlyph = nullptr;
-        auto error = FT_Get_Glyph(m_face->glyph, &ftGlyph);
-        {
-            if (error)
-            {
-                LOG_ERROR(CONTEXT_TEXT, "Freetype2FontInstance::extractGlyphBitmapData:  FT_Get_Glyph failed - error: " << error);
-                assert(ftGlyph == nullptr);
-                return nullptr;
-            }
-            assert(ftGlyph != nullptr);
-
-            if (ftGlyph->format != FT_GLYPH_FORMAT_BITMAP)
-            {
-                error = FT_Glyph_To_Bitmap(&ftGlyph, FT_RENDER_MODE_NORMAL, nullptr, 1);
-                if (error)
-                {
-                    LOG_ERROR(CONTEXT_TEXT, "Freetype2FontInstance::extractGlyphBitmapData:  FT_Glyph_To_Bitmap failed - error: " << error);
-                    FT_Done_Glyph(ftGlyph);
-                    return nullptr;
-                }
-            }
-
-            const FT_BitmapGlyph bitmapGlyph = reinterpret_cast<FT_BitmapGlyph>(ftGlyph);
-            const QuadSize glyphBitmapSize(bitmapGlyph->bitmap.width, bitmapGlyph->bitmap.rows);
-            data.width = glyphBitmapSize.x;
-            data.height = glyphBitmapSize.y;
-            const uint32_t numberPixels = glyphBitmapSize.getArea();
-            const uint8_t* bitmapBuffer = reinterpret_cast<uint8_t*>(bitmapGlyph->bitmap.buffer);
-            data.data = GlyphData(bitmapBuffer, bitmapBuffer + numberPixels);
-        }
-        FT_Done_Glyph(ftGlyph);
+        if (!Freetype2GlyphRasterizer::RasterizeLoadedGlyph(m_face, data))
+            return nullptr;
 
         return &m_glyphBitmapCache.insert({ glyphId, std::move(data) }).first->second;
     }
@@ -181,11 +249,7 @@ namespace ramses
         // must call activateSize() before loading
         activateSize();
 
-        int32_t flags = FT_LOAD_DEFAULT;
-        if (m_forceAutohinting)
-            flags = FT_LOAD_FORCE_AUTOHINT;
-
-        const uint32_t error = FT_Load_Glyph(m_face, glyphId.getValue(), flags);
+        const uint32_t error = FT_Load_Glyph(m_face, glyphId.getValue(), Freetype2GlyphRasterizer::GetLoadFlags(m_forceAutohinting));
         if (error != 0)
         {
             LOG_ERROR(CONTEXT_TEXT, "Freetype2FontInstance: Failed to load glyph " << glyphId << ", FT error " << error);
@@ -12,17 +12,24 @@
 #include "ramses-text-api/IFontInstance.h"
 #include "ramses-text/Freetype2Wrapper.h"
 #include "ramses-text-api/Glyph.h"
+#include "ramses-text/Freetype2GlyphRasterizer.h"
 #include <unordered_map>
 #include <unordered_set>
+#include <memory>
+
+namespace ramses_internal
+{
+    class ThreadedTaskExecutor;
+}
 
 namespace ramses
 {
-    class Freetype2Font;
+    class FreetypeFontFace;
 
     class Freetype2FontInstance : public IFontInstance
     {
     public:
-        Freetype2FontInstance(FontInstanceId id, FT_Face fontFace, uint32_t pixelSize, bool forceAutohinting);
+        Freetype2FontInstance(FontInstanceId id, FreetypeFontFace& fontFace, uint32_t pixelSize, bool forceAutohinting);
         virtual ~Freetype2FontInstance();
 
         virtual bool      supportsCharacter(char32_t character) const override final;
@@ -32,42 +39,52 @@ namespace ramses
 
         virtual void                 loadAndAppendGlyphMetrics(std::u32string::const_iterator charsBegin, std::u32string::const_iterator charsEnd, GlyphMetricsVector& positionedGlyphs) override;
         virtual GlyphData            loadGlyphBitmapData(GlyphId glyphId, uint32_t& sizeX, uint32_t& sizeY) override final;
+        virtual void                 prefetchGlyphBitmapData(const std::vector<GlyphId>& glyphIds) override final;
+        virtual uint64_t             getGlyphCacheIdentifier() const override final;
         std::unordered_set<unsigned long> getAllSupportedCharacters() override;
 
         GlyphId getGlyphId(char32_t character) const;
 
+        // glyph batches smaller than this are rasterized on the calling thread
+        static constexpr size_t MinGlyphsPerRasterizerThread = 8u;
+        static constexpr size_t MaxRasterizerThreads = 4u;
+
     protected:
-        struct GlyphBitmapData;
+        using GlyphBitmapData = GlyphBitmap;
 
         const GlyphMetrics*    getGlyphMetricsData(GlyphId glyphId);
         const GlyphBitmapData* getGlyphBitmapData(GlyphId glyphId);
+        size_t                 getNumberOfRasterizerThreads(size_t numGlyphs);
         bool                   loadGlyph(GlyphId glyphId);
         void                   activateSize() const;
         int32_t                getKerningAdvance(GlyphId glyphIdentifier1, GlyphId glyphIdentifier2) const;
         void                   cacheAllSupportedCharacters();
 
         FontInstanceId          m_id;
+        FreetypeFontFace&       m_fontFace;
         FT_Face                 m_face = nullptr;
         FT_Size                 m_size = nullptr;
+        uint32_t                m_pixelSize = 0u;
         bool                    m_forceAutohinting = false;
         int                     m_height = 0;
         int                     m_ascender = 0;
         int                     m_descender = 0;
         bool                    m_allSupportedCharactersCached = false;
 
-        struct GlyphBitmapData
-        {
-            GlyphData data;
-            uint32_t  width;
-            uint32_t  height;
-        };
-
         // The reason for separation of the metrics and bitmap data cache
         // is that bitmap loading is relatively heavy and not needed for determining text layout
         // which needs metrics only.
         std::unordered_map<GlyphId, GlyphMetrics> m_glyphMetricsCache;
         std::unordered_map<GlyphId, GlyphBitmapData> m_glyphBitmapCache;
         mutable std::unordered_map<unsigned long, bool> m_supportedCharacters;
+
+        // created on first concurrent rasterization and kept, each owns a separate FreeType face
+        std::vector<std::unique_ptr<Freetype2GlyphRasterizer>> m_rasterizers;
+        // not retried once failed, glyphs are then rasterized with the rasterizers created so far or on calling thread
+        bool m_rasterizerCreationFailed = false;
+        GlyphRasterizationBatch m_rasterizationBatch;
+        // worker threads executing the rasterizers, created together with the first rasterizers and kept
+        std::unique_ptr<ramses_internal::ThreadedTaskExecutor> m_rasterizerExecutor;
     };
 }
 
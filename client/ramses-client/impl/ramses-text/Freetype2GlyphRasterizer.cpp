@@ -0,0 +1,159 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2020 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "ramses-text/Freetype2GlyphRasterizer.h"
+#include "ramses-text/TextTypesImpl.h"
+#include "Utils/LogMacros.h"
+#include <cassert>
+
+namespace ramses
+{
+    void GlyphRasterizationBatch::start(size_t numRasterizers)
+    {
+        std::lock_guard<std::mutex> guard(m_lock);
+        assert(m_pendingRasterizers == 0u);
+        m_pendingRasterizers = numRasterizers;
+    }
+
+    void GlyphRasterizationBatch::wait()
+    {
+        std::unique_lock<std::mutex> lock(m_lock);
+        m_allFinished.wait(lock, [&]() { return m_pendingRasterizers == 0u; });
+    }
+
+    void GlyphRasterizationBatch::TaskFinished(ramses_internal::ITask& /*task*/)
+    {
+        bool allFinished = false;
+        {
+            std::lock_guard<std::mutex> guard(m_lock);
+            assert(m_pendingRasterizers > 0u);
+            allFinished = (--m_pendingRasterizers == 0u);
+        }
+        if (allFinished)
+            m_allFinished.notify_one();
+    }
+
+    Freetype2GlyphRasterizer::Freetype2GlyphRasterizer(const std::string& fontPath, uint32_t pixelSize, bool forceAutohinting, ramses_internal::ITaskFinishHandler& finishHandler)
+        : m_forceAutohinting(forceAutohinting)
+        , m_finishHandler(finishHandler)
+    {
+        int32_t error = FT_Init_FreeType(&m_library);
+        if (error != 0)
+        {
+            LOG_ERROR(CONTEXT_TEXT, "Freetype2GlyphRasterizer: Failed to initialize library, FT error " << error);
+            m_library = nullptr;
+            return;
+        }
+
+        FT_Open_Args fontDataArgs;
+        fontDataArgs.flags = FT_OPEN_PATHNAME;
+        fontDataArgs.pathname = const_cast<char*>(fontPath.data());
+        fontDataArgs.num_params = 0;
+        error = FT_Open_Face(m_library, &fontDataArgs, 0, &m_face);
+        if (error != 0)
+        {
+            LOG_ERROR(CONTEXT_TEXT, "Freetype2GlyphRasterizer: Failed to open face, FT error " << error);
+            m_face = nullptr;
+            return;
+        }
+
+        error = FT_Set_Pixel_Sizes(m_face, 0, pixelSize);
+        if (error != 0)
+        {
+            LOG_ERROR(CONTEXT_TEXT, "Freetype2GlyphRasterizer: Failed to set pixel sizes, FT error " << error);
+            FT_Done_Face(m_face);
+            m_face = nullptr;
+        }
+    }
+
+    Freetype2GlyphRasterizer::~Freetype2GlyphRasterizer()
+    {
+        if (m_face)
+            FT_Done_Face(m_face);
+        if (m_library)
+            FT_Done_FreeType(m_library);
+    }
+
+    bool Freetype2GlyphRasterizer::isValid() const
+    {
+        return m_face != nullptr;
+    }
+
+    void Freetype2GlyphRasterizer::setGlyphs(std::vector<GlyphId> glyphIds)
+    {
+        m_glyphIds = std::move(glyphIds);
+        m_results.clear();
+    }
+
+    void Freetype2GlyphRasterizer::execute()
+    {
+        assert(isValid());
+        m_results.reserve(m_glyphIds.size());
+        const int32_t loadFlags = GetLoadFlags(m_forceAutohinting);
+
+        for (const auto glyphId : m_glyphIds)
+        {
+            const auto error = FT_Load_Glyph(m_face, glyphId.getValue(), loadFlags);
+            if (error != 0)
+            {
+                LOG_ERROR(CONTEXT_TEXT, "Freetype2GlyphRasterizer: Failed to load glyph " << glyphId << ", FT error " << error);
+                continue;
+            }
+
+            GlyphBitmap bitmap;
+            if (RasterizeLoadedGlyph(m_face, bitmap))
+                m_results.emplace_back(glyphId, std::move(bitmap));
+        }
+
+        m_finishHandler.TaskFinished(*this);
+    }
+
+    std::vector<std::pair<GlyphId, GlyphBitmap>>& Freetype2GlyphRasterizer::getResults()
+    {
+        return m_results;
+    }
+
+    bool Freetype2GlyphRasterizer::RasterizeLoadedGlyph(FT_Face face, GlyphBitmap& result)
+    {
+        FT_Glyph ftGlyph = nullptr;
+        auto error = FT_Get_Glyph(face->glyph, &ftGlyph);
+        if (error)
+        {
+            LOG_ERROR(CONTEXT_TEXT, "Freetype2GlyphRasterizer::RasterizeLoadedGlyph:  FT_Get_Glyph failed - error: " << error);
+            assert(ftGlyph == nullptr);
+            return false;
+        }
+        assert(ftGlyph != nullptr);
+
+        if (ftGlyph->format != FT_GLYPH_FORMAT_BITMAP)
+        {
+            error = FT_Glyph_To_Bitmap(&ftGlyph, FT_RENDER_MODE_NORMAL, nullptr, 1);
+            if (error)
+            {
+                LOG_ERROR(CONTEXT_TEXT, "Freetype2GlyphRasterizer::RasterizeLoadedGlyph:  FT_Glyph_To_Bitmap failed - error: " << error);
+                FT_Done_Glyph(ftGlyph);
+                return false;
+            }
+        }
+
+        const FT_BitmapGlyph bitmapGlyph = reinterpret_cast<FT_BitmapGlyph>(ftGlyph);
+        result.width = bitmapGlyph->bitmap.width;
+        result.height = bitmapGlyph->bitmap.rows;
+        const uint32_t numberPixels = result.width * result.height;
+        const uint8_t* bitmapBuffer = reinterpret_cast<uint8_t*>(bitmapGlyph->bitmap.buffer);
+        result.data = GlyphData(bitmapBuffer, bitmapBuffer + numberPixels);
+        FT_Done_Glyph(ftGlyph);
+
+        return true;
+    }
+
+    int32_t Freetype2GlyphRasterizer::GetLoadFlags(bool forceAutohinting)
+    {
+        return forceAutohinting ? FT_LOAD_FORCE_AUTOHINT : FT_LOAD_DEFAULT;
+    }
+}
@@ -0,0 +1,73 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2020 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#ifndef RAMSES_FREETYPE2GLYPHRASTERIZER_H
+#define RAMSES_FREETYPE2GLYPHRASTERIZER_H
+
+#include "ramses-text/Freetype2Wrapper.h"
+#include "ramses-text/GlyphBitmap.h"
+#include "TaskFramework/ITask.h"
+#include "TaskFramework/ITaskFinishHandler.h"
+#include <string>
+#include <vector>
+#include <utility>
+#include <mutex>
+#include <condition_variable>
+
+namespace ramses
+{
+    // Lets the thread which enqueued a batch of rasterizers wait until all of them executed
+    class GlyphRasterizationBatch final : public ramses_internal::ITaskFinishHandler
+    {
+    public:
+        void start(size_t numRasterizers);
+        void wait();
+        virtual void TaskFinished(ramses_internal::ITask& task) override;
+
+    private:
+        size_t m_pendingRasterizers = 0u;
+        std::mutex m_lock;
+        std::condition_variable m_allFinished;
+    };
+
+    // Rasterizes glyphs of one font instance as a task on a worker thread. FreeType objects must not be shared
+    // between threads, therefore every rasterizer owns its own FT_Library and FT_Face opened from the font file
+    // and set up with the same size and hinting as the font instance it works for.
+    class Freetype2GlyphRasterizer final : public ramses_internal::ITask
+    {
+    public:
+        Freetype2GlyphRasterizer(const std::string& fontPath, uint32_t pixelSize, bool forceAutohinting, ramses_internal::ITaskFinishHandler& finishHandler);
+        virtual ~Freetype2GlyphRasterizer() override;
+
+        bool isValid() const;
+
+        // glyphs must be set before the rasterizer is enqueued, results are valid once it reported to be finished.
+        // Glyphs which failed to rasterize are not part of the results.
+        void setGlyphs(std::vector<GlyphId> glyphIds);
+        virtual void execute() override;
+        std::vector<std::pair<GlyphId, GlyphBitmap>>& getResults();
+
+        // expects the glyph to be loaded in the glyph slot of the face
+        static bool RasterizeLoadedGlyph(FT_Face face, GlyphBitmap& result);
+        static int32_t GetLoadFlags(bool forceAutohinting);
+
+        Freetype2GlyphRasterizer(const Freetype2GlyphRasterizer&) = delete;
+        Freetype2GlyphRasterizer& operator=(const Freetype2GlyphRasterizer&) = delete;
+
+    private:
+        FT_Library m_library = nullptr;
+        FT_Face m_face = nullptr;
+        const bool m_forceAutohinting;
+        ramses_internal::ITaskFinishHandler& m_finishHandler;
+
+        std::vector<GlyphId> m_glyphIds;
+        std::vector<std::pair<GlyphId, GlyphBitmap>> m_results;
+    };
+}
+
+#endif
@@ -8,7 +8,9 @@
 
 #include "FreetypeFontFace.h"
 #include "Utils/LogMacros.h"
+#include "Utils/File.h"
 #include <cassert>
+#include <vector>
 
 namespace ramses
 {
@@ -67,4 +69,47 @@ namespace ramses
     {
         return m_face;
     }
+
+    const std::string& FreetypeFontFace::getFontPath() const
+    {
+        return m_fontPath;
+    }
+
+    uint64_t FreetypeFontFace::getContentHash()
+    {
+        if (m_contentHashComputed)
+            return m_contentHash;
+        m_contentHashComputed = true;
+
+        ramses_internal::File file(m_fontPath.c_str());
+        if (!file.open(ramses_internal::File::Mode::ReadOnlyBinary))
+        {
+            LOG_ERROR(CONTEXT_TEXT, "FreetypeFontFace::getContentHash: Failed to open font file " << m_fontPath);
+            return m_contentHash;
+        }
+
+        // FNV-1a over the whole file
+        uint64_t hash = 14695981039346656037u;
+        std::vector<uint8_t> buffer(64u * 1024u);
+        size_t numBytesRead = 0u;
+        ramses_internal::EStatus status = ramses_internal::EStatus::Ok;
+        do
+        {
+            status = file.read(buffer.data(), buffer.size(), numBytesRead);
+            for (size_t i = 0u; i < numBytesRead; ++i)
+            {
+                hash ^= buffer[i];
+                hash *= 1099511628211u;
+            }
+        } while (status == ramses_internal::EStatus::Ok && numBytesRead == buffer.size());
+
+        if (status != ramses_internal::EStatus::Ok && status != ramses_internal::EStatus::Eof)
+        {
+            LOG_ERROR(CONTEXT_TEXT, "FreetypeFontFace::getContentHash: Failed to read font file " << m_fontPath);
+            return m_contentHash;
+        }
+
+        m_contentHash = hash;
+        return m_contentHash;
+    }
 }
@@ -22,6 +22,10 @@ namespace ramses
 
         bool init();
         FT_Face getFace();
+        const std::string& getFontPath() const;
+
+        // hash of the font file contents, computed on first use. Returns 0 if the file cannot be read.
+        uint64_t getContentHash();
 
         FreetypeFontFace(const FreetypeFontFace&) = delete;
         FreetypeFontFace& operator=(const FreetypeFontFace&) = delete;
@@ -32,6 +36,8 @@ namespace ramses
         std::string m_fontPath;
         FT_Library m_freetypeLib;
         FT_Face m_face = nullptr;
+        uint64_t m_contentHash = 0u;
+        bool m_contentHashComputed = false;
     };
 }
 
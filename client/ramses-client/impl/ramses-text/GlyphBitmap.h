@@ -0,0 +1,24 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2020 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#ifndef RAMSES_GLYPHBITMAP_H
+#define RAMSES_GLYPHBITMAP_H
+
+#include "ramses-text-api/Glyph.h"
+
+namespace ramses
+{
+    struct GlyphBitmap
+    {
+        GlyphData data;
+        uint32_t  width = 0u;
+        uint32_t  height = 0u;
+    };
+}
+
+#endif
@@ -161,6 +161,23 @@ namespace ramses
         return createGlyphsGeometry(atlasPage, glyphs);
     }
 
+    GlyphGeometry GlyphTextureAtlas::mapGlyphsToPageAndCreateGeometry(const GlyphMetricsVector& glyphs, size_t atlasPage)
+    {
+        assert(glyphs.end() == std::find_if(glyphs.begin(), glyphs.end(), [this](GlyphMetrics const& glyph)
+        {
+            return !isGlyphRegistered(glyph.key);
+        }));
+        assert(atlasPage < m_glyphAtlasPages.size());
+
+        if (!findMappingForPage(atlasPage, glyphs))
+        {
+            LOG_ERROR(CONTEXT_TEXT, "GlyphTextureAtlas::mapGlyphsToPageAndCreateGeometry failed - glyphs do not fit on page " << atlasPage);
+            return {};
+        }
+
+        return createGlyphsGeometry(atlasPage, glyphs);
+    }
+
     GlyphGeometry GlyphTextureAtlas::createGlyphsGeometry(size_t atlasPage, const GlyphMetricsVector& glyphs)
     {
         GlyphGeometry geometry;
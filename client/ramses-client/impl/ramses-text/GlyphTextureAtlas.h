@@ -30,8 +30,11 @@ namespace ramses
 
         void registerGlyph(const GlyphKey& key, const QuadSize& size, GlyphData&& data);
         bool isGlyphRegistered(const GlyphKey& key) const;
+        template <typename F>
+        void forEachRegisteredGlyph(F&& visitor) const;
 
         GlyphGeometry mapGlyphsAndCreateGeometry(const GlyphMetricsVector& positionedGlyphVector);
+        GlyphGeometry mapGlyphsToPageAndCreateGeometry(const GlyphMetricsVector& positionedGlyphVector, size_t atlasPage);
         void unmapGlyphsFromPage(const GlyphMetricsVector& positionedGlyphVector, size_t atlasPage);
 
         const TextureSampler& getTextureSampler(size_t atlasPage) const;
@@ -70,5 +73,12 @@ namespace ramses
         using GlyphInfoMap = std::unordered_map<GlyphKey, GlyphInfo>;
         GlyphInfoMap m_glyphInfoMap;
     };
+
+    template <typename F>
+    void GlyphTextureAtlas::forEachRegisteredGlyph(F&& visitor) const
+    {
+        for (const auto& glyphInfo : m_glyphInfoMap)
+            visitor(glyphInfo.first, glyphInfo.second.size, glyphInfo.second.data);
+    }
 }
 #endif
@@ -26,7 +26,7 @@ namespace ramses
             return (fixed - 32) / 64;
     }
 
-    HarfbuzzFontInstance::HarfbuzzFontInstance(FontInstanceId id, FT_Face fontFace, uint32_t pixelSize, bool forceAutohinting)
+    HarfbuzzFontInstance::HarfbuzzFontInstance(FontInstanceId id, FreetypeFontFace& fontFace, uint32_t pixelSize, bool forceAutohinting)
         : Freetype2FontInstance(id, fontFace, pixelSize, forceAutohinting)
     {
         m_hbFont = hb_ft_font_create(m_face, nullptr);
@@ -19,7 +19,7 @@ namespace ramses
     class HarfbuzzFontInstance final : public Freetype2FontInstance
     {
     public:
-        HarfbuzzFontInstance(FontInstanceId id, FT_Face fontFace, uint32_t pixelSize, bool forceAutohinting);
+        HarfbuzzFontInstance(FontInstanceId id, FreetypeFontFace& fontFace, uint32_t pixelSize, bool forceAutohinting);
         virtual ~HarfbuzzFontInstance();
 
         virtual void loadAndAppendGlyphMetrics(std::u32string::const_iterator charsBegin, std::u32string::const_iterator charsEnd, GlyphMetricsVector& positionedGlyphs) override final;
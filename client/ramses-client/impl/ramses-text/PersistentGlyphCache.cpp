@@ -0,0 +1,113 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2020 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "ramses-text/PersistentGlyphCache.h"
+#include "Utils/File.h"
+#include "Utils/BinaryFileInputStream.h"
+#include "Utils/BinaryFileOutputStream.h"
+#include "Utils/LogMacros.h"
+
+namespace ramses
+{
+    bool PersistentGlyphCache::load(const std::string& path)
+    {
+        ramses_internal::File file(path.c_str());
+        if (!file.exists())
+        {
+            LOG_ERROR(CONTEXT_TEXT, "PersistentGlyphCache::load: glyph cache file " << path << " does not exist");
+            return false;
+        }
+
+        ramses_internal::BinaryFileInputStream stream(file);
+        uint32_t magic = 0u;
+        uint32_t version = 0u;
+        uint32_t numGlyphs = 0u;
+        stream >> magic >> version >> numGlyphs;
+        if (stream.getState() != ramses_internal::EStatus::Ok || magic != FileMagic || version != FileVersion)
+        {
+            LOG_ERROR(CONTEXT_TEXT, "PersistentGlyphCache::load: " << path << " is not a valid glyph cache file");
+            return false;
+        }
+
+        std::map<Key, GlyphBitmap> glyphs;
+        for (uint32_t i = 0u; i < numGlyphs; ++i)
+        {
+            uint64_t fontIdentifier = 0u;
+            uint32_t glyphId = 0u;
+            GlyphBitmap bitmap;
+            uint32_t dataSize = 0u;
+            stream >> fontIdentifier >> glyphId >> bitmap.width >> bitmap.height >> dataSize;
+            if (stream.getState() != ramses_internal::EStatus::Ok || dataSize > MaxGlyphDataSize || uint64_t(bitmap.width) * bitmap.height != dataSize)
+            {
+                LOG_ERROR(CONTEXT_TEXT, "PersistentGlyphCache::load: glyph cache file " << path << " is corrupted");
+                return false;
+            }
+
+            bitmap.data.resize(dataSize);
+            if (dataSize > 0u)
+                stream.read(bitmap.data.data(), dataSize);
+            glyphs[{ fontIdentifier, glyphId }] = std::move(bitmap);
+        }
+
+        if (stream.getState() != ramses_internal::EStatus::Ok)
+        {
+            LOG_ERROR(CONTEXT_TEXT, "PersistentGlyphCache::load: glyph cache file " << path << " is corrupted");
+            return false;
+        }
+
+        LOG_INFO(CONTEXT_TEXT, "PersistentGlyphCache::load: loaded " << glyphs.size() << " glyphs from " << path);
+        for (auto& glyph : glyphs)
+            m_glyphs[glyph.first] = std::move(glyph.second);
+
+        return true;
+    }
+
+    bool PersistentGlyphCache::save(const std::string& path) const
+    {
+        ramses_internal::File file(path.c_str());
+        ramses_internal::BinaryFileOutputStream stream(file);
+        if (stream.getState() != ramses_internal::EStatus::Ok)
+        {
+            LOG_ERROR(CONTEXT_TEXT, "PersistentGlyphCache::save: failed to open glyph cache file " << path << " for writing");
+            return false;
+        }
+
+        stream << FileMagic << FileVersion << static_cast<uint32_t>(m_glyphs.size());
+        for (const auto& glyph : m_glyphs)
+        {
+            const GlyphBitmap& bitmap = glyph.second;
+            stream << glyph.first.first << glyph.first.second << bitmap.width << bitmap.height << static_cast<uint32_t>(bitmap.data.size());
+            if (!bitmap.data.empty())
+                stream.write(bitmap.data.data(), bitmap.data.size());
+        }
+
+        if (stream.getState() != ramses_internal::EStatus::Ok || !file.flush())
+        {
+            LOG_ERROR(CONTEXT_TEXT, "PersistentGlyphCache::save: failed to write glyph cache file " << path);
+            return false;
+        }
+
+        return true;
+    }
+
+    const GlyphBitmap* PersistentGlyphCache::find(uint64_t fontIdentifier, GlyphId glyphId) const
+    {
+        const auto it = m_glyphs.find({ fontIdentifier, glyphId.getValue() });
+        return it != m_glyphs.cend() ? &it->second : nullptr;
+    }
+
+    void PersistentGlyphCache::add(uint64_t fontIdentifier, GlyphId glyphId, const GlyphBitmap& bitmap)
+    {
+        m_glyphs[{ fontIdentifier, glyphId.getValue() }] = bitmap;
+    }
+
+    size_t PersistentGlyphCache::size() const
+    {
+        return m_glyphs.size();
+    }
+}
@@ -0,0 +1,43 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2020 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#ifndef RAMSES_PERSISTENTGLYPHCACHE_H
+#define RAMSES_PERSISTENTGLYPHCACHE_H
+
+#include "ramses-text/GlyphBitmap.h"
+#include <map>
+#include <string>
+#include <utility>
+
+namespace ramses
+{
+    // Rasterized glyph bitmaps keyed by IFontInstance::getGlyphCacheIdentifier() and glyph id,
+    // which can be stored to and restored from a file to skip rasterization in later program runs.
+    class PersistentGlyphCache
+    {
+    public:
+        // merges content of the file into the cache, cache is unchanged if the file is not a valid glyph cache
+        bool load(const std::string& path);
+        bool save(const std::string& path) const;
+
+        const GlyphBitmap* find(uint64_t fontIdentifier, GlyphId glyphId) const;
+        void add(uint64_t fontIdentifier, GlyphId glyphId, const GlyphBitmap& bitmap);
+        size_t size() const;
+
+    private:
+        static constexpr uint32_t FileMagic = 0x52474331u; // 'RGC1'
+        static constexpr uint32_t FileVersion = 1u;
+        // upper bound for a single glyph bitmap, protects against corrupted files
+        static constexpr uint32_t MaxGlyphDataSize = 4096u * 4096u;
+
+        using Key = std::pair<uint64_t, uint32_t>;
+        std::map<Key, GlyphBitmap> m_glyphs;
+    };
+}
+
+#endif
@@ -19,14 +19,44 @@
 #include "ramses-client-api/AttributeInput.h"
 #include "ramses-client-api/UniformInput.h"
 #include "ramses-client-api/Effect.h"
+#include "ramses-client-api/EVisibilityMode.h"
 
 #include "Utils/LogMacros.h"
 #include "RamsesFrameworkTypesImpl.h"
 #include "ramses-text/TextTypesImpl.h"
 #include <limits>
+#include <iterator>
+#include <unordered_set>
 
 namespace ramses
 {
+    namespace
+    {
+        // uint16 indices can address 65536 vertices, four per glyph quad
+        const uint32_t MaxGlyphsPerBatch = 16384u;
+
+        bool FindTextEffectInputs(const Effect& effect, UniformInput& texInput, AttributeInput& posInput, AttributeInput& texCoordInput)
+        {
+            effect.findUniformInput(EEffectUniformSemantic::TextTexture, texInput);
+            effect.findAttributeInput(EEffectAttributeSemantic::TextPositions, posInput);
+            effect.findAttributeInput(EEffectAttributeSemantic::TextTextureCoordinates, texCoordInput);
+            return texInput.isValid() && posInput.isValid() && texCoordInput.isValid();
+        }
+
+        void WriteDegenerateQuads(ArrayBuffer& indices, uint32_t firstQuad, uint32_t numQuads)
+        {
+            if (numQuads == 0u)
+                return;
+
+            // all indices of a quad point to its own first vertex, so nothing is rasterized
+            std::vector<uint16_t> degenerateIndices;
+            degenerateIndices.reserve(numQuads * 6u);
+            for (uint32_t quad = firstQuad; quad < firstQuad + numQuads; ++quad)
+                degenerateIndices.insert(degenerateIndices.end(), 6u, static_cast<uint16_t>(quad * 4u));
+            indices.updateData(firstQuad * 6u, numQuads * 6u, degenerateIndices.data());
+        }
+    }
+
     TextCacheImpl::TextCacheImpl(Scene& scene, IFontAccessor& fontAccessor, uint32_t atlasTextureWidth, uint32_t atlasTextureHeight)
         : m_scene(scene)
         , m_fontAccessor(fontAccessor)
@@ -72,30 +102,14 @@ namespace ramses
         UniformInput texInput;
         AttributeInput posInput;
         AttributeInput texCoordInput;
-        effect.findUniformInput(EEffectUniformSemantic::TextTexture, texInput);
-        effect.findAttributeInput(EEffectAttributeSemantic::TextPositions, posInput);
-        effect.findAttributeInput(EEffectAttributeSemantic::TextTextureCoordinates, texCoordInput);
-        if (!texInput.isValid() || !posInput.isValid() || !texCoordInput.isValid())
+        if (!FindTextEffectInputs(effect, texInput, posInput, texCoordInput))
         {
             LOG_ERROR(CONTEXT_TEXT, "TextCache::createTextLine failed - text appearance effect must provide inputs for positions and coordinates attributes and a texture uniform");
             return {};
         }
 
-        for (const auto& glyph : glyphs)
-        {
-            if (!m_textureAtlas.isGlyphRegistered(glyph.key))
-            {
-                IFontInstance* fontInstance = m_fontAccessor.getFontInstance(glyph.key.fontInstanceId);
-                if (fontInstance == nullptr)
-                {
-                    LOG_ERROR(CONTEXT_TEXT, "TextCache::createTextLine: Could not find font instance " << glyph.key.fontInstanceId);
-                    return {};
-                }
-                QuadSize glyphSize;
-                GlyphData data = fontInstance->loadGlyphBitmapData(glyph.key.identifier, glyphSize.x, glyphSize.y);
-                m_textureAtlas.registerGlyph(glyph.key, glyphSize, std::move(data));
-            }
-        }
+        if (!registerGlyphs(glyphs))
+            return {};
 
         const GlyphGeometry geometry = m_textureAtlas.mapGlyphsAndCreateGeometry(glyphs);
         if (geometry.atlasPage == std::numeric_limits<decltype(geometry.atlasPage)>::max() || geometry.indices.empty())
@@ -148,6 +162,91 @@ namespace ramses
         return textLineId;
     }
 
+    bool TextCacheImpl::registerGlyphs(const GlyphMetricsVector& glyphs)
+    {
+        // collect all glyphs to register first, so that each font instance can rasterize them in one go
+        std::unordered_map<FontInstanceId, std::vector<GlyphId>> glyphsToRegister;
+        std::unordered_set<GlyphKey> uniqueGlyphs;
+        for (const auto& glyph : glyphs)
+        {
+            if (!m_textureAtlas.isGlyphRegistered(glyph.key) && uniqueGlyphs.insert(glyph.key).second)
+                glyphsToRegister[glyph.key.fontInstanceId].push_back(glyph.key.identifier);
+        }
+
+        for (const auto& fontGlyphs : glyphsToRegister)
+        {
+            const FontInstanceId fontInstanceId = fontGlyphs.first;
+            IFontInstance* fontInstance = m_fontAccessor.getFontInstance(fontInstanceId);
+            if (fontInstance == nullptr)
+            {
+                LOG_ERROR(CONTEXT_TEXT, "TextCache: Could not find font instance " << fontInstanceId);
+                return false;
+            }
+
+            const uint64_t glyphCacheIdentifier = fontInstance->getGlyphCacheIdentifier();
+            std::vector<GlyphId> glyphsToLoad;
+            glyphsToLoad.reserve(fontGlyphs.second.size());
+            for (const auto glyphId : fontGlyphs.second)
+            {
+                const GlyphBitmap* cachedBitmap = (glyphCacheIdentifier != 0u ? m_glyphCache.find(glyphCacheIdentifier, glyphId) : nullptr);
+                if (cachedBitmap != nullptr)
+                    m_textureAtlas.registerGlyph({ glyphId, fontInstanceId }, { cachedBitmap->width, cachedBitmap->height }, GlyphData(cachedBitmap->data));
+                else
+                    glyphsToLoad.push_back(glyphId);
+            }
+
+            if (glyphsToLoad.empty())
+                continue;
+
+            fontInstance->prefetchGlyphBitmapData(glyphsToLoad);
+            for (const auto glyphId : glyphsToLoad)
+            {
+                QuadSize glyphSize;
+                GlyphData data = fontInstance->loadGlyphBitmapData(glyphId, glyphSize.x, glyphSize.y);
+                m_textureAtlas.registerGlyph({ glyphId, fontInstanceId }, glyphSize, std::move(data));
+            }
+        }
+
+        return true;
+    }
+
+    bool TextCacheImpl::loadGlyphCache(const char* path)
+    {
+        if (path == nullptr)
+        {
+            LOG_ERROR(CONTEXT_TEXT, "TextCache::loadGlyphCache failed - invalid path");
+            return false;
+        }
+
+        return m_glyphCache.load(path);
+    }
+
+    bool TextCacheImpl::saveGlyphCache(const char* path) const
+    {
+        if (path == nullptr)
+        {
+            LOG_ERROR(CONTEXT_TEXT, "TextCache::saveGlyphCache failed - invalid path");
+            return false;
+        }
+
+        PersistentGlyphCache glyphCache = m_glyphCache;
+        std::unordered_map<FontInstanceId, uint64_t> glyphCacheIdentifiers;
+        m_textureAtlas.forEachRegisteredGlyph([&](const GlyphKey& key, const QuadSize& size, const GlyphData& data)
+        {
+            auto identifierIt = glyphCacheIdentifiers.find(key.fontInstanceId);
+            if (identifierIt == glyphCacheIdentifiers.end())
+            {
+                const IFontInstance* fontInstance = m_fontAccessor.getFontInstance(key.fontInstanceId);
+                identifierIt = glyphCacheIdentifiers.insert({ key.fontInstanceId, fontInstance ? fontInstance->getGlyphCacheIdentifier() : 0u }).first;
+            }
+
+            if (identifierIt->second != 0u)
+                glyphCache.add(identifierIt->second, key.identifier, { data, size.x, size.y });
+        });
+
+        return glyphCache.save(path);
+    }
+
     TextLine const* TextCacheImpl::getTextLine(TextLineId textId) const
     {
         const auto it = m_textLines.find(textId);
@@ -183,4 +282,335 @@ namespace ramses
         m_textLines.erase(textId);
         return true;
     }
+
+    TextBatchId TextCacheImpl::createTextBatch(const Effect& effect, uint32_t maxNumberOfGlyphs)
+    {
+        if (maxNumberOfGlyphs == 0u || maxNumberOfGlyphs > MaxGlyphsPerBatch)
+        {
+            LOG_ERROR(CONTEXT_TEXT, "TextCache::createTextBatch failed - number of glyphs must be between 1 and " << MaxGlyphsPerBatch << ", got " << maxNumberOfGlyphs);
+            return {};
+        }
+
+        UniformInput texInput;
+        AttributeInput posInput;
+        AttributeInput texCoordInput;
+        if (!FindTextEffectInputs(effect, texInput, posInput, texCoordInput))
+        {
+            LOG_ERROR(CONTEXT_TEXT, "TextCache::createTextBatch failed - text appearance effect must provide inputs for positions and coordinates attributes and a texture uniform");
+            return {};
+        }
+
+        GeometryBinding* geometryBinding = m_scene.createGeometryBinding(effect);
+        Appearance* appearance = m_scene.createAppearance(effect);
+        if (geometryBinding == nullptr || appearance == nullptr)
+        {
+            LOG_ERROR(CONTEXT_TEXT, "TextCache::createTextBatch failed - failed to create geometry binding and/or appearance, check Ramses logs for more details");
+            if (geometryBinding != nullptr)
+                m_scene.destroy(*geometryBinding);
+            if (appearance != nullptr)
+                m_scene.destroy(*appearance);
+            return {};
+        }
+
+        auto batchId = m_textBatchIdCounter;
+        m_textBatchIdCounter.getReference()++;
+
+        TextBatchData& batchData = m_textBatches[batchId];
+        batchData.freeQuadRanges.emplace(0u, maxNumberOfGlyphs);
+        TextBatch& batch = batchData.batch;
+        batch.maxNumberOfGlyphs = maxNumberOfGlyphs;
+        batch.meshNode = m_scene.createMeshNode();
+        batch.indices = m_scene.createArrayBuffer(ramses::EDataType::UInt16, maxNumberOfGlyphs * 6u, "");
+        batch.positions = m_scene.createArrayBuffer(ramses::EDataType::Vector2F, maxNumberOfGlyphs * 4u, "");
+        batch.textureCoordinates = m_scene.createArrayBuffer(ramses::EDataType::Vector2F, maxNumberOfGlyphs * 4u, "");
+
+        geometryBinding->setIndices(*batch.indices);
+        geometryBinding->setInputBuffer(posInput, *batch.positions);
+        geometryBinding->setInputBuffer(texCoordInput, *batch.textureCoordinates);
+
+        batch.meshNode->setAppearance(*appearance);
+        batch.meshNode->setGeometryBinding(*geometryBinding);
+        batch.meshNode->setStartIndex(0);
+        batch.meshNode->setIndexCount(0);
+        // texture sampler is known only after first text line is mapped to an atlas page
+        batch.meshNode->setVisibility(EVisibilityMode::Off);
+
+        return batchId;
+    }
+
+    TextLineId TextCacheImpl::addTextLineToBatch(TextBatchId batchId, const GlyphMetricsVector& glyphs, float offsetX, float offsetY)
+    {
+        const auto batchIt = m_textBatches.find(batchId);
+        if (batchIt == m_textBatches.end())
+        {
+            LOG_ERROR(CONTEXT_TEXT, "TextCache::addTextLineToBatch failed - no text batch " << batchId);
+            return {};
+        }
+        TextBatchData& batchData = batchIt->second;
+
+        if (glyphs.empty())
+        {
+            LOG_ERROR(CONTEXT_TEXT, "TextCache::addTextLineToBatch failed - cannot create text geometry for empty string");
+            return {};
+        }
+
+        if (!registerGlyphs(glyphs))
+            return {};
+
+        const GlyphGeometry geometry = mapGlyphsForBatch(batchData.batch, glyphs);
+        if (geometry.atlasPage == std::numeric_limits<decltype(geometry.atlasPage)>::max())
+        {
+            LOG_ERROR(CONTEXT_TEXT, "TextCache::addTextLineToBatch failed - glyphs could not be mapped to atlas page of text batch " << batchId);
+            return {};
+        }
+
+        const uint32_t numQuads = static_cast<uint32_t>(geometry.indices.size() / 6u);
+        BatchedTextLine textLine;
+        textLine.batch = batchId;
+        textLine.quadCapacity = numQuads;
+        if (!AllocateQuadRange(batchData, numQuads, textLine.firstQuad))
+        {
+            LOG_ERROR(CONTEXT_TEXT, "TextCache::addTextLineToBatch failed - not enough space left in text batch " << batchId << " for " << numQuads << " glyphs");
+            m_textureAtlas.unmapGlyphsFromPage(glyphs, geometry.atlasPage);
+            return {};
+        }
+
+        // first text line added successfully decides which atlas page the whole batch uses
+        if (batchData.batch.atlasPage == std::numeric_limits<decltype(batchData.batch.atlasPage)>::max())
+            assignAtlasPageToBatch(batchData.batch, geometry.atlasPage);
+
+        auto textLineId = m_textIdCounter;
+        m_textIdCounter.getReference()++;
+
+        textLine.glyphs = glyphs;
+        WriteGeometryToBatch(batchData, geometry, textLine, offsetX, offsetY);
+        UpdateBatchIndexCount(batchData);
+        m_batchedTextLines.emplace(textLineId, std::move(textLine));
+
+        return textLineId;
+    }
+
+    bool TextCacheImpl::updateTextLineInBatch(TextLineId textId, const GlyphMetricsVector& glyphs, float offsetX, float offsetY)
+    {
+        const auto lineIt = m_batchedTextLines.find(textId);
+        if (lineIt == m_batchedTextLines.end())
+        {
+            LOG_ERROR(CONTEXT_TEXT, "TextCache::updateTextLineInBatch failed - no batched text line " << textId);
+            return false;
+        }
+        BatchedTextLine& textLine = lineIt->second;
+        TextBatchData& batchData = m_textBatches.at(textLine.batch);
+
+        if (glyphs.empty())
+        {
+            LOG_ERROR(CONTEXT_TEXT, "TextCache::updateTextLineInBatch failed - cannot create text geometry for empty string");
+            return false;
+        }
+
+        if (!registerGlyphs(glyphs))
+            return false;
+
+        // map new glyphs before unmapping old ones, so glyphs used by both stay on page
+        const GlyphGeometry geometry = mapGlyphsForBatch(batchData.batch, glyphs);
+        if (geometry.atlasPage == std::numeric_limits<decltype(geometry.atlasPage)>::max())
+        {
+            LOG_ERROR(CONTEXT_TEXT, "TextCache::updateTextLineInBatch failed - glyphs could not be mapped to atlas page of text batch " << textLine.batch);
+            return false;
+        }
+
+        const uint32_t numQuads = static_cast<uint32_t>(geometry.indices.size() / 6u);
+        if (numQuads > textLine.quadCapacity)
+        {
+            uint32_t newFirstQuad = 0u;
+            if (!AllocateQuadRange(batchData, numQuads, newFirstQuad))
+            {
+                LOG_ERROR(CONTEXT_TEXT, "TextCache::updateTextLineInBatch failed - not enough space left in text batch " << textLine.batch << " for " << numQuads << " glyphs");
+                m_textureAtlas.unmapGlyphsFromPage(glyphs, geometry.atlasPage);
+                return false;
+            }
+            WriteDegenerateQuads(*batchData.batch.indices, textLine.firstQuad, textLine.quadCapacity);
+            ReleaseQuadRange(batchData, textLine.firstQuad, textLine.quadCapacity);
+            textLine.firstQuad = newFirstQuad;
+            textLine.quadCapacity = numQuads;
+        }
+
+        m_textureAtlas.unmapGlyphsFromPage(textLine.glyphs, batchData.batch.atlasPage);
+        textLine.glyphs = glyphs;
+        WriteGeometryToBatch(batchData, geometry, textLine, offsetX, offsetY);
+        UpdateBatchIndexCount(batchData);
+
+        return true;
+    }
+
+    bool TextCacheImpl::removeTextLineFromBatch(TextLineId textId)
+    {
+        const auto lineIt = m_batchedTextLines.find(textId);
+        if (lineIt == m_batchedTextLines.end())
+        {
+            LOG_ERROR(CONTEXT_TEXT, "TextCache::removeTextLineFromBatch failed - no batched text line " << textId);
+            return false;
+        }
+        const BatchedTextLine& textLine = lineIt->second;
+        TextBatchData& batchData = m_textBatches.at(textLine.batch);
+
+        WriteDegenerateQuads(*batchData.batch.indices, textLine.firstQuad, textLine.quadCapacity);
+        ReleaseQuadRange(batchData, textLine.firstQuad, textLine.quadCapacity);
+        UpdateBatchIndexCount(batchData);
+        m_textureAtlas.unmapGlyphsFromPage(textLine.glyphs, batchData.batch.atlasPage);
+
+        m_batchedTextLines.erase(lineIt);
+        return true;
+    }
+
+    TextBatch const* TextCacheImpl::getTextBatch(TextBatchId batchId) const
+    {
+        const auto it = m_textBatches.find(batchId);
+        return it != m_textBatches.cend() ? &it->second.batch : nullptr;
+    }
+
+    bool TextCacheImpl::deleteTextBatch(TextBatchId batchId)
+    {
+        const auto batchIt = m_textBatches.find(batchId);
+        if (batchIt == m_textBatches.end())
+        {
+            LOG_ERROR(CONTEXT_TEXT, "TextCache::deleteTextBatch: Cannot delete text batch " << batchId << ", no such entry");
+            return false;
+        }
+        TextBatch& batch = batchIt->second.batch;
+
+        for (auto lineIt = m_batchedTextLines.begin(); lineIt != m_batchedTextLines.end();)
+        {
+            if (lineIt->second.batch == batchId)
+            {
+                m_textureAtlas.unmapGlyphsFromPage(lineIt->second.glyphs, batch.atlasPage);
+                lineIt = m_batchedTextLines.erase(lineIt);
+            }
+            else
+                ++lineIt;
+        }
+
+        auto geometry = batch.meshNode->getGeometryBinding();
+        auto appearance = batch.meshNode->getAppearance();
+        m_scene.destroy(*batch.meshNode);
+        m_scene.destroy(*geometry);
+        m_scene.destroy(*appearance);
+        m_scene.destroy(*batch.positions);
+        m_scene.destroy(*batch.textureCoordinates);
+        m_scene.destroy(*batch.indices);
+
+        m_textBatches.erase(batchIt);
+        return true;
+    }
+
+    GlyphGeometry TextCacheImpl::mapGlyphsForBatch(const TextBatch& batch, const GlyphMetricsVector& glyphs)
+    {
+        if (batch.atlasPage != std::numeric_limits<decltype(batch.atlasPage)>::max())
+            return m_textureAtlas.mapGlyphsToPageAndCreateGeometry(glyphs, batch.atlasPage);
+
+        // batch without text line yet can use any page
+        return m_textureAtlas.mapGlyphsAndCreateGeometry(glyphs);
+    }
+
+    void TextCacheImpl::assignAtlasPageToBatch(TextBatch& batch, size_t atlasPage)
+    {
+        batch.atlasPage = atlasPage;
+
+        UniformInput texInput;
+        Appearance* appearance = batch.meshNode->getAppearance();
+        appearance->getEffect().findUniformInput(EEffectUniformSemantic::TextTexture, texInput);
+        appearance->setInputTexture(texInput, m_textureAtlas.getTextureSampler(batch.atlasPage));
+        batch.meshNode->setVisibility(EVisibilityMode::Visible);
+    }
+
+    bool TextCacheImpl::AllocateQuadRange(TextBatchData& batchData, uint32_t numQuads, uint32_t& firstQuad)
+    {
+        if (numQuads == 0u)
+        {
+            firstQuad = 0u;
+            return true;
+        }
+
+        // first fit keeps used quads packed at the beginning of the buffers, which keeps the index count low
+        for (auto it = batchData.freeQuadRanges.begin(); it != batchData.freeQuadRanges.end(); ++it)
+        {
+            if (it->second >= numQuads)
+            {
+                firstQuad = it->first;
+                const uint32_t remainingQuads = it->second - numQuads;
+                batchData.freeQuadRanges.erase(it);
+                if (remainingQuads > 0u)
+                    batchData.freeQuadRanges.emplace(firstQuad + numQuads, remainingQuads);
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    void TextCacheImpl::ReleaseQuadRange(TextBatchData& batchData, uint32_t firstQuad, uint32_t numQuads)
+    {
+        if (numQuads == 0u)
+            return;
+
+        auto& freeRanges = batchData.freeQuadRanges;
+        auto it = freeRanges.emplace(firstQuad, numQuads).first;
+
+        // merge with following and preceding free range
+        auto nextIt = std::next(it);
+        if (nextIt != freeRanges.end() && it->first + it->second == nextIt->first)
+        {
+            it->second += nextIt->second;
+            freeRanges.erase(nextIt);
+        }
+        if (it != freeRanges.begin())
+        {
+            auto prevIt = std::prev(it);
+            if (prevIt->first + prevIt->second == it->first)
+            {
+                prevIt->second += it->second;
+                freeRanges.erase(it);
+            }
+        }
+    }
+
+    void TextCacheImpl::WriteGeometryToBatch(TextBatchData& batchData, const GlyphGeometry& geometry, const BatchedTextLine& textLine, float offsetX, float offsetY)
+    {
+        TextBatch& batch = batchData.batch;
+        const uint32_t numQuads = static_cast<uint32_t>(geometry.indices.size() / 6u);
+        assert(numQuads <= textLine.quadCapacity);
+
+        if (numQuads > 0u)
+        {
+            assert(geometry.positions.size() == numQuads * 8u);  // four vertices with two floats each per quad
+            std::vector<float> positions(geometry.positions);
+            for (size_t i = 0u; i < positions.size(); i += 2u)
+            {
+                positions[i] += offsetX;
+                positions[i + 1u] += offsetY;
+            }
+
+            std::vector<uint16_t> indices(geometry.indices);
+            const uint16_t firstVertex = static_cast<uint16_t>(textLine.firstQuad * 4u);
+            for (auto& index : indices)
+                index = static_cast<uint16_t>(index + firstVertex);
+
+            batch.positions->updateData(textLine.firstQuad * 4u, numQuads * 4u, positions.data());
+            batch.textureCoordinates->updateData(textLine.firstQuad * 4u, numQuads * 4u, geometry.texcoords.data());
+            batch.indices->updateData(textLine.firstQuad * 6u, numQuads * 6u, indices.data());
+        }
+
+        // line got shorter than its sub-range, hide the rest
+        WriteDegenerateQuads(*batch.indices, textLine.firstQuad + numQuads, textLine.quadCapacity - numQuads);
+    }
+
+    void TextCacheImpl::UpdateBatchIndexCount(TextBatchData& batchData)
+    {
+        // render up to the end of the last used sub-range, free sub-ranges in between hold degenerate quads
+        uint32_t usedQuads = batchData.batch.maxNumberOfGlyphs;
+        const auto lastFreeRange = batchData.freeQuadRanges.crbegin();
+        if (lastFreeRange != batchData.freeQuadRanges.crend() && lastFreeRange->first + lastFreeRange->second == usedQuads)
+            usedQuads = lastFreeRange->first;
+
+        batchData.batch.meshNode->setIndexCount(usedQuads * 6u);
+    }
 }
@@ -10,9 +10,12 @@
 #define RAMSES_TEXTCACHEIMPL_H
 
 #include "ramses-text/GlyphTextureAtlas.h"
+#include "ramses-text/PersistentGlyphCache.h"
 #include "ramses-text-api/TextLine.h"
+#include "ramses-text-api/TextBatch.h"
 #include "ramses-text-api/FontInstanceOffsets.h"
 #include <unordered_map>
+#include <map>
 #include <string>
 
 namespace ramses
@@ -36,20 +39,62 @@ namespace ramses
         TextLine*               getTextLine(TextLineId textId);
         bool                    deleteTextLine(TextLineId textId);
 
+        TextBatchId             createTextBatch(const Effect& effect, uint32_t maxNumberOfGlyphs);
+        TextLineId              addTextLineToBatch(TextBatchId batchId, const GlyphMetricsVector& glyphs, float offsetX, float offsetY);
+        bool                    updateTextLineInBatch(TextLineId textId, const GlyphMetricsVector& glyphs, float offsetX, float offsetY);
+        bool                    removeTextLineFromBatch(TextLineId textId);
+        TextBatch const*        getTextBatch(TextBatchId batchId) const;
+        bool                    deleteTextBatch(TextBatchId batchId);
+
+        bool                    loadGlyphCache(const char* path);
+        bool                    saveGlyphCache(const char* path) const;
+
         TextCacheImpl(const TextCacheImpl&) = delete;
         TextCacheImpl& operator=(const TextCacheImpl&) = delete;
         TextCacheImpl(TextCacheImpl&&) = delete;
         TextCacheImpl& operator=(TextCacheImpl&&) = delete;
 
     private:
+        struct BatchedTextLine
+        {
+            TextBatchId batch;
+            GlyphMetricsVector glyphs;
+            // sub-range of batch buffers in quads, capacity can be larger than quads currently used by the line
+            uint32_t firstQuad = 0u;
+            uint32_t quadCapacity = 0u;
+        };
+
+        struct TextBatchData
+        {
+            TextBatch batch;
+            // free sub-ranges of batch buffers in quads, first quad -> number of quads
+            std::map<uint32_t, uint32_t> freeQuadRanges;
+        };
+
+        bool registerGlyphs(const GlyphMetricsVector& glyphs);
+        GlyphGeometry mapGlyphsForBatch(const TextBatch& batch, const GlyphMetricsVector& glyphs);
+        void assignAtlasPageToBatch(TextBatch& batch, size_t atlasPage);
+        static bool AllocateQuadRange(TextBatchData& batchData, uint32_t numQuads, uint32_t& firstQuad);
+        static void ReleaseQuadRange(TextBatchData& batchData, uint32_t firstQuad, uint32_t numQuads);
+        static void WriteGeometryToBatch(TextBatchData& batchData, const GlyphGeometry& geometry, const BatchedTextLine& textLine, float offsetX, float offsetY);
+        static void UpdateBatchIndexCount(TextBatchData& batchData);
+
         Scene& m_scene;
         IFontAccessor& m_fontAccessor;
         GlyphTextureAtlas m_textureAtlas;
+        PersistentGlyphCache m_glyphCache;
 
         using Texts = std::unordered_map<TextLineId, TextLine>;
         Texts m_textLines;
 
+        using TextBatches = std::unordered_map<TextBatchId, TextBatchData>;
+        TextBatches m_textBatches;
+
+        using BatchedTexts = std::unordered_map<TextLineId, BatchedTextLine>;
+        BatchedTexts m_batchedTextLines;
+
         TextLineId m_textIdCounter{ 0u };
+        TextBatchId m_textBatchIdCounter{ 0u };
     };
 }
 
@@ -12,11 +12,13 @@
 #include "ramses-text-api/FontInstanceId.h"
 #include "ramses-text-api/Glyph.h"
 #include "ramses-text-api/TextLine.h"
+#include "ramses-text-api/TextBatch.h"
 #include "Common/StronglyTypedValue.h"
 
 MAKE_STRONGLYTYPEDVALUE_PRINTABLE(ramses::FontInstanceId);
 MAKE_STRONGLYTYPEDVALUE_PRINTABLE(ramses::GlyphId);
 MAKE_STRONGLYTYPEDVALUE_PRINTABLE(ramses::TextLineId);
+MAKE_STRONGLYTYPEDVALUE_PRINTABLE(ramses::TextBatchId);
 MAKE_STRONGLYTYPEDVALUE_PRINTABLE(ramses::FontId);
 
 #endif
@@ -50,4 +50,44 @@ namespace ramses
     {
         return impl->deleteTextLine(textId);
     }
+
+    TextBatchId TextCache::createTextBatch(const Effect& effect, uint32_t maxNumberOfGlyphs)
+    {
+        return impl->createTextBatch(effect, maxNumberOfGlyphs);
+    }
+
+    TextLineId TextCache::addTextLineToBatch(TextBatchId batchId, const GlyphMetricsVector& glyphs, float offsetX, float offsetY)
+    {
+        return impl->addTextLineToBatch(batchId, glyphs, offsetX, offsetY);
+    }
+
+    bool TextCache::updateTextLineInBatch(TextLineId textId, const GlyphMetricsVector& glyphs, float offsetX, float offsetY)
+    {
+        return impl->updateTextLineInBatch(textId, glyphs, offsetX, offsetY);
+    }
+
+    bool TextCache::removeTextLineFromBatch(TextLineId textId)
+    {
+        return impl->removeTextLineFromBatch(textId);
+    }
+
+    TextBatch const* TextCache::getTextBatch(TextBatchId batchId) const
+    {
+        return impl->getTextBatch(batchId);
+    }
+
+    bool TextCache::deleteTextBatch(TextBatchId batchId)
+    {
+        return impl->deleteTextBatch(batchId);
+    }
+
+    bool TextCache::loadGlyphCache(const char* path)
+    {
+        return impl->loadGlyphCache(path);
+    }
+
+    bool TextCache::saveGlyphCache(const char* path) const
+    {
+        return impl->saveGlyphCache(path);
+    }
 }
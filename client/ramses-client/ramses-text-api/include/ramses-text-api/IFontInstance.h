@@ -74,6 +74,31 @@ namespace ramses
         * @return The glyph data if glyphId is found, or empty glyph data otherwise
         */
         virtual GlyphData loadGlyphBitmapData(GlyphId glyphId, uint32_t& sizeX, uint32_t& sizeY) = 0;
+
+        /**
+        * @brief Announce that the glyph data of several glyphs is going to be loaded using loadGlyphBitmapData()
+        *
+        * Implementations can use this to rasterize all of the glyphs at once, e.g. concurrently on several threads,
+        * and keep the results until they are loaded. The default implementation does nothing.
+        * @param[in] glyphIds Ids of glyphs for which glyph data is going to be loaded
+        */
+        virtual void prefetchGlyphBitmapData(const std::vector<GlyphId>& glyphIds)
+        {
+            (void)glyphIds;
+        }
+
+        /**
+        * @brief Get an identifier of the glyph data produced by the font instance, which is stable across program runs
+        *
+        * The identifier is used to look up glyph data of the font instance in a glyph cache file (see TextCache::loadGlyphCache()).
+        * It must be different for font instances which produce different glyph data, e.g. because of different font files or sizes.
+        * The default implementation returns 0, which means glyph data of the font instance is never stored in a glyph cache file.
+        * @return Identifier of the glyph data, or 0 if the glyph data cannot be cached persistently
+        */
+        virtual uint64_t getGlyphCacheIdentifier() const
+        {
+            return 0u;
+        }
     };
 }
 
@@ -0,0 +1,58 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2020 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#ifndef RAMSES_TEXTBATCH_H
+#define RAMSES_TEXTBATCH_H
+
+#include "ramses-text-api/TextLine.h"
+#include <limits>
+
+namespace ramses
+{
+    /**
+    * @brief An empty struct to make TextBatchId a strong type
+    */
+    struct TextBatchIdTag {};
+
+    /**
+    * @brief A strongly typed integer to distinguish between different text batches
+    */
+    using TextBatchId = StronglyTypedValue<uint32_t, std::numeric_limits<uint32_t>::max(), TextBatchIdTag>;
+
+    class MeshNode;
+    class ArrayBuffer;
+
+    /**
+    * @brief Groups the scene objects needed to render many text lines with a single draw call
+    *
+    * All text lines added to a batch share one effect, one texture atlas page and one set of vertex and index
+    * buffers. Every text line occupies a sub-range of the buffers which is updated or cleared in place
+    * when the text line is changed or removed.
+    */
+    struct TextBatch
+    {
+        /// Mesh node that renders all text lines of the batch
+        MeshNode*                meshNode = nullptr;
+        /// Index to the atlas page containing the glyphs of all text lines in the batch,
+        /// it is assigned when the first text line is added
+        size_t                   atlasPage = std::numeric_limits<size_t>::max();
+        /// Maximum number of (visible) glyphs that all text lines of the batch can hold together
+        uint32_t                 maxNumberOfGlyphs = 0u;
+        /// Stores vertex data for the quads of all text lines
+        ArrayBuffer*             positions = nullptr;
+        /// Stores texture coordinate data for the quads of all text lines
+        ArrayBuffer*             textureCoordinates = nullptr;
+        /// Stores index data for the quads of all text lines
+        ArrayBuffer*             indices = nullptr;
+    };
+
+    static_assert(std::is_nothrow_move_constructible<TextBatch>::value, "TextBatch must be movable");
+    static_assert(std::is_nothrow_move_assignable<TextBatch>::value, "TextBatch must be movable");
+}
+
+#endif
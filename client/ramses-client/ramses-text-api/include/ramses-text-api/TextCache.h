@@ -10,6 +10,7 @@
 #define RAMSES_TEXTCACHE_H
 
 #include "ramses-text-api/TextLine.h"
+#include "ramses-text-api/TextBatch.h"
 #include "ramses-text-api/FontInstanceOffsets.h"
 #include <string>
 
@@ -79,6 +80,13 @@ namespace ramses
     * Finally, the TextLine object holds pointers to the original vector of glyphs which were used to create it.
     * Be careful to not tamper with it, as it is used when destroying the text line to obtain information which
     * glyphs can be freed.
+    *
+    * When many text lines are shown at the same time (e.g. a page of labels), a separate MeshNode per text line
+    * results in one draw call and several scene objects per line. For such cases text lines can be added to a
+    * TextBatch instead (see createTextBatch()). All lines of a batch share one MeshNode, one Appearance, one GeometryBinding
+    * and one set of vertex/index buffers, and are all rendered in one draw call. The same single page limitation applies
+    * to a batch as a whole - all glyphs of all its text lines must fit on the atlas page the batch was assigned to.
+    * Text lines in a batch are positioned by an offset baked into their vertices, because they share a single node.
     */
     class RAMSES_API TextCache
     {
@@ -171,6 +179,94 @@ namespace ramses
         */
         bool                    deleteTextLine(TextLineId textId);
 
+        /**
+        * @brief Create the scene objects for a batch of text lines which are rendered together with a single draw call
+        *
+        * The batch creates one MeshNode, Appearance and GeometryBinding, and vertex and index buffers large enough
+        * to hold maxNumberOfGlyphs visible glyphs. The effect has the same requirements as for createTextLine().
+        * Text lines are added to the batch using addTextLineToBatch(). The atlas page used by the batch is
+        * determined when the first text line is added, all following text lines must fit on the same page.
+        *
+        * @param[in] effect The effect used for creating the appearance of the batch and rendering all its text lines
+        * @param[in] maxNumberOfGlyphs Maximum number of visible glyphs all text lines of the batch can hold together,
+        *                              must be between 1 and 16384
+        * @return Id of the text batch created, invalid id on failure
+        */
+        TextBatchId             createTextBatch(const Effect& effect, uint32_t maxNumberOfGlyphs);
+
+        /**
+        * @brief Add a text line (represented by glyph metrics) to a text batch
+        *
+        * The text line occupies a sub-range of the batch buffers. Its glyphs are placed relative to
+        * the given offset in the coordinate system of the batch mesh node.
+        *
+        * @param[in] batchId Id of the text batch to add the text line to
+        * @param[in] glyphs The glyph metrics for which to create a text line
+        * @param[in] offsetX Horizontal offset of the text line origin within the batch
+        * @param[in] offsetY Vertical offset of the text line origin within the batch
+        * @return Id of the text line created, invalid id on failure (e.g. glyphs do not fit on the atlas
+        *         page of the batch or there is not enough space left in the batch buffers)
+        */
+        TextLineId              addTextLineToBatch(TextBatchId batchId, const GlyphMetricsVector& glyphs, float offsetX, float offsetY);
+
+        /**
+        * @brief Replace glyphs and offset of a text line previously added to a text batch
+        *
+        * The text line is rewritten in place if the new glyphs fit into the sub-range it occupies already,
+        * otherwise it is moved to a new sub-range of the batch. On failure the text line is left unchanged.
+        *
+        * @param[in] textId Id of the batched text line to update
+        * @param[in] glyphs The new glyph metrics of the text line
+        * @param[in] offsetX Horizontal offset of the text line origin within the batch
+        * @param[in] offsetY Vertical offset of the text line origin within the batch
+        * @return True on success, false otherwise
+        */
+        bool                    updateTextLineInBatch(TextLineId textId, const GlyphMetricsVector& glyphs, float offsetX, float offsetY);
+
+        /**
+        * @brief Remove a text line from its text batch, its sub-range of the batch buffers is freed for reuse
+        * @param[in] textId Id of the batched text line to remove
+        * @return True on success, false otherwise
+        */
+        bool                    removeTextLineFromBatch(TextLineId textId);
+
+        /**
+        * @brief Get a const pointer to a (previously created) text batch object
+        * @param[in] batchId Id of the text batch object to get
+        * @return A pointer to the text batch object, or nullptr on failure
+        */
+        TextBatch const*        getTextBatch(TextBatchId batchId) const;
+
+        /**
+        * @brief Delete an existing text batch object together with all text lines it contains
+        * @param[in] batchId Id of the text batch object to delete
+        * @return True on success, false otherwise
+        */
+        bool                    deleteTextBatch(TextBatchId batchId);
+
+        /**
+        * @brief Load rasterized glyph bitmaps from a glyph cache file previously written using saveGlyphCache()
+        *
+        * Glyphs of font instances which provide a glyph cache identifier (see IFontInstance::getGlyphCacheIdentifier())
+        * are taken from the loaded glyph cache instead of being rasterized when they are used for the first time.
+        * Typically the glyph cache is loaded once at startup, before any text lines are created. Glyphs which
+        * were already loaded keep their data.
+        *
+        * @param[in] path Path of the glyph cache file
+        * @return True on success, false if the file could not be read or is not a valid glyph cache file
+        */
+        bool                    loadGlyphCache(const char* path);
+
+        /**
+        * @brief Write all glyph bitmaps used so far and all glyph bitmaps loaded using loadGlyphCache() to a glyph cache file
+        *
+        * Only glyphs of font instances which provide a glyph cache identifier are written. An existing file is overwritten.
+        *
+        * @param[in] path Path of the glyph cache file
+        * @return True on success, false otherwise
+        */
+        bool                    saveGlyphCache(const char* path) const;
+
         /**
         * Stores internal data for implementation specifics of TextCache.
         */
@@ -18,6 +18,7 @@
 #include "ramses-text-api/IFontInstance.h"
 #include "ramses-text-api/TextCache.h"
 #include "ramses-text-api/TextLine.h"
+#include "ramses-text-api/TextBatch.h"
 #include "ramses-text-api/UtfUtils.h"
 #include "ramses-text-api/LayoutUtils.h"
 
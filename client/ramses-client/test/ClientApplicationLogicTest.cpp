@@ -181,8 +181,8 @@ class AClientApplicationLogicWithRealComponents : public ::testing::Test
 {
 public:
     AClientApplicationLogicWithRealComponents()
-        : resComp(stats, fwlock)
-        , sceneComp(clientId, commSystem, connStatusUpdateNotifier, resComp, fwlock)
+        : resComp(stats)
+        , sceneComp(clientId, commSystem, connStatusUpdateNotifier, resComp, stats, fwlock)
         , logic(clientId, fwlock)
     {
         logic.init(resComp, sceneComp);
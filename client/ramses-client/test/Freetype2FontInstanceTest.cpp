@@ -202,4 +202,69 @@ namespace ramses
         EXPECT_TRUE(supportedChars.end() != supportedChars.find(165u));
         EXPECT_FALSE(supportedChars.end() != supportedChars.find(127u));
     }
+
+    TEST_F(AFreetype2FontInstance, PrefetchesGlyphBitmapDataIdenticalToGlyphBitmapDataLoadedOnDemand)
+    {
+        const auto fontId = FRegistry->createFreetype2Font("res/ramses-text-Roboto-Bold.ttf");
+        auto& prefetchingInstance = *FRegistry->getFontInstance(FRegistry->createFreetype2FontInstance(fontId, 16));
+        auto& onDemandInstance = *FRegistry->getFontInstance(FRegistry->createFreetype2FontInstance(fontId, 16));
+
+        const GlyphMetricsVector glyphs = getPositionedGlyphs(U"abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789", prefetchingInstance);
+        std::vector<GlyphId> glyphIds;
+        for (const auto& glyph : glyphs)
+            glyphIds.push_back(glyph.key.identifier);
+        prefetchingInstance.prefetchGlyphBitmapData(glyphIds);
+
+        for (const auto glyphId : glyphIds)
+        {
+            uint32_t prefetchedWidth = 0u;
+            uint32_t prefetchedHeight = 0u;
+            const GlyphData prefetchedData = prefetchingInstance.loadGlyphBitmapData(glyphId, prefetchedWidth, prefetchedHeight);
+            uint32_t width = 0u;
+            uint32_t height = 0u;
+            const GlyphData data = onDemandInstance.loadGlyphBitmapData(glyphId, width, height);
+
+            EXPECT_EQ(width, prefetchedWidth);
+            EXPECT_EQ(height, prefetchedHeight);
+            EXPECT_EQ(data, prefetchedData);
+        }
+    }
+
+    TEST_F(AFreetype2FontInstance, PrefetchesSeveralBatchesOfGlyphBitmapData)
+    {
+        const auto fontId = FRegistry->createFreetype2Font("res/ramses-text-Roboto-Bold.ttf");
+        auto& prefetchingInstance = *FRegistry->getFontInstance(FRegistry->createFreetype2FontInstance(fontId, 16));
+        auto& onDemandInstance = *FRegistry->getFontInstance(FRegistry->createFreetype2FontInstance(fontId, 16));
+
+        for (const auto& str : { std::u32string(U"abcdefghijklmnopqrstuvwxyz"), std::u32string(U"ABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789") })
+        {
+            std::vector<GlyphId> glyphIds;
+            for (const auto& glyph : getPositionedGlyphs(str, prefetchingInstance))
+                glyphIds.push_back(glyph.key.identifier);
+            prefetchingInstance.prefetchGlyphBitmapData(glyphIds);
+
+            for (const auto glyphId : glyphIds)
+            {
+                uint32_t prefetchedWidth = 0u;
+                uint32_t prefetchedHeight = 0u;
+                const GlyphData prefetchedData = prefetchingInstance.loadGlyphBitmapData(glyphId, prefetchedWidth, prefetchedHeight);
+                uint32_t width = 0u;
+                uint32_t height = 0u;
+                EXPECT_EQ(onDemandInstance.loadGlyphBitmapData(glyphId, width, height), prefetchedData);
+            }
+        }
+    }
+
+    TEST_F(AFreetype2FontInstance, ProvidesGlyphCacheIdentifierDependingOnFontDataAndSize)
+    {
+        const auto fontId = FRegistry->createFreetype2Font("res/ramses-text-Roboto-Bold.ttf");
+        const auto* otherInstance10 = FRegistry->getFontInstance(FRegistry->createFreetype2FontInstanceWithHarfBuzz(fontId, 10));
+        const auto* autohintedInstance10 = FRegistry->getFontInstance(FRegistry->createFreetype2FontInstanceWithHarfBuzz(fontId, 10, true));
+
+        EXPECT_NE(0u, FontInstance4->getGlyphCacheIdentifier());
+        EXPECT_NE(0u, FontInstance10->getGlyphCacheIdentifier());
+        EXPECT_NE(FontInstance4->getGlyphCacheIdentifier(), FontInstance10->getGlyphCacheIdentifier());
+        EXPECT_EQ(FontInstance10->getGlyphCacheIdentifier(), otherInstance10->getGlyphCacheIdentifier());
+        EXPECT_NE(FontInstance10->getGlyphCacheIdentifier(), autohintedInstance10->getGlyphCacheIdentifier());
+    }
 }
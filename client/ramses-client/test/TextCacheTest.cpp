@@ -17,6 +17,7 @@
 #include "ramses-client-api/ArrayBuffer.h"
 #include "ramses-client-api/EffectDescription.h"
 #include "ramses-utils.h"
+#include "Utils/File.h"
 #include "gtest/gtest.h"
 #include "gmock/gmock.h"
 
@@ -537,4 +538,179 @@ namespace ramses
 
         EXPECT_FALSE(m_textCache.createTextLine(positionedGlyphs, *textEffect).isValid());
     }
+
+    TEST_F(ATextCache, failsToCreateTextBatchWithInvalidNumberOfGlyphs)
+    {
+        Effect* textEffect = createTestEffect(m_scene);
+        ASSERT_TRUE(textEffect != nullptr);
+
+        EXPECT_FALSE(m_textCache.createTextBatch(*textEffect, 0u).isValid());
+        EXPECT_FALSE(m_textCache.createTextBatch(*textEffect, 16385u).isValid());
+    }
+
+    TEST_F(ATextCache, failsToCreateTextBatchUsingNonTextEffect)
+    {
+        EffectDescription effectDesc;
+        effectDesc.setVertexShader("void main() { gl_Position = vec4(1.0, 0.0, 0.0, 1.0); }\n");
+        effectDesc.setFragmentShader("void main() { gl_FragColor = vec4(1.0, 0.0, 0.0, 1.0); }\n");
+        Effect* effect = m_scene.createEffect(effectDesc);
+        ASSERT_TRUE(effect != nullptr);
+
+        EXPECT_FALSE(m_textCache.createTextBatch(*effect, 10u).isValid());
+    }
+
+    TEST_F(ATextCache, createsTextBatchWithOneMeshForMultipleTextLines)
+    {
+        Effect* textEffect = createTestEffect(m_scene);
+        ASSERT_TRUE(textEffect != nullptr);
+
+        const TextBatchId batchId = m_textCache.createTextBatch(*textEffect, 32u);
+        ASSERT_TRUE(batchId.isValid());
+        const TextBatch* batch = m_textCache.getTextBatch(batchId);
+        ASSERT_TRUE(batch != nullptr);
+        ASSERT_TRUE(batch->meshNode != nullptr);
+        EXPECT_NE(nullptr, batch->meshNode->getAppearance());
+        EXPECT_NE(nullptr, batch->meshNode->getGeometryBinding());
+        EXPECT_EQ(0u, batch->meshNode->getIndexCount());
+        EXPECT_EQ(32u, batch->maxNumberOfGlyphs);
+
+        const auto positionedGlyphs = m_textCache.getPositionedGlyphs(U" test ", LatinFontInstance12);
+        const TextLineId textLineId1 = m_textCache.addTextLineToBatch(batchId, positionedGlyphs, 0.f, 0.f);
+        const TextLineId textLineId2 = m_textCache.addTextLineToBatch(batchId, positionedGlyphs, 100.f, 50.f);
+        EXPECT_TRUE(textLineId1.isValid());
+        EXPECT_TRUE(textLineId2.isValid());
+        EXPECT_NE(textLineId1, textLineId2);
+        // batched text lines have no mesh of their own
+        EXPECT_EQ(nullptr, m_textCache.getTextLine(textLineId1));
+
+        EXPECT_NE(std::numeric_limits<decltype(batch->atlasPage)>::max(), batch->atlasPage);
+        EXPECT_EQ(48u, batch->meshNode->getIndexCount());
+        EXPECT_EQ(48u, batch->indices->getUsedNumberOfElements());
+        EXPECT_EQ(32u, batch->positions->getUsedNumberOfElements());
+        EXPECT_EQ(32u, batch->textureCoordinates->getUsedNumberOfElements());
+
+        std::vector<float> positions(64u);
+        ASSERT_EQ(StatusOK, batch->positions->getData(positions.data(), 32u));
+        for (size_t i = 0u; i < 32u; i += 2u)
+        {
+            EXPECT_FLOAT_EQ(positions[i] + 100.f, positions[32u + i]);
+            EXPECT_FLOAT_EQ(positions[i + 1u] + 50.f, positions[32u + i + 1u]);
+        }
+
+        std::vector<uint16_t> indices(48u);
+        ASSERT_EQ(StatusOK, batch->indices->getData(indices.data(), 48u));
+        EXPECT_EQ(indices[0] + 16u, indices[24]);
+    }
+
+    TEST_F(ATextCache, updatesBatchedTextLineInPlaceAndShrinksIndexCountWhenLastLineRemoved)
+    {
+        Effect* textEffect = createTestEffect(m_scene);
+        ASSERT_TRUE(textEffect != nullptr);
+        const TextBatchId batchId = m_textCache.createTextBatch(*textEffect, 32u);
+        const TextBatch* batch = m_textCache.getTextBatch(batchId);
+        ASSERT_TRUE(batch != nullptr);
+
+        const TextLineId textLineId1 = m_textCache.addTextLineToBatch(batchId, m_textCache.getPositionedGlyphs(U" test ", LatinFontInstance12), 0.f, 0.f);
+        const TextLineId textLineId2 = m_textCache.addTextLineToBatch(batchId, m_textCache.getPositionedGlyphs(U"est", LatinFontInstance12), 0.f, 20.f);
+        ASSERT_TRUE(textLineId1.isValid());
+        ASSERT_TRUE(textLineId2.isValid());
+        EXPECT_EQ(42u, batch->meshNode->getIndexCount());
+
+        EXPECT_TRUE(m_textCache.updateTextLineInBatch(textLineId1, m_textCache.getPositionedGlyphs(U"te", LatinFontInstance12), 10.f, 0.f));
+        EXPECT_EQ(42u, batch->meshNode->getIndexCount());
+
+        EXPECT_TRUE(m_textCache.removeTextLineFromBatch(textLineId2));
+        EXPECT_EQ(24u, batch->meshNode->getIndexCount());
+        EXPECT_FALSE(m_textCache.removeTextLineFromBatch(textLineId2));
+        EXPECT_FALSE(m_textCache.updateTextLineInBatch(textLineId2, m_textCache.getPositionedGlyphs(U"te", LatinFontInstance12), 0.f, 0.f));
+    }
+
+    TEST_F(ATextCache, movesBatchedTextLineToFreeRangeWhenItGrows)
+    {
+        Effect* textEffect = createTestEffect(m_scene);
+        ASSERT_TRUE(textEffect != nullptr);
+        const TextBatchId batchId = m_textCache.createTextBatch(*textEffect, 8u);
+        const TextBatch* batch = m_textCache.getTextBatch(batchId);
+        ASSERT_TRUE(batch != nullptr);
+
+        const TextLineId textLineId1 = m_textCache.addTextLineToBatch(batchId, m_textCache.getPositionedGlyphs(U"te", LatinFontInstance12), 0.f, 0.f);
+        const TextLineId textLineId2 = m_textCache.addTextLineToBatch(batchId, m_textCache.getPositionedGlyphs(U"st", LatinFontInstance12), 0.f, 20.f);
+        EXPECT_EQ(24u, batch->meshNode->getIndexCount());
+
+        EXPECT_TRUE(m_textCache.updateTextLineInBatch(textLineId1, m_textCache.getPositionedGlyphs(U" test ", LatinFontInstance12), 0.f, 0.f));
+        EXPECT_EQ(48u, batch->meshNode->getIndexCount());
+
+        // no more space for text line 2 to grow, it stays unchanged
+        EXPECT_FALSE(m_textCache.updateTextLineInBatch(textLineId2, m_textCache.getPositionedGlyphs(U" test ", LatinFontInstance12), 0.f, 0.f));
+        EXPECT_TRUE(m_textCache.removeTextLineFromBatch(textLineId2));
+        EXPECT_EQ(48u, batch->meshNode->getIndexCount());
+        // freed range is reused
+        EXPECT_TRUE(m_textCache.addTextLineToBatch(batchId, m_textCache.getPositionedGlyphs(U"test", LatinFontInstance12), 0.f, 0.f).isValid());
+        EXPECT_EQ(48u, batch->meshNode->getIndexCount());
+    }
+
+    TEST_F(ATextCache, failsToAddTextLineToBatchWithoutEnoughSpace)
+    {
+        Effect* textEffect = createTestEffect(m_scene);
+        ASSERT_TRUE(textEffect != nullptr);
+        const TextBatchId batchId = m_textCache.createTextBatch(*textEffect, 3u);
+        const TextBatch* batch = m_textCache.getTextBatch(batchId);
+        ASSERT_TRUE(batch != nullptr);
+
+        EXPECT_FALSE(m_textCache.addTextLineToBatch(batchId, m_textCache.getPositionedGlyphs(U" test ", LatinFontInstance12), 0.f, 0.f).isValid());
+        // failed text line does not decide atlas page of batch
+        EXPECT_EQ(std::numeric_limits<decltype(batch->atlasPage)>::max(), batch->atlasPage);
+        EXPECT_EQ(EVisibilityMode::Off, batch->meshNode->getVisibility());
+        EXPECT_FALSE(m_textCache.addTextLineToBatch(batchId, {}, 0.f, 0.f).isValid());
+        EXPECT_FALSE(m_textCache.addTextLineToBatch(TextBatchId(99u), m_textCache.getPositionedGlyphs(U"te", LatinFontInstance12), 0.f, 0.f).isValid());
+        EXPECT_TRUE(m_textCache.addTextLineToBatch(batchId, m_textCache.getPositionedGlyphs(U"tes", LatinFontInstance12), 0.f, 0.f).isValid());
+        EXPECT_NE(std::numeric_limits<decltype(batch->atlasPage)>::max(), batch->atlasPage);
+        EXPECT_EQ(EVisibilityMode::Visible, batch->meshNode->getVisibility());
+    }
+
+    TEST_F(ATextCache, deletesTextBatchWithAllItsTextLines)
+    {
+        Effect* textEffect = createTestEffect(m_scene);
+        ASSERT_TRUE(textEffect != nullptr);
+        const TextBatchId batchId = m_textCache.createTextBatch(*textEffect, 8u);
+        const TextLineId textLineId = m_textCache.addTextLineToBatch(batchId, m_textCache.getPositionedGlyphs(U"te", LatinFontInstance12), 0.f, 0.f);
+        ASSERT_TRUE(textLineId.isValid());
+
+        EXPECT_TRUE(m_textCache.deleteTextBatch(batchId));
+        EXPECT_EQ(nullptr, m_textCache.getTextBatch(batchId));
+        EXPECT_FALSE(m_textCache.removeTextLineFromBatch(textLineId));
+        EXPECT_FALSE(m_textCache.deleteTextBatch(batchId));
+    }
+
+    TEST_F(ATextCache, savesAndLoadsGlyphCache)
+    {
+        const auto positionedGlyphs = m_textCache.getPositionedGlyphs(U"cached glyphs", LatinFontInstance12);
+        Effect* textEffect = createTestEffect(m_scene);
+        ASSERT_TRUE(textEffect != nullptr);
+        ASSERT_TRUE(m_textCache.createTextLine(positionedGlyphs, *textEffect).isValid());
+        EXPECT_TRUE(m_textCache.saveGlyphCache("textCacheTest.glyphcache"));
+
+        TextCache otherTextCache(m_scene, *FRegistry, 64u, 64u);
+        EXPECT_TRUE(otherTextCache.loadGlyphCache("textCacheTest.glyphcache"));
+        const TextLineId textLineId = otherTextCache.createTextLine(positionedGlyphs, *textEffect);
+        ASSERT_TRUE(textLineId.isValid());
+        const TextLine* textLine = otherTextCache.getTextLine(textLineId);
+        ASSERT_TRUE(textLine != nullptr);
+        EXPECT_EQ(positionedGlyphs, textLine->glyphs);
+        EXPECT_EQ(m_textCache.getTextLine(TextLineId(0u))->meshNode->getIndexCount(), textLine->meshNode->getIndexCount());
+
+        ramses_internal::File("textCacheTest.glyphcache").remove();
+    }
+
+    TEST_F(ATextCache, failsToSaveGlyphCacheToFileWhichCannotBeOpened)
+    {
+        EXPECT_FALSE(m_textCache.saveGlyphCache("nonExistingDirectory/textCacheTest.glyphcache"));
+    }
+
+    TEST_F(ATextCache, failsToLoadGlyphCacheFromInvalidFile)
+    {
+        EXPECT_FALSE(m_textCache.loadGlyphCache("nonExistingFile.glyphcache"));
+        EXPECT_FALSE(m_textCache.loadGlyphCache("./res/ramses-text-Roboto-Bold.ttf"));
+        EXPECT_FALSE(m_textCache.loadGlyphCache(nullptr));
+    }
 }
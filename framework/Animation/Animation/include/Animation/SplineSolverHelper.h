@@ -26,14 +26,19 @@ namespace ramses_internal
             Float segmentTime);
 
     private:
-        static Float getInterpolatedValueBezierScalar(
-            Float value1,
-            Float value2,
+        static Float getBezierFraction(
             const Vector2& tangent1,
             const Vector2& tangent2,
             SplineTimeStamp time1,
             SplineTimeStamp time2,
             Float segmentTime);
+
+        static Float getInterpolatedValueBezierScalar(
+            Float value1,
+            Float value2,
+            const Vector2& tangent1,
+            const Vector2& tangent2,
+            Float bezierFraction);
     };
 
     template <typename EDataType>
@@ -50,12 +55,15 @@ namespace ramses_internal
         const typename TypeTraits::CorrespondingFloatType key1f = TypeTraits::ToCorrespondingFloatType(key1.m_value);
         const typename TypeTraits::CorrespondingFloatType key2f = TypeTraits::ToCorrespondingFloatType(key2.m_value);
 
+        // time axis of the curve is shared by all components, solve it only once
+        const Float bezierFraction = getBezierFraction(key1.m_tangentOut, key2.m_tangentIn, key1Time, key2Time, segmentTime);
+
         EDataType result;
         for (UInt32 i = 0u; i < TypeTraits::NumComponents; ++i)
         {
             const Float key1compf = TypeFloatTraits::GetComponent(key1f, EVectorComponent(i));
             const Float key2compf = TypeFloatTraits::GetComponent(key2f, EVectorComponent(i));
-            const Float interpolatedValue = getInterpolatedValueBezierScalar(key1compf, key2compf, key1.m_tangentOut, key2.m_tangentIn, key1Time, key2Time, segmentTime);
+            const Float interpolatedValue = getInterpolatedValueBezierScalar(key1compf, key2compf, key1.m_tangentOut, key2.m_tangentIn, bezierFraction);
             TypeTraits::SetComponent(result, static_cast<typename TypeTraits::ComponentType>(interpolatedValue), EVectorComponent(i));
         }
 
@@ -76,23 +84,32 @@ namespace ramses_internal
         return Interpolator::InterpolateLinear(key1.m_value, key2.m_value, segmentTime);
     }
 
-    inline Float SplineSolverHelper::getInterpolatedValueBezierScalar(
-        Float value1,
-        Float value2,
+    inline Float SplineSolverHelper::getBezierFraction(
         const Vector2& tangent1,
         const Vector2& tangent2,
         SplineTimeStamp time1,
         SplineTimeStamp time2,
         Float segmentTime)
     {
-        const Vector2 p0(static_cast<Float>(time1), value1);
-        const Vector2 p3(static_cast<Float>(time2), value2);
-        const Vector2 p1 = p0 + tangent1;
-        const Vector2 p2 = p3 + tangent2;
+        const Float p0 = static_cast<Float>(time1);
+        const Float p3 = static_cast<Float>(time2);
+        const Float p1 = p0 + tangent1.x;
+        const Float p2 = p3 + tangent2.x;
 
-        const Float segmentTimeInMS = p0.x + (p3.x - p0.x) * segmentTime;
-        const Float segmentFraction = Interpolator::FindFractionForGivenXOnBezierSpline(p0.x, p1.x, p2.x, p3.x, segmentTimeInMS);
-        return Interpolator::InterpolateCubicBezier(p0.y, p1.y, p2.y, p3.y, segmentFraction);
+        const Float segmentTimeInMS = p0 + (p3 - p0) * segmentTime;
+        return Interpolator::FindFractionForGivenXOnBezierSpline(p0, p1, p2, p3, segmentTimeInMS);
+    }
+
+    inline Float SplineSolverHelper::getInterpolatedValueBezierScalar(
+        Float value1,
+        Float value2,
+        const Vector2& tangent1,
+        const Vector2& tangent2,
+        Float bezierFraction)
+    {
+        const Float p1 = value1 + tangent1.y;
+        const Float p2 = value2 + tangent2.y;
+        return Interpolator::InterpolateCubicBezier(value1, p1, p2, value2, bezierFraction);
     }
 }
 
@@ -72,6 +72,25 @@ namespace ramses_internal
         splineSolverValuesAtKeys(EInterpolationType_Bezier);
     }
 
+    TEST_F(ASpline, SplineSolverBezierInterpolatesVectorSameAsEachComponent)
+    {
+        const Vector2 tangentIn(-30.f, 2.f);
+        const Vector2 tangentOut(40.f, -3.f);
+        const SplineKeyTangents<Vector3> key1(Vector3(1.f, -2.f, 5.f), tangentIn, tangentOut);
+        const SplineKeyTangents<Vector3> key2(Vector3(10.f, 4.f, -7.f), tangentIn, tangentOut);
+
+        for (const Float segmentTime : { 0.1f, 0.37f, 0.5f, 0.81f })
+        {
+            const Vector3 value = SplineSolverHelper::GetInterpolatedValueBezier(key1, key2, 100u, 200u, segmentTime);
+            for (UInt32 i = 0u; i < 3u; ++i)
+            {
+                const SplineKeyTangents<Float> componentKey1(key1.m_value[i], tangentIn, tangentOut);
+                const SplineKeyTangents<Float> componentKey2(key2.m_value[i], tangentIn, tangentOut);
+                EXPECT_EQ(SplineSolverHelper::GetInterpolatedValueBezier(componentKey1, componentKey2, 100u, 200u, segmentTime), value[i]);
+            }
+        }
+    }
+
     TEST_F(ASpline, DISABLED_SplineSolverBezierInterpolateTypes)
     {
         splineSolverInterpolateTypesTest(EInterpolationType_Bezier);
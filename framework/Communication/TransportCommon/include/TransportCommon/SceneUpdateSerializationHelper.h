@@ -10,6 +10,8 @@
 #define RAMSES_SCENEUPDATESERIALIZATIONHELPER_H
 
 #include "PlatformAbstraction/PlatformTypes.h"
+#include "SceneAPI/ResourceContentHash.h"
+#include "Resource/IResource.h"
 #include "absl/types/span.h"
 #include <vector>
 #include <memory>
@@ -25,7 +27,8 @@ namespace ramses_internal
         absl::Span<const Byte> SerializeDescription(const SceneActionCollection& actions, std::vector<Byte>& workingMemory);
         absl::Span<const Byte> SerializeData(const SceneActionCollection& actions);
 
-        SceneActionCollection Deserialize(absl::Span<const Byte> description, absl::Span<const Byte> data);
+        // returns false if description is malformed or does not match data
+        bool Deserialize(absl::Span<const Byte> description, absl::Span<const Byte> data, SceneActionCollection& actions);
     };
 
     namespace ResourceSerialization
@@ -34,6 +37,25 @@ namespace ramses_internal
         absl::Span<const Byte> SerializeData(const IResource& resource);
 
         std::unique_ptr<IResource> Deserialize(absl::Span<const Byte> description, absl::Span<const Byte> data);
+
+        // resource whose description was read but data is still to be received
+        struct IncompleteResource
+        {
+            std::unique_ptr<IResource> resource;
+            ResourceContentHash hash;
+            uint32_t dataSize = 0;
+            uint32_t decompressedSize = 0;
+            bool compressed = false;
+            // only one of them gets allocated depending on compression
+            ResourceBlob data;
+            CompressedResouceBlob compressedData;
+        };
+
+        // resource is null if description is invalid or expects other data size
+        IncompleteResource DeserializeDescription(absl::Span<const Byte> description, uint32_t dataSize);
+        // storage for data of given resource to be filled before finalizing it
+        absl::Span<Byte> AllocateData(IncompleteResource& incompleteResource);
+        std::unique_ptr<IResource> Finalize(IncompleteResource incompleteResource);
     }
 
     namespace FlushInformationSerialization
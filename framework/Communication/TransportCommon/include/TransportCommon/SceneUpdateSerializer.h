@@ -10,20 +10,23 @@
 #define RAMSES_SCENEUPDATESERIALIZER_H
 
 #include "TransportCommon/ISceneUpdateSerializer.h"
+#include "TransportCommon/SingleSceneUpdateWriter.h"
+#include "Resource/IResource.h"
 
 namespace ramses_internal
 {
-    struct SceneUpdate;
-
     class SceneUpdateSerializer : public ISceneUpdateSerializer
     {
     public:
-        explicit SceneUpdateSerializer(const SceneUpdate& update);
+        // Compresses resources with given level and serializes all descriptions right away, writeToPackets only copies into packets.
+        // Allows doing the expensive part of sending before taking locks needed for sending. Update must not change afterwards.
+        explicit SceneUpdateSerializer(const SceneUpdate& update, IResource::CompressionLevel compressionLevel = IResource::CompressionLevel::NONE);
         bool writeToPackets(absl::Span<Byte> packetMem, const std::function<bool(size_t)>& writeDoneFunc) const override;
 
         const SceneUpdate& getUpdate() const;
     private:
         const SceneUpdate& m_update;
+        SingleSceneUpdateWriter::Descriptions m_descriptions;
     };
 }
 
@@ -11,11 +11,12 @@
 
 #include "Scene/SceneActionCollection.h"
 #include "Components/FlushInformation.h"
+#include "TransportCommon/SceneUpdateSerializationHelper.h"
 #include "absl/types/span.h"
+#include <unordered_map>
 
 namespace ramses_internal
 {
-    class IResource;
     class BinaryInputStream;
 
     class SceneUpdateStreamDeserializer
@@ -41,13 +42,24 @@ namespace ramses_internal
             SceneActionCollection                   actions;
             FlushInformation                        flushInfos;
             std::vector<std::unique_ptr<IResource>> resources;
+            // number of resources taken over from an interrupted update instead of receiving their data again
+            uint32_t                                resumedResources = 0;
         };
 
         Result processData(absl::Span<const Byte> data);
 
+        // Resources fully received as part of an update that did not complete (e.g. connection lost)
+        // plus not yet reused resumable resources. Can be handed to a new deserializer when the update is resent.
+        std::vector<std::unique_ptr<IResource>> takeResourcesOfIncompleteUpdate();
+        // Resources of next update with matching hash are taken from here, their received data is skipped.
+        // Resources not used by next update are discarded when it completes.
+        void addResumableResources(std::vector<std::unique_ptr<IResource>> resources);
+
     private:
-        void continueReadingBlock(BinaryInputStream& is, size_t dataSize);
+        bool continueReadingBlock(BinaryInputStream& is, size_t dataSize);
         bool startReadingNewBlock(BinaryInputStream& is, size_t dataSize);
+        bool startReadingResourceData();
+        size_t getResourceBlockBytesBeforeData() const;
         Result fail();
 
         bool finalizeBlock();
@@ -58,9 +70,18 @@ namespace ramses_internal
         uint32_t m_nextExpectedPacketNum = 1;
         bool m_hasFailed = false;
         uint32_t m_currentBlockSize = 0;
+        uint32_t m_currentBlockRead = 0;
         uint32_t m_blockType;
+        // holds whole block except resource data, which is stored directly in the resource as it arrives
         std::vector<Byte> m_currentBlock;
         Result m_currentResult;
+
+        bool m_readingResourceData = false;
+        ResourceSerialization::IncompleteResource m_incompleteResource;
+        std::unique_ptr<IResource> m_resumedResource;
+        absl::Span<Byte> m_resourceDataStorage;
+        uint32_t m_resourceDataRead = 0;
+        std::unordered_map<ResourceContentHash, std::unique_ptr<IResource>> m_resumableResources;
     };
 }
 
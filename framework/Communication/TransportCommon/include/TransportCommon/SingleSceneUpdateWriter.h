@@ -18,7 +18,16 @@ namespace ramses_internal
     class SingleSceneUpdateWriter
     {
     public:
-        SingleSceneUpdateWriter(const SceneUpdate& update, absl::Span<Byte> packetMem, const std::function<bool(size_t)>& writeDoneFunc);
+        // serialized descriptions of all blocks of an update, they do not depend on packet size and can be created ahead
+        struct Descriptions
+        {
+            std::vector<Byte> actions;
+            std::vector<std::vector<Byte>> resources;
+            std::vector<Byte> flushInfos;
+        };
+        static void SerializeDescriptions(const SceneUpdate& update, Descriptions& descriptions);
+
+        SingleSceneUpdateWriter(const SceneUpdate& update, const Descriptions& descriptions, absl::Span<Byte> packetMem, const std::function<bool(size_t)>& writeDoneFunc);
 
         bool write();
 
@@ -37,18 +46,18 @@ namespace ramses_internal
         bool finalizePacket(bool more);
 
         bool writeSceneActionCollection();
-        bool writeResource(const IResource& resource);
-        bool writeFlushInfos(const FlushInformation& infos);
+        bool writeResource(const IResource& resource, const std::vector<Byte>& description);
+        bool writeFlushInfos();
 
         bool writeBlock(BlockType type, std::initializer_list<absl::Span<const Byte>> spans);
         bool writeDataToPackets(absl::Span<const Byte> data, bool writeContinuous = false);
 
         const SceneUpdate&                 m_update;
+        const Descriptions&                m_descriptions;
         const absl::Span<Byte>             m_packetMem;
         const std::function<bool(size_t)>& m_writeDoneFunc;
         RawBinaryOutputStream              m_packetWriter;
         uint32_t                           m_packetNum = 1;
-        std::vector<Byte>                  m_temporaryMemToSerializeDescription;  // optimization to avoid allocations
     };
 }
 
@@ -49,8 +49,13 @@ namespace ramses_internal
 
             LOG_DEBUG(CONTEXT_COMMUNICATION, "ConstructTCPConnectionManager: Daemon Address: " << daemonNetworkAddress.getIp() << ":" << daemonNetworkAddress.getPort());
 
+            // payloads to participants on the same host go through shared memory, TCP still carries connection handling
+            const bool sharedMemoryTransport = config.m_tcpConfig.getSharedMemoryTransportEnabled();
+            LOG_INFO(CONTEXT_COMMUNICATION, "ConstructTCPConnectionManager: Shared memory transport for local participants " << (sharedMemoryTransport ? "enabled" : "disabled"));
+
             // allocate
-            return std::make_unique<TCPConnectionSystem>(participantNetworkAddress, config.getProtocolVersion(), daemonNetworkAddress, false, frameworkLock, statisticCollection, config.m_tcpConfig.getAliveInterval(), config.m_tcpConfig.getAliveTimeout());
+            return std::make_unique<TCPConnectionSystem>(participantNetworkAddress, config.getProtocolVersion(), daemonNetworkAddress, false, frameworkLock, statisticCollection,
+                config.m_tcpConfig.getAliveInterval(), config.m_tcpConfig.getAliveTimeout(), sharedMemoryTransport);
         }
 #endif
     }
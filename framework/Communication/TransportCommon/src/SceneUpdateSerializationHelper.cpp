@@ -11,9 +11,10 @@
 #include "Scene/SceneActionCollection.h"
 #include "Utils/LogMacros.h"
 #include "Utils/BinaryInputStream.h"
+#include "Utils/VarIntEncoding.h"
 #include "Components/ResourceSerializationHelper.h"
 #include "Components/FlushInformation.h"
-
+#include <limits>
 
 namespace
 {
@@ -54,10 +55,27 @@ namespace ramses_internal
         absl::Span<const Byte> SerializeDescription(const SceneActionCollection& actions, std::vector<Byte>& workingMemory)
         {
             VectorBinaryOutputStream os(workingMemory);
-            os << static_cast<uint32_t>(actions.numberOfActions());
-            for (const auto& sa : actions)
-                os << static_cast<uint32_t>(sa.type())
-                   << static_cast<uint32_t>(sa.offsetInCollection());
+            os << static_cast<uint32_t>(actions.numberOfActions())
+               << static_cast<uint8_t>(actions.getEncoding());
+            if (actions.getEncoding() == ESceneActionEncoding::Compact)
+            {
+                // types are small and offsets grow, store type and offset delta to previous action
+                Byte buffer[2 * VarIntEncoding::MaxEncodedSize];
+                uint32_t previousOffset = 0u;
+                for (const auto& sa : actions)
+                {
+                    UInt size = VarIntEncoding::Encode(static_cast<uint32_t>(sa.type()), buffer);
+                    size += VarIntEncoding::Encode(sa.offsetInCollection() - previousOffset, buffer + size);
+                    os.write(buffer, static_cast<uint32_t>(size));
+                    previousOffset = sa.offsetInCollection();
+                }
+            }
+            else
+            {
+                for (const auto& sa : actions)
+                    os << static_cast<uint32_t>(sa.type())
+                       << static_cast<uint32_t>(sa.offsetInCollection());
+            }
             return workingMemory;
         }
 
@@ -66,24 +84,67 @@ namespace ramses_internal
             return actions.collectionData();
         }
 
-        SceneActionCollection Deserialize(absl::Span<const Byte> description, absl::Span<const Byte> data)
+        bool Deserialize(absl::Span<const Byte> description, absl::Span<const Byte> data, SceneActionCollection& actions)
         {
+            constexpr size_t headerSize = sizeof(uint32_t) + sizeof(uint8_t);
+            if (description.size() < headerSize)
+                return false;
+
             BinaryInputStream is(description.data());
             uint32_t numActions = 0;
-            is >> numActions;
-            assert(description.size() == numActions*2*sizeof(uint32_t) + sizeof(uint32_t));
+            uint8_t encoding = 0;
+            is >> numActions
+               >> encoding;
+            if (encoding > static_cast<uint8_t>(ESceneActionEncoding::Compact))
+                return false;
 
-            SceneActionCollection actions(data.size(), numActions);
-            actions.appendRawData(data.data(), data.size());
+            // check number of actions against description size before reserving memory for them
+            const size_t minimumInfoSize = (encoding == static_cast<uint8_t>(ESceneActionEncoding::Compact)) ? 2u : 2u * sizeof(uint32_t);
+            if (numActions > (description.size() - headerSize) / minimumInfoSize)
+                return false;
+            if (encoding == static_cast<uint8_t>(ESceneActionEncoding::Fixed) && description.size() != headerSize + numActions * minimumInfoSize)
+                return false;
+
+            SceneActionCollection result(data.size(), numActions);
+            result.setEncoding(static_cast<ESceneActionEncoding>(encoding));
+            result.appendRawData(data.data(), data.size());
+
+            const Byte* readPosition = is.readPosition();
+            const Byte* descriptionEnd = description.data() + description.size();
+            uint64_t offset = 0u;
             for (uint32_t i = 0; i < numActions; ++i)
             {
-                uint32_t type = 0;
-                uint32_t offset = 0;
-                is >> type
-                   >> offset;
-                actions.addRawSceneActionInformation(static_cast<ESceneActionId>(type), offset);
+                uint64_t type = 0u;
+                if (result.getEncoding() == ESceneActionEncoding::Compact)
+                {
+                    uint64_t offsetDelta = 0u;
+                    if (!VarIntEncoding::Decode(readPosition, descriptionEnd, type) ||
+                        !VarIntEncoding::Decode(readPosition, descriptionEnd, offsetDelta) ||
+                        offsetDelta > data.size() - offset)
+                        return false;
+                    offset += offsetDelta;
+                }
+                else
+                {
+                    uint32_t fixedType = 0;
+                    uint32_t fixedOffset = 0;
+                    is >> fixedType
+                       >> fixedOffset;
+                    if (fixedOffset < offset)
+                        return false;
+                    type = fixedType;
+                    offset = fixedOffset;
+                }
+                // offsets must not decrease and stay inside data, so action sizes are well defined
+                if (type > std::numeric_limits<uint32_t>::max() || offset > data.size())
+                    return false;
+                result.addRawSceneActionInformation(static_cast<ESceneActionId>(type), static_cast<uint32_t>(offset));
             }
-            return actions;
+            if (result.getEncoding() == ESceneActionEncoding::Compact && readPosition != descriptionEnd)
+                return false;
+
+            actions = std::move(result);
+            return true;
         }
     }
 
@@ -242,28 +303,65 @@ namespace ramses_internal
 
         std::unique_ptr<IResource> Deserialize(absl::Span<const Byte> description, absl::Span<const Byte> data)
         {
+            IncompleteResource incompleteResource = DeserializeDescription(description, static_cast<uint32_t>(data.size()));
+            if (!incompleteResource.resource)
+                return nullptr;
+            const absl::Span<Byte> storage = AllocateData(incompleteResource);
+            if (!data.empty())
+                PlatformMemory::Copy(storage.data(), data.data(), data.size());
+            return Finalize(std::move(incompleteResource));
+        }
+
+        IncompleteResource DeserializeDescription(absl::Span<const Byte> description, uint32_t dataSize)
+        {
+            IncompleteResource incompleteResource;
             BinaryInputStream is(description.data());
-            ResourceContentHash hash;
-            is >> hash;
+            is >> incompleteResource.hash;
             ResourceSerializationHelper::DeserializedResourceHeader header =
                 ResourceSerializationHelper::ResourceFromMetadataStream(is);
             std::unique_ptr<IResource> resource(header.resource);
-            const size_t expectedDataSize = header.compressionStatus == EResourceCompressionStatus_Compressed ?
-                header.compressedSize : header.decompressedSize;
-            if (data.size() != expectedDataSize)
+            if (!resource)
+            {
+                LOG_ERROR_P(CONTEXT_FRAMEWORK, "ResourceSerialization::DeserializeDescription: Invalid resource metadata for {}", incompleteResource.hash);
+                return incompleteResource;
+            }
+
+            incompleteResource.compressed = header.compressionStatus == EResourceCompressionStatus_Compressed;
+            const size_t expectedDataSize = incompleteResource.compressed ? header.compressedSize : header.decompressedSize;
+            if (dataSize != expectedDataSize)
             {
                 LOG_ERROR_P(CONTEXT_FRAMEWORK, "ResourceSerialization::Deserialize: Expected resource size {} but got {}, compression state {}",
-                            expectedDataSize, data.size(), header.compressionStatus);
-                return nullptr;
+                            expectedDataSize, dataSize, header.compressionStatus);
+                return incompleteResource;
+            }
+
+            incompleteResource.resource = std::move(resource);
+            incompleteResource.dataSize = dataSize;
+            incompleteResource.decompressedSize = header.decompressedSize;
+            return incompleteResource;
+        }
+
+        absl::Span<Byte> AllocateData(IncompleteResource& incompleteResource)
+        {
+            if (incompleteResource.compressed)
+            {
+                incompleteResource.compressedData = CompressedResouceBlob(incompleteResource.dataSize);
+                return { incompleteResource.compressedData.data(), incompleteResource.compressedData.size() };
             }
-            if (data.size() > 0)
+            incompleteResource.data = ResourceBlob(incompleteResource.dataSize);
+            return { incompleteResource.data.data(), incompleteResource.data.size() };
+        }
+
+        std::unique_ptr<IResource> Finalize(IncompleteResource incompleteResource)
+        {
+            if (incompleteResource.dataSize > 0)
             {
-                if (header.compressionStatus == EResourceCompressionStatus_Compressed)
-                    resource->setCompressedResourceData(CompressedResouceBlob(data.size(), data.data()), header.decompressedSize, hash);
+                if (incompleteResource.compressed)
+                    incompleteResource.resource->setCompressedResourceData(std::move(incompleteResource.compressedData), incompleteResource.decompressedSize, incompleteResource.hash);
                 else
-                    resource->setResourceData(ResourceBlob(data.size(), data.data()), hash);
+                    incompleteResource.resource->setResourceData(std::move(incompleteResource.data), incompleteResource.hash);
             }
-            return resource;
+            return std::move(incompleteResource.resource);
         }
     }
 }
@@ -7,18 +7,21 @@
 //  -------------------------------------------------------------------------
 
 #include "TransportCommon/SceneUpdateSerializer.h"
-#include "TransportCommon/SingleSceneUpdateWriter.h"
 
 namespace ramses_internal
 {
-    SceneUpdateSerializer::SceneUpdateSerializer(const SceneUpdate& update)
+    SceneUpdateSerializer::SceneUpdateSerializer(const SceneUpdate& update, IResource::CompressionLevel compressionLevel)
         : m_update(update)
     {
+        // resource descriptions contain the compression state
+        for (const auto& resource : m_update.resources)
+            resource->compress(compressionLevel);
+        SingleSceneUpdateWriter::SerializeDescriptions(m_update, m_descriptions);
     }
 
     bool SceneUpdateSerializer::writeToPackets(absl::Span<Byte> packetMem, const std::function<bool(size_t)>& writeDoneFunc) const
     {
-        SingleSceneUpdateWriter writer(m_update, packetMem, writeDoneFunc);
+        SingleSceneUpdateWriter writer(m_update, m_descriptions, packetMem, writeDoneFunc);
         return writer.write();
     }
 
@@ -56,7 +56,10 @@ namespace ramses_internal
         while (is.getCurrentReadBytes() < data.size())
         {
             if (m_currentBlockSize != 0)
-                continueReadingBlock(is, data.size());
+            {
+                if (!continueReadingBlock(is, data.size()))
+                    return fail();
+            }
             else
             {
                 if (!startReadingNewBlock(is, data.size()))
@@ -64,7 +67,7 @@ namespace ramses_internal
             }
 
             // check if read full block
-            if (m_currentBlock.size() == m_currentBlockSize)
+            if (m_currentBlockRead == m_currentBlockSize)
             {
                 if (!finalizeBlock())
                     return fail();
@@ -74,13 +77,16 @@ namespace ramses_internal
         // check if done with update
         if (m_nextExpectedPacketNum == 1)
         {
-            if (!m_currentBlock.empty() || m_currentBlockSize != 0)
+            if (m_currentBlockRead != 0 || m_currentBlockSize != 0)
             {
                 LOG_ERROR_P(CONTEXT_FRAMEWORK, "SceneUpdateStreamDeserializer::processData: Last packet but data left to read (read {}, needed {}, type {})",
-                            m_currentBlock.size(), m_currentBlockSize, m_blockType);
+                            m_currentBlockRead, m_currentBlockSize, m_blockType);
                 return fail();
             }
 
+            // resumable resources are only expected in the update resent after interruption
+            m_resumableResources.clear();
+
             Result toReturn = std::move(m_currentResult);
             toReturn.result = ResultType::HasData;
             m_currentResult = Result{ResultType::Empty, SceneActionCollection(), {}, {}};
@@ -90,16 +96,119 @@ namespace ramses_internal
         return Result{ResultType::Empty, SceneActionCollection(), {}, {}};
     }
 
-    void SceneUpdateStreamDeserializer::continueReadingBlock(BinaryInputStream& is, size_t dataSize)
+    std::vector<std::unique_ptr<IResource>> SceneUpdateStreamDeserializer::takeResourcesOfIncompleteUpdate()
     {
-        assert(m_currentBlockSize > m_currentBlock.size());
+        std::vector<std::unique_ptr<IResource>> resources = std::move(m_currentResult.resources);
+        m_currentResult.resources.clear();
+        for (auto& resumableResource : m_resumableResources)
+            resources.push_back(std::move(resumableResource.second));
+        m_resumableResources.clear();
+        return resources;
+    }
+
+    void SceneUpdateStreamDeserializer::addResumableResources(std::vector<std::unique_ptr<IResource>> resources)
+    {
+        for (auto& resource : resources)
+        {
+            if (resource)
+            {
+                const ResourceContentHash hash = resource->getHash();
+                m_resumableResources[hash] = std::move(resource);
+            }
+        }
+    }
+
+    bool SceneUpdateStreamDeserializer::continueReadingBlock(BinaryInputStream& is, size_t dataSize)
+    {
+        assert(m_currentBlockSize > m_currentBlockRead);
 
         const size_t remainingDatInPacket = dataSize - is.getCurrentReadBytes();
-        const size_t remainingBytesToReadForBlock = m_currentBlockSize - m_currentBlock.size();
-        const size_t readBytes = std::min(remainingDatInPacket, remainingBytesToReadForBlock);
+        const size_t remainingBytesToReadForBlock = m_currentBlockSize - m_currentBlockRead;
+        size_t readBytes = std::min(remainingDatInPacket, remainingBytesToReadForBlock);
 
-        m_currentBlock.insert(m_currentBlock.end(), is.readPosition(), is.readPosition() + readBytes);
+        if (m_readingResourceData)
+        {
+            // store resource data in place, data of resumed resource is already there
+            if (!m_resumedResource)
+                PlatformMemory::Copy(m_resourceDataStorage.data() + m_resourceDataRead, is.readPosition(), readBytes);
+            m_resourceDataRead += static_cast<uint32_t>(readBytes);
+        }
+        else
+        {
+            if (static_cast<SingleSceneUpdateWriter::BlockType>(m_blockType) == SingleSceneUpdateWriter::BlockType::Resource)
+                readBytes = std::min(readBytes, getResourceBlockBytesBeforeData() - m_currentBlock.size());
+            m_currentBlock.insert(m_currentBlock.end(), is.readPosition(), is.readPosition() + readBytes);
+        }
         is.skip(readBytes);
+        m_currentBlockRead += static_cast<uint32_t>(readBytes);
+
+        if (!m_readingResourceData &&
+            static_cast<SingleSceneUpdateWriter::BlockType>(m_blockType) == SingleSceneUpdateWriter::BlockType::Resource)
+        {
+            if (m_currentBlock.size() == sizeof(uint32_t)*2)
+            {
+                // validate sizes before receiving (and allocating) anything else of the resource
+                BinaryInputStream headerStream(m_currentBlock.data());
+                uint32_t descSize = 0;
+                uint32_t resourceDataSize = 0;
+                headerStream >> descSize
+                             >> resourceDataSize;
+                if (sizeof(uint32_t)*2 + static_cast<uint64_t>(descSize) + resourceDataSize != m_currentBlockSize)
+                {
+                    LOG_ERROR_P(CONTEXT_FRAMEWORK, "SceneUpdateStreamDeserializer::continueReadingBlock: Resource block size {} does not match description size {} and data size {}",
+                                m_currentBlockSize, descSize, resourceDataSize);
+                    return false;
+                }
+            }
+            if (m_currentBlock.size() == getResourceBlockBytesBeforeData())
+                return startReadingResourceData();
+        }
+
+        return true;
+    }
+
+    size_t SceneUpdateStreamDeserializer::getResourceBlockBytesBeforeData() const
+    {
+        if (m_currentBlock.size() < sizeof(uint32_t)*2)
+            return sizeof(uint32_t)*2;
+        BinaryInputStream is(m_currentBlock.data());
+        uint32_t descSize = 0;
+        is >> descSize;
+        return sizeof(uint32_t)*2 + descSize;
+    }
+
+    bool SceneUpdateStreamDeserializer::startReadingResourceData()
+    {
+        BinaryInputStream is(m_currentBlock.data());
+        uint32_t descSize = 0;
+        uint32_t dataSize = 0;
+        is >> descSize
+           >> dataSize;
+        if (descSize < sizeof(ResourceContentHash))
+        {
+            LOG_ERROR_P(CONTEXT_FRAMEWORK, "SceneUpdateStreamDeserializer::startReadingResourceData: Resource description too small ({})", descSize);
+            return false;
+        }
+
+        m_incompleteResource = ResourceSerialization::DeserializeDescription(absl::Span<const Byte>(is.readPosition(), descSize), dataSize);
+        if (!m_incompleteResource.resource)
+            return false;
+
+        auto resumableIt = m_resumableResources.find(m_incompleteResource.hash);
+        if (resumableIt != m_resumableResources.end())
+        {
+            m_resumedResource = std::move(resumableIt->second);
+            m_resumableResources.erase(resumableIt);
+            m_incompleteResource = ResourceSerialization::IncompleteResource();
+            ++m_currentResult.resumedResources;
+        }
+        else
+            m_resourceDataStorage = ResourceSerialization::AllocateData(m_incompleteResource);
+
+        m_currentBlock.clear();
+        m_resourceDataRead = 0;
+        m_readingResourceData = true;
+        return true;
     }
 
     bool SceneUpdateStreamDeserializer::startReadingNewBlock(BinaryInputStream& is, size_t dataSize)
@@ -115,6 +224,7 @@ namespace ramses_internal
 
         is >> m_blockType
            >> m_currentBlockSize;
+        m_currentBlockRead = 0;
 
         return true;
     }
@@ -146,6 +256,7 @@ namespace ramses_internal
 
         m_currentBlock.clear();
         m_currentBlockSize = 0;
+        m_currentBlockRead = 0;
         return true;
     }
 
@@ -174,29 +285,41 @@ namespace ramses_internal
         is >> descSize
            >> dataSize;
 
-        m_currentResult.actions = SceneActionSerialization::Deserialize(absl::Span<const Byte>(is.readPosition(), descSize),
-                                                                        absl::Span<const Byte>(is.readPosition() + descSize, dataSize));
+        if (static_cast<uint64_t>(descSize) + dataSize > m_currentBlock.size() - sizeof(uint32_t)*2)
+        {
+            LOG_ERROR_P(CONTEXT_FRAMEWORK, "SceneUpdateStreamDeserializer::handleSceneActionCollection: Description ({}) and data ({}) exceed block size ({})",
+                        descSize, dataSize, m_currentBlock.size());
+            return false;
+        }
+        if (!SceneActionSerialization::Deserialize(absl::Span<const Byte>(is.readPosition(), descSize),
+                                                   absl::Span<const Byte>(is.readPosition() + descSize, dataSize),
+                                                   m_currentResult.actions))
+        {
+            LOG_ERROR_P(CONTEXT_FRAMEWORK, "SceneUpdateStreamDeserializer::handleSceneActionCollection: Invalid SceneActionCollection description ({} bytes) for {} bytes data",
+                        descSize, dataSize);
+            return false;
+        }
         return true;
     }
 
     bool SceneUpdateStreamDeserializer::handleResource()
     {
-        if (m_currentBlock.size() < sizeof(uint32_t)*2)
+        if (!m_readingResourceData)
         {
-            LOG_ERROR_P(CONTEXT_FRAMEWORK, "SceneUpdateStreamDeserializer::handleResource: Block to small ({})", m_currentBlock.size());
+            LOG_ERROR_P(CONTEXT_FRAMEWORK, "SceneUpdateStreamDeserializer::handleResource: Block to small ({})", m_currentBlockSize);
             return false;
         }
 
-        BinaryInputStream is(m_currentBlock.data());
-        uint32_t descSize = 0;
-        uint32_t dataSize = 0;
-        is >> descSize
-           >> dataSize;
+        if (m_resumedResource)
+            m_currentResult.resources.push_back(std::move(m_resumedResource));
+        else
+            m_currentResult.resources.push_back(ResourceSerialization::Finalize(std::move(m_incompleteResource)));
 
-        m_currentResult.resources.push_back(ResourceSerialization::Deserialize(absl::Span<const Byte>(is.readPosition(), descSize),
-                                                                               absl::Span<const Byte>(is.readPosition() + descSize, dataSize)));
+        m_incompleteResource = ResourceSerialization::IncompleteResource();
+        m_resourceDataStorage = {};
+        m_resourceDataRead = 0;
+        m_readingResourceData = false;
         return true;
-
     }
 
     bool SceneUpdateStreamDeserializer::handleFlushInfos()
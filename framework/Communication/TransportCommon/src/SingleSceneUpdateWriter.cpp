@@ -9,11 +9,30 @@
 #include "TransportCommon/SingleSceneUpdateWriter.h"
 #include "TransportCommon/SceneUpdateSerializationHelper.h"
 #include "Utils/LogMacros.h"
+#include <cassert>
 
 namespace ramses_internal
 {
-    SingleSceneUpdateWriter::SingleSceneUpdateWriter(const SceneUpdate& update, absl::Span<Byte> packetMem, const std::function<bool(size_t)>& writeDoneFunc)
+    void SingleSceneUpdateWriter::SerializeDescriptions(const SceneUpdate& update, Descriptions& descriptions)
+    {
+        descriptions.actions.clear();
+        SceneActionSerialization::SerializeDescription(update.actions, descriptions.actions);
+
+        descriptions.resources.resize(update.resources.size());
+        for (size_t i = 0; i < update.resources.size(); ++i)
+        {
+            descriptions.resources[i].clear();
+            ResourceSerialization::SerializeDescription(*update.resources[i], descriptions.resources[i]);
+        }
+
+        descriptions.flushInfos.clear();
+        if (update.flushInfos.containsValidInformation)
+            FlushInformationSerialization::SerializeInfos(update.flushInfos, descriptions.flushInfos);
+    }
+
+    SingleSceneUpdateWriter::SingleSceneUpdateWriter(const SceneUpdate& update, const Descriptions& descriptions, absl::Span<Byte> packetMem, const std::function<bool(size_t)>& writeDoneFunc)
         : m_update(update)
+        , m_descriptions(descriptions)
         , m_packetMem(packetMem)
         , m_writeDoneFunc(writeDoneFunc)
         , m_packetWriter(m_packetMem.data(), static_cast<uint32_t>(m_packetMem.size()))
@@ -58,14 +77,15 @@ namespace ramses_internal
         if (!writeSceneActionCollection())
             return false;
 
-        for (const auto& res : m_update.resources)
+        assert(m_descriptions.resources.size() == m_update.resources.size());
+        for (size_t i = 0; i < m_update.resources.size(); ++i)
         {
-            if (!writeResource(*res))
+            if (!writeResource(*m_update.resources[i], m_descriptions.resources[i]))
                 return false;
         }
 
         if (m_update.flushInfos.containsValidInformation)
-            if (!writeFlushInfos(m_update.flushInfos))
+            if (!writeFlushInfos())
                 return false;
 
         if (m_packetWriter.getBytesWritten() > 0)
@@ -79,8 +99,7 @@ namespace ramses_internal
 
     bool SingleSceneUpdateWriter::writeSceneActionCollection()
     {
-        m_temporaryMemToSerializeDescription.clear();
-        const auto descSpan = SceneActionSerialization::SerializeDescription(m_update.actions, m_temporaryMemToSerializeDescription);
+        const absl::Span<const Byte> descSpan = m_descriptions.actions;
         const auto dataSpan = SceneActionSerialization::SerializeData(m_update.actions);
 
         Byte header[sizeof(uint32_t)*2];
@@ -90,10 +109,9 @@ namespace ramses_internal
         return writeBlock(BlockType::SceneActionCollection, {{os.getData(), os.getSize()}, descSpan, dataSpan});
     }
 
-    bool SingleSceneUpdateWriter::writeResource(const IResource& res)
+    bool SingleSceneUpdateWriter::writeResource(const IResource& res, const std::vector<Byte>& description)
     {
-        m_temporaryMemToSerializeDescription.clear();
-        const auto descSpan = ResourceSerialization::SerializeDescription(res, m_temporaryMemToSerializeDescription);
+        const absl::Span<const Byte> descSpan = description;
         const auto dataSpan = ResourceSerialization::SerializeData(res);
 
         Byte header[sizeof(uint32_t)*2];
@@ -103,10 +121,9 @@ namespace ramses_internal
         return writeBlock(BlockType::Resource, {{os.getData(), os.getSize()}, descSpan, dataSpan});
     }
 
-    bool SingleSceneUpdateWriter::writeFlushInfos(const FlushInformation& infos)
+    bool SingleSceneUpdateWriter::writeFlushInfos()
     {
-        m_temporaryMemToSerializeDescription.clear();
-        const auto descSpan = FlushInformationSerialization::SerializeInfos(infos, m_temporaryMemToSerializeDescription);
+        const absl::Span<const Byte> descSpan = m_descriptions.flushInfos;
 
         Byte header[sizeof(uint32_t)];
         RawBinaryOutputStream os(header, sizeof(header));
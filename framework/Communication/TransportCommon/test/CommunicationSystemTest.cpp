@@ -11,6 +11,7 @@
 #include "ConnectionSystemTestHelper.h"
 #include "Components/SceneUpdate.h"
 #include "TransportCommon/SceneUpdateSerializer.h"
+#include "SceneUpdateSerializerTestHelper.h"
 
 namespace ramses_internal
 {
@@ -183,6 +184,166 @@ namespace ramses_internal
         state->disconnectAll();
     }
 
+    TEST_P(ACommunicationSystemWithDaemon, gathersBurstOfMessagesIntoFewerSocketWrites)
+    {
+        if (state->communicationSystemType == ECommunicationSystemType::GenericSomeIP)
+            GTEST_SKIP();
+
+        auto sender = std::make_unique<CommunicationSystemTestWrapper>(*state, "sender");
+        auto receiver = std::make_unique<CommunicationSystemTestWrapper>(*state, "receiver");
+
+        state->connectAll();
+        ASSERT_TRUE(state->blockOnAllConnected());
+
+        StrictMock<SceneProviderServiceHandlerMock> handler;
+        receiver->commSystem->setSceneProviderServiceHandler(&handler);
+
+        constexpr uint32_t numMessages = 200u;
+        std::vector<SceneId> received;
+        {
+            PlatformGuard g(receiver->frameworkLock);
+            EXPECT_CALL(handler, handleSubscribeScene(_, sender->id)).Times(numMessages).WillRepeatedly(Invoke([&](const SceneId& sceneId, const Guid&) {
+                received.push_back(sceneId);
+                state->sendEvent();
+            }));
+        }
+        {
+            PlatformGuard g(sender->frameworkLock);
+            sender->statisticCollection.statSocketWrites.reset();
+            sender->statisticCollection.statSocketBytesSent.reset();
+            for (uint32_t i = 0u; i < numMessages; ++i)
+                EXPECT_TRUE(sender->commSystem->sendSubscribeScene(receiver->id, SceneId(i)));
+        }
+        ASSERT_TRUE(state->event.waitForEvents(numMessages));
+
+        // order is kept and messages were written together
+        for (uint32_t i = 0u; i < numMessages; ++i)
+            EXPECT_EQ(SceneId(i), received[i]);
+        EXPECT_GT(sender->statisticCollection.statSocketWrites.getCounterValue(), 0u);
+        EXPECT_LT(sender->statisticCollection.statSocketWrites.getCounterValue(), numMessages);
+        EXPECT_GT(sender->statisticCollection.statSocketBytesSent.getCounterValue(), numMessages * sizeof(SceneId));
+
+        state->disconnectAll();
+    }
+
+    TEST_P(ACommunicationSystemWithDaemon, canSendLargeSceneUpdateToConnectedParticipant)
+    {
+        auto sender = std::make_unique<CommunicationSystemTestWrapper>(*state, "sender");
+        auto receiver = std::make_unique<CommunicationSystemTestWrapper>(*state, "receiver");
+
+        state->connectAll();
+        ASSERT_TRUE(state->blockOnAllConnected());
+
+        StrictMock<SceneRendererServiceHandlerMock> handler;
+        receiver->commSystem->setSceneRendererServiceHandler(&handler);
+
+        // enough data to wrap around any intermediate buffer
+        constexpr uint32_t numPackets = 40u;
+        const auto packetContent = [](uint32_t packet, size_t idx) { return static_cast<Byte>(packet * 31u + idx); };
+        std::vector<size_t> sentSizes;
+        StrictMock<SceneUpdateSerializerMock> serializer;
+        EXPECT_CALL(serializer, writeToPackets(_, _)).WillOnce(Invoke([&](absl::Span<Byte> packetMem, const std::function<bool(size_t)>& writeDoneFunc) {
+            for (uint32_t packet = 0u; packet < numPackets; ++packet)
+            {
+                const size_t size = packetMem.size() - packet * 1000u;
+                for (size_t i = 0u; i < size; ++i)
+                    packetMem[i] = packetContent(packet, i);
+                sentSizes.push_back(size);
+                if (!writeDoneFunc(size))
+                    return false;
+            }
+            return true;
+        }));
+
+        SceneId sceneId(123);
+        std::vector<std::vector<Byte>> received;
+        {
+            PlatformGuard g(receiver->frameworkLock);
+            EXPECT_CALL(handler, handleSceneUpdate(sceneId, _, sender->id)).Times(numPackets).WillRepeatedly(Invoke([&](const SceneId&, absl::Span<const Byte> data, const Guid&) {
+                received.emplace_back(data.begin(), data.end());
+                state->sendEvent();
+            }));
+        }
+        {
+            PlatformGuard g(sender->frameworkLock);
+            EXPECT_TRUE(sender->commSystem->sendSceneUpdate(receiver->id, sceneId, serializer));
+        }
+        ASSERT_TRUE(state->event.waitForEvents(numPackets));
+
+        state->disconnectAll();
+
+        ASSERT_EQ(numPackets, received.size());
+        for (uint32_t packet = 0u; packet < numPackets; ++packet)
+        {
+            ASSERT_EQ(sentSizes[packet], received[packet].size());
+            for (size_t i = 0u; i < received[packet].size(); ++i)
+                ASSERT_EQ(packetContent(packet, i), received[packet][i]);
+        }
+    }
+
+    TEST_P(ACommunicationSystemWithDaemon, smallSceneUpdateOvertakesLargeSceneUpdateOfOtherScene)
+    {
+        if (state->communicationSystemType == ECommunicationSystemType::GenericSomeIP)
+            GTEST_SKIP();
+
+        auto sender = std::make_unique<CommunicationSystemTestWrapper>(*state, "sender");
+        auto receiver = std::make_unique<CommunicationSystemTestWrapper>(*state, "receiver");
+
+        state->connectAll();
+        ASSERT_TRUE(state->blockOnAllConnected());
+
+        StrictMock<SceneRendererServiceHandlerMock> handler;
+        receiver->commSystem->setSceneRendererServiceHandler(&handler);
+
+        // more data than socket and shared memory can buffer while receiver is blocked
+        constexpr uint32_t numPackets = 150u;
+        StrictMock<SceneUpdateSerializerMock> largeSerializer;
+        EXPECT_CALL(largeSerializer, writeToPackets(_, _)).WillOnce(Invoke([&](absl::Span<Byte> packetMem, const std::function<bool(size_t)>& writeDoneFunc) {
+            for (uint32_t packet = 0u; packet < numPackets; ++packet)
+            {
+                std::fill(packetMem.begin(), packetMem.end(), static_cast<Byte>(packet));
+                if (!writeDoneFunc(packetMem.size()))
+                    return false;
+            }
+            return true;
+        }));
+        const std::vector<Byte> smallData{ 1, 2, 3 };
+        StrictMock<SceneUpdateSerializerMock> smallSerializer;
+        EXPECT_CALL(smallSerializer, writeToPackets(_, _)).WillOnce(Invoke([&](absl::Span<Byte> packetMem, const std::function<bool(size_t)>& writeDoneFunc) {
+            std::copy(smallData.begin(), smallData.end(), packetMem.begin());
+            return writeDoneFunc(smallData.size());
+        }));
+
+        const SceneId largeSceneId(123);
+        const SceneId smallSceneId(124);
+        std::vector<SceneId> received;
+        {
+            // blocking the receiver stalls the sender once all buffers are full
+            PlatformGuard receiverGuard(receiver->frameworkLock);
+            EXPECT_CALL(handler, handleSceneUpdate(largeSceneId, _, sender->id)).Times(numPackets).WillRepeatedly(Invoke([&](const SceneId& sceneId, absl::Span<const Byte>, const Guid&) {
+                received.push_back(sceneId);
+                state->sendEvent();
+            }));
+            EXPECT_CALL(handler, handleSceneUpdate(smallSceneId, _, sender->id)).WillOnce(Invoke([&](const SceneId& sceneId, absl::Span<const Byte> data, const Guid&) {
+                EXPECT_EQ(smallData, std::vector<Byte>(data.begin(), data.end()));
+                received.push_back(sceneId);
+                state->sendEvent();
+            }));
+
+            PlatformGuard senderGuard(sender->frameworkLock);
+            EXPECT_TRUE(sender->commSystem->sendSceneUpdate(receiver->id, largeSceneId, largeSerializer));
+            EXPECT_TRUE(sender->commSystem->sendSceneUpdate(receiver->id, smallSceneId, smallSerializer));
+        }
+        ASSERT_TRUE(state->event.waitForEvents(numPackets + 1u));
+
+        state->disconnectAll();
+
+        ASSERT_EQ(numPackets + 1u, received.size());
+        const auto smallIt = std::find(received.begin(), received.end(), smallSceneId);
+        ASSERT_TRUE(smallIt != received.end());
+        EXPECT_LT(static_cast<size_t>(smallIt - received.begin()), numPackets);
+    }
+
     TEST_P(ACommunicationSystemWithDaemon, canConnectAndDisconnectMultipleTimes)
     {
         auto csw = std::make_unique<CommunicationSystemTestWrapper>(*state);
@@ -26,6 +26,9 @@ namespace ramses_internal
         case ECommunicationSystemType::Tcp:
             *os << "ECommunicationSystemType::Tcp";
             return;
+        case ECommunicationSystemType::TcpSharedMemory:
+            *os << "ECommunicationSystemType::TcpSharedMemory";
+            return;
         case ECommunicationSystemType::GenericSomeIP:
             *os << "ECommunicationSystemType::GenericSomeIP";
             return;
@@ -103,6 +106,7 @@ namespace ramses_internal
         std::vector<ECommunicationSystemType> ret;
 #if defined(HAS_TCP_COMM)
         ret.push_back(ECommunicationSystemType::Tcp);
+        ret.push_back(ECommunicationSystemType::TcpSharedMemory);
 #endif
         return ret;
     }
@@ -113,6 +117,7 @@ namespace ramses_internal
     {
         ramses::RamsesFrameworkConfigImpl config(0, nullptr);
         config.enableProtocolVersionOffset();
+        config.m_tcpConfig.setSharedMemoryTransportEnabled(state.communicationSystemType == ECommunicationSystemType::TcpSharedMemory);
 
         commSystem = CommunicationSystemFactory::ConstructCommunicationSystem(config, ParticipantIdentifier(id, name), frameworkLock, statisticCollection);
         state.knownCommunicationSystems.push_back(this);
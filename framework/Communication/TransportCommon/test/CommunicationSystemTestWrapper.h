@@ -24,6 +24,7 @@ namespace ramses_internal
     enum class ECommunicationSystemType
     {
         Tcp,
+        TcpSharedMemory,
         GenericSomeIP,
     };
 
@@ -20,7 +20,19 @@ namespace ramses_internal
         {
             const absl::Span<const Byte> desc = SceneActionSerialization::SerializeDescription(actions, workingMem);
             const absl::Span<const Byte> data = SceneActionSerialization::SerializeData(actions);
-            return SceneActionSerialization::Deserialize(desc, data);
+            SceneActionCollection result;
+            EXPECT_TRUE(SceneActionSerialization::Deserialize(desc, data, result));
+            return result;
+        }
+
+        static SceneActionCollection CreateTestActions(ESceneActionEncoding encoding)
+        {
+            SceneActionCollection actions(encoding);
+            actions.beginWriteSceneAction(ESceneActionId::TestAction);
+            actions.write(static_cast<uint32_t>(123));
+            actions.beginWriteSceneAction(ESceneActionId::AllocateNode);
+            actions.write(String("foobar"));
+            return actions;
         }
 
         std::vector<Byte> workingMem;
@@ -44,6 +56,110 @@ namespace ramses_internal
         EXPECT_EQ(in, SerializeDeserialize(in));
     }
 
+    TEST_F(ASceneActionSerialization, canSerializeDeserializeCompactCollectionWithData)
+    {
+        SceneActionCollection in(ESceneActionEncoding::Compact);
+        in.beginWriteSceneAction(ESceneActionId::TestAction);
+        in.write(static_cast<uint32_t>(123));
+        in.write(static_cast<uint32_t>(456789));
+        in.beginWriteSceneAction(ESceneActionId::AllocateNode);
+        in.write(String("foobar"));
+        in.beginWriteSceneAction(ESceneActionId::ReleaseNode);
+
+        const SceneActionCollection out = SerializeDeserialize(in);
+        EXPECT_EQ(ESceneActionEncoding::Compact, out.getEncoding());
+        EXPECT_EQ(in, out);
+    }
+
+    TEST_F(ASceneActionSerialization, compactCollectionHasSmallerDescription)
+    {
+        SceneActionCollection fixed;
+        SceneActionCollection compact(ESceneActionEncoding::Compact);
+        for (uint32_t i = 0u; i < 100u; ++i)
+        {
+            fixed.beginWriteSceneAction(ESceneActionId::TestAction);
+            fixed.write(i);
+            compact.beginWriteSceneAction(ESceneActionId::TestAction);
+            compact.write(i);
+        }
+
+        std::vector<Byte> compactWorkingMem;
+        const auto fixedDescriptionSize = SceneActionSerialization::SerializeDescription(fixed, workingMem).size();
+        const auto compactDescriptionSize = SceneActionSerialization::SerializeDescription(compact, compactWorkingMem).size();
+        // type id of TestAction needs two bytes, offset delta one byte
+        EXPECT_EQ(sizeof(uint32_t) + sizeof(uint8_t) + 100u * 2u * sizeof(uint32_t), fixedDescriptionSize);
+        EXPECT_EQ(sizeof(uint32_t) + sizeof(uint8_t) + 100u * 3u, compactDescriptionSize);
+    }
+
+    TEST_F(ASceneActionSerialization, failsDeserializeWithUnknownEncoding)
+    {
+        const SceneActionCollection in = CreateTestActions(ESceneActionEncoding::Compact);
+        const absl::Span<const Byte> desc = SceneActionSerialization::SerializeDescription(in, workingMem);
+        std::vector<Byte> invalidDesc(desc.begin(), desc.end());
+        invalidDesc[sizeof(uint32_t)] = static_cast<Byte>(ESceneActionEncoding::Compact) + 1u;
+
+        SceneActionCollection out;
+        EXPECT_FALSE(SceneActionSerialization::Deserialize(invalidDesc, SceneActionSerialization::SerializeData(in), out));
+        EXPECT_TRUE(out.empty());
+    }
+
+    TEST_F(ASceneActionSerialization, failsDeserializeWithTooSmallDescription)
+    {
+        const SceneActionCollection in = CreateTestActions(ESceneActionEncoding::Fixed);
+        const absl::Span<const Byte> data = SceneActionSerialization::SerializeData(in);
+        SceneActionCollection out;
+        EXPECT_FALSE(SceneActionSerialization::Deserialize({}, data, out));
+        const std::vector<Byte> onlyNumActions(sizeof(uint32_t), 0u);
+        EXPECT_FALSE(SceneActionSerialization::Deserialize(onlyNumActions, data, out));
+    }
+
+    TEST_F(ASceneActionSerialization, failsDeserializeWithTruncatedDescription)
+    {
+        for (const auto encoding : { ESceneActionEncoding::Fixed, ESceneActionEncoding::Compact })
+        {
+            workingMem.clear();
+            const SceneActionCollection in = CreateTestActions(encoding);
+            const absl::Span<const Byte> desc = SceneActionSerialization::SerializeDescription(in, workingMem);
+            SceneActionCollection out;
+            EXPECT_FALSE(SceneActionSerialization::Deserialize(desc.subspan(0, desc.size() - 1), SceneActionSerialization::SerializeData(in), out));
+        }
+    }
+
+    TEST_F(ASceneActionSerialization, failsDeserializeWithUnterminatedVarInt)
+    {
+        const SceneActionCollection in = CreateTestActions(ESceneActionEncoding::Compact);
+        const absl::Span<const Byte> desc = SceneActionSerialization::SerializeDescription(in, workingMem);
+        std::vector<Byte> invalidDesc(desc.begin(), desc.end());
+        invalidDesc.back() |= 0x80u;
+
+        SceneActionCollection out;
+        EXPECT_FALSE(SceneActionSerialization::Deserialize(invalidDesc, SceneActionSerialization::SerializeData(in), out));
+    }
+
+    TEST_F(ASceneActionSerialization, failsDeserializeWithTrailingDescriptionBytes)
+    {
+        const SceneActionCollection in = CreateTestActions(ESceneActionEncoding::Compact);
+        const absl::Span<const Byte> desc = SceneActionSerialization::SerializeDescription(in, workingMem);
+        std::vector<Byte> invalidDesc(desc.begin(), desc.end());
+        invalidDesc.push_back(0u);
+
+        SceneActionCollection out;
+        EXPECT_FALSE(SceneActionSerialization::Deserialize(invalidDesc, SceneActionSerialization::SerializeData(in), out));
+    }
+
+    TEST_F(ASceneActionSerialization, failsDeserializeWithOffsetsBeyondData)
+    {
+        for (const auto encoding : { ESceneActionEncoding::Fixed, ESceneActionEncoding::Compact })
+        {
+            workingMem.clear();
+            const SceneActionCollection in = CreateTestActions(encoding);
+            const absl::Span<const Byte> desc = SceneActionSerialization::SerializeDescription(in, workingMem);
+            const absl::Span<const Byte> data = SceneActionSerialization::SerializeData(in);
+            // second action starts behind first action's data
+            SceneActionCollection out;
+            EXPECT_FALSE(SceneActionSerialization::Deserialize(desc, data.subspan(0, in[1].offsetInCollection() - 1), out));
+        }
+    }
 
     class AResourceSerialization : public ::testing::Test
     {
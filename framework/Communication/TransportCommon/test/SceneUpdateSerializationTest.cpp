@@ -8,6 +8,7 @@
 
 #include "TransportCommon/SceneUpdateSerializer.h"
 #include "TransportCommon/SceneUpdateStreamDeserializer.h"
+#include "TransportCommon/SingleSceneUpdateWriter.h"
 #include "Components/SceneUpdate.h"
 #include "Scene/SceneActionCollection.h"
 #include "gtest/gtest.h"
@@ -152,6 +153,36 @@ namespace ramses_internal
         expectDeserializeToSame();
     }
 
+    TEST_F(ASceneUpdateSerialization, compressesResourcesWithGivenLevelWhenCreated)
+    {
+        update.resources.push_back(CreateTestResource(100000));
+        SceneUpdateSerializer uncompressed(update);
+        EXPECT_FALSE(update.resources[0]->isCompressedAvailable());
+
+        SceneUpdateSerializer sus(update, IResource::CompressionLevel::REALTIME);
+        EXPECT_TRUE(update.resources[0]->isCompressedAvailable());
+    }
+
+    TEST_F(ASceneUpdateSerialization, canWriteSameSerializerMultipleTimesWithDifferentPacketSizes)
+    {
+        addTestActions();
+        update.resources.push_back(CreateTestResource(1000));
+        addFlushInformation();
+        const SceneUpdateSerializer sus(update);
+
+        for (const size_t pktSize : { 100u, 333u })
+        {
+            data.clear();
+            std::vector<Byte> vec(pktSize);
+            EXPECT_TRUE(sus.writeToPackets({vec.data(), vec.size()}, [&](size_t s) {
+                data.push_back(vec);
+                data.back().resize(s);
+                return true;
+            }));
+            expectDeserializeToSame();
+        }
+    }
+
     TEST_F(ASceneUpdateSerialization, canSerializeDeserializeFlushInformation)
     {
         addFlushInformation();
@@ -286,6 +317,69 @@ namespace ramses_internal
         }
     }
 
+    TEST_F(ASceneUpdateSerialization, resumesResourcesReceivedBeforeUpdateWasInterrupted)
+    {
+        update.resources.push_back(CreateTestResource(100));
+        update.resources.push_back(CreateTestResource(200));
+        update.resources.push_back(CreateTestResource(1000));
+        addTestActions();
+        EXPECT_TRUE(serialize(100));
+
+        // last packet holds end of last resource
+        for (size_t i = 0; i + 1 < data.size(); ++i)
+            EXPECT_EQ(SceneUpdateStreamDeserializer::ResultType::Empty, deser.processData(data[i]).result);
+        std::vector<std::unique_ptr<IResource>> receivedResources = deser.takeResourcesOfIncompleteUpdate();
+        ASSERT_EQ(2u, receivedResources.size());
+        EXPECT_EQ(update.resources[0]->getHash(), receivedResources[0]->getHash());
+        EXPECT_EQ(update.resources[1]->getHash(), receivedResources[1]->getHash());
+
+        deser = SceneUpdateStreamDeserializer();
+        deser.addResumableResources(std::move(receivedResources));
+        const auto result = deserialize();
+        compare(result);
+        EXPECT_EQ(2u, result.resumedResources);
+    }
+
+    TEST_F(ASceneUpdateSerialization, discardsResumableResourcesNotPartOfNextUpdate)
+    {
+        std::vector<std::unique_ptr<IResource>> resumableResources;
+        resumableResources.emplace_back(new ArrayResource(EResourceType_VertexArray, 10, EDataType::Vector3F, nullptr, ResourceCacheFlag(15u), "resName"));
+        ResourceSerializationTestHelper::SetResourceDataRandom(*resumableResources.back(), 10);
+        deser.addResumableResources(std::move(resumableResources));
+
+        update.resources.push_back(CreateTestResource(100));
+        EXPECT_TRUE(serialize(100));
+        const auto result = deserialize();
+        compare(result);
+        EXPECT_EQ(0u, result.resumedResources);
+        EXPECT_TRUE(deser.takeResourcesOfIncompleteUpdate().empty());
+    }
+
+    TEST_F(ASceneUpdateSerialization, failsOnResourceBlockWithInconsistentSizesBeforeReceivingItsData)
+    {
+        // packet header, resource block header of size 100 with description and data sizes not adding up
+        const uint32_t packet[] = { 1u, SingleSceneUpdateWriter::hasMorePacketsFlag, static_cast<uint32_t>(SingleSceneUpdateWriter::BlockType::Resource), 100u, 10u, 10u };
+        const Byte* packetData = reinterpret_cast<const Byte*>(packet);
+        EXPECT_EQ(SceneUpdateStreamDeserializer::ResultType::Failed, deser.processData(absl::Span<const Byte>(packetData, sizeof(packet))).result);
+    }
+
+    TEST_F(ASceneUpdateSerialization, failsOnSceneActionBlockWithSizesExceedingBlock)
+    {
+        // packet header, scene action block header of size 8 with description size 5 but no description following
+        const uint32_t packet[] = { 1u, SingleSceneUpdateWriter::lastPacketFlag, static_cast<uint32_t>(SingleSceneUpdateWriter::BlockType::SceneActionCollection), 8u, 5u, 0u };
+        const Byte* packetData = reinterpret_cast<const Byte*>(packet);
+        EXPECT_EQ(SceneUpdateStreamDeserializer::ResultType::Failed, deser.processData(absl::Span<const Byte>(packetData, sizeof(packet))).result);
+    }
+
+    TEST_F(ASceneUpdateSerialization, failsOnSceneActionBlockWithUnknownEncoding)
+    {
+        // packet header, scene action block header of size 13, description of 5 bytes without actions, no data
+        const uint32_t packetStart[] = { 1u, SingleSceneUpdateWriter::lastPacketFlag, static_cast<uint32_t>(SingleSceneUpdateWriter::BlockType::SceneActionCollection), 13u, 5u, 0u, 0u };
+        std::vector<Byte> packet(reinterpret_cast<const Byte*>(packetStart), reinterpret_cast<const Byte*>(packetStart) + sizeof(packetStart));
+        packet.push_back(static_cast<Byte>(ESceneActionEncoding::Compact) + 1u);
+        EXPECT_EQ(SceneUpdateStreamDeserializer::ResultType::Failed, deser.processData(packet).result);
+    }
+
     TEST_F(ASceneUpdateSerialization, failsDeserializeEmptyPacket)
     {
         const auto res = deser.processData({});
@@ -46,6 +46,11 @@ namespace ramses_internal
         DcsmForceUnregisterContent,
         DcsmUpdateContentMetadata,
 
+        // same host shared memory transport
+        SharedMemoryOffer,
+        SharedMemoryAnswer,
+        SharedMemoryPayload,
+
         NUM_ELEMENTS
     };
 
@@ -72,6 +77,9 @@ namespace ramses_internal
         "EMessageId::DcsmRequestUnregisterContent",
         "EMessageId::DcsmForceUnregisterContent",
         "EMessageId::DcsmUpdateContentMetadata",
+        "EMessageId::SharedMemoryOffer",
+        "EMessageId::SharedMemoryAnswer",
+        "EMessageId::SharedMemoryPayload",
     };
 
     inline IOutputStream& operator<<(IOutputStream& outputStream, EMessageId messageId)
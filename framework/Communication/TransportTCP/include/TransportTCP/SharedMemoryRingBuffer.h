@@ -0,0 +1,76 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2020 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#ifndef RAMSES_SHAREDMEMORYRINGBUFFER_H
+#define RAMSES_SHAREDMEMORYRINGBUFFER_H
+
+#include "PlatformAbstraction/PlatformTypes.h"
+#include "PlatformAbstraction/Macros.h"
+#include <string>
+#include <memory>
+
+namespace ramses_internal
+{
+    // Single producer / single consumer byte ring in a named shared memory object, used to pass
+    // message payloads between two processes on the same host without copying them through a socket.
+    // The producer writes a block and tells the consumer its offset and size by other means (the
+    // consumer never polls). The consumer releases blocks in the order they were written.
+    // Blocks are always contiguous in memory, the tail of the ring is skipped when a block does not fit.
+    class SharedMemoryRingBuffer final
+    {
+    public:
+        // Producer side: creates and maps a new shared memory object with a unique name.
+        // Returns nullptr when not supported on this platform or when creation fails.
+        static std::unique_ptr<SharedMemoryRingBuffer> Create(uint32_t capacity);
+        // Consumer side: maps an existing shared memory object created by Create with the same capacity.
+        // Refuses names that Create would never have produced.
+        static std::unique_ptr<SharedMemoryRingBuffer> Open(const std::string& name, uint32_t capacity);
+        static bool IsSupported();
+        // true when name has the form Create uses ("/ramses-<pid>-<counter>")
+        static bool IsValidName(const std::string& name);
+
+        ~SharedMemoryRingBuffer();
+
+        RNODISCARD const std::string& getName() const;
+        RNODISCARD uint32_t getCapacity() const;
+
+        // Removes the name of the shared memory object, existing mappings stay valid.
+        // Producer calls this as soon as the consumer has opened it (or will never do), so nothing leaks when a process dies.
+        void unlink();
+
+        // producer: copy data into the ring, returns false when there is not enough free space
+        RNODISCARD bool write(const Byte* data, uint32_t size, uint64_t& offset);
+
+        // consumer: returns the block written at offset or nullptr when offset and size do not describe
+        // a valid, not yet released block
+        RNODISCARD const Byte* getBlock(uint64_t offset, uint32_t size) const;
+        // consumer: make space of given block and all blocks before it available again to producer
+        void release(uint64_t offset, uint32_t size);
+
+        SharedMemoryRingBuffer(const SharedMemoryRingBuffer&) = delete;
+        SharedMemoryRingBuffer& operator=(const SharedMemoryRingBuffer&) = delete;
+
+    private:
+        struct Header;
+
+        SharedMemoryRingBuffer(std::string name, uint32_t capacity, void* mapping, bool isLinked);
+
+        const std::string m_name;
+        const uint32_t m_capacity;
+        void* const m_mapping;
+        Header* const m_header;
+        Byte* const m_data;
+        bool m_isLinked;
+
+        // own position is kept locally, the shared header only publishes it to the other side
+        uint64_t m_writeOffset = 0u;
+        uint64_t m_readOffset = 0u;
+    };
+}
+
+#endif
@@ -14,6 +14,7 @@
 #include "PlatformAbstraction/PlatformThread.h"
 #include "TransportTCP/NetworkParticipantAddress.h"
 #include "TransportTCP/EMessageId.h"
+#include "TransportTCP/SharedMemoryRingBuffer.h"
 #include "Utils/BinaryOutputStream.h"
 #include "Collections/HashSet.h"
 #include "Collections/HashMap.h"
@@ -31,7 +32,7 @@ namespace ramses_internal
     public:
         TCPConnectionSystem(const NetworkParticipantAddress& participantAddress, UInt32 protocolVersion, const NetworkParticipantAddress& daemonAddress, bool pureDaemon,
                             PlatformLock& frameworkLock, StatisticCollectionFramework& statisticCollection,
-                            std::chrono::milliseconds aliveInterval, std::chrono::milliseconds aliveTimeout);
+                            std::chrono::milliseconds aliveInterval, std::chrono::milliseconds aliveTimeout, bool sharedMemoryTransport);
         virtual ~TCPConnectionSystem() override;
 
         static Guid GetDaemonId();
@@ -121,6 +122,16 @@ namespace ramses_internal
             std::vector<Guid> to;
             EMessageId messageType;
             BinaryOutputStream stream;
+            // only for scene updates, messages of different scenes may be reordered
+            SceneId sceneId;
+            // order of scene messages within participant out queues
+            uint64_t sequence = 0u;
+        };
+
+        struct SceneUpdateQueue
+        {
+            SceneId sceneId;
+            std::deque<OutMessage> messages;
         };
 
         struct Participant
@@ -133,8 +144,17 @@ namespace ramses_internal
             asio::ip::tcp::socket socket;
             asio::steady_timer connectTimer;
 
-            std::deque<OutMessage> outQueue;
-            std::vector<Byte> currentOutBuffer;
+            // Messages waiting to be written. Control messages (connection handling, keep alive, DCSM) overtake
+            // scene traffic. Scene updates of different scenes are interleaved packet by packet, all other scene
+            // messages keep their order relative to each other and to all scene updates.
+            std::deque<OutMessage> outQueueControl;
+            std::deque<OutMessage> outQueueScene;
+            std::vector<SceneUpdateQueue> outQueueSceneUpdates;
+            size_t nextSceneUpdateQueue = 0u;
+            uint64_t nextOutSequence = 0u;
+            // messages currently written to socket by one gathering write
+            std::vector<std::vector<Byte>> currentOutBuffers;
+            std::vector<asio::const_buffer> currentOutBufferSequence;
 
             uint32_t lengthReceiveBuffer;
             std::vector<Byte> receiveBuffer;
@@ -146,6 +166,11 @@ namespace ramses_internal
 
             EParticipantType type;
             EParticipantState state;
+
+            // payload transport to participant on same host, socket only carries location in ring then
+            std::unique_ptr<SharedMemoryRingBuffer> sharedMemoryOut;
+            bool sharedMemoryOutAccepted = false;
+            std::unique_ptr<SharedMemoryRingBuffer> sharedMemoryIn;
         };
         using ParticipantPtr = std::shared_ptr<Participant>;
 
@@ -171,6 +196,12 @@ namespace ramses_internal
         void doAcceptIncomingConnections();
 
         void sendMessageToParticipant(const ParticipantPtr& pp, OutMessage msg);
+        void addMessageToCurrentOutBuffers(const ParticipantPtr& pp, OutMessage msg);
+        static void EnqueueOutMessage(Participant& p, OutMessage msg);
+        static std::deque<OutMessage>* SelectNextOutQueue(Participant& p, size_t& sceneUpdateQueueIndex);
+        static void OnSceneUpdateQueueServed(Participant& p, size_t sceneUpdateQueueIndex);
+        static bool HasQueuedOutMessages(const Participant& p);
+        void writeCurrentOutBuffers(const ParticipantPtr& pp);
         void removeParticipant(const ParticipantPtr& pp, bool reconnectWithBackoff = false);
         void addNewParticipantByAddress(const NetworkParticipantAddress& address);
         void initializeNewlyConnectedParticipant(const ParticipantPtr& pp);
@@ -179,14 +210,20 @@ namespace ramses_internal
         void updateLastReceivedTime(const ParticipantPtr& pp);
         void sendConnectorAddressExchangeMessagesForNewParticipant(const ParticipantPtr& newPp);
         void triggerConnectionUpdateNotification(Guid participant, EConnectionStatus status);
+        bool isParticipantOnSameHost(const ParticipantPtr& pp) const;
+        void offerSharedMemoryTransport(const ParticipantPtr& pp);
+        void moveMessageToSharedMemory(const ParticipantPtr& pp, OutMessage& msg);
 
         void handleConnectionDescriptionMessage(const ParticipantPtr& pp, BinaryInputStream& stream);
         void handleConnectorAddressExchange(const ParticipantPtr& pp, BinaryInputStream& stream);
+        void handleSharedMemoryOffer(const ParticipantPtr& pp, BinaryInputStream& stream);
+        void handleSharedMemoryAnswer(const ParticipantPtr& pp, BinaryInputStream& stream);
+        void handleSharedMemoryPayload(const ParticipantPtr& pp, BinaryInputStream& stream);
 
         void handleSubscribeScene(const ParticipantPtr& pp, BinaryInputStream& stream);
         void handleUnsubscribeScene(const ParticipantPtr& pp, BinaryInputStream& stream);
         void handleCreateScene(const ParticipantPtr& pp, BinaryInputStream& stream);
-        void handleSceneUpdate(const ParticipantPtr& pp, BinaryInputStream& stream);
+        void handleSceneUpdate(const ParticipantPtr& pp, BinaryInputStream& stream, size_t messageSize);
         void handlePublishScene(const ParticipantPtr& pp, BinaryInputStream& stream);
         void handleUnpublishScene(const ParticipantPtr& pp, BinaryInputStream& stream);
         void handleSceneNotAvailable(const ParticipantPtr& pp, BinaryInputStream& stream);
@@ -213,6 +250,7 @@ namespace ramses_internal
         const EParticipantType m_participantType;
         const std::chrono::milliseconds m_aliveInterval;
         const std::chrono::milliseconds m_aliveIntervalTimeout;
+        const bool m_sharedMemoryTransport;
 
         PlatformLock& m_frameworkLock;
         PlatformThread m_thread;
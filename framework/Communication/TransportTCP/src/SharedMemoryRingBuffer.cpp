@@ -0,0 +1,246 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2020 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "TransportTCP/SharedMemoryRingBuffer.h"
+#include <atomic>
+#include <cassert>
+#include <cstring>
+#include <new>
+
+namespace ramses_internal
+{
+    static_assert(ATOMIC_LLONG_LOCK_FREE == 2, "shared memory ring needs address free 64 bit atomics");
+
+    // producer and consumer position on separate cache lines, offsets only grow and are taken modulo capacity
+    struct SharedMemoryRingBuffer::Header
+    {
+        alignas(64) std::atomic<uint64_t> writeOffset{0u};
+        alignas(64) std::atomic<uint64_t> readOffset{0u};
+    };
+
+    SharedMemoryRingBuffer::SharedMemoryRingBuffer(std::string name, uint32_t capacity, void* mapping, bool isLinked)
+        : m_name(std::move(name))
+        , m_capacity(capacity)
+        , m_mapping(mapping)
+        , m_header(static_cast<Header*>(mapping))
+        , m_data(static_cast<Byte*>(mapping) + sizeof(Header))
+        , m_isLinked(isLinked)
+    {
+    }
+
+    namespace
+    {
+        const char* const NamePrefix = "/ramses-";
+
+        bool IsNumber(const std::string& str, size_t begin, size_t end)
+        {
+            if (begin >= end)
+                return false;
+            for (size_t i = begin; i < end; ++i)
+            {
+                if (str[i] < '0' || str[i] > '9')
+                    return false;
+            }
+            return true;
+        }
+    }
+
+    bool SharedMemoryRingBuffer::IsValidName(const std::string& name)
+    {
+        const size_t prefixLength = std::strlen(NamePrefix);
+        if (name.compare(0u, prefixLength, NamePrefix) != 0)
+            return false;
+        const size_t separator = name.find('-', prefixLength);
+        return separator != std::string::npos
+            && IsNumber(name, prefixLength, separator)
+            && IsNumber(name, separator + 1u, name.size());
+    }
+
+    const std::string& SharedMemoryRingBuffer::getName() const
+    {
+        return m_name;
+    }
+
+    uint32_t SharedMemoryRingBuffer::getCapacity() const
+    {
+        return m_capacity;
+    }
+
+    bool SharedMemoryRingBuffer::write(const Byte* data, uint32_t size, uint64_t& offset)
+    {
+        if (size == 0u || size > m_capacity)
+            return false;
+
+        uint64_t writeOffset = m_writeOffset;
+        const uint64_t readOffset = m_header->readOffset.load(std::memory_order_acquire);
+        assert(writeOffset >= readOffset && writeOffset - readOffset <= m_capacity);
+
+        // skip the tail of the ring if the block would wrap around
+        const uint32_t position = static_cast<uint32_t>(writeOffset % m_capacity);
+        const uint32_t padding = (position + uint64_t(size) > m_capacity) ? m_capacity - position : 0u;
+        if (writeOffset + padding + size - readOffset > m_capacity)
+            return false;
+
+        writeOffset += padding;
+        std::memcpy(m_data + writeOffset % m_capacity, data, size);
+        offset = writeOffset;
+
+        m_writeOffset = writeOffset + size;
+        m_header->writeOffset.store(m_writeOffset, std::memory_order_release);
+        return true;
+    }
+
+    const Byte* SharedMemoryRingBuffer::getBlock(uint64_t offset, uint32_t size) const
+    {
+        if (size == 0u || size > m_capacity || offset < m_readOffset)
+            return nullptr;
+
+        const uint64_t writeOffset = m_header->writeOffset.load(std::memory_order_acquire);
+        if (offset > writeOffset || writeOffset - offset < size)
+            return nullptr;
+
+        const uint32_t position = static_cast<uint32_t>(offset % m_capacity);
+        if (position + uint64_t(size) > m_capacity)
+            return nullptr;
+
+        return m_data + position;
+    }
+
+    void SharedMemoryRingBuffer::release(uint64_t offset, uint32_t size)
+    {
+        assert(offset >= m_readOffset);
+        m_readOffset = offset + size;
+        m_header->readOffset.store(m_readOffset, std::memory_order_release);
+    }
+}
+
+#if defined(__linux__) && !defined(__ANDROID__)
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <cerrno>
+
+namespace ramses_internal
+{
+    namespace
+    {
+        size_t GetMappingSize(uint32_t capacity)
+        {
+            return 2 * 64 + size_t(capacity);
+        }
+    }
+
+    std::unique_ptr<SharedMemoryRingBuffer> SharedMemoryRingBuffer::Create(uint32_t capacity)
+    {
+        static_assert(sizeof(Header) == 2 * 64, "unexpected header layout");
+        static std::atomic<uint32_t> counter{0u};
+
+        const size_t mappingSize = GetMappingSize(capacity);
+        std::string name;
+        int fd = -1;
+        for (int attempt = 0; attempt < 8 && fd < 0; ++attempt)
+        {
+            // a stale object of a crashed process with same pid might still exist, just use another name then
+            name = NamePrefix + std::to_string(::getpid()) + "-" + std::to_string(counter++);
+            fd = ::shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, S_IRUSR | S_IWUSR);
+            if (fd < 0 && errno != EEXIST)
+                return nullptr;
+        }
+        if (fd < 0)
+            return nullptr;
+
+        void* mapping = MAP_FAILED;  // NOLINT(cppcoreguidelines-pro-type-cstyle-cast) ignore cast in system macro
+        if (::ftruncate(fd, static_cast<off_t>(mappingSize)) == 0)
+            mapping = ::mmap(nullptr, mappingSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        // mapping stays valid after closing the descriptor
+        ::close(fd);
+        if (mapping == MAP_FAILED)  // NOLINT(cppcoreguidelines-pro-type-cstyle-cast) ignore cast in system macro
+        {
+            ::shm_unlink(name.c_str());
+            return nullptr;
+        }
+
+        new (mapping) Header();
+        return std::unique_ptr<SharedMemoryRingBuffer>(new SharedMemoryRingBuffer(std::move(name), capacity, mapping, true));
+    }
+
+    std::unique_ptr<SharedMemoryRingBuffer> SharedMemoryRingBuffer::Open(const std::string& name, uint32_t capacity)
+    {
+        if (!IsValidName(name))
+            return nullptr;
+
+        const size_t mappingSize = GetMappingSize(capacity);
+        const int fd = ::shm_open(name.c_str(), O_RDWR, 0);
+        if (fd < 0)
+            return nullptr;
+
+        struct stat fileStats;
+        if (fstat(fd, &fileStats) != 0 || static_cast<size_t>(fileStats.st_size) != mappingSize)
+        {
+            ::close(fd);
+            return nullptr;
+        }
+
+        void* mapping = ::mmap(nullptr, mappingSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        ::close(fd);
+        if (mapping == MAP_FAILED)  // NOLINT(cppcoreguidelines-pro-type-cstyle-cast) ignore cast in system macro
+            return nullptr;
+
+        return std::unique_ptr<SharedMemoryRingBuffer>(new SharedMemoryRingBuffer(name, capacity, mapping, false));
+    }
+
+    bool SharedMemoryRingBuffer::IsSupported()
+    {
+        return true;
+    }
+
+    SharedMemoryRingBuffer::~SharedMemoryRingBuffer()
+    {
+        unlink();
+        ::munmap(m_mapping, GetMappingSize(m_capacity));
+    }
+
+    void SharedMemoryRingBuffer::unlink()
+    {
+        if (m_isLinked)
+        {
+            ::shm_unlink(m_name.c_str());
+            m_isLinked = false;
+        }
+    }
+}
+
+#else
+
+namespace ramses_internal
+{
+    std::unique_ptr<SharedMemoryRingBuffer> SharedMemoryRingBuffer::Create(uint32_t /*capacity*/)
+    {
+        return nullptr;
+    }
+
+    std::unique_ptr<SharedMemoryRingBuffer> SharedMemoryRingBuffer::Open(const std::string& /*name*/, uint32_t /*capacity*/)
+    {
+        return nullptr;
+    }
+
+    bool SharedMemoryRingBuffer::IsSupported()
+    {
+        return false;
+    }
+
+    SharedMemoryRingBuffer::~SharedMemoryRingBuffer()
+    {
+    }
+
+    void SharedMemoryRingBuffer::unlink()
+    {
+    }
+}
+#endif
@@ -15,6 +15,8 @@
 #include "Utils/StatisticCollection.h"
 #include "Utils/LogMacros.h"
 #include <thread>
+#include <algorithm>
+#include <limits>
 #include "Components/CategoryInfo.h"
 #include "TransportCommon/ISceneUpdateSerializer.h"
 
@@ -22,6 +24,10 @@ namespace ramses_internal
 {
     static const constexpr uint32_t ResourceDataSize = 300000;
     static const constexpr uint32_t SceneActionDataSize = 300000;
+    static const constexpr uint32_t SharedMemoryRingSize = 32 * SceneActionDataSize;
+    // limits for gathering queued messages into one socket write, a single larger message is still sent on its own
+    static const constexpr size_t MaxBytesPerWrite = 2 * SceneActionDataSize;
+    static const constexpr size_t MaxMessagesPerWrite = 64;
 
     TCPConnectionSystem::TCPConnectionSystem(const NetworkParticipantAddress& participantAddress,
                                                      uint32_t protocolVersion,
@@ -30,7 +36,8 @@ namespace ramses_internal
                                                      PlatformLock& frameworkLock,
                                                      StatisticCollectionFramework& statisticCollection,
                                                      std::chrono::milliseconds aliveInterval,
-                                                     std::chrono::milliseconds aliveTimeout)
+                                                     std::chrono::milliseconds aliveTimeout,
+                                                     bool sharedMemoryTransport)
         : m_participantAddress(participantAddress)
         , m_protocolVersion(protocolVersion)
         , m_daemonAddress(daemonAddress)
@@ -44,6 +51,7 @@ namespace ramses_internal
                             : EParticipantType::Client)
         , m_aliveInterval(aliveInterval)
         , m_aliveIntervalTimeout(aliveTimeout)
+        , m_sharedMemoryTransport(sharedMemoryTransport && SharedMemoryRingBuffer::IsSupported())
         , m_frameworkLock(frameworkLock)
         , m_thread("R_TCP_ConnSys")
         , m_statisticCollection(statisticCollection)
@@ -317,20 +325,38 @@ namespace ramses_internal
 
     void TCPConnectionSystem::sendMessageToParticipant(const ParticipantPtr& pp, OutMessage msg)
     {
-        assert(pp->currentOutBuffer.empty());
+        assert(pp->currentOutBuffers.empty());
+        addMessageToCurrentOutBuffers(pp, std::move(msg));
+        writeCurrentOutBuffers(pp);
+    }
+
+    void TCPConnectionSystem::addMessageToCurrentOutBuffers(const ParticipantPtr& pp, OutMessage msg)
+    {
+        if (pp->sharedMemoryOutAccepted && msg.messageType == EMessageId::SendSceneUpdate)
+            moveMessageToSharedMemory(pp, msg);
 
-        pp->currentOutBuffer = msg.stream.release();
-        const uint32_t fullSize = static_cast<uint32_t>(pp->currentOutBuffer.size());
+        pp->currentOutBuffers.push_back(msg.stream.release());
+        std::vector<Byte>& buffer = pp->currentOutBuffers.back();
+        const uint32_t fullSize = static_cast<uint32_t>(buffer.size());
 
         LOG_DEBUG(CONTEXT_COMMUNICATION, "TCPConnectionSystem(" << m_participantAddress.getParticipantName() << ")::sendMessageToParticipant: To " << pp->address.getParticipantId() <<
                   ", MsgType " << msg.messageType << ", Size " << fullSize);
 
-        RawBinaryOutputStream s(reinterpret_cast<uint8_t*>(pp->currentOutBuffer.data()), static_cast<uint32_t>(pp->currentOutBuffer.size()));
+        RawBinaryOutputStream s(reinterpret_cast<uint8_t*>(buffer.data()), static_cast<uint32_t>(buffer.size()));
         const uint32_t remainingSize = fullSize - sizeof(pp->lengthReceiveBuffer);
         s << remainingSize
           << m_protocolVersion;
 
-        asio::async_write(pp->socket, asio::const_buffer(pp->currentOutBuffer.data(), pp->currentOutBuffer.size()),
+        // buffer memory does not move when vector of buffers grows
+        pp->currentOutBufferSequence.emplace_back(buffer.data(), buffer.size());
+    }
+
+    void TCPConnectionSystem::writeCurrentOutBuffers(const ParticipantPtr& pp)
+    {
+        assert(!pp->currentOutBuffers.empty());
+        m_statisticCollection.statSocketWrites.incCounter(1);
+
+        asio::async_write(pp->socket, pp->currentOutBufferSequence,
                           [this, pp](asio::error_code e, std::size_t sentBytes) {
                               if (e)
                               {
@@ -343,9 +369,11 @@ namespace ramses_internal
                               else
                               {
                                   LOG_DEBUG(CONTEXT_COMMUNICATION, "TCPConnectionSystem(" << m_participantAddress.getParticipantName() << ")::sendMessageToParticipant: To " << pp->address.getParticipantId() <<
-                                            ", MsgBytes " << pp->currentOutBuffer.size() << ", SentBytes " << sentBytes);
+                                            ", Msgs " << pp->currentOutBuffers.size() << ", SentBytes " << sentBytes);
 
-                                  pp->currentOutBuffer.clear();
+                                  m_statisticCollection.statSocketBytesSent.incCounter(static_cast<UInt32>(sentBytes));
+                                  pp->currentOutBuffers.clear();
+                                  pp->currentOutBufferSequence.clear();
                                   pp->lastSent = std::chrono::steady_clock::now();
 
                                   pp->sendAliveTimer.expires_after(m_aliveInterval);
@@ -364,20 +392,119 @@ namespace ramses_internal
 
     void TCPConnectionSystem::doSendQueuedMessage(const ParticipantPtr& pp)
     {
-        if (pp->currentOutBuffer.empty() && !pp->outQueue.empty())
+        if (pp->currentOutBuffers.empty() && HasQueuedOutMessages(*pp))
+        {
+            // gather as many queued messages as allowed into one write, always at least one
+            size_t bytesToWrite = 0u;
+            size_t sceneUpdateQueueIndex = 0u;
+            std::deque<OutMessage>* queue = SelectNextOutQueue(*pp, sceneUpdateQueueIndex);
+            while (queue &&
+                   pp->currentOutBuffers.size() < MaxMessagesPerWrite &&
+                   (pp->currentOutBuffers.empty() || bytesToWrite + queue->front().stream.getSize() <= MaxBytesPerWrite))
+            {
+                OutMessage msg = std::move(queue->front());
+                queue->pop_front();
+                if (queue != &pp->outQueueControl && queue != &pp->outQueueScene)
+                    OnSceneUpdateQueueServed(*pp, sceneUpdateQueueIndex);
+
+                addMessageToCurrentOutBuffers(pp, std::move(msg));
+                bytesToWrite += pp->currentOutBuffers.back().size();
+                queue = SelectNextOutQueue(*pp, sceneUpdateQueueIndex);
+            }
+
+            writeCurrentOutBuffers(pp);
+        }
+    }
+
+    void TCPConnectionSystem::EnqueueOutMessage(Participant& p, OutMessage msg)
+    {
+        switch (msg.messageType)
+        {
+        case EMessageId::ConnectionDescriptionMessage:
+        case EMessageId::ConnectorAddressExchange:
+        case EMessageId::Alive:
+        case EMessageId::SharedMemoryOffer:
+        case EMessageId::SharedMemoryAnswer:
+        case EMessageId::DcsmRegisterContent:
+        case EMessageId::DcsmCanvasSizeChange:
+        case EMessageId::DcsmContentStatusChange:
+        case EMessageId::DcsmContentAvailable:
+        case EMessageId::DcsmContentDescription:
+        case EMessageId::DcsmCategoryContentSwitchRequest:
+        case EMessageId::DcsmRequestUnregisterContent:
+        case EMessageId::DcsmForceUnregisterContent:
+        case EMessageId::DcsmUpdateContentMetadata:
+            p.outQueueControl.push_back(std::move(msg));
+            return;
+        default:
+            break;
+        }
+
+        msg.sequence = p.nextOutSequence++;
+        if (msg.messageType != EMessageId::SendSceneUpdate)
+        {
+            p.outQueueScene.push_back(std::move(msg));
+            return;
+        }
+
+        auto it = std::find_if(p.outQueueSceneUpdates.begin(), p.outQueueSceneUpdates.end(), [&](const SceneUpdateQueue& q) { return q.sceneId == msg.sceneId; });
+        if (it == p.outQueueSceneUpdates.end())
+        {
+            p.outQueueSceneUpdates.push_back({msg.sceneId, {}});
+            it = p.outQueueSceneUpdates.end() - 1;
+        }
+        it->messages.push_back(std::move(msg));
+    }
+
+    std::deque<TCPConnectionSystem::OutMessage>* TCPConnectionSystem::SelectNextOutQueue(Participant& p, size_t& sceneUpdateQueueIndex)
+    {
+        if (!p.outQueueControl.empty())
+            return &p.outQueueControl;
+
+        // scene updates queued before the next other scene message (e.g. unpublish) must be sent before it,
+        // among those take scene queues round robin so one large update does not block the others
+        const uint64_t barrier = p.outQueueScene.empty() ? std::numeric_limits<uint64_t>::max() : p.outQueueScene.front().sequence;
+        const size_t numQueues = p.outQueueSceneUpdates.size();
+        for (size_t i = 0u; i < numQueues; ++i)
         {
-            OutMessage msg = std::move(pp->outQueue.front());
-            pp->outQueue.pop_front();
+            const size_t index = (p.nextSceneUpdateQueue + i) % numQueues;
+            if (p.outQueueSceneUpdates[index].messages.front().sequence < barrier)
+            {
+                sceneUpdateQueueIndex = index;
+                return &p.outQueueSceneUpdates[index].messages;
+            }
+        }
 
-            sendMessageToParticipant(pp, std::move(msg));
+        if (!p.outQueueScene.empty())
+            return &p.outQueueScene;
+        return nullptr;
+    }
+
+    void TCPConnectionSystem::OnSceneUpdateQueueServed(Participant& p, size_t sceneUpdateQueueIndex)
+    {
+        if (p.outQueueSceneUpdates[sceneUpdateQueueIndex].messages.empty())
+        {
+            p.outQueueSceneUpdates.erase(p.outQueueSceneUpdates.begin() + sceneUpdateQueueIndex);
+            p.nextSceneUpdateQueue = sceneUpdateQueueIndex;
+        }
+        else
+        {
+            p.nextSceneUpdateQueue = sceneUpdateQueueIndex + 1u;
         }
+        if (p.nextSceneUpdateQueue >= p.outQueueSceneUpdates.size())
+            p.nextSceneUpdateQueue = 0u;
+    }
+
+    bool TCPConnectionSystem::HasQueuedOutMessages(const Participant& p)
+    {
+        return !p.outQueueControl.empty() || !p.outQueueScene.empty() || !p.outQueueSceneUpdates.empty();
     }
 
     void TCPConnectionSystem::doTrySendAliveMessage(const ParticipantPtr& pp)
     {
-        if (pp->currentOutBuffer.empty())
+        if (pp->currentOutBuffers.empty())
         {
-            assert(pp->outQueue.empty());
+            assert(!HasQueuedOutMessages(*pp));
 
             sendMessageToParticipant(pp, OutMessage(std::vector<Guid>(), EMessageId::Alive));
         }
@@ -473,6 +600,9 @@ namespace ramses_internal
         pp->connectTimer.cancel();
         pp->sendAliveTimer.cancel();
         pp->checkReceivedAliveTimer.cancel();
+        pp->sharedMemoryOut.reset();
+        pp->sharedMemoryOutAccepted = false;
+        pp->sharedMemoryIn.reset();
         pp->state = EParticipantState::Invalid;
 
         // remove from sets
@@ -574,7 +704,7 @@ namespace ramses_internal
                                     assert(pp);
 
                                     // cannot move here when broadcast to more than 1 participant
-                                    pp->outQueue.push_back(msg);
+                                    EnqueueOutMessage(*pp, msg);
 
                                     doSendQueuedMessage(pp);
                                 }
@@ -590,7 +720,7 @@ namespace ramses_internal
                                 }
                                 assert(pp);
 
-                                pp->outQueue.push_back(std::move(msg));
+                                EnqueueOutMessage(*pp, std::move(msg));
 
                                 doSendQueuedMessage(pp);
                             }
@@ -633,6 +763,15 @@ namespace ramses_internal
         case EMessageId::ConnectorAddressExchange:
             handleConnectorAddressExchange(pp, stream);
             break;
+        case EMessageId::SharedMemoryOffer:
+            handleSharedMemoryOffer(pp, stream);
+            break;
+        case EMessageId::SharedMemoryAnswer:
+            handleSharedMemoryAnswer(pp, stream);
+            break;
+        case EMessageId::SharedMemoryPayload:
+            handleSharedMemoryPayload(pp, stream);
+            break;
         case EMessageId::PublishScene:
             handlePublishScene(pp, stream);
             break;
@@ -646,7 +785,7 @@ namespace ramses_internal
             handleUnsubscribeScene(pp, stream);
             break;
         case EMessageId::SendSceneUpdate:
-            handleSceneUpdate(pp, stream);
+            handleSceneUpdate(pp, stream, pp->receiveBuffer.size());
             break;
         case EMessageId::CreateScene:
             handleCreateScene(pp, stream);
@@ -743,6 +882,140 @@ namespace ramses_internal
             triggerConnectionUpdateNotification(guid, EConnectionStatus_Connected);
 
         sendConnectorAddressExchangeMessagesForNewParticipant(pp);
+
+        if (m_sharedMemoryTransport && pp->type == EParticipantType::Client && isParticipantOnSameHost(pp))
+            offerSharedMemoryTransport(pp);
+    }
+
+    bool TCPConnectionSystem::isParticipantOnSameHost(const ParticipantPtr& pp) const
+    {
+        // both ends of the connection use the same address only when on the same host (loopback or own external address)
+        asio::error_code e;
+        const auto localEp = pp->socket.local_endpoint(e);
+        if (e)
+            return false;
+        const auto remoteEp = pp->socket.remote_endpoint(e);
+        if (e)
+            return false;
+        return localEp.address() == remoteEp.address();
+    }
+
+    void TCPConnectionSystem::offerSharedMemoryTransport(const ParticipantPtr& pp)
+    {
+        // every side creates the ring it writes to, receiver maps it and answers. Until the answer arrives all messages go through the socket
+        pp->sharedMemoryOut = SharedMemoryRingBuffer::Create(SharedMemoryRingSize);
+        if (!pp->sharedMemoryOut)
+        {
+            LOG_WARN(CONTEXT_COMMUNICATION, "TCPConnectionSystem(" << m_participantAddress.getParticipantName() << ")::offerSharedMemoryTransport: Failed to create shared memory for "
+                     << pp->address.getParticipantId() << ", keep sending all data through socket");
+            return;
+        }
+
+        LOG_INFO(CONTEXT_COMMUNICATION, "TCPConnectionSystem(" << m_participantAddress.getParticipantName() << ")::offerSharedMemoryTransport: Offer " << pp->sharedMemoryOut->getName()
+                 << " with " << pp->sharedMemoryOut->getCapacity() << " bytes to " << pp->address.getParticipantId());
+
+        OutMessage msg(pp->address.getParticipantId(), EMessageId::SharedMemoryOffer);
+        msg.stream << pp->sharedMemoryOut->getName()
+                   << pp->sharedMemoryOut->getCapacity();
+        postMessageForSending(std::move(msg));
+    }
+
+    void TCPConnectionSystem::moveMessageToSharedMemory(const ParticipantPtr& pp, OutMessage& msg)
+    {
+        // size and protocol version are only needed for the socket, ring block starts with message type
+        const uint32_t socketHeaderSize = 2 * sizeof(uint32_t);
+        const uint32_t blockSize = static_cast<uint32_t>(msg.stream.getSize()) - socketHeaderSize;
+
+        uint64_t offset = 0u;
+        if (!pp->sharedMemoryOut->write(msg.stream.getData() + socketHeaderSize, blockSize, offset))
+        {
+            // receiver did not catch up yet, sending through socket keeps message order
+            LOG_DEBUG(CONTEXT_COMMUNICATION, "TCPConnectionSystem(" << m_participantAddress.getParticipantName() << ")::moveMessageToSharedMemory: No space for "
+                      << blockSize << " bytes to " << pp->address.getParticipantId() << ", send through socket");
+            return;
+        }
+
+        OutMessage payloadMsg(pp->address.getParticipantId(), EMessageId::SharedMemoryPayload);
+        payloadMsg.stream << offset
+                          << blockSize;
+        msg = std::move(payloadMsg);
+    }
+
+    void TCPConnectionSystem::handleSharedMemoryOffer(const ParticipantPtr& pp, BinaryInputStream& stream)
+    {
+        std::string name;
+        uint32_t capacity = 0;
+        stream >> name
+               >> capacity;
+
+        // only map objects of a ramses peer on this host, the offer could name any object this user can open otherwise
+        if (m_sharedMemoryTransport && !pp->sharedMemoryIn && isParticipantOnSameHost(pp) && SharedMemoryRingBuffer::IsValidName(name))
+            pp->sharedMemoryIn = SharedMemoryRingBuffer::Open(name, capacity);
+        const bool accepted = (pp->sharedMemoryIn != nullptr);
+
+        LOG_INFO(CONTEXT_COMMUNICATION, "TCPConnectionSystem(" << m_participantAddress.getParticipantName() << ")::handleSharedMemoryOffer: from " << pp->address.getParticipantId()
+                 << ", " << name << " with " << capacity << " bytes " << (accepted ? "accepted" : "rejected"));
+
+        OutMessage msg(pp->address.getParticipantId(), EMessageId::SharedMemoryAnswer);
+        msg.stream << accepted;
+        postMessageForSending(std::move(msg));
+    }
+
+    void TCPConnectionSystem::handleSharedMemoryAnswer(const ParticipantPtr& pp, BinaryInputStream& stream)
+    {
+        bool accepted = false;
+        stream >> accepted;
+
+        if (!pp->sharedMemoryOut || pp->sharedMemoryOutAccepted)
+        {
+            LOG_WARN(CONTEXT_COMMUNICATION, "TCPConnectionSystem(" << m_participantAddress.getParticipantName() << ")::handleSharedMemoryAnswer: Unexpected answer from " << pp->address.getParticipantId());
+            return;
+        }
+
+        LOG_INFO(CONTEXT_COMMUNICATION, "TCPConnectionSystem(" << m_participantAddress.getParticipantName() << ")::handleSharedMemoryAnswer: " << pp->sharedMemoryOut->getName()
+                 << (accepted ? " accepted" : " rejected") << " by " << pp->address.getParticipantId());
+
+        // mapped by receiver (or never will be), name not needed anymore
+        pp->sharedMemoryOut->unlink();
+        if (accepted)
+            pp->sharedMemoryOutAccepted = true;
+        else
+            pp->sharedMemoryOut.reset();
+    }
+
+    void TCPConnectionSystem::handleSharedMemoryPayload(const ParticipantPtr& pp, BinaryInputStream& stream)
+    {
+        uint64_t offset = 0u;
+        uint32_t blockSize = 0u;
+        stream >> offset
+               >> blockSize;
+
+        const Byte* block = pp->sharedMemoryIn ? pp->sharedMemoryIn->getBlock(offset, blockSize) : nullptr;
+        if (!block || blockSize < sizeof(uint32_t))
+        {
+            LOG_ERROR(CONTEXT_COMMUNICATION, "TCPConnectionSystem(" << m_participantAddress.getParticipantName() << ")::handleSharedMemoryPayload: Invalid block at " << offset << " size " << blockSize
+                      << " from " << pp->address.getParticipantId() << ". Drop connection");
+            removeParticipant(pp, true);
+            return;
+        }
+
+        // handled in place, ring space is only released afterwards
+        BinaryInputStream blockStream(block);
+        uint32_t messageTypeTmp = 0;
+        blockStream >> messageTypeTmp;
+        const EMessageId messageType = static_cast<EMessageId>(messageTypeTmp);
+        if (messageType != EMessageId::SendSceneUpdate)
+        {
+            LOG_ERROR(CONTEXT_COMMUNICATION, "TCPConnectionSystem(" << m_participantAddress.getParticipantName() << ")::handleSharedMemoryPayload: Invalid messagetype " << messageType
+                      << " from " << pp->address.getParticipantId() << ". Drop connection");
+            removeParticipant(pp, true);
+            return;
+        }
+
+        handleSceneUpdate(pp, blockStream, blockSize);
+
+        if (pp->sharedMemoryIn)
+            pp->sharedMemoryIn->release(offset, blockSize);
     }
 
     void TCPConnectionSystem::sendConnectorAddressExchangeMessagesForNewParticipant(const ParticipantPtr& newPp)
@@ -951,6 +1224,7 @@ namespace ramses_internal
 
             const uint32_t usedSize = static_cast<uint32_t>(size);
             OutMessage msg(to, EMessageId::SendSceneUpdate);
+            msg.sceneId = sceneId;
             msg.stream << sceneId.getValue()
                        << usedSize;
             msg.stream.write(buffer.data(), usedSize);
@@ -960,22 +1234,34 @@ namespace ramses_internal
     }
 
 
-    void TCPConnectionSystem::handleSceneUpdate(const ParticipantPtr& pp, BinaryInputStream& stream)
+    void TCPConnectionSystem::handleSceneUpdate(const ParticipantPtr& pp, BinaryInputStream& stream, size_t messageSize)
     {
         if (m_sceneRendererHandler)
         {
             SceneId sceneId;
-            stream >> sceneId.getReference();
             uint32_t dataSize = 0;
+            if (stream.getCurrentReadBytes() + sizeof(sceneId.getReference()) + sizeof(dataSize) > messageSize)
+            {
+                LOG_ERROR(CONTEXT_COMMUNICATION, "TCPConnectionSystem(" << m_participantAddress.getParticipantName() << ")::handleSceneUpdate: Message of size " << messageSize
+                          << " too small for header from " << pp->address.getParticipantId() << ". Drop message");
+                return;
+            }
+            stream >> sceneId.getReference();
             stream >> dataSize;
 
-            std::vector<Byte> data(dataSize);
-            stream.read(data.data(), dataSize);
+            // size is written by peer, data must not be read beyond received message or shared memory block
+            if (dataSize > messageSize - stream.getCurrentReadBytes())
+            {
+                LOG_ERROR(CONTEXT_COMMUNICATION, "TCPConnectionSystem(" << m_participantAddress.getParticipantName() << ")::handleSceneUpdate: Data size " << dataSize
+                          << " exceeds remaining message size " << messageSize - stream.getCurrentReadBytes() << " for scene " << sceneId << " from " << pp->address.getParticipantId() << ". Drop message");
+                return;
+            }
 
             LOG_TRACE(CONTEXT_COMMUNICATION, "TCPConnectionSystem(" << m_participantAddress.getParticipantName() << ")::handleSceneActionList: from " << pp->address.getParticipantId());
 
+            // handler consumes data before returning, no need to copy out of receive buffer or shared memory
             PlatformGuard guard(m_frameworkLock);
-            m_sceneRendererHandler->handleSceneUpdate(sceneId, std::move(data), pp->address.getParticipantId());
+            m_sceneRendererHandler->handleSceneUpdate(sceneId, absl::Span<const Byte>(stream.readPosition(), dataSize), pp->address.getParticipantId());
         }
     }
 
@@ -1435,6 +1721,8 @@ namespace ramses_internal
                                     sos << "  "  << addr.getParticipantId() << " / " << addr.getParticipantName() << " at " << addr.getIp() << ":" << addr.getPort();
                                     if (m_hasOtherDaemon && addr.getIp() == m_daemonAddress.getIp() && addr.getPort() == m_daemonAddress.getPort())
                                         sos << " (daemon)";
+                                    if (p.value->sharedMemoryOutAccepted || p.value->sharedMemoryIn)
+                                        sos << " (shared memory out " << p.value->sharedMemoryOutAccepted << ", in " << (p.value->sharedMemoryIn != nullptr) << ")";
                                     sos << "\n";
                                 }
 
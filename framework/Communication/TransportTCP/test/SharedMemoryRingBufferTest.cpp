@@ -0,0 +1,154 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2020 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "TransportTCP/SharedMemoryRingBuffer.h"
+#include "gtest/gtest.h"
+#include <vector>
+#include <numeric>
+
+namespace ramses_internal
+{
+    class ASharedMemoryRingBuffer : public ::testing::Test
+    {
+    public:
+        void SetUp() override
+        {
+            if (!SharedMemoryRingBuffer::IsSupported())
+                GTEST_SKIP();
+
+            producer = SharedMemoryRingBuffer::Create(Capacity);
+            ASSERT_TRUE(producer);
+            consumer = SharedMemoryRingBuffer::Open(producer->getName(), Capacity);
+            ASSERT_TRUE(consumer);
+        }
+
+        static std::vector<Byte> MakeData(uint32_t size, Byte start)
+        {
+            std::vector<Byte> data(size);
+            std::iota(data.begin(), data.end(), start);
+            return data;
+        }
+
+        void expectBlock(uint64_t offset, const std::vector<Byte>& data)
+        {
+            const Byte* block = consumer->getBlock(offset, static_cast<uint32_t>(data.size()));
+            ASSERT_TRUE(block != nullptr);
+            EXPECT_EQ(data, std::vector<Byte>(block, block + data.size()));
+        }
+
+        static constexpr uint32_t Capacity = 100u;
+        std::unique_ptr<SharedMemoryRingBuffer> producer;
+        std::unique_ptr<SharedMemoryRingBuffer> consumer;
+    };
+
+    constexpr uint32_t ASharedMemoryRingBuffer::Capacity;
+
+    TEST_F(ASharedMemoryRingBuffer, consumerSeesDataWrittenByProducer)
+    {
+        const auto data1 = MakeData(30u, 1u);
+        const auto data2 = MakeData(20u, 50u);
+        uint64_t offset1 = 0u;
+        uint64_t offset2 = 0u;
+        ASSERT_TRUE(producer->write(data1.data(), 30u, offset1));
+        ASSERT_TRUE(producer->write(data2.data(), 20u, offset2));
+        EXPECT_EQ(0u, offset1);
+        EXPECT_EQ(30u, offset2);
+
+        expectBlock(offset1, data1);
+        consumer->release(offset1, 30u);
+        expectBlock(offset2, data2);
+        consumer->release(offset2, 20u);
+    }
+
+    TEST_F(ASharedMemoryRingBuffer, failsToWriteWhenFullUntilConsumerReleases)
+    {
+        const auto data = MakeData(40u, 0u);
+        uint64_t offset1 = 0u;
+        uint64_t offset2 = 0u;
+        uint64_t offset3 = 0u;
+        ASSERT_TRUE(producer->write(data.data(), 40u, offset1));
+        ASSERT_TRUE(producer->write(data.data(), 40u, offset2));
+        EXPECT_FALSE(producer->write(data.data(), 40u, offset3));
+
+        consumer->release(offset1, 40u);
+        EXPECT_TRUE(producer->write(data.data(), 40u, offset3));
+    }
+
+    TEST_F(ASharedMemoryRingBuffer, keepsBlocksContiguousWhenWrappingAround)
+    {
+        const auto data1 = MakeData(70u, 0u);
+        const auto data2 = MakeData(50u, 100u);
+        uint64_t offset1 = 0u;
+        uint64_t offset2 = 0u;
+        ASSERT_TRUE(producer->write(data1.data(), 70u, offset1));
+        consumer->release(offset1, 70u);
+
+        // does not fit into remaining 30 bytes at end, starts at beginning of ring again
+        ASSERT_TRUE(producer->write(data2.data(), 50u, offset2));
+        EXPECT_EQ(Capacity, offset2);
+        expectBlock(offset2, data2);
+    }
+
+    TEST_F(ASharedMemoryRingBuffer, rejectsBlocksNotWrittenOrAlreadyReleased)
+    {
+        const auto data = MakeData(30u, 0u);
+        uint64_t offset = 0u;
+        ASSERT_TRUE(producer->write(data.data(), 30u, offset));
+
+        EXPECT_TRUE(consumer->getBlock(offset, 0u) == nullptr);
+        EXPECT_TRUE(consumer->getBlock(offset, 31u) == nullptr);
+        EXPECT_TRUE(consumer->getBlock(offset + 10u, 30u) == nullptr);
+        EXPECT_TRUE(consumer->getBlock(offset, Capacity + 1u) == nullptr);
+
+        consumer->release(offset, 30u);
+        EXPECT_TRUE(consumer->getBlock(offset, 30u) == nullptr);
+    }
+
+    TEST_F(ASharedMemoryRingBuffer, rejectsTooLargeWrite)
+    {
+        const auto data = MakeData(Capacity + 1u, 0u);
+        uint64_t offset = 0u;
+        EXPECT_FALSE(producer->write(data.data(), Capacity + 1u, offset));
+        EXPECT_FALSE(producer->write(data.data(), 0u, offset));
+    }
+
+    TEST_F(ASharedMemoryRingBuffer, cannotBeOpenedAfterUnlinkButMappingStaysValid)
+    {
+        producer->unlink();
+        EXPECT_FALSE(SharedMemoryRingBuffer::Open(producer->getName(), Capacity));
+
+        const auto data = MakeData(10u, 3u);
+        uint64_t offset = 0u;
+        ASSERT_TRUE(producer->write(data.data(), 10u, offset));
+        expectBlock(offset, data);
+    }
+
+    TEST_F(ASharedMemoryRingBuffer, cannotBeOpenedWithDifferentCapacity)
+    {
+        EXPECT_FALSE(SharedMemoryRingBuffer::Open(producer->getName(), Capacity + 1u));
+    }
+
+    TEST_F(ASharedMemoryRingBuffer, createsOnlyValidNames)
+    {
+        EXPECT_TRUE(SharedMemoryRingBuffer::IsValidName(producer->getName()));
+    }
+
+    TEST(SharedMemoryRingBuffer, rejectsNamesNotCreatedByRamses)
+    {
+        EXPECT_TRUE(SharedMemoryRingBuffer::IsValidName("/ramses-123-0"));
+        EXPECT_FALSE(SharedMemoryRingBuffer::IsValidName(""));
+        EXPECT_FALSE(SharedMemoryRingBuffer::IsValidName("/ramses-"));
+        EXPECT_FALSE(SharedMemoryRingBuffer::IsValidName("/ramses-123"));
+        EXPECT_FALSE(SharedMemoryRingBuffer::IsValidName("/ramses-123-"));
+        EXPECT_FALSE(SharedMemoryRingBuffer::IsValidName("/ramses--1"));
+        EXPECT_FALSE(SharedMemoryRingBuffer::IsValidName("/ramses-123-0/x"));
+        EXPECT_FALSE(SharedMemoryRingBuffer::IsValidName("/other-123-0"));
+        EXPECT_FALSE(SharedMemoryRingBuffer::IsValidName("ramses-123-0"));
+        EXPECT_FALSE(SharedMemoryRingBuffer::Open("/other-123-0", 100u));
+    }
+}
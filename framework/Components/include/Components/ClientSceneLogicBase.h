@@ -13,6 +13,8 @@
 #include "Scene/ClientScene.h"
 #include "Animation/AnimationSystemFactory.h"
 #include "Scene/Scene.h"
+#include "PlatformAbstraction/PlatformLock.h"
+#include <memory>
 
 namespace ramses_internal
 {
@@ -21,11 +23,12 @@ namespace ramses_internal
     struct FlushTimeInformation;
     class IResourceProviderComponent;
     struct SceneUpdate;
+    class SceneUpdateSerializer;
 
     class ClientSceneLogicBase
     {
     public:
-        ClientSceneLogicBase(ISceneGraphSender& sceneGraphSender, ClientScene& scene, IResourceProviderComponent& res, const Guid& clientAddress);
+        ClientSceneLogicBase(ISceneGraphSender& sceneGraphSender, ClientScene& scene, IResourceProviderComponent& res, const Guid& clientAddress, PlatformLock& frameworkLock);
         virtual ~ClientSceneLogicBase();
 
         void publish(EScenePublicationMode publicationMode);
@@ -36,15 +39,31 @@ namespace ramses_internal
 
         std::vector<Guid> getWaitingAndActiveSubscribers() const;
 
-        virtual bool flushSceneActions(const FlushTimeInformation& flushTimeInfo, SceneVersionTag versionTag) = 0;
+        bool flushSceneActions(const FlushTimeInformation& flushTimeInfo, SceneVersionTag versionTag);
 
         const char* getSceneStateString() const;
 
     protected:
+        using AddressVector = std::vector<Guid>;
+
+        // called with scene logic lock held only, must not call anything taking the framework lock
+        virtual bool prepareFlush(const FlushTimeInformation& flushTimeInfo, SceneVersionTag versionTag, SceneUpdate& sceneUpdate, bool& sendSceneUpdate) = 0;
+        // called with framework lock and scene logic lock held
+        virtual void finishFlush(const FlushTimeInformation& flushTimeInfo, SceneVersionTag versionTag) = 0;
         virtual void postAddSubscriber() {};
         void sendSceneToWaitingSubscribers(const IScene& scene, const FlushTimeInformation& flushTimeInfo, SceneVersionTag versionTag);
+        // nullptr when all subscribers are local
+        std::unique_ptr<SceneUpdateSerializer> createSerializerForRemoteSubscribers(const AddressVector& subscribers, const SceneUpdate& sceneUpdate) const;
         void printFlushInfo(StringOutputStream& sos, const char* name, const SceneActionCollection& collection) const;
         bool verifyAndGetResourceChanges(SceneUpdate& sceneUpdate, bool hasNewActions);
+        // compact encoding saves bandwidth for remote subscribers, local renderer applies fixed encoded actions faster
+        ESceneActionEncoding getSceneActionEncoding(const AddressVector& subscribers) const;
+        void selectSceneActionEncodingForNextFlush();
+
+        // Lock order is always framework lock before scene logic lock. The scene logic lock alone protects
+        // the per scene state so that flushes of different scenes do not serialize on the framework lock.
+        PlatformLock&          m_frameworkLock;
+        mutable PlatformLock   m_sceneLogicLock;
 
         ISceneGraphSender&     m_scenegraphSender;
         IResourceProviderComponent& m_resourceComponent;
@@ -52,11 +71,14 @@ namespace ramses_internal
         const SceneId          m_sceneId;
         ClientScene&           m_scene;
 
-        using AddressVector = std::vector<Guid>;
         AddressVector  m_subscribersActive;
         AddressVector  m_subscribersWaitingForScene;
         EScenePublicationMode m_scenePublicationMode;
 
+        // subscribers which got the scene while a prepared flush was not sent yet, they already have its content
+        bool m_flushPendingForSending = false;
+        AddressVector m_subscribersSkippingPendingFlush;
+
         UInt64                 m_flushCounter = 0u;
         ResourceContentHashVector m_lastFlushClientResourcesInUse;
 
@@ -17,11 +17,12 @@ namespace ramses_internal
     class ClientSceneLogicDirect final : public ClientSceneLogicBase
     {
     public:
-        ClientSceneLogicDirect(ISceneGraphSender& sceneGraphSender, ClientScene& scene, IResourceProviderComponent& res, const Guid& clientAddress);
-
-        virtual bool flushSceneActions(const FlushTimeInformation& flushTimeInfo, SceneVersionTag versionTag) override;
+        ClientSceneLogicDirect(ISceneGraphSender& sceneGraphSender, ClientScene& scene, IResourceProviderComponent& res, const Guid& clientAddress, PlatformLock& frameworkLock);
 
     private:
+        virtual bool prepareFlush(const FlushTimeInformation& flushTimeInfo, SceneVersionTag versionTag, SceneUpdate& sceneUpdate, bool& sendSceneUpdate) override;
+        virtual void finishFlush(const FlushTimeInformation& flushTimeInfo, SceneVersionTag versionTag) override;
+
         SceneSizeInformation m_previousSceneSizes;
     };
 }
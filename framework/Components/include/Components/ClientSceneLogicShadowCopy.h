@@ -12,21 +12,29 @@
 #include "Components/ClientSceneLogicBase.h"
 #include "Components/FlushTimeInformation.h"
 #include "Components/ManagedResource.h"
+#include "Scene/SceneActionCollection.h"
+#include "SceneAPI/SceneSizeInformation.h"
 
 namespace ramses_internal
 {
     class ClientSceneLogicShadowCopy final : public ClientSceneLogicBase
     {
     public:
-        ClientSceneLogicShadowCopy(ISceneGraphSender& sceneGraphSender, ClientScene& scene, IResourceProviderComponent& res, const Guid& clientAddress);
-
-        virtual bool flushSceneActions(const FlushTimeInformation& flushTimeInfo, SceneVersionTag versionTag) override;
+        ClientSceneLogicShadowCopy(ISceneGraphSender& sceneGraphSender, ClientScene& scene, IResourceProviderComponent& res, const Guid& clientAddress, PlatformLock& frameworkLock);
 
     private:
+        virtual bool prepareFlush(const FlushTimeInformation& flushTimeInfo, SceneVersionTag versionTag, SceneUpdate& sceneUpdate, bool& sendSceneUpdate) override;
+        virtual void finishFlush(const FlushTimeInformation& flushTimeInfo, SceneVersionTag versionTag) override;
         virtual void postAddSubscriber() override;
         void sendShadowCopySceneToWaitingSubscribers();
+        void appendToShadowCopyLog(const SceneActionCollection& actions);
 
-        SceneWithExplicitMemory m_sceneShadowCopy;
+        // The shadow copy is only materialized when a subscriber needs the full scene. Until then all flushed
+        // actions are appended to a log which is compacted by re-describing the flushed scene state once the log
+        // has grown well beyond the size of a full scene description.
+        SceneActionCollection m_shadowCopyLog;
+        UInt m_shadowCopyLogCompactedSize = 0u;
+        SceneSizeInformation m_sceneSizesOfLastFlush;
         FlushTimeInformation m_flushTimeInfoOfLastFlush;
         SceneVersionTag m_lastVersionTag;
         ManagedResourceVector m_lastFlushUsedResources;
@@ -12,6 +12,7 @@
 #include "Components/DcsmTypes.h"
 #include "Components/IDcsmComponent.h"
 #include "Components/DcsmMetadata.h"
+#include "Components/DcsmPreviewImageCache.h"
 #include "TransportCommon/IConnectionStatusListener.h"
 #include "TransportCommon/ServiceHandlerInterfaces.h"
 #include "PlatformAbstraction/PlatformLock.h"
@@ -153,6 +154,9 @@ namespace ramses_internal
         void addConsumerEvent_ForceStopOfferContent(ContentID contentID, const Guid& providerID);
         void addConsumerEvent_UpdateContentMetadata(ContentID contentID,  DcsmMetadata metadata, const Guid& providerID);
 
+        void sendUpdateContentMetadataToRemote(const Guid& to, ContentID contentID, const DcsmMetadata& metadata);
+        bool resolveReceivedPreviewImage(DcsmMetadata& metadata, const Guid& providerID);
+
         const char* EnumToString(EDcsmCommandType cmd) const;
         const char* EnumToString(ContentState val) const;
 
@@ -178,6 +182,10 @@ namespace ramses_internal
 
         std::vector<DcsmEvent> m_providerEvents;
         std::vector<DcsmEvent> m_consumerEvents;
+
+        // preview image PNGs are sent only once per connection, afterwards referenced by their content hash
+        HashMap<Guid, DcsmPreviewImageCache> m_previewImagesSentToConsumer;
+        HashMap<Guid, DcsmPreviewImageCache> m_previewImagesReceivedFromProvider;
     };
 }
 
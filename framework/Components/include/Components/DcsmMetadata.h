@@ -35,6 +35,16 @@ namespace ramses_internal
         bool empty() const;
         std::vector<Byte> toBinary() const;
         void updateFromOther(const DcsmMetadata& other);
+        // returns all fields set here which are not set in base or set to a different value
+        DcsmMetadata getChangedFields(const DcsmMetadata& base) const;
+
+        // A preview image reference carries only the content hash of a PNG the receiver got before.
+        // It is serialized instead of the PNG data and must be resolved by the receiver.
+        uint64_t getPreviewImageHash() const;
+        bool hasPreviewImageReference() const;
+        void replacePreviewImagePngByReference();
+        void resolvePreviewImageReference(std::vector<unsigned char> previewImagePng);
+        void clearPreviewImagePng();
 
         bool setPreviewImagePng(const void* data, size_t dataLength);
         bool setPreviewDescription(std::u32string previewDescription);
@@ -83,6 +93,7 @@ namespace ramses_internal
         void fromBinary(absl::Span<const Byte> data);
 
         std::vector<unsigned char> m_previewImagePng;
+        uint64_t m_previewImageHash = 0;
         std::u32string m_previewDescription;
         int32_t m_widgetOrder = 0;
         int32_t m_widgetBackgroundID = 0;
@@ -96,6 +107,7 @@ namespace ramses_internal
 
         bool m_hasCarModelView = false;
         bool m_hasPreviewImagePng = false;
+        bool m_previewImageIsReference = false;
         bool m_hasPreviewDescription = false;
         bool m_hasWidgetOrder = false;
         bool m_hasWidgetBackgroundID = false;
@@ -119,6 +131,8 @@ struct fmt::formatter<ramses_internal::DcsmMetadata> : public ramses_internal::S
         fmt::format_to(ctx.out(), "[png:");
         if (dm.hasPreviewImagePng())
             fmt::format_to(ctx.out(), "{}",  dm.m_previewImagePng.size());
+        else if (dm.hasPreviewImageReference())
+            fmt::format_to(ctx.out(), "ref {:x}", dm.m_previewImageHash);
         fmt::format_to(ctx.out(), "; desc:");
         if (dm.hasPreviewDescription())
             fmt::format_to(ctx.out(), "{}", dm.m_previewDescription.size());
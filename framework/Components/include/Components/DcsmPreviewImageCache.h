@@ -0,0 +1,58 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2020 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#ifndef RAMSES_COMPONENT_DCSMPREVIEWIMAGECACHE_H
+#define RAMSES_COMPONENT_DCSMPREVIEWIMAGECACHE_H
+
+#include <cstdint>
+#include <cstddef>
+#include <list>
+#include <unordered_map>
+#include <vector>
+
+namespace ramses_internal
+{
+    // Byte bounded LRU cache of preview images exchanged with one remote, identified by their hash.
+    // Provider (knowing only sizes) and consumer (keeping the images) each keep one per remote and apply
+    // the same sequence of operations in message order, so the provider only sends a reference to an image
+    // which the consumer still has.
+    class DcsmPreviewImageCache
+    {
+    public:
+        static constexpr size_t DefaultMaxBytes = 4u * 1024u * 1024u;
+
+        explicit DcsmPreviewImageCache(size_t maxBytes = DefaultMaxBytes);
+
+        // returns nullptr if image is not known, otherwise marks it as most recently used
+        const std::vector<unsigned char>* use(uint64_t hash);
+        // least recently used images are evicted to stay within budget, images exceeding the budget alone are not kept
+        void add(uint64_t hash, size_t sizeInBytes, std::vector<unsigned char> png = {});
+
+        size_t getNumberOfImages() const;
+        size_t getTotalBytes() const;
+
+    private:
+        struct Entry
+        {
+            uint64_t hash;
+            size_t sizeInBytes;
+            std::vector<unsigned char> png;
+        };
+        using EntryList = std::list<Entry>;
+
+        void remove(EntryList::iterator it);
+
+        size_t m_maxBytes;
+        size_t m_totalBytes = 0u;
+        // most recently used first
+        EntryList m_entries;
+        std::unordered_map<uint64_t, EntryList::iterator> m_entryLookup;
+    };
+}
+
+#endif
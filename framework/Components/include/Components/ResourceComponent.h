@@ -21,7 +21,7 @@ namespace ramses_internal
     class ResourceComponent : public IResourceProviderComponent
     {
     public:
-        ResourceComponent(StatisticCollectionFramework& statistics, PlatformLock& frameworkLock);
+        explicit ResourceComponent(StatisticCollectionFramework& statistics);
         virtual ~ResourceComponent() override;
 
         // implement IResourceProviderComponent
@@ -42,6 +42,9 @@ namespace ramses_internal
 
     private:
         ResourceStorage m_resourceStorage;
+
+        // guards resource files registry and reading from its streams, independent of framework lock
+        mutable PlatformLock m_resourceFilesLock;
         ResourceFilesRegistry m_resourceFiles;
 
         StatisticCollectionFramework& m_statistics;
@@ -33,7 +33,7 @@ namespace ramses_internal
             bool deletionAllowed;
         };
     public:
-        explicit ResourceStorage(PlatformLock& lockToUse, StatisticCollectionFramework& statistics);
+        explicit ResourceStorage(StatisticCollectionFramework& statistics);
         virtual ~ResourceStorage();
 
         ResourceInfoVector getAllResourceInfo() const;
@@ -42,7 +42,7 @@ namespace ramses_internal
         ManagedResource getResource(ResourceContentHash hash);
         ResourceHashUsage getResourceHashUsage(const ResourceContentHash& hash);
         void storeResourceInfo(const ResourceContentHash& hash, const ResourceInfo& resourceInfo);
-        const ResourceInfo& getResourceInfo(const ResourceContentHash& hash) const;
+        ResourceInfo getResourceInfo(const ResourceContentHash& hash) const;
 
         virtual void managedResourceDeleted(const IResource& resourceToRemove) override;
         virtual void resourceHashUsageZero(const ResourceContentHash& hash) override;
@@ -56,7 +56,8 @@ namespace ramses_internal
         void referenceResource(const ResourceContentHash& hash);
         void checkForDeletion(RefCntResource& entry, const ResourceContentHash& hash);
 
-        PlatformLock& m_resourceMapLock;
+        // storage is a leaf in lock order, it never calls out while holding its own lock
+        mutable PlatformLock m_resourceMapLock;
         StatisticCollectionFramework& m_statistics;
 
         using ResourceMap = HashMap<ResourceContentHash, RefCntResource>;
@@ -23,7 +23,10 @@
 #include "Utils/IPeriodicLogSupplier.h"
 #include "ISceneProviderEventConsumer.h"
 #include "TransportCommon/ServiceHandlerInterfaces.h"
+#include "Utils/StatisticCollection.h"
 #include <unordered_map>
+#include <memory>
+#include <chrono>
 #include "ERendererToClientEventType.h"
 
 namespace ramses_internal
@@ -35,7 +38,9 @@ namespace ramses_internal
     struct SceneUpdate;
     class ISceneRendererHandler;
     class SceneUpdateStreamDeserializer;
+    class SceneUpdateSerializer;
     class IResourceProviderComponent;
+    class IResource;
 
     class SceneGraphComponent final : public ISceneGraphProviderComponent,
                                       public ISceneGraphSender,
@@ -46,14 +51,14 @@ namespace ramses_internal
                                       public IPeriodicLogSupplier
     {
     public:
-        SceneGraphComponent(const Guid& myID, ICommunicationSystem& communicationSystem, IConnectionStatusUpdateNotifier& connectionStatusUpdateNotifier, IResourceProviderComponent& res, PlatformLock& frameworkLock);
+        SceneGraphComponent(const Guid& myID, ICommunicationSystem& communicationSystem, IConnectionStatusUpdateNotifier& connectionStatusUpdateNotifier, IResourceProviderComponent& res, StatisticCollectionFramework& statistics, PlatformLock& frameworkLock);
         virtual ~SceneGraphComponent() override;
 
         virtual void setSceneRendererHandler(ISceneRendererHandler* sceneRendererHandler) override;
 
         // ISceneGraphSender
         virtual void sendCreateScene(const Guid& to, const SceneId& sceneId, EScenePublicationMode mode) override;
-        virtual void sendSceneUpdate(const std::vector<Guid>& toVec, SceneUpdate&& sceneUpdate, SceneId sceneId, EScenePublicationMode mode) override;
+        virtual void sendSceneUpdate(const std::vector<Guid>& toVec, SceneUpdate&& sceneUpdate, SceneId sceneId, EScenePublicationMode mode, const SceneUpdateSerializer* remoteSerializer) override;
         virtual void sendPublishScene(SceneId sceneId, EScenePublicationMode mode, const String& name) override;
         virtual void sendUnpublishScene(SceneId sceneId, EScenePublicationMode mode) override;
 
@@ -94,6 +99,10 @@ namespace ramses_internal
     private:
         void forwardToSceneProviderEventConsumer(SceneReferenceEvent const& event);
         void forwardToSceneProviderEventConsumer(ResourceAvailabilityEvent const& event);
+        void keepResourcesOfIncompleteUpdate(SceneId sceneId, const Guid& providerID, SceneUpdateStreamDeserializer& deserializer);
+        void resumeInterruptedUpdate(SceneId sceneId, const Guid& providerID, SceneUpdateStreamDeserializer& deserializer);
+        void limitInterruptedSceneUpdatesByteSize(SceneId keptSceneId);
+        void discardExpiredInterruptedSceneUpdates();
 
         ISceneRendererHandler* m_sceneRendererHandler;
         Guid m_myID;
@@ -104,7 +113,8 @@ namespace ramses_internal
 
         HashMap<SceneId, SceneInfo> m_locallyPublishedScenes;
 
-        using ClientSceneLogicMap = HashMap<SceneId, ClientSceneLogicBase *>;
+        // shared so that a flush running without framework lock keeps its scene logic alive when the scene is removed meanwhile
+        using ClientSceneLogicMap = HashMap<SceneId, std::shared_ptr<ClientSceneLogicBase>>;
         ClientSceneLogicMap m_clientSceneLogicMap;
 
         using SceneEventConsumerMap = HashMap<SceneId, ISceneProviderEventConsumer *>;
@@ -120,6 +130,21 @@ namespace ramses_internal
         };
 
         std::unordered_map<SceneId, ReceivedScene> m_remoteScenes;
+
+        // resources already received for updates interrupted by re-initialization of the scene or by
+        // disconnect of its provider, taken over instead of received again when the same provider resends
+        // the update shortly after. Dropped when expired or when exceeding the byte limit.
+        struct InterruptedSceneUpdate
+        {
+            Guid provider;
+            std::chrono::steady_clock::time_point interruptionTime;
+            std::vector<std::unique_ptr<IResource>> resources;
+            UInt64 byteSize = 0u;
+        };
+        std::unordered_map<SceneId, InterruptedSceneUpdate> m_interruptedSceneUpdates;
+        UInt64 m_interruptedSceneUpdatesByteSize = 0u;
+
+        StatisticCollectionFramework& m_statistics;
     };
 }
 
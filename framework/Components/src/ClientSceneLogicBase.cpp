@@ -15,14 +15,18 @@
 #include "SceneUtils/ResourceUtils.h"
 #include "PlatformAbstraction/PlatformTime.h"
 #include "Utils/LogMacros.h"
+#include "Utils/TraceRecorder.h"
 #include "Utils/StatisticCollection.h"
 #include "Components/IResourceProviderComponent.h"
 #include "Components/SceneUpdate.h"
+#include "TransportCommon/SceneUpdateSerializer.h"
+#include <algorithm>
 
 namespace ramses_internal
 {
-    ClientSceneLogicBase::ClientSceneLogicBase(ISceneGraphSender& scenegraphProviderComponent, ClientScene& scene, IResourceProviderComponent& res, const Guid& clientAddress)
-        : m_scenegraphSender(scenegraphProviderComponent)
+    ClientSceneLogicBase::ClientSceneLogicBase(ISceneGraphSender& scenegraphProviderComponent, ClientScene& scene, IResourceProviderComponent& res, const Guid& clientAddress, PlatformLock& frameworkLock)
+        : m_frameworkLock(frameworkLock)
+        , m_scenegraphSender(scenegraphProviderComponent)
         , m_resourceComponent(res)
         , m_myID(clientAddress)
         , m_sceneId(scene.getSceneId())
@@ -41,6 +45,7 @@ namespace ramses_internal
 
     void ClientSceneLogicBase::publish(EScenePublicationMode publicationMode)
     {
+        PlatformGuard guard(m_sceneLogicLock);
         if (m_scenePublicationMode == EScenePublicationMode_Unpublished)
         {
             m_scenePublicationMode = publicationMode;
@@ -50,6 +55,7 @@ namespace ramses_internal
 
     void ClientSceneLogicBase::unpublish()
     {
+        PlatformGuard guard(m_sceneLogicLock);
         if (m_scenePublicationMode != EScenePublicationMode_Unpublished)
         {
             m_scenegraphSender.sendUnpublishScene(m_sceneId, m_scenePublicationMode);
@@ -64,11 +70,13 @@ namespace ramses_internal
 
     bool ClientSceneLogicBase::isPublished() const
     {
+        PlatformGuard guard(m_sceneLogicLock);
         return m_scenePublicationMode != EScenePublicationMode_Unpublished;
     }
 
     void ClientSceneLogicBase::addSubscriber(const Guid& newSubscriber)
     {
+        PlatformGuard guard(m_sceneLogicLock);
         if (contains_c(m_subscribersActive, newSubscriber) || contains_c(m_subscribersWaitingForScene, newSubscriber))
         {
             LOG_WARN(CONTEXT_CLIENT, "ClientSceneLogic::addSubscriber: already has " << newSubscriber << " for scene " << m_sceneId);
@@ -82,6 +90,7 @@ namespace ramses_internal
 
     void ClientSceneLogicBase::removeSubscriber(const Guid& subscriber)
     {
+        PlatformGuard guard(m_sceneLogicLock);
         auto it = find_c(m_subscribersActive, subscriber);
         if (it != m_subscribersActive.end())
         {
@@ -101,11 +110,71 @@ namespace ramses_internal
 
     std::vector<Guid> ClientSceneLogicBase::getWaitingAndActiveSubscribers() const
     {
+        PlatformGuard guard(m_sceneLogicLock);
         std::vector<Guid> result(m_subscribersActive);
         result.insert(result.end(), m_subscribersWaitingForScene.begin(), m_subscribersWaitingForScene.end());
         return result;
     }
 
+    bool ClientSceneLogicBase::flushSceneActions(const FlushTimeInformation& flushTimeInfo, SceneVersionTag versionTag)
+    {
+        TraceScope traceScope("client", "flushSceneActions", m_sceneId.getValue());
+        SceneUpdate sceneUpdate;
+        bool sendSceneUpdate = false;
+        AddressVector receivers;
+        std::unique_ptr<SceneUpdateSerializer> remoteSerializer;
+        {
+            // collecting and applying actions only touches this scene, flushes of other scenes can run concurrently
+            PlatformGuard sceneGuard(m_sceneLogicLock);
+            TraceScope prepareScope("client", "prepareFlush", m_sceneId.getValue());
+            if (!prepareFlush(flushTimeInfo, versionTag, sceneUpdate, sendSceneUpdate))
+                return false;
+            prepareScope.setFlushIndex(sceneUpdate.flushInfos.flushCounter);
+            traceScope.setFlushIndex(sceneUpdate.flushInfos.flushCounter);
+            m_flushPendingForSending = true;
+
+            // until sending, active subscribers can only be removed, new ones get the whole scene instead of this update.
+            // Compressing and serializing for remote subscribers is the expensive part of sending, it needs no framework lock
+            if (sendSceneUpdate)
+            {
+                receivers = m_subscribersActive;
+                remoteSerializer = createSerializerForRemoteSubscribers(receivers, sceneUpdate);
+            }
+        }
+
+        // sending uses shared framework state (communication system, local renderer)
+        PlatformGuard frameworkGuard(m_frameworkLock);
+        PlatformGuard sceneGuard(m_sceneLogicLock);
+        m_flushPendingForSending = false;
+
+        if (sendSceneUpdate && isPublished())
+        {
+            receivers.erase(std::remove_if(receivers.begin(), receivers.end(), [&](const Guid& sub) {
+                return !contains_c(m_subscribersActive, sub) || contains_c(m_subscribersSkippingPendingFlush, sub);
+            }), receivers.end());
+
+            if (!receivers.empty())
+            {
+                m_scene.getStatisticCollection().statSceneActionsSent.incCounter(sceneUpdate.actions.numberOfActions() * static_cast<UInt32>(receivers.size()));
+                m_scenegraphSender.sendSceneUpdate(receivers, std::move(sceneUpdate), m_sceneId, m_scenePublicationMode, remoteSerializer.get());
+            }
+        }
+        m_subscribersSkippingPendingFlush.clear();
+
+        finishFlush(flushTimeInfo, versionTag);
+
+        return true;
+    }
+
+    std::unique_ptr<SceneUpdateSerializer> ClientSceneLogicBase::createSerializerForRemoteSubscribers(const AddressVector& subscribers, const SceneUpdate& sceneUpdate) const
+    {
+        if (std::all_of(subscribers.cbegin(), subscribers.cend(), [&](const Guid& sub) { return sub == m_myID; }))
+            return nullptr;
+
+        TraceScope traceScope("client", "serializeSceneUpdate", m_sceneId.getValue(), sceneUpdate.flushInfos.flushCounter);
+        return std::make_unique<SceneUpdateSerializer>(sceneUpdate, IResource::CompressionLevel::REALTIME);
+    }
+
     void ClientSceneLogicBase::sendSceneToWaitingSubscribers(const IScene& scene, const FlushTimeInformation& flushTimeInfo, SceneVersionTag versionTag)
     {
         if (m_subscribersWaitingForScene.empty())
@@ -115,6 +184,7 @@ namespace ramses_internal
         }
 
         SceneUpdate sceneUpdate;
+        sceneUpdate.actions.setEncoding(getSceneActionEncoding(m_subscribersWaitingForScene));
         SceneActionCollectionCreator creator(sceneUpdate.actions);
         SceneDescriber::describeScene<IScene>(scene, creator);
 
@@ -139,8 +209,11 @@ namespace ramses_internal
             m_scenegraphSender.sendCreateScene(subscriber, m_sceneId, m_scenePublicationMode);
         }
         m_scene.getStatisticCollection().statSceneActionsSent.incCounter(sceneUpdate.actions.numberOfActions()*static_cast<UInt32>(m_subscribersWaitingForScene.size()));
-        m_scenegraphSender.sendSceneUpdate(m_subscribersWaitingForScene, std::move(sceneUpdate), m_sceneId, m_scenePublicationMode);
+        const auto remoteSerializer = createSerializerForRemoteSubscribers(m_subscribersWaitingForScene, sceneUpdate);
+        m_scenegraphSender.sendSceneUpdate(m_subscribersWaitingForScene, std::move(sceneUpdate), m_sceneId, m_scenePublicationMode, remoteSerializer.get());
 
+        if (m_flushPendingForSending)
+            m_subscribersSkippingPendingFlush.insert(m_subscribersSkippingPendingFlush.end(), m_subscribersWaitingForScene.begin(), m_subscribersWaitingForScene.end());
         m_subscribersActive.insert(m_subscribersActive.end(), m_subscribersWaitingForScene.begin(), m_subscribersWaitingForScene.end());
         m_subscribersWaitingForScene.clear();
     }
@@ -175,6 +248,7 @@ namespace ramses_internal
 
     const char* ClientSceneLogicBase::getSceneStateString() const
     {
+        PlatformGuard guard(m_sceneLogicLock);
         if (m_subscribersActive.size() > 0)
         {
             return "Subscribed";
@@ -223,4 +297,18 @@ namespace ramses_internal
 
         return true;
     }
+
+    ESceneActionEncoding ClientSceneLogicBase::getSceneActionEncoding(const AddressVector& subscribers) const
+    {
+        const bool hasRemoteSubscriber = std::any_of(subscribers.cbegin(), subscribers.cend(), [&](const Guid& subscriber) { return subscriber != m_myID; });
+        return hasRemoteSubscriber ? ESceneActionEncoding::Compact : ESceneActionEncoding::Fixed;
+    }
+
+    void ClientSceneLogicBase::selectSceneActionEncodingForNextFlush()
+    {
+        // waiting subscribers become active with the next flush and receive the actions collected until then
+        const bool useCompact = getSceneActionEncoding(m_subscribersActive) == ESceneActionEncoding::Compact ||
+            getSceneActionEncoding(m_subscribersWaitingForScene) == ESceneActionEncoding::Compact;
+        m_scene.getSceneActionCollection().setEncoding(useCompact ? ESceneActionEncoding::Compact : ESceneActionEncoding::Fixed);
+    }
 }
@@ -22,17 +22,16 @@
 
 namespace ramses_internal
 {
-    ClientSceneLogicDirect::ClientSceneLogicDirect(ISceneGraphSender& sceneGraphSender, ClientScene& scene, IResourceProviderComponent& res, const Guid& clientAddress)
-        : ClientSceneLogicBase(sceneGraphSender, scene, res, clientAddress)
+    ClientSceneLogicDirect::ClientSceneLogicDirect(ISceneGraphSender& sceneGraphSender, ClientScene& scene, IResourceProviderComponent& res, const Guid& clientAddress, PlatformLock& frameworkLock)
+        : ClientSceneLogicBase(sceneGraphSender, scene, res, clientAddress, frameworkLock)
         , m_previousSceneSizes(m_scene.getSceneSizeInformation())
     {
     }
 
-    bool ClientSceneLogicDirect::flushSceneActions(const FlushTimeInformation& flushTimeInfo, SceneVersionTag versionTag)
+    bool ClientSceneLogicDirect::prepareFlush(const FlushTimeInformation& flushTimeInfo, SceneVersionTag versionTag, SceneUpdate& sceneUpdate, bool& sendSceneUpdate)
     {
         const bool hasNewActions = !m_scene.getSceneActionCollection().empty();
 
-        SceneUpdate sceneUpdate;
         if (!verifyAndGetResourceChanges(sceneUpdate, hasNewActions))
         {
             LOG_ERROR(CONTEXT_CLIENT, "ClientSceneLogicDirect::flushSceneActions: At least one resource can't be loaded, Scene can't be rendered. Consult log and run Scene::validate() for more information");
@@ -43,6 +42,7 @@ namespace ramses_internal
 
         // swap out of ClientScene and reserve new memory there
         sceneUpdate.actions.swap(m_scene.getSceneActionCollection());
+        selectSceneActionEncodingForNextFlush();
 
         if (m_flushCounter == 0)
         {
@@ -80,20 +80,19 @@ namespace ramses_internal
 
         LOG_DEBUG_F(CONTEXT_CLIENT, ([&](StringOutputStream& sos) { printFlushInfo(sos, "ClientSceneLogicDirect::flushSceneActions", sceneUpdate.actions); }));
 
-        if (isPublished() && !m_subscribersActive.empty())
-        {
-            m_scene.getStatisticCollection().statSceneActionsSent.incCounter(sceneUpdate.actions.numberOfActions()*static_cast<UInt32>(m_subscribersActive.size()));
-            m_scenegraphSender.sendSceneUpdate(m_subscribersActive, std::move(sceneUpdate), m_sceneId, m_scenePublicationMode);
-        }
+        sendSceneUpdate = isPublished();
 
         m_scene.resetResourceChanges();
         m_scene.resetSceneReferenceActions();
 
+        return true;
+    }
+
+    void ClientSceneLogicDirect::finishFlush(const FlushTimeInformation& flushTimeInfo, SceneVersionTag versionTag)
+    {
         if (isPublished())
         {
             sendSceneToWaitingSubscribers(m_scene, flushTimeInfo, versionTag);
         }
-
-        return true;
     }
 }
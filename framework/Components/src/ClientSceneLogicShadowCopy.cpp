@@ -18,14 +18,14 @@
 #include "Components/FlushTimeInformation.h"
 #include "Components/IResourceProviderComponent.h"
 #include "Components/SceneUpdate.h"
+#include <algorithm>
 
 namespace ramses_internal
 {
-    ClientSceneLogicShadowCopy::ClientSceneLogicShadowCopy(ISceneGraphSender& sceneGraphSender, ClientScene& scene, IResourceProviderComponent& res, const Guid& clientAddress)
-        : ClientSceneLogicBase(sceneGraphSender, scene, res, clientAddress)
-        , m_sceneShadowCopy(SceneInfo(scene.getSceneId(), scene.getName()))
+    ClientSceneLogicShadowCopy::ClientSceneLogicShadowCopy(ISceneGraphSender& sceneGraphSender, ClientScene& scene, IResourceProviderComponent& res, const Guid& clientAddress, PlatformLock& frameworkLock)
+        : ClientSceneLogicBase(sceneGraphSender, scene, res, clientAddress, frameworkLock)
+        , m_sceneSizesOfLastFlush(m_scene.getSceneSizeInformation())
     {
-        m_sceneShadowCopy.preallocateSceneSize(m_scene.getSceneSizeInformation());
     }
 
     void ClientSceneLogicShadowCopy::postAddSubscriber()
@@ -33,11 +33,10 @@ namespace ramses_internal
         sendShadowCopySceneToWaitingSubscribers();
     }
 
-    bool ClientSceneLogicShadowCopy::flushSceneActions(const FlushTimeInformation& flushTimeInfo, SceneVersionTag versionTag)
+    bool ClientSceneLogicShadowCopy::prepareFlush(const FlushTimeInformation& flushTimeInfo, SceneVersionTag versionTag, SceneUpdate& sceneUpdate, bool& sendSceneUpdate)
     {
         const bool hasNewActions = !m_scene.getSceneActionCollection().empty();
 
-        SceneUpdate sceneUpdate;
         if (!verifyAndGetResourceChanges(sceneUpdate, hasNewActions))
         {
             LOG_ERROR(CONTEXT_CLIENT, "ClientSceneLogicShadowCopy::flushSceneActions: At least one resource can not be loaded, Scene is not valid. Consult previous log messages or run Scene::validate() for more information.");
@@ -48,7 +47,10 @@ namespace ramses_internal
 
         // swap out of ClientScene and reserve new memory there
         sceneUpdate.actions.swap(m_scene.getSceneActionCollection());
-        m_lastFlushUsedResources = m_resourceComponent.resolveResources(m_lastFlushClientResourcesInUse); // keep ll resources alive, in case we need to send a scene update to a new subscriber
+        selectSceneActionEncodingForNextFlush();
+        // keep all resources alive, in case we need to send a scene update to a new subscriber, resolve only if set of used resources changed
+        if (!m_resourceChanges.m_resourcesAdded.empty() || !m_resourceChanges.m_resourcesRemoved.empty())
+            m_lastFlushUsedResources = m_resourceComponent.resolveResources(m_lastFlushClientResourcesInUse);
 
         if (m_flushCounter == 0)
         {
@@ -75,36 +77,29 @@ namespace ramses_internal
 
         if (isPublished())
         {
-            sceneUpdate.flushInfos = { m_flushCounter, versionTag, sceneSizes, m_resourceChanges, m_scene.getSceneReferenceActions(), flushTimeInfo,sceneSizes > m_sceneShadowCopy.getSceneSizeInformation(), true };
+            sceneUpdate.flushInfos = { m_flushCounter, versionTag, sceneSizes, m_resourceChanges, m_scene.getSceneReferenceActions(), flushTimeInfo, sceneSizes > m_sceneSizesOfLastFlush, true };
             SceneActionCollectionCreator creator(sceneUpdate.actions);
         }
 
         // reserve memory in ClientScene after flush because flush might add a lot of data
         m_scene.getSceneActionCollection().reserveAdditionalCapacity(sceneUpdate.actions.collectionData().size(), sceneUpdate.actions.numberOfActions());
 
+        m_sceneSizesOfLastFlush = sceneSizes;
         if (hasNewActions)
         {
-            m_sceneShadowCopy.preallocateSceneSize(sceneSizes);
-            SceneActionApplier::ApplyActionsOnScene(m_sceneShadowCopy, sceneUpdate.actions, &m_animationSystemFactory);
+            appendToShadowCopyLog(sceneUpdate.actions);
             m_scene.getStatisticCollection().statSceneActionsGenerated.incCounter(sceneUpdate.actions.numberOfActions());
             m_scene.getStatisticCollection().statSceneActionsGeneratedSize.incCounter(static_cast<UInt32>(sceneUpdate.actions.collectionData().size()));
         }
 
         LOG_DEBUG_F(CONTEXT_CLIENT, ([&](StringOutputStream& sos) { printFlushInfo(sos, "ClientSceneLogicShadowCopy::flushSceneActions", sceneUpdate.actions); }));
 
-        if (isPublished() && !m_subscribersActive.empty())
+        if (isPublished() && !m_subscribersActive.empty() && skipSceneActionSend)
         {
-            if (skipSceneActionSend)
-            {
-                LOG_DEBUG(CONTEXT_CLIENT, "ClientSceneLogicShadowCopy::flushSceneActions: skip flush for sceneId " << m_sceneId << ", cnt " << m_flushCounter << " because empty");
-                m_scene.getStatisticCollection().statSceneActionsSentSkipped.incCounter(1);
-            }
-            else
-            {
-                m_scene.getStatisticCollection().statSceneActionsSent.incCounter(sceneUpdate.actions.numberOfActions() * static_cast<UInt32>(m_subscribersActive.size()));
-                m_scenegraphSender.sendSceneUpdate(m_subscribersActive, std::move(sceneUpdate), m_sceneId, m_scenePublicationMode);
-            }
+            LOG_DEBUG(CONTEXT_CLIENT, "ClientSceneLogicShadowCopy::flushSceneActions: skip flush for sceneId " << m_sceneId << ", cnt " << m_flushCounter << " because empty");
+            m_scene.getStatisticCollection().statSceneActionsSentSkipped.incCounter(1);
         }
+        sendSceneUpdate = isPublished() && !skipSceneActionSend;
 
         m_scene.resetResourceChanges();
         m_scene.resetSceneReferenceActions();
@@ -114,13 +109,16 @@ namespace ramses_internal
         if (versionTag.isValid())
             m_lastVersionTag = versionTag;
 
+        return true;
+    }
+
+    void ClientSceneLogicShadowCopy::finishFlush(const FlushTimeInformation& /*flushTimeInfo*/, SceneVersionTag /*versionTag*/)
+    {
         // send to subscribers if flushed for first time
         if (m_flushCounter == 1u)
         {
             sendShadowCopySceneToWaitingSubscribers();
         }
-
-        return true;
     }
 
     void ClientSceneLogicShadowCopy::sendShadowCopySceneToWaitingSubscribers()
@@ -132,6 +130,38 @@ namespace ramses_internal
             return;
         }
 
-        sendSceneToWaitingSubscribers(m_sceneShadowCopy, m_flushTimeInfoOfLastFlush, m_lastVersionTag);
+        if (m_subscribersWaitingForScene.empty())
+            return;
+
+        SceneWithExplicitMemory sceneShadowCopy(SceneInfo(m_sceneId, m_scene.getName()));
+        sceneShadowCopy.preallocateSceneSize(m_sceneSizesOfLastFlush);
+        SceneActionApplier::ApplyActionsOnScene(sceneShadowCopy, m_shadowCopyLog, &m_animationSystemFactory);
+        LOG_DEBUG(CONTEXT_CLIENT, "ClientSceneLogicShadowCopy::sendShadowCopySceneToWaitingSubscribers: built shadow copy of scene " << m_sceneId <<
+            " from " << m_shadowCopyLog.numberOfActions() << " logged actions (" << m_shadowCopyLog.collectionData().size() << " bytes)");
+
+        sendSceneToWaitingSubscribers(sceneShadowCopy, m_flushTimeInfoOfLastFlush, m_lastVersionTag);
+    }
+
+    void ClientSceneLogicShadowCopy::appendToShadowCopyLog(const SceneActionCollection& actions)
+    {
+        static const UInt MinimumSizeForCompaction = 64u * 1024u;
+
+        // encoding follows the subscribers, a log with different encoding is rebuilt instead of appended to
+        const bool encodingChanged = !m_shadowCopyLog.empty() && m_shadowCopyLog.getEncoding() != actions.getEncoding();
+        if (!encodingChanged)
+        {
+            m_shadowCopyLog.append(actions);
+            if (m_shadowCopyLog.collectionData().size() <= std::max(MinimumSizeForCompaction, 2u * m_shadowCopyLogCompactedSize))
+                return;
+        }
+
+        // all flushed actions were swapped out of the client scene before, so it holds exactly the flushed state
+        m_shadowCopyLog.clear();
+        m_shadowCopyLog.setEncoding(actions.getEncoding());
+        SceneActionCollectionCreator creator(m_shadowCopyLog);
+        SceneDescriber::describeScene<IScene>(m_scene, creator);
+        m_shadowCopyLogCompactedSize = m_shadowCopyLog.collectionData().size();
+        LOG_DEBUG(CONTEXT_CLIENT, "ClientSceneLogicShadowCopy::appendToShadowCopyLog: compacted log of scene " << m_sceneId << " to " <<
+            m_shadowCopyLog.numberOfActions() << " actions (" << m_shadowCopyLogCompactedSize << " bytes)");
     }
 }
@@ -239,6 +239,9 @@ namespace ramses_internal
             return;
         }
 
+        m_previewImagesSentToConsumer.remove(from);
+        m_previewImagesReceivedFromProvider.remove(from);
+
         // stop offer locally
         if (m_localConsumerAvailable)
         {
@@ -612,9 +615,15 @@ namespace ramses_internal
         if (!isLocallyProvidingContent(methodName, contentID))
             return false;
 
-        // send out update only but store merged state for later consumers
+        // send out changed fields only but store merged state for later consumers
         ContentInfo& ci = m_contentRegistry[contentID];
-        ci.metadata.updateFromOther(metadata);
+        const DcsmMetadata changes = metadata.getChangedFields(ci.metadata);
+        if (changes.empty())
+        {
+            LOG_INFO(CONTEXT_DCSM, "DcsmComponent(" << m_myID << ")::sendUpdateContentMetadata: metadata unchanged, skip sending for content " << contentID);
+            return true;
+        }
+        ci.metadata.updateFromOther(changes);
 
         if (ci.state == ContentState::Assigned ||
             ci.state == ContentState::ReadyRequested ||
@@ -628,10 +637,10 @@ namespace ramses_internal
             if (m_myID == to)
             {
                 assert(m_localConsumerAvailable && "Logic error on consumer disable");
-                addConsumerEvent_UpdateContentMetadata(contentID, metadata, m_myID);
+                addConsumerEvent_UpdateContentMetadata(contentID, changes, m_myID);
             }
             else
-                m_communicationSystem.sendDcsmUpdateContentMetadata(to, contentID, metadata);
+                sendUpdateContentMetadataToRemote(to, contentID, changes);
         }
         return true;
     }
@@ -1054,7 +1063,7 @@ namespace ramses_internal
             if(ci->contentDescriptor.isValid())
                 m_communicationSystem.sendDcsmContentDescription(consumerID, contentID, ci->contentDescriptor);
             if (!ci->metadata.empty())
-                m_communicationSystem.sendDcsmUpdateContentMetadata(consumerID, contentID, ci->metadata);
+                sendUpdateContentMetadataToRemote(consumerID, contentID, ci->metadata);
             for (auto& req : ci->m_currentFocusRequests)
                 m_communicationSystem.sendDcsmContentEnableFocusRequest(consumerID, contentID, req);
         }
@@ -1347,6 +1356,12 @@ namespace ramses_internal
     {
         LOG_INFO(CONTEXT_DCSM, "DcsmComponent(" << m_myID << ")::handleUpdateContentMetadata: from " << providerID << ", ContentID " << contentID << ", metadata " << metadata);
 
+        // the provider expects every sent preview image to be known from now on, even if the update is rejected below,
+        // e.g. when received before the connect of the provider was handled
+        if (!resolveReceivedPreviewImage(metadata, providerID))
+            LOG_ERROR(CONTEXT_DCSM, "DcsmComponent(" << m_myID << ")::handleUpdateContentMetadata: received from " << providerID << " for content " << contentID <<
+                      " with unknown preview image reference " << metadata.getPreviewImageHash() << ", ignore preview image");
+
         const char* methodName = "handleUpdateContentMetadata";
         if (!isAllowedToReceiveFrom(methodName, providerID))
             return;
@@ -1376,6 +1391,47 @@ namespace ramses_internal
         addConsumerEvent_UpdateContentMetadata(contentID, std::move(metadata), providerID);
     }
 
+    void DcsmComponent::sendUpdateContentMetadataToRemote(const Guid& to, ContentID contentID, const DcsmMetadata& metadata)
+    {
+        if (metadata.hasPreviewImagePng())
+        {
+            DcsmPreviewImageCache& sentPreviewImages = m_previewImagesSentToConsumer[to];
+            if (sentPreviewImages.use(metadata.getPreviewImageHash()))
+            {
+                DcsmMetadata metadataWithReference(metadata);
+                metadataWithReference.replacePreviewImagePngByReference();
+                m_communicationSystem.sendDcsmUpdateContentMetadata(to, contentID, metadataWithReference);
+                return;
+            }
+            // only size is needed to mirror the consumer's cache
+            sentPreviewImages.add(metadata.getPreviewImageHash(), metadata.getPreviewImagePng().size());
+        }
+
+        m_communicationSystem.sendDcsmUpdateContentMetadata(to, contentID, metadata);
+    }
+
+    bool DcsmComponent::resolveReceivedPreviewImage(DcsmMetadata& metadata, const Guid& providerID)
+    {
+        auto& receivedPreviewImages = m_previewImagesReceivedFromProvider[providerID];
+        if (metadata.hasPreviewImagePng())
+        {
+            std::vector<unsigned char> previewImage = metadata.getPreviewImagePng();
+            const size_t previewImageSize = previewImage.size();
+            receivedPreviewImages.add(metadata.getPreviewImageHash(), previewImageSize, std::move(previewImage));
+        }
+        else if (metadata.hasPreviewImageReference())
+        {
+            const std::vector<unsigned char>* previewImage = receivedPreviewImages.use(metadata.getPreviewImageHash());
+            if (!previewImage)
+            {
+                metadata.clearPreviewImagePng();
+                return false;
+            }
+            metadata.resolvePreviewImageReference(*previewImage);
+        }
+        return true;
+    }
+
     bool DcsmComponent::dispatchProviderEvents(IDcsmProviderEventHandler& handler)
     {
         if (!m_localProviderAvailable)
@@ -11,6 +11,7 @@
 #include "Utils/BinaryOutputStream.h"
 #include "Utils/BinaryInputStream.h"
 #include "lodepng.h"
+#include "city.h"
 #include <cassert>
 
 namespace ramses_internal
@@ -32,9 +33,15 @@ namespace ramses_internal
             WidgetCarModelView = 7,
             WidgetCarModelVisibility = 8,
             WidgetExclusiveBackground = 9,
-            WidgetStreamID = 10
+            WidgetStreamID = 10,
+            PreviewImagePngReference = 11
         };
 
+        uint64_t HashPreviewImage(const std::vector<unsigned char>& png)
+        {
+            return cityhash::CityHash64(reinterpret_cast<const char*>(png.data()), png.size());
+        }
+
         constexpr const uint32_t CurrentMetadataVersion = 1;
     }
 
@@ -75,7 +82,13 @@ namespace ramses_internal
            << numEntries;
 
         // write entries
-        if (m_hasPreviewImagePng)
+        if (m_hasPreviewImagePng && m_previewImageIsReference)
+        {
+            os << DcsmMetadataType::PreviewImagePngReference
+               << static_cast<uint32_t>(sizeof(m_previewImageHash))
+               << m_previewImageHash;
+        }
+        else if (m_hasPreviewImagePng)
         {
             const uint32_t size = static_cast<uint32_t>(m_previewImagePng.size());
             os << DcsmMetadataType::PreviewImagePng
@@ -190,8 +203,17 @@ namespace ramses_internal
             {
             case DcsmMetadataType::PreviewImagePng:
                 m_hasPreviewImagePng = true;
+                m_previewImageIsReference = false;
                 m_previewImagePng.resize(size);    // TODO(tobias) avoid zero init
                 is.read(m_previewImagePng.data(), size);
+                m_previewImageHash = HashPreviewImage(m_previewImagePng);
+                break;
+
+            case DcsmMetadataType::PreviewImagePngReference:
+                m_hasPreviewImagePng = true;
+                m_previewImageIsReference = true;
+                m_previewImagePng.clear();
+                is >> m_previewImageHash;
                 break;
 
             case DcsmMetadataType::PreviewDescription:
@@ -274,7 +296,9 @@ namespace ramses_internal
         if (other.m_hasPreviewImagePng)
         {
             m_hasPreviewImagePng = true;
+            m_previewImageIsReference = other.m_previewImageIsReference;
             m_previewImagePng = other.m_previewImagePng;
+            m_previewImageHash = other.m_previewImageHash;
         }
         if (other.m_hasPreviewDescription)
         {
@@ -324,6 +348,100 @@ namespace ramses_internal
         }
     }
 
+    DcsmMetadata DcsmMetadata::getChangedFields(const DcsmMetadata& base) const
+    {
+        DcsmMetadata changes;
+        if (m_hasPreviewImagePng && (!base.m_hasPreviewImagePng || m_previewImageIsReference != base.m_previewImageIsReference ||
+            m_previewImageHash != base.m_previewImageHash || m_previewImagePng != base.m_previewImagePng))
+        {
+            changes.m_hasPreviewImagePng = true;
+            changes.m_previewImageIsReference = m_previewImageIsReference;
+            changes.m_previewImagePng = m_previewImagePng;
+            changes.m_previewImageHash = m_previewImageHash;
+        }
+        if (m_hasPreviewDescription && (!base.m_hasPreviewDescription || m_previewDescription != base.m_previewDescription))
+        {
+            changes.m_hasPreviewDescription = true;
+            changes.m_previewDescription = m_previewDescription;
+        }
+        if (m_hasWidgetOrder && (!base.m_hasWidgetOrder || m_widgetOrder != base.m_widgetOrder))
+        {
+            changes.m_hasWidgetOrder = true;
+            changes.m_widgetOrder = m_widgetOrder;
+        }
+        if (m_hasWidgetBackgroundID && (!base.m_hasWidgetBackgroundID || m_widgetBackgroundID != base.m_widgetBackgroundID))
+        {
+            changes.m_hasWidgetBackgroundID = true;
+            changes.m_widgetBackgroundID = m_widgetBackgroundID;
+        }
+        if (m_hasWidgetHUDLineID && (!base.m_hasWidgetHUDLineID || m_widgetHUDLineID != base.m_widgetHUDLineID))
+        {
+            changes.m_hasWidgetHUDLineID = true;
+            changes.m_widgetHUDLineID = m_widgetHUDLineID;
+        }
+        if (m_hasCarModel && (!base.m_hasCarModel || m_carModel != base.m_carModel))
+        {
+            changes.m_hasCarModel = true;
+            changes.m_carModel = m_carModel;
+        }
+        if (m_hasCarModelView && (!base.m_hasCarModelView || m_carModelView != base.m_carModelView || !(m_carModelViewTiming == base.m_carModelViewTiming)))
+        {
+            changes.m_hasCarModelView = true;
+            changes.m_carModelView = m_carModelView;
+            changes.m_carModelViewTiming = m_carModelViewTiming;
+        }
+        if (m_hasCarModelVisibility && (!base.m_hasCarModelVisibility || m_carModelVisibility != base.m_carModelVisibility))
+        {
+            changes.m_hasCarModelVisibility = true;
+            changes.m_carModelVisibility = m_carModelVisibility;
+        }
+        if (m_hasExclusiveBackground && (!base.m_hasExclusiveBackground || m_exclusiveBackground != base.m_exclusiveBackground))
+        {
+            changes.m_hasExclusiveBackground = true;
+            changes.m_exclusiveBackground = m_exclusiveBackground;
+        }
+        if (m_hasStreamID && (!base.m_hasStreamID || m_streamID != base.m_streamID))
+        {
+            changes.m_hasStreamID = true;
+            changes.m_streamID = m_streamID;
+        }
+        return changes;
+    }
+
+    uint64_t DcsmMetadata::getPreviewImageHash() const
+    {
+        return m_previewImageHash;
+    }
+
+    bool DcsmMetadata::hasPreviewImageReference() const
+    {
+        return m_hasPreviewImagePng && m_previewImageIsReference;
+    }
+
+    void DcsmMetadata::replacePreviewImagePngByReference()
+    {
+        assert(hasPreviewImagePng());
+        m_previewImagePng.clear();
+        m_previewImagePng.shrink_to_fit();
+        m_previewImageIsReference = true;
+    }
+
+    void DcsmMetadata::resolvePreviewImageReference(std::vector<unsigned char> previewImagePng)
+    {
+        assert(hasPreviewImageReference());
+        assert(HashPreviewImage(previewImagePng) == m_previewImageHash);
+        m_previewImagePng = std::move(previewImagePng);
+        m_previewImageIsReference = false;
+    }
+
+    void DcsmMetadata::clearPreviewImagePng()
+    {
+        m_previewImagePng.clear();
+        m_previewImageHash = 0;
+        m_hasPreviewImagePng = false;
+        m_previewImageIsReference = false;
+    }
+
     bool DcsmMetadata::setPreviewImagePng(const void* data, size_t dataLength)
     {
         LOG_INFO(CONTEXT_DCSM, "DcsmMetadata::setPreviewImagePng: Length " << dataLength);
@@ -359,7 +477,9 @@ namespace ramses_internal
 
         m_previewImagePng.clear();
         m_previewImagePng.insert(m_previewImagePng.end(), dataC, dataC + dataLength);
+        m_previewImageHash = HashPreviewImage(m_previewImagePng);
         m_hasPreviewImagePng = true;
+        m_previewImageIsReference = false;
 
         return true;
     }
@@ -448,7 +568,7 @@ namespace ramses_internal
 
     bool DcsmMetadata::hasPreviewImagePng() const
     {
-        return m_hasPreviewImagePng;
+        return m_hasPreviewImagePng && !m_previewImageIsReference;
     }
 
     bool DcsmMetadata::hasPreviewDescription() const
@@ -554,6 +674,8 @@ namespace ramses_internal
     bool DcsmMetadata::operator==(const DcsmMetadata& other) const
     {
         return m_hasPreviewImagePng == other.m_hasPreviewImagePng &&
+            m_previewImageIsReference == other.m_previewImageIsReference &&
+            m_previewImageHash == other.m_previewImageHash &&
             m_hasPreviewDescription == other.m_hasPreviewDescription &&
             m_previewImagePng == other.m_previewImagePng &&
             m_previewDescription == other.m_previewDescription &&
@@ -0,0 +1,66 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2020 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "Components/DcsmPreviewImageCache.h"
+#include <cassert>
+
+namespace ramses_internal
+{
+    DcsmPreviewImageCache::DcsmPreviewImageCache(size_t maxBytes)
+        : m_maxBytes(maxBytes)
+    {
+    }
+
+    const std::vector<unsigned char>* DcsmPreviewImageCache::use(uint64_t hash)
+    {
+        const auto it = m_entryLookup.find(hash);
+        if (it == m_entryLookup.end())
+            return nullptr;
+
+        m_entries.splice(m_entries.begin(), m_entries, it->second);
+        return &it->second->png;
+    }
+
+    void DcsmPreviewImageCache::add(uint64_t hash, size_t sizeInBytes, std::vector<unsigned char> png)
+    {
+        const auto it = m_entryLookup.find(hash);
+        if (it != m_entryLookup.end())
+            remove(it->second);
+
+        if (sizeInBytes > m_maxBytes)
+            return;
+
+        while (m_totalBytes + sizeInBytes > m_maxBytes)
+        {
+            assert(!m_entries.empty());
+            remove(std::prev(m_entries.end()));
+        }
+
+        m_entries.push_front({ hash, sizeInBytes, std::move(png) });
+        m_entryLookup[hash] = m_entries.begin();
+        m_totalBytes += sizeInBytes;
+    }
+
+    size_t DcsmPreviewImageCache::getNumberOfImages() const
+    {
+        return m_entries.size();
+    }
+
+    size_t DcsmPreviewImageCache::getTotalBytes() const
+    {
+        return m_totalBytes;
+    }
+
+    void DcsmPreviewImageCache::remove(EntryList::iterator it)
+    {
+        assert(m_totalBytes >= it->sizeInBytes);
+        m_totalBytes -= it->sizeInBytes;
+        m_entryLookup.erase(it->hash);
+        m_entries.erase(it);
+    }
+}
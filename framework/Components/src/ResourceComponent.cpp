@@ -13,8 +13,8 @@
 
 namespace ramses_internal
 {
-    ResourceComponent::ResourceComponent(StatisticCollectionFramework& statistics, PlatformLock& frameworkLock)
-        : m_resourceStorage(frameworkLock, statistics)
+    ResourceComponent::ResourceComponent(StatisticCollectionFramework& statistics)
+        : m_resourceStorage(statistics)
         , m_statistics(statistics)
     {
     }
@@ -45,6 +45,7 @@ namespace ramses_internal
 
     void ResourceComponent::addResourceFile(ResourceFileInputStreamSPtr resourceFileInputStream, const ramses_internal::ResourceTableOfContents& toc)
     {
+        PlatformGuard guard(m_resourceFilesLock);
         for (const auto& item : toc.getFileContents())
         {
             m_resourceStorage.storeResourceInfo(item.key, item.value.resourceInfo);
@@ -54,11 +55,13 @@ namespace ramses_internal
 
     bool ResourceComponent::hasResourceFile(const String& resourceFileName) const
     {
+        PlatformGuard guard(m_resourceFilesLock);
         return m_resourceFiles.hasResourceFile(resourceFileName);
     }
 
     void ResourceComponent::loadResourceFromFile(const String& resourceFileName)
     {
+        PlatformGuard guard(m_resourceFilesLock);
         // If resources of a file are loaded, check if they are in use by any scene object (=hashusage) or as a resource
         // a) If they are in use, we need to load them from file, also remove the deletion allowed flag from
         // them, because they is not supposed to be loadable anymore.
@@ -86,11 +89,13 @@ namespace ramses_internal
 
     void ResourceComponent::removeResourceFile(const String& resourceFileName)
     {
+        PlatformGuard guard(m_resourceFilesLock);
         m_resourceFiles.unregisterResourceFile(resourceFileName);
     }
 
     ManagedResource ResourceComponent::loadResource(const ResourceContentHash& hash)
     {
+        PlatformGuard guard(m_resourceFilesLock);
         BinaryFileInputStream* resourceStream(nullptr);
         ResourceFileEntry entry;
         const EStatus canLoadFromFile = m_resourceFiles.getEntry(hash, resourceStream, entry);
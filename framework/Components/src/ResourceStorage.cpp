@@ -13,9 +13,8 @@
 
 namespace ramses_internal
 {
-    ResourceStorage::ResourceStorage(PlatformLock& lockToUse, StatisticCollectionFramework& statistics)
-        : m_resourceMapLock(lockToUse)
-        , m_statistics(statistics)
+    ResourceStorage::ResourceStorage(StatisticCollectionFramework& statistics)
+        : m_statistics(statistics)
     {
     }
 
@@ -109,6 +108,7 @@ namespace ramses_internal
 
     void ResourceStorage::storeResourceInfo(const ResourceContentHash& hash, const ResourceInfo& resourceInfo)
     {
+        PlatformGuard lock(m_resourceMapLock);
         RefCntResource* entry = m_resourceMap.get(hash);
         if (entry)
         {
@@ -127,8 +127,9 @@ namespace ramses_internal
         }
     }
 
-    const ResourceInfo& ResourceStorage::getResourceInfo(const ResourceContentHash& hash) const
+    ResourceInfo ResourceStorage::getResourceInfo(const ResourceContentHash& hash) const
     {
+        PlatformGuard lock(m_resourceMapLock);
         RefCntResource* entry = m_resourceMap.get(hash);
         assert(entry);
         //if real resource is available, update internally stored information first (could have changed, e.g. due to compression)
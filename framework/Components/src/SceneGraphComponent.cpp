@@ -13,6 +13,7 @@
 #include "TransportCommon/IConnectionStatusUpdateNotifier.h"
 #include "TransportCommon/ICommunicationSystem.h"
 #include "Utils/LogMacros.h"
+#include "Utils/TraceRecorder.h"
 #include "Scene/SceneActionCollection.h"
 #include "SceneReferencing/SceneReferenceEvent.h"
 #include "Components/ISceneRendererHandler.h"
@@ -25,13 +26,27 @@
 
 namespace ramses_internal
 {
-    SceneGraphComponent::SceneGraphComponent(const Guid& myID, ICommunicationSystem& communicationSystem, IConnectionStatusUpdateNotifier& connectionStatusUpdateNotifier, IResourceProviderComponent& res, PlatformLock& frameworkLock)
+    namespace
+    {
+        // resources of interrupted update are kept only for short time until the update is resent
+        const std::chrono::seconds InterruptedSceneUpdateTimeout{ 10 };
+        // limits memory held by resources of all interrupted updates together
+        const UInt64 InterruptedSceneUpdatesMaxByteSize = 64u * 1024u * 1024u;
+
+        UInt64 GetResourceByteSize(const IResource& resource)
+        {
+            return resource.isCompressedAvailable() ? resource.getCompressedDataSize() : resource.getDecompressedDataSize();
+        }
+    }
+
+    SceneGraphComponent::SceneGraphComponent(const Guid& myID, ICommunicationSystem& communicationSystem, IConnectionStatusUpdateNotifier& connectionStatusUpdateNotifier, IResourceProviderComponent& res, StatisticCollectionFramework& statistics, PlatformLock& frameworkLock)
         : m_sceneRendererHandler(nullptr)
         , m_myID(myID)
         , m_communicationSystem(communicationSystem)
         , m_connectionStatusUpdateNotifier(connectionStatusUpdateNotifier)
         , m_frameworkLock(frameworkLock)
         , m_resourceComponent(res)
+        , m_statistics(statistics)
     {
         m_connectionStatusUpdateNotifier.registerForConnectionUpdates(this);
         m_communicationSystem.setSceneProviderServiceHandler(this);
@@ -44,10 +59,7 @@ namespace ramses_internal
         m_communicationSystem.setSceneProviderServiceHandler(nullptr);
         m_communicationSystem.setSceneRendererServiceHandler(nullptr);
 
-        for (auto logic : m_clientSceneLogicMap)
-        {
-            delete logic.value;
-        }
+        m_clientSceneLogicMap.clear();
     }
 
     void SceneGraphComponent::setSceneRendererHandler(ISceneRendererHandler* sceneRendererHandler)
@@ -103,11 +115,14 @@ namespace ramses_internal
         }
     }
 
-    void SceneGraphComponent::sendSceneUpdate(const std::vector<Guid>& toVec, SceneUpdate&& sceneUpdate, SceneId sceneId, EScenePublicationMode /*mode*/)
+    void SceneGraphComponent::sendSceneUpdate(const std::vector<Guid>& toVec, SceneUpdate&& sceneUpdate, SceneId sceneId, EScenePublicationMode /*mode*/, const SceneUpdateSerializer* remoteSerializer)
     {
-        // send to network (no ownership transfer)
+        const UInt64 flushIndex = sceneUpdate.flushInfos.flushCounter;
+        TraceScope traceScope("transport", "sendSceneUpdate", sceneId.getValue(), flushIndex);
+        GetTraceRecorder().addFlowStartEvent("flush", "sceneUpdate", TraceRecorder::GetFlushFlowId(sceneId.getValue(), flushIndex));
+
+        // send to network (no ownership transfer), resources were compressed and update serialized when creating the serializer
         bool sendToSelf = false;
-        bool alreadyCompressed = false;
         for (const auto& to : toVec)
         {
             if (m_myID == to)
@@ -116,15 +131,10 @@ namespace ramses_internal
             }
             else
             {
-                if (!alreadyCompressed)
-                {
-                    for (auto& resource : sceneUpdate.resources)
-                    {
-                        resource->compress(IResource::CompressionLevel::REALTIME);
-                    }
-                    alreadyCompressed = true;
-                }
-                m_communicationSystem.sendSceneUpdate(to, sceneId, SceneUpdateSerializer(sceneUpdate));
+                assert(remoteSerializer);
+                assert(&remoteSerializer->getUpdate() == &sceneUpdate);
+                TraceScope sendScope("transport", "send", sceneId.getValue(), flushIndex);
+                m_communicationSystem.sendSceneUpdate(to, sceneId, *remoteSerializer);
             }
         }
 
@@ -203,7 +213,7 @@ namespace ramses_internal
         // remove all subscribers from CSL
         for (const auto& p : m_clientSceneLogicMap)
         {
-            ClientSceneLogicBase* sceneLogic = p.value;
+            ClientSceneLogicBase* sceneLogic = p.value.get();
             const std::vector<Guid> subscribers(sceneLogic->getWaitingAndActiveSubscribers());
             for (const auto& sub : subscribers)
             {
@@ -242,7 +252,7 @@ namespace ramses_internal
         PlatformGuard guard(m_frameworkLock);
         for(const auto& publishedScene : m_locallyPublishedScenes)
         {
-            if (ClientSceneLogicBase** sceneLogic = m_clientSceneLogicMap.get(publishedScene.key))
+            if (std::shared_ptr<ClientSceneLogicBase>* sceneLogic = m_clientSceneLogicMap.get(publishedScene.key))
                 (*sceneLogic)->removeSubscriber(disconnnectedParticipant);
         }
 
@@ -250,6 +260,9 @@ namespace ramses_internal
         {
             if (it->second.provider == disconnnectedParticipant)
             {
+                // provider may reconnect shortly and resend the update
+                if (it->second.sceneUpdateDeserializer)
+                    keepResourcesOfIncompleteUpdate(it->first, disconnnectedParticipant, *it->second.sceneUpdateDeserializer);
                 if (m_sceneRendererHandler)
                     m_sceneRendererHandler->handleSceneBecameUnavailable(it->first, disconnnectedParticipant);
                 it = m_remoteScenes.erase(it);
@@ -263,16 +276,16 @@ namespace ramses_internal
     {
         const SceneId sceneId = scene.getSceneId();
         assert(!m_clientSceneLogicMap.contains(sceneId));
-        ClientSceneLogicBase* sceneLogic = nullptr;
+        std::shared_ptr<ClientSceneLogicBase> sceneLogic;
         if (enableLocalOnlyOptimization)
         {
             LOG_INFO(CONTEXT_CLIENT, "SceneGraphComponent::handleCreateScene: creating scene " << scene.getSceneId() << " (direct)");
-            sceneLogic = new ClientSceneLogicDirect(*this, scene, m_resourceComponent, m_myID);
+            sceneLogic = std::make_shared<ClientSceneLogicDirect>(*this, scene, m_resourceComponent, m_myID, m_frameworkLock);
         }
         else
         {
             LOG_INFO(CONTEXT_CLIENT, "SceneGraphComponent::handleCreateScene: creating scene " << scene.getSceneId() << " (shadow copy)");
-            sceneLogic = new ClientSceneLogicShadowCopy(*this, scene, m_resourceComponent, m_myID);
+            sceneLogic = std::make_shared<ClientSceneLogicShadowCopy>(*this, scene, m_resourceComponent, m_myID, m_frameworkLock);
         }
         m_sceneEventConsumers.put(sceneId, &eventConsumer);
         m_clientSceneLogicMap.put(sceneId, sceneLogic);
@@ -298,26 +311,29 @@ namespace ramses_internal
 
     bool SceneGraphComponent::handleFlush(SceneId sceneId, const FlushTimeInformation& flushTimeInfo, SceneVersionTag versionTag)
     {
-        assert(m_clientSceneLogicMap.contains(sceneId));
-
-        ClientSceneLogicBase& sceneLogic = **m_clientSceneLogicMap.get(sceneId);
+        std::shared_ptr<ClientSceneLogicBase> sceneLogic;
+        {
+            PlatformGuard guard(m_frameworkLock);
+            assert(m_clientSceneLogicMap.contains(sceneId));
+            sceneLogic = *m_clientSceneLogicMap.get(sceneId);
+        }
 
-        return sceneLogic.flushSceneActions(flushTimeInfo, versionTag);
+        // scene logic takes framework lock only for sending, flushes of different scenes can run in parallel.
+        // Holding the logic keeps it alive until flush is done even when scene gets removed meanwhile.
+        return sceneLogic->flushSceneActions(flushTimeInfo, versionTag);
     }
 
     void SceneGraphComponent::handleRemoveScene(SceneId sceneId)
     {
         LOG_INFO(CONTEXT_CLIENT, "SceneGraphComponent::handleRemoveScene: " << sceneId);
-        ClientSceneLogicBase* sceneLogic = *m_clientSceneLogicMap.get(sceneId);
-        assert(sceneLogic != nullptr);
+        assert(m_clientSceneLogicMap.contains(sceneId));
         m_clientSceneLogicMap.remove(sceneId);
         m_sceneEventConsumers.remove(sceneId);
-        delete sceneLogic;
     }
 
     void SceneGraphComponent::handleSubscribeScene(const SceneId& sceneId, const Guid& consumerID)
     {
-        ClientSceneLogicBase** sceneLogic = m_clientSceneLogicMap.get(sceneId);
+        std::shared_ptr<ClientSceneLogicBase>* sceneLogic = m_clientSceneLogicMap.get(sceneId);
         if (sceneLogic != nullptr)
         {
             LOG_INFO(CONTEXT_CLIENT, "SceneGraphComponent::handleSceneSubscription: received scene subscription for scene " << sceneId << " from " << consumerID);
@@ -331,7 +347,7 @@ namespace ramses_internal
 
     void SceneGraphComponent::handleUnsubscribeScene(const SceneId& sceneId, const Guid& consumerID)
     {
-        ClientSceneLogicBase** sceneLogic = m_clientSceneLogicMap.get(sceneId);
+        std::shared_ptr<ClientSceneLogicBase>* sceneLogic = m_clientSceneLogicMap.get(sceneId);
         if (sceneLogic != nullptr)
         {
             LOG_INFO(CONTEXT_CLIENT, "SceneGraphComponent::handleSceneUnsubscription:  received scene unsubscription for scene " << sceneId << " from " << consumerID);
@@ -346,6 +362,7 @@ namespace ramses_internal
     void SceneGraphComponent::triggerLogMessageForPeriodicLog()
     {
         PlatformGuard guard(m_frameworkLock);
+        discardExpiredInterruptedSceneUpdates();
         LOG_INFO_F(CONTEXT_PERIODIC, ([&](StringOutputStream& sos) {
                     sos << "Client: " << m_clientSceneLogicMap.size() << " scene(s):";
                     bool first = true;
@@ -361,6 +378,8 @@ namespace ramses_internal
                         }
                         sos << " " << m_clientScenesIter.key << " " << m_clientScenesIter.value->getSceneStateString();
                     }
+                    if (!m_interruptedSceneUpdates.empty())
+                        sos << ", interrupted updates: " << m_interruptedSceneUpdates.size() << " (" << m_interruptedSceneUpdatesByteSize << " bytes)";
                 }));
     }
 
@@ -465,7 +484,10 @@ namespace ramses_internal
 
         // start with fresh deinitializer
         // TODO(tobias) should already be cleared when unsub was sent ou for this scene
+        if (it->second.sceneUpdateDeserializer)
+            keepResourcesOfIncompleteUpdate(sceneId, providerID, *it->second.sceneUpdateDeserializer);
         it->second.sceneUpdateDeserializer = std::make_unique<SceneUpdateStreamDeserializer>();
+        resumeInterruptedUpdate(sceneId, providerID, *it->second.sceneUpdateDeserializer);
 
         m_sceneRendererHandler->handleInitializeScene(it->second.info, providerID);
     }
@@ -502,6 +524,7 @@ namespace ramses_internal
             return;
         }
 
+        TraceScope traceScope("transport", "receiveSceneUpdate", sceneId.getValue());
         auto result = deserializer->processData(actionData);
         switch (result.result)
         {
@@ -513,6 +536,11 @@ namespace ramses_internal
             break;
         case SceneUpdateStreamDeserializer::ResultType::HasData:
             {
+                traceScope.setFlushIndex(result.flushInfos.flushCounter);
+                // resumed resources were taken over from an interrupted update, not received again
+                m_statistics.statResourcesReceivedNumber.incCounter(static_cast<UInt32>(result.resources.size()) - result.resumedResources);
+                m_statistics.statResourcesResumedNumber.incCounter(result.resumedResources);
+                discardExpiredInterruptedSceneUpdates();
                 SceneUpdate sceneUpdate;
                 sceneUpdate.actions = std::move(result.actions);
                 for (auto& res : result.resources)
@@ -524,6 +552,104 @@ namespace ramses_internal
         }
     }
 
+    void SceneGraphComponent::keepResourcesOfIncompleteUpdate(SceneId sceneId, const Guid& providerID, SceneUpdateStreamDeserializer& deserializer)
+    {
+        std::vector<std::unique_ptr<IResource>> resources = deserializer.takeResourcesOfIncompleteUpdate();
+        if (resources.empty())
+            return;
+
+        discardExpiredInterruptedSceneUpdates();
+        InterruptedSceneUpdate& interruptedUpdate = m_interruptedSceneUpdates[sceneId];
+        if (interruptedUpdate.provider != providerID)
+        {
+            m_interruptedSceneUpdatesByteSize -= interruptedUpdate.byteSize;
+            interruptedUpdate = InterruptedSceneUpdate{};
+        }
+        interruptedUpdate.provider = providerID;
+        interruptedUpdate.interruptionTime = std::chrono::steady_clock::now();
+        for (auto& resource : resources)
+        {
+            const UInt64 byteSize = GetResourceByteSize(*resource);
+            interruptedUpdate.byteSize += byteSize;
+            m_interruptedSceneUpdatesByteSize += byteSize;
+            interruptedUpdate.resources.push_back(std::move(resource));
+        }
+        limitInterruptedSceneUpdatesByteSize(sceneId);
+
+        LOG_INFO(CONTEXT_FRAMEWORK, "SceneGraphComponent::keepResourcesOfIncompleteUpdate: keep " << resources.size() << " received resources of scene " << sceneId <<
+            ", " << m_interruptedSceneUpdatesByteSize << " bytes kept for " << m_interruptedSceneUpdates.size() << " interrupted updates");
+    }
+
+    void SceneGraphComponent::resumeInterruptedUpdate(SceneId sceneId, const Guid& providerID, SceneUpdateStreamDeserializer& deserializer)
+    {
+        discardExpiredInterruptedSceneUpdates();
+
+        auto interruptedIt = m_interruptedSceneUpdates.find(sceneId);
+        if (interruptedIt == m_interruptedSceneUpdates.end())
+            return;
+
+        m_interruptedSceneUpdatesByteSize -= interruptedIt->second.byteSize;
+        if (interruptedIt->second.provider != providerID)
+        {
+            LOG_INFO(CONTEXT_FRAMEWORK, "SceneGraphComponent::resumeInterruptedUpdate: drop " << interruptedIt->second.resources.size() << " resources of scene " << sceneId <<
+                " from " << interruptedIt->second.provider << ", scene now provided by " << providerID);
+        }
+        else
+        {
+            LOG_INFO(CONTEXT_FRAMEWORK, "SceneGraphComponent::resumeInterruptedUpdate: reuse up to " << interruptedIt->second.resources.size() << " resources of scene " << sceneId);
+            deserializer.addResumableResources(std::move(interruptedIt->second.resources));
+        }
+        m_interruptedSceneUpdates.erase(interruptedIt);
+    }
+
+    void SceneGraphComponent::limitInterruptedSceneUpdatesByteSize(SceneId keptSceneId)
+    {
+        while (m_interruptedSceneUpdatesByteSize > InterruptedSceneUpdatesMaxByteSize)
+        {
+            // drop oldest other interrupted update first, then the last resources of the one just kept
+            auto oldestIt = m_interruptedSceneUpdates.end();
+            for (auto it = m_interruptedSceneUpdates.begin(); it != m_interruptedSceneUpdates.end(); ++it)
+            {
+                if (it->first != keptSceneId && (oldestIt == m_interruptedSceneUpdates.end() || it->second.interruptionTime < oldestIt->second.interruptionTime))
+                    oldestIt = it;
+            }
+
+            if (oldestIt != m_interruptedSceneUpdates.end())
+            {
+                m_interruptedSceneUpdatesByteSize -= oldestIt->second.byteSize;
+                m_interruptedSceneUpdates.erase(oldestIt);
+            }
+            else
+            {
+                InterruptedSceneUpdate& keptUpdate = m_interruptedSceneUpdates[keptSceneId];
+                const UInt64 byteSize = GetResourceByteSize(*keptUpdate.resources.back());
+                keptUpdate.byteSize -= byteSize;
+                m_interruptedSceneUpdatesByteSize -= byteSize;
+                keptUpdate.resources.pop_back();
+                if (keptUpdate.resources.empty())
+                    m_interruptedSceneUpdates.erase(keptSceneId);
+            }
+        }
+    }
+
+    void SceneGraphComponent::discardExpiredInterruptedSceneUpdates()
+    {
+        if (m_interruptedSceneUpdates.empty())
+            return;
+
+        const auto now = std::chrono::steady_clock::now();
+        for (auto it = m_interruptedSceneUpdates.begin(); it != m_interruptedSceneUpdates.end();)
+        {
+            if (now - it->second.interruptionTime > InterruptedSceneUpdateTimeout)
+            {
+                m_interruptedSceneUpdatesByteSize -= it->second.byteSize;
+                it = m_interruptedSceneUpdates.erase(it);
+            }
+            else
+                ++it;
+        }
+    }
+
     void SceneGraphComponent::handleNewScenesAvailable(const SceneInfoVector& newScenes, const Guid& providerID)
     {
         // TODO(tobias) also cross-check with locally published scenes (+ published by someone else?) and warn/ignore if exists
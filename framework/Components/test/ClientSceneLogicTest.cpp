@@ -15,8 +15,10 @@
 #include "Scene/ClientScene.h"
 #include "Scene/EScenePublicationMode.h"
 #include "Scene/SceneActionApplier.h"
+#include "Scene/Scene.h"
 #include "ramses-framework-api/RamsesFrameworkTypes.h"
 #include "Components/SceneUpdate.h"
+#include "TransportCommon/SceneUpdateSerializer.h"
 #include "Resource/ArrayResource.h"
 
 using namespace ramses_internal;
@@ -53,7 +55,8 @@ namespace
                     && m_sceneUpdate.flushInfos.versionTag == updatearg.flushInfos.versionTag
                     && m_sceneUpdate.flushInfos.sizeInfo == updatearg.flushInfos.sizeInfo;
             }
-            return updatearg.actions == m_sceneUpdate.actions;
+            // empty collections carry no encoded data, encoding depends on subscribers only
+            return (updatearg.actions.empty() && m_sceneUpdate.actions.empty()) || updatearg.actions == m_sceneUpdate.actions;
         }
 
         virtual void DescribeTo(::std::ostream* os) const override
@@ -78,18 +81,27 @@ namespace
 class SceneGraphSenderMock : public ISceneGraphSender
 {
 public:
-    SceneGraphSenderMock() {}
+    explicit SceneGraphSenderMock(const Guid& localId_)
+        : localId(localId_)
+    {
+    }
     virtual ~SceneGraphSenderMock() {}
     MOCK_METHOD(void, sendPublishScene, (SceneId sceneId, EScenePublicationMode publicationMode, const String& name), (override));
     MOCK_METHOD(void, sendUnpublishScene, (SceneId sceneId, EScenePublicationMode publicationMode), (override));
     MOCK_METHOD(void, sendCreateScene, (const Guid& to, const SceneId& sceneId, EScenePublicationMode publicationMode), (override));
     MOCK_METHOD(void, sendSceneUpdate_rvr, (const std::vector<Guid>& to, const SceneUpdate & sceneAction, SceneId sceneId, EScenePublicationMode publicationMode));
 
-    void sendSceneUpdate(const std::vector<Guid>& to, SceneUpdate&& update, SceneId sceneId, EScenePublicationMode publicationMode) override
+    void sendSceneUpdate(const std::vector<Guid>& to, SceneUpdate&& update, SceneId sceneId, EScenePublicationMode publicationMode, const SceneUpdateSerializer* remoteSerializer) override
     {
+        const bool hasRemoteReceiver = std::any_of(to.cbegin(), to.cend(), [&](const Guid& g) { return g != localId; });
+        EXPECT_EQ(hasRemoteReceiver, remoteSerializer != nullptr);
+        if (remoteSerializer)
+            EXPECT_EQ(&update, &remoteSerializer->getUpdate());
         sendSceneUpdate_rvr(to, update, sceneId, publicationMode);
         update.actions.clear(); // simulate moved away
     }
+
+    const Guid localId;
 };
 
 template <typename T>
@@ -100,7 +112,8 @@ public:
         : m_myID(765)
         , m_sceneId(33u)
         , m_scene(SceneInfo(m_sceneId))
-        , m_sceneLogic(m_sceneGraphProviderComponent, m_scene, m_resourceComponent, m_myID)
+        , m_sceneGraphProviderComponent(m_myID)
+        , m_sceneLogic(m_sceneGraphProviderComponent, m_scene, m_resourceComponent, m_myID, m_frameworkLock)
         , m_rendererID(1337)
     {
     }
@@ -168,9 +181,10 @@ protected:
         EXPECT_CALL(m_sceneGraphProviderComponent, sendUnpublishScene(m_sceneId, _));
     }
 
-    void expectResolveResources(ManagedResourceVector const& resources = {}, uint8_t times = 1)
+    void expectResolveResources(ManagedResourceVector const& resources = {}, uint8_t times = 1, bool resourcesInUseChanged = false)
     {
-        times += std::is_same<T, ClientSceneLogicShadowCopy>() ? 1 : 0;
+        // shadow copy keeps resources in use alive, it resolves them again whenever they change
+        times += (std::is_same<T, ClientSceneLogicShadowCopy>() && (times > 0 || resourcesInUseChanged)) ? 1 : 0;
         if (times) // allow additional expects
             EXPECT_CALL(this->m_resourceComponent, resolveResources(_)).Times(times).WillRepeatedly(Return(resources));
     }
@@ -180,8 +194,11 @@ protected:
     ramses_internal::ClientScene m_scene;
     StrictMock<ResourceProviderComponentMock> m_resourceComponent;
     StrictMock<SceneGraphSenderMock> m_sceneGraphProviderComponent;
+    PlatformLock m_frameworkLock;
     T m_sceneLogic;
     ramses_internal::Guid m_rendererID;
+    // serialized for remote subscribers, has to be a valid resource
+    const ManagedResource m_dummyResource{ std::make_shared<const ArrayResource>(EResourceType_IndexArray, 0u, EDataType::UInt16, nullptr, ResourceCacheFlag_DoNotCache, "dummy") };
 };
 
 class AClientSceneLogic_ShadowCopy : public AClientSceneLogic_All<ClientSceneLogicShadowCopy>
@@ -915,7 +932,7 @@ TYPED_TEST(AClientSceneLogic_All, sendListOfNewResourcesTogetherWithFlush)
         EXPECT_EQ(blitpassHandle, resourceChanges.m_sceneResourceActions[3].handle);
         EXPECT_EQ(ESceneResourceAction_CreateBlitPass, resourceChanges.m_sceneResourceActions[3].action);
     });
-    this->expectResolveResources({ nullptr });
+    this->expectResolveResources({ this->m_dummyResource });
     this->m_sceneLogic.flushSceneActions({}, {});
     this->expectSceneUnpublish();
 }
@@ -968,7 +985,7 @@ TYPED_TEST(AClientSceneLogic_All, flushClearsListsOfChangedResources)
         EXPECT_EQ(0u, resourceChanges.m_resourcesRemoved.size());
         EXPECT_EQ(4u, resourceChanges.m_sceneResourceActions.size());
     });
-    this->expectResolveResources({ nullptr });
+    this->expectResolveResources({ this->m_dummyResource });
     this->m_sceneLogic.flushSceneActions({}, {});
 
     this->m_scene.allocateNode();
@@ -979,7 +996,7 @@ TYPED_TEST(AClientSceneLogic_All, flushClearsListsOfChangedResources)
         EXPECT_EQ(0u, resourceChanges.m_resourcesRemoved.size());
         EXPECT_EQ(0u, resourceChanges.m_sceneResourceActions.size());
     });
-    this->expectResolveResources({ nullptr }, 0);
+    this->expectResolveResources({ this->m_dummyResource }, 0);
     this->m_sceneLogic.flushSceneActions({}, {});
 
     this->expectSceneUnpublish();
@@ -998,7 +1015,7 @@ TYPED_TEST(AClientSceneLogic_All, sendListOfObsoleteResourcesTogetherWithFlush)
     const BlitPassHandle blitpassHandle = this->m_scene.allocateBlitPass(RenderBufferHandle(1u), RenderBufferHandle(2u));
 
     EXPECT_CALL(this->m_sceneGraphProviderComponent, sendSceneUpdate_rvr(std::vector<Guid>{ this->m_rendererID }, _, this->m_sceneId, _));
-    this->expectResolveResources({ nullptr });
+    this->expectResolveResources({ this->m_dummyResource });
     this->m_sceneLogic.flushSceneActions({}, {});
 
     this->m_scene.releaseRenderTarget(renderTarget);
@@ -1025,7 +1042,7 @@ TYPED_TEST(AClientSceneLogic_All, sendListOfObsoleteResourcesTogetherWithFlush)
         EXPECT_EQ(blitpassHandle, resourceChanges.m_sceneResourceActions[3].handle);
         EXPECT_EQ(ESceneResourceAction_DestroyBlitPass, resourceChanges.m_sceneResourceActions[3].action);
     });
-    this->expectResolveResources({}, 0);
+    this->expectResolveResources({}, 0, true);
     this->m_sceneLogic.flushSceneActions({}, {});
     this->expectSceneUnpublish();
 }
@@ -1080,7 +1097,7 @@ TEST_F(AClientSceneLogic_ShadowCopy, sendsSceneToNewlySubscribedRendererWithNewR
     auto layoutHandle = this->m_scene.allocateDataLayout({}, hash);
     auto instanceHandle = this->m_scene.allocateDataInstance(layoutHandle);
     this->m_scene.setRenderableDataInstance(rendHandle, ERenderableDataSlotType_Geometry, instanceHandle);
-    this->expectResolveResources({ nullptr });
+    this->expectResolveResources({ this->m_dummyResource });
     this->m_sceneLogic.flushSceneActions({}, {});
 
     this->m_scene.allocateNode(); // action not flushed
@@ -1097,7 +1114,7 @@ TEST_F(AClientSceneLogic_ShadowCopy, sendsSceneToNewlySubscribedRendererWithNewR
         EXPECT_TRUE(resourceChanges.m_resourcesRemoved.empty());
         EXPECT_TRUE(resourceChanges.m_sceneResourceActions.empty());
     });
-    EXPECT_CALL(this->m_resourceComponent, resolveResources(_)).WillOnce(Return(ManagedResourceVector{ nullptr }));
+    EXPECT_CALL(this->m_resourceComponent, resolveResources(_)).WillOnce(Return(ManagedResourceVector{ this->m_dummyResource }));
     this->m_sceneLogic.addSubscriber(newRendererID);
     this->expectSceneUnpublish();
 }
@@ -1153,6 +1170,36 @@ TEST_F(AClientSceneLogic_ShadowCopy, sendsSceneToNewlySubscribedRendererWithLast
     this->expectSceneUnpublish();
 }
 
+TEST_F(AClientSceneLogic_ShadowCopy, sendsLatestFlushedStateToNewlySubscribedRendererAfterManyFlushes)
+{
+    this->publishAndAddSubscriberWithoutPendingActions();
+
+    const TransformHandle transform = this->m_scene.allocateTransform(this->m_scene.allocateNode());
+    EXPECT_CALL(this->m_sceneGraphProviderComponent, sendSceneUpdate_rvr(std::vector<Guid>{ this->m_rendererID }, _, this->m_sceneId, _)).Times(AnyNumber());
+    // enough flushes to exceed the size of the shadow copy action log and make it compact
+    for (UInt32 i = 0u; i < 5000u; ++i)
+    {
+        this->m_scene.setTranslation(transform, Vector3(static_cast<Float>(i), 0.f, 0.f));
+        this->m_sceneLogic.flushSceneActions({}, {});
+    }
+    this->m_scene.setTranslation(transform, Vector3(-1.f, 0.f, 0.f)); // not flushed
+    Mock::VerifyAndClearExpectations(&this->m_sceneGraphProviderComponent);
+
+    const ramses_internal::Guid newRendererID("12345678-1234-5678-0000-123456789012");
+    EXPECT_CALL(this->m_sceneGraphProviderComponent, sendCreateScene(newRendererID, this->m_sceneId, _));
+    EXPECT_CALL(this->m_sceneGraphProviderComponent, sendSceneUpdate_rvr(std::vector<Guid>{ newRendererID }, _, this->m_sceneId, _)).WillOnce([&](const auto&, const auto& update, auto, auto)
+    {
+        Scene receivedScene(SceneInfo(this->m_sceneId));
+        SceneActionApplier::ApplyActionsOnScene(receivedScene, update.actions);
+        ASSERT_TRUE(receivedScene.isTransformAllocated(transform));
+        EXPECT_EQ(Vector3(4999.f, 0.f, 0.f), receivedScene.getTranslation(transform));
+    });
+    this->m_sceneLogic.addSubscriber(newRendererID);
+
+    Mock::VerifyAndClearExpectations(&this->m_sceneGraphProviderComponent);
+    this->expectSceneUnpublish();
+}
+
 TEST_F(AClientSceneLogic_Direct, sendsSceneToNewlySubscribedRendererWithNewResources)
 {
     // add some active subscriber so actions are queued
@@ -1161,7 +1208,7 @@ TEST_F(AClientSceneLogic_Direct, sendsSceneToNewlySubscribedRendererWithNewResou
     const ResourceContentHash hash(0xff00ff00, 0);
     auto layoutHandle = this->m_scene.allocateDataLayout({}, hash);
     auto instanceHandle = this->m_scene.allocateDataInstance(layoutHandle);
-    EXPECT_CALL(this->m_resourceComponent, resolveResources(_)).WillOnce(Return(ManagedResourceVector{ nullptr }));
+    EXPECT_CALL(this->m_resourceComponent, resolveResources(_)).WillOnce(Return(ManagedResourceVector{ this->m_dummyResource }));
     this->m_scene.setRenderableDataInstance(rendHandle, ERenderableDataSlotType_Geometry, instanceHandle);
     this->m_sceneLogic.flushSceneActions({}, {});
 
@@ -1181,7 +1228,7 @@ TEST_F(AClientSceneLogic_Direct, sendsSceneToNewlySubscribedRendererWithNewResou
         EXPECT_TRUE(resourceChanges.m_resourcesRemoved.empty());
         EXPECT_TRUE(resourceChanges.m_sceneResourceActions.empty());
     });
-    EXPECT_CALL(this->m_resourceComponent, resolveResources(_)).WillOnce(Return(ManagedResourceVector{ nullptr })); // old resource to new subscriber
+    EXPECT_CALL(this->m_resourceComponent, resolveResources(_)).WillOnce(Return(ManagedResourceVector{ this->m_dummyResource })); // old resource to new subscriber
     this->flush({}, SceneVersionTag::Invalid(), true);
     this->expectSceneUnpublish();
 }
@@ -1323,11 +1370,12 @@ TYPED_TEST(AClientSceneLogic_All, doesSendSceneToSubscriberAfterFlush)
     this->m_scene.allocateNode(0,NodeHandle(0u));
     this->m_scene.allocateTransform(NodeHandle(0u), TransformHandle(0u));
 
-    // copy the current action collection to use it later
-    // for checking
+    // remote subscriber receives scene actions compact encoded
     SceneUpdate update;
-    update.actions = (this->m_scene.getSceneActionCollection().copy());
+    update.actions.setEncoding(ESceneActionEncoding::Compact);
     SceneActionCollectionCreator creator(update.actions);
+    creator.allocateNode(0, NodeHandle(0u));
+    creator.allocateTransform(NodeHandle(0u), TransformHandle(0u));
     update.flushInfos.hasSizeInfo = true;
     update.flushInfos.flushCounter = 1;
     update.flushInfos.sizeInfo = this->m_scene.getSceneSizeInformation();
@@ -1339,6 +1387,45 @@ TYPED_TEST(AClientSceneLogic_All, doesSendSceneToSubscriberAfterFlush)
     this->unpublish();
 }
 
+TYPED_TEST(AClientSceneLogic_All, keepsFixedSceneActionEncodingForLocalSubscriberOnly)
+{
+    this->publish();
+    this->m_sceneLogic.addSubscriber(this->m_myID);
+    this->m_scene.allocateNode(0, NodeHandle(0u));
+
+    EXPECT_CALL(this->m_sceneGraphProviderComponent, sendCreateScene(this->m_myID, this->m_sceneId, _));
+    EXPECT_CALL(this->m_sceneGraphProviderComponent, sendSceneUpdate_rvr(std::vector<Guid>{ this->m_myID }, _, this->m_sceneId, _)).WillOnce([&](const auto&, const auto& update, auto, auto)
+    {
+        EXPECT_EQ(ESceneActionEncoding::Fixed, update.actions.getEncoding());
+    });
+    this->flush({}, SceneVersionTag::Invalid(), true);
+
+    this->m_scene.allocateNode(0, NodeHandle(1u));
+    EXPECT_CALL(this->m_sceneGraphProviderComponent, sendSceneUpdate_rvr(std::vector<Guid>{ this->m_myID }, _, this->m_sceneId, _)).WillOnce([&](const auto&, const auto& update, auto, auto)
+    {
+        ASSERT_EQ(1u, update.actions.numberOfActions());
+        EXPECT_EQ(ESceneActionEncoding::Fixed, update.actions.getEncoding());
+    });
+    this->flush();
+
+    this->unpublish();
+}
+
+TYPED_TEST(AClientSceneLogic_All, usesCompactSceneActionEncodingWithRemoteSubscriber)
+{
+    this->publishAndAddSubscriberWithoutPendingActions();
+
+    this->m_scene.allocateNode(0, NodeHandle(1u));
+    EXPECT_CALL(this->m_sceneGraphProviderComponent, sendSceneUpdate_rvr(std::vector<Guid>{ this->m_rendererID }, _, this->m_sceneId, _)).WillOnce([&](const auto&, const auto& update, auto, auto)
+    {
+        ASSERT_EQ(1u, update.actions.numberOfActions());
+        EXPECT_EQ(ESceneActionEncoding::Compact, update.actions.getEncoding());
+    });
+    this->flush();
+
+    this->unpublish();
+}
+
 TEST_F(AClientSceneLogic_ShadowCopy, doesSendSceneAfterFlushToLateSubscribers)
 {
     this->publish();
@@ -1346,11 +1433,12 @@ TEST_F(AClientSceneLogic_ShadowCopy, doesSendSceneAfterFlushToLateSubscribers)
     this->m_scene.allocateNode(0, NodeHandle(0u));
     this->m_scene.allocateTransform(NodeHandle(0u), TransformHandle(0u));
 
-    // copy the current action collection to use it later
-    // for checking
+    // remote subscriber receives scene actions compact encoded
     SceneUpdate update;
-    update.actions = this->m_scene.getSceneActionCollection().copy();
+    update.actions.setEncoding(ESceneActionEncoding::Compact);
     SceneActionCollectionCreator creator(update.actions);
+    creator.allocateNode(0, NodeHandle(0u));
+    creator.allocateTransform(NodeHandle(0u), TransformHandle(0u));
     update.flushInfos.hasSizeInfo = true;
     update.flushInfos.flushCounter = 1;
     update.flushInfos.sizeInfo = this->m_scene.getSceneSizeInformation();
@@ -1374,11 +1462,12 @@ TEST_F(AClientSceneLogic_Direct, doesSendSceneAfterFlushToLateSubscribers)
     this->m_scene.allocateNode(0, NodeHandle(0u));
     this->m_scene.allocateTransform(NodeHandle(0u), TransformHandle(0u));
 
-    // copy the current action collection to use it later
-    // for checking
+    // remote subscriber receives scene actions compact encoded
     SceneUpdate expectedUpdate;
-    expectedUpdate.actions = (this->m_scene.getSceneActionCollection().copy());
+    expectedUpdate.actions.setEncoding(ESceneActionEncoding::Compact);
     SceneActionCollectionCreator creator(expectedUpdate.actions);
+    creator.allocateNode(0, NodeHandle(0u));
+    creator.allocateTransform(NodeHandle(0u), TransformHandle(0u));
     expectedUpdate.flushInfos.hasSizeInfo = true;
     expectedUpdate.flushInfos.flushCounter = 1;
     expectedUpdate.flushInfos.sizeInfo = this->m_scene.getSceneSizeInformation();
@@ -1531,7 +1620,7 @@ TYPED_TEST(AClientSceneLogic_All, resolvesClientResourcesWhenFlushing)
             auto& resourceChanges = update.flushInfos.resourceChanges;
             EXPECT_EQ(1u, resourceChanges.m_resourcesAdded.size());
         });
-    this->flush({}, SceneVersionTag::Invalid(), false, { nullptr });
+    this->flush({}, SceneVersionTag::Invalid(), false, { this->m_dummyResource });
 
     this->m_scene.allocateNode();
     this->m_scene.allocateStreamTexture(WaylandIviSurfaceId{0u}, ResourceContentHash{ 0, 2 });
@@ -1540,7 +1629,7 @@ TYPED_TEST(AClientSceneLogic_All, resolvesClientResourcesWhenFlushing)
             auto& resourceChanges = update.flushInfos.resourceChanges;
             EXPECT_EQ(1u, resourceChanges.m_resourcesAdded.size());
         });
-    this->flush({}, SceneVersionTag::Invalid(), false, { nullptr });
+    this->flush({}, SceneVersionTag::Invalid(), false, { this->m_dummyResource });
 
     this->expectSceneUnpublish();
 }
@@ -1549,13 +1638,13 @@ TYPED_TEST(AClientSceneLogic_All, resolvesClientResourcesWhenFlushingUnpublished
 {
     this->m_scene.allocateNode();
     this->m_scene.allocateStreamTexture(WaylandIviSurfaceId(0), ResourceContentHash{ 0, 1 });
-    this->flush({}, SceneVersionTag::Invalid(), false, { nullptr });
+    this->flush({}, SceneVersionTag::Invalid(), false, { this->m_dummyResource });
     this->m_scene.allocateNode();
     this->m_scene.allocateStreamTexture(WaylandIviSurfaceId(0), ResourceContentHash{ 0, 2 });
-    this->flush({}, SceneVersionTag::Invalid(), false, { nullptr });
+    this->flush({}, SceneVersionTag::Invalid(), false, { this->m_dummyResource });
     this->publish();
 
-    EXPECT_CALL(this->m_resourceComponent, resolveResources(_)).WillOnce(Return(ManagedResourceVector{ nullptr, nullptr }));
+    EXPECT_CALL(this->m_resourceComponent, resolveResources(_)).WillOnce(Return(ManagedResourceVector{ this->m_dummyResource, this->m_dummyResource }));
     EXPECT_CALL(this->m_sceneGraphProviderComponent, sendSceneUpdate_rvr(std::vector<Guid>{ this->m_rendererID }, _, this->m_sceneId, _)).WillOnce([&](const auto&, const auto& update, auto, auto)
         {
             auto& resourceChanges = update.flushInfos.resourceChanges;
@@ -1600,13 +1689,13 @@ TYPED_TEST(AClientSceneLogic_All, resolvesOldResourcesForNewSubscriber)
     this->publish();
     this->m_scene.allocateNode();
     this->m_scene.allocateStreamTexture(WaylandIviSurfaceId(0), ResourceContentHash{ 0, 1 });
-    this->flush({}, SceneVersionTag::Invalid(), false, { nullptr });
+    this->flush({}, SceneVersionTag::Invalid(), false, { this->m_dummyResource });
     this->m_scene.allocateNode();
     this->flush();
 
     EXPECT_CALL(this->m_sceneGraphProviderComponent, sendSceneUpdate_rvr(std::vector<Guid>{ this->m_rendererID }, _, this->m_sceneId, _));
 
-    EXPECT_CALL(this->m_resourceComponent, resolveResources(_)).WillOnce(Return(ManagedResourceVector{ nullptr }));
+    EXPECT_CALL(this->m_resourceComponent, resolveResources(_)).WillOnce(Return(ManagedResourceVector{ this->m_dummyResource }));
     this->expectSceneSend();
     this->m_sceneLogic.addSubscriber(this->m_rendererID);
     this->flush();
@@ -1648,7 +1737,7 @@ TYPED_TEST(AClientSceneLogic_All, succeedsASecondFlushContainingAllSceneActionsA
             EXPECT_EQ(streamTexHandle2, resourceChanges.m_sceneResourceActions[2].handle);
             EXPECT_EQ(ESceneResourceAction_CreateStreamTexture, resourceChanges.m_sceneResourceActions[2].action);
         });
-    this->expectResolveResources({ nullptr, nullptr, nullptr });
+    this->expectResolveResources({ this->m_dummyResource, this->m_dummyResource, this->m_dummyResource });
     EXPECT_TRUE(this->m_sceneLogic.flushSceneActions({}, {}));
 
     this->expectSceneUnpublish();
@@ -2432,6 +2432,148 @@ namespace ramses_internal
         EXPECT_TRUE(comp.sendUpdateContentMetadata(ContentID(2), deltaDm));
     }
 
+    TEST_F(ADcsmComponent, sendsOnlyChangedMetadataFieldsToRemoteConsumer)
+    {
+        comp.newParticipantHasConnected(remoteId);
+        EXPECT_TRUE(comp.setLocalProviderAvailability(true));
+        getContentToState_LPRC(2, CS::Assigned);
+
+        EXPECT_CALL(comm, sendDcsmUpdateContentMetadata(remoteId, ContentID(2), metadata)).WillOnce(Return(true));
+        EXPECT_TRUE(comp.sendUpdateContentMetadata(ContentID(2), metadata));
+
+        // unchanged update is not sent at all
+        EXPECT_TRUE(comp.sendUpdateContentMetadata(ContentID(2), metadata));
+
+        DcsmMetadata changedDm(metadata);
+        changedDm.setWidgetOrder(321);
+        DcsmMetadata expectedDm;
+        expectedDm.setWidgetOrder(321);
+        EXPECT_CALL(comm, sendDcsmUpdateContentMetadata(remoteId, ContentID(2), expectedDm)).WillOnce(Return(true));
+        EXPECT_TRUE(comp.sendUpdateContentMetadata(ContentID(2), changedDm));
+    }
+
+    TEST_F(ADcsmComponent, sendsOnlyChangedMetadataFieldsToLocalConsumer)
+    {
+        EXPECT_TRUE(comp.setLocalProviderAvailability(true));
+        EXPECT_TRUE(comp.setLocalConsumerAvailability(true));
+        getContentToState_LPLC(2, CS::Assigned);
+
+        EXPECT_TRUE(comp.sendUpdateContentMetadata(ContentID(2), metadata));
+        EXPECT_CALL(consumer, contentMetadataUpdated(ramses::ContentID(2), _)).WillOnce(Invoke([&](auto, auto& mdp) { EXPECT_EQ(metadata, mdp.impl.getMetadata()); }));
+        EXPECT_TRUE(comp.dispatchConsumerEvents(consumer));
+
+        EXPECT_TRUE(comp.sendUpdateContentMetadata(ContentID(2), metadata));
+        ensureNoEventsPending();
+
+        DcsmMetadata changedDm(metadata);
+        changedDm.setPreviewDescription(U"changed");
+        DcsmMetadata expectedDm;
+        expectedDm.setPreviewDescription(U"changed");
+        EXPECT_TRUE(comp.sendUpdateContentMetadata(ContentID(2), changedDm));
+        EXPECT_CALL(consumer, contentMetadataUpdated(ramses::ContentID(2), _)).WillOnce(Invoke([&](auto, auto& mdp) { EXPECT_EQ(expectedDm, mdp.impl.getMetadata()); }));
+        EXPECT_TRUE(comp.dispatchConsumerEvents(consumer));
+    }
+
+    TEST_F(ADcsmComponent, sendsPreviewImageAlreadyKnownByRemoteConsumerAsReference)
+    {
+        comp.newParticipantHasConnected(remoteId);
+        EXPECT_TRUE(comp.setLocalProviderAvailability(true));
+        getContentToState_LPRC(2, CS::Assigned);
+
+        const std::vector<unsigned char> png1 = TestPngHeader::GetValidHeader();
+        const std::vector<unsigned char> png2 = TestPngHeader::GetValidHeaderWithFakeData();
+        DcsmMetadata dm1;
+        dm1.setPreviewImagePng(png1.data(), png1.size());
+        DcsmMetadata dm2;
+        dm2.setPreviewImagePng(png2.data(), png2.size());
+        DcsmMetadata dm1Reference(dm1);
+        dm1Reference.replacePreviewImagePngByReference();
+
+        InSequence seq;
+        EXPECT_CALL(comm, sendDcsmUpdateContentMetadata(remoteId, ContentID(2), dm1)).WillOnce(Return(true));
+        EXPECT_CALL(comm, sendDcsmUpdateContentMetadata(remoteId, ContentID(2), dm2)).WillOnce(Return(true));
+        EXPECT_CALL(comm, sendDcsmUpdateContentMetadata(remoteId, ContentID(2), dm1Reference)).WillOnce(Return(true));
+        EXPECT_TRUE(comp.sendUpdateContentMetadata(ContentID(2), dm1));
+        EXPECT_TRUE(comp.sendUpdateContentMetadata(ContentID(2), dm2));
+        EXPECT_TRUE(comp.sendUpdateContentMetadata(ContentID(2), dm1));
+    }
+
+    TEST_F(ADcsmComponent, sendsPreviewImageAgainToRemoteConsumerAfterReconnect)
+    {
+        comp.newParticipantHasConnected(remoteId);
+        EXPECT_TRUE(comp.setLocalProviderAvailability(true));
+        getContentToState_LPRC(2, CS::Assigned);
+
+        EXPECT_CALL(comm, sendDcsmUpdateContentMetadata(remoteId, ContentID(2), metadata)).WillOnce(Return(true));
+        EXPECT_TRUE(comp.sendUpdateContentMetadata(ContentID(2), metadata));
+
+        EXPECT_CALL(provider, contentStateChange(ramses::ContentID(2), EDcsmState::Offered, _, _));
+        comp.participantHasDisconnected(remoteId);
+        EXPECT_TRUE(comp.dispatchProviderEvents(provider));
+
+        EXPECT_CALL(comm, sendDcsmOfferContent(remoteId, ContentID(2), Category(3), ETechnicalContentType::RamsesSceneID, "mycontent"));
+        comp.newParticipantHasConnected(remoteId);
+        EXPECT_CALL(comm, sendDcsmContentDescription(remoteId, ContentID(2), TechnicalContentDescriptor(5)));
+        EXPECT_CALL(comm, sendDcsmUpdateContentMetadata(remoteId, ContentID(2), metadata)).WillOnce(Return(true));
+        comp.handleContentStateChange(ContentID(2), EDcsmState::Assigned, CategoryInfo{2, 3}, AnimationInformation{1, 2}, remoteId);
+        EXPECT_CALL(provider, contentStateChange(ramses::ContentID(2), EDcsmState::Assigned, _, ramses::AnimationInformation{1, 2}));
+        EXPECT_TRUE(comp.dispatchProviderEvents(provider));
+    }
+
+    TEST_F(ADcsmComponent, resolvesPreviewImageReferenceFromRemoteProvider)
+    {
+        comp.newParticipantHasConnected(remoteId);
+        EXPECT_TRUE(comp.setLocalConsumerAvailability(true));
+        getContentToState_RPLC(2, CS::Assigned);
+
+        comp.handleUpdateContentMetadata(ContentID(2), metadata, remoteId);
+        EXPECT_CALL(consumer, contentMetadataUpdated(ramses::ContentID(2), _)).WillOnce(Invoke([&](auto, auto& mdp) { EXPECT_EQ(metadata, mdp.impl.getMetadata()); }));
+        EXPECT_TRUE(comp.dispatchConsumerEvents(consumer));
+
+        DcsmMetadata referenceDm(metadata);
+        referenceDm.replacePreviewImagePngByReference();
+        comp.handleUpdateContentMetadata(ContentID(2), DcsmMetadata(referenceDm.toBinary()), remoteId);
+        EXPECT_CALL(consumer, contentMetadataUpdated(ramses::ContentID(2), _)).WillOnce(Invoke([&](auto, auto& mdp) {
+            EXPECT_TRUE(mdp.hasPreviewImagePng());
+            EXPECT_EQ(metadata.getPreviewImagePng(), mdp.getPreviewImagePng());
+            }));
+        EXPECT_TRUE(comp.dispatchConsumerEvents(consumer));
+    }
+
+    TEST_F(ADcsmComponent, keepsPreviewImageFromRemoteProviderReceivedBeforeConnect)
+    {
+        EXPECT_TRUE(comp.setLocalConsumerAvailability(true));
+        comp.handleUpdateContentMetadata(ContentID(2), metadata, remoteId);
+
+        comp.newParticipantHasConnected(remoteId);
+        getContentToState_RPLC(2, CS::Assigned);
+
+        DcsmMetadata referenceDm(metadata);
+        referenceDm.replacePreviewImagePngByReference();
+        comp.handleUpdateContentMetadata(ContentID(2), referenceDm, remoteId);
+        EXPECT_CALL(consumer, contentMetadataUpdated(ramses::ContentID(2), _)).WillOnce(Invoke([&](auto, auto& mdp) {
+            EXPECT_TRUE(mdp.hasPreviewImagePng());
+            EXPECT_EQ(metadata.getPreviewImagePng(), mdp.getPreviewImagePng());
+            }));
+        EXPECT_TRUE(comp.dispatchConsumerEvents(consumer));
+    }
+
+    TEST_F(ADcsmComponent, dropsUnknownPreviewImageReferenceFromRemoteProvider)
+    {
+        comp.newParticipantHasConnected(remoteId);
+        EXPECT_TRUE(comp.setLocalConsumerAvailability(true));
+        getContentToState_RPLC(2, CS::Assigned);
+
+        DcsmMetadata referenceDm(metadata);
+        referenceDm.replacePreviewImagePngByReference();
+        comp.handleUpdateContentMetadata(ContentID(2), referenceDm, remoteId);
+        EXPECT_CALL(consumer, contentMetadataUpdated(ramses::ContentID(2), _)).WillOnce(Invoke([&](auto, auto& mdp) {
+            EXPECT_FALSE(mdp.hasPreviewImagePng());
+            EXPECT_TRUE(mdp.hasPreviewDescription());
+            }));
+        EXPECT_TRUE(comp.dispatchConsumerEvents(consumer));
+    }
+
     TEST_F(ADcsmComponent, storesFocusRequestsForLateLocalConsumerAndSendsAfterwards)
     {
         EXPECT_TRUE(comp.setLocalProviderAvailability(true));
@@ -639,4 +639,59 @@ namespace ramses_internal
         EXPECT_TRUE(s.find("8") >= 0);//animation start
         EXPECT_TRUE(s.find("9") >= 0);//animation end
     }
+
+    TEST_F(ADcsmMetadata, getsChangedFieldsComparedToBase)
+    {
+        EXPECT_EQ(filledDm, filledDm.getChangedFields(emptyDm));
+        EXPECT_TRUE(filledDm.getChangedFields(filledDm).empty());
+        EXPECT_TRUE(emptyDm.getChangedFields(filledDm).empty());
+
+        DcsmMetadata changedDm(filledDm);
+        changedDm.setWidgetOrder(m_widgetorder + 1);
+        changedDm.setPreviewImagePng(pngShort.data(), pngShort.size());
+
+        DcsmMetadata expectedDm;
+        expectedDm.setWidgetOrder(m_widgetorder + 1);
+        expectedDm.setPreviewImagePng(pngShort.data(), pngShort.size());
+        EXPECT_EQ(expectedDm, changedDm.getChangedFields(filledDm));
+    }
+
+    TEST_F(ADcsmMetadata, hashesPreviewImageContent)
+    {
+        DcsmMetadata dm;
+        dm.setPreviewImagePng(pngShort.data(), pngShort.size());
+        EXPECT_NE(0u, dm.getPreviewImageHash());
+        EXPECT_NE(filledDm.getPreviewImageHash(), dm.getPreviewImageHash());
+        EXPECT_EQ(dm.getPreviewImageHash(), serializeDeserialize(dm).getPreviewImageHash());
+    }
+
+    TEST_F(ADcsmMetadata, canSerializeDeserializePreviewImageReference)
+    {
+        DcsmMetadata referenceDm(filledDm);
+        referenceDm.replacePreviewImagePngByReference();
+        EXPECT_FALSE(referenceDm.hasPreviewImagePng());
+        EXPECT_TRUE(referenceDm.hasPreviewImageReference());
+        EXPECT_FALSE(referenceDm.empty());
+        EXPECT_LT(referenceDm.toBinary().size() + pngLong.size() / 2, filledDm.toBinary().size());
+
+        DcsmMetadata deserializedDm = serializeDeserialize(referenceDm);
+        EXPECT_EQ(referenceDm, deserializedDm);
+        EXPECT_TRUE(deserializedDm.hasPreviewImageReference());
+        EXPECT_EQ(filledDm.getPreviewImageHash(), deserializedDm.getPreviewImageHash());
+
+        deserializedDm.resolvePreviewImageReference(pngLong);
+        EXPECT_TRUE(deserializedDm.hasPreviewImagePng());
+        EXPECT_FALSE(deserializedDm.hasPreviewImageReference());
+        EXPECT_EQ(filledDm, deserializedDm);
+    }
+
+    TEST_F(ADcsmMetadata, canClearPreviewImage)
+    {
+        DcsmMetadata dm;
+        dm.setPreviewImagePng(pngShort.data(), pngShort.size());
+        dm.clearPreviewImagePng();
+        EXPECT_FALSE(dm.hasPreviewImagePng());
+        EXPECT_TRUE(dm.empty());
+        EXPECT_EQ(emptyDm, dm);
+    }
 }
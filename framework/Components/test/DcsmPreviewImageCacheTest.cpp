@@ -0,0 +1,86 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2020 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "gtest/gtest.h"
+#include "Components/DcsmPreviewImageCache.h"
+
+namespace ramses_internal
+{
+    TEST(ADcsmPreviewImageCache, returnsAddedImage)
+    {
+        DcsmPreviewImageCache cache(100u);
+        EXPECT_EQ(nullptr, cache.use(1u));
+
+        cache.add(1u, 3u, { 1, 2, 3 });
+        const std::vector<unsigned char>* image = cache.use(1u);
+        ASSERT_NE(nullptr, image);
+        EXPECT_EQ(std::vector<unsigned char>({ 1, 2, 3 }), *image);
+        EXPECT_EQ(1u, cache.getNumberOfImages());
+        EXPECT_EQ(3u, cache.getTotalBytes());
+    }
+
+    TEST(ADcsmPreviewImageCache, evictsLeastRecentlyUsedImagesToStayWithinBudget)
+    {
+        DcsmPreviewImageCache cache(100u);
+        cache.add(1u, 40u);
+        cache.add(2u, 40u);
+        EXPECT_NE(nullptr, cache.use(1u));
+
+        cache.add(3u, 40u);
+        EXPECT_NE(nullptr, cache.use(1u));
+        EXPECT_EQ(nullptr, cache.use(2u));
+        EXPECT_NE(nullptr, cache.use(3u));
+        EXPECT_EQ(80u, cache.getTotalBytes());
+
+        cache.add(4u, 100u);
+        EXPECT_EQ(1u, cache.getNumberOfImages());
+        EXPECT_NE(nullptr, cache.use(4u));
+    }
+
+    TEST(ADcsmPreviewImageCache, doesNotKeepImageExceedingBudget)
+    {
+        DcsmPreviewImageCache cache(100u);
+        cache.add(1u, 40u);
+        cache.add(2u, 101u);
+        EXPECT_EQ(nullptr, cache.use(2u));
+        EXPECT_NE(nullptr, cache.use(1u));
+        EXPECT_EQ(40u, cache.getTotalBytes());
+    }
+
+    TEST(ADcsmPreviewImageCache, replacesImageAddedAgain)
+    {
+        DcsmPreviewImageCache cache(100u);
+        cache.add(1u, 40u);
+        cache.add(1u, 50u);
+        EXPECT_EQ(1u, cache.getNumberOfImages());
+        EXPECT_EQ(50u, cache.getTotalBytes());
+    }
+
+    TEST(ADcsmPreviewImageCache, staysInSyncWithMirroredCacheKnowingOnlySizes)
+    {
+        DcsmPreviewImageCache providerSide(100u);
+        DcsmPreviewImageCache consumerSide(100u);
+
+        const uint64_t hashes[] = { 1u, 2u, 1u, 3u, 4u, 2u, 1u, 5u, 3u, 1u };
+        for (const auto hash : hashes)
+        {
+            const size_t size = static_cast<size_t>(hash * 15u);
+            if (providerSide.use(hash))
+            {
+                // reference sent
+                EXPECT_NE(nullptr, consumerSide.use(hash));
+            }
+            else
+            {
+                providerSide.add(hash, size);
+                consumerSide.add(hash, size, std::vector<unsigned char>(size));
+            }
+            EXPECT_EQ(providerSide.getTotalBytes(), consumerSide.getTotalBytes());
+        }
+    }
+}
@@ -113,7 +113,6 @@ namespace ramses_internal
         }
 
     protected:
-        PlatformLock frameworkLock;
         const String resourceFileName;
     };
 
@@ -121,7 +120,7 @@ namespace ramses_internal
     {
     public:
         AResourceComponentTest()
-            : localResourceComponent(statistics, frameworkLock)
+            : localResourceComponent(statistics)
         {}
 
         virtual ResourceComponent& getResourceComponent() override
@@ -157,7 +156,7 @@ namespace ramses_internal
     {
     public:
         AResourceComponentWithThreadedTaskExecutorTest()
-            : localResourceComponent(statistics, frameworkLock)
+            : localResourceComponent(statistics)
         {}
 
         virtual ResourceComponent& getResourceComponent() override
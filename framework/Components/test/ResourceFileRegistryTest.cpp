@@ -18,13 +18,11 @@ namespace ramses_internal
     {
     public:
         AResourceFileRegistry()
-            : lock()
-            , stats()
-            , storage(lock, stats)
+            : stats()
+            , storage(stats)
             , registry()
         {}
 
-        PlatformLock lock;
         StatisticCollectionFramework stats;
         ResourceStorage storage;
         ResourceFilesRegistry registry;
@@ -22,9 +22,8 @@ namespace ramses_internal
     {
     public:
         AResourceStorage()
-            : lock()
-            , stats()
-            , storage(lock, stats)
+            : stats()
+            , storage(stats)
         {
         }
 
@@ -35,7 +34,6 @@ namespace ramses_internal
         }
 
     protected:
-        PlatformLock lock;
         StatisticCollectionFramework stats;
         ResourceStorage storage;
     };
@@ -26,7 +26,7 @@ public:
     ASceneGraphComponent()
         : localParticipantID(11)
         , remoteParticipantID(12)
-        , sceneGraphComponent(localParticipantID, communicationSystem, connectionStatusUpdateNotifier, resourceComponent, frameworkLock)
+        , sceneGraphComponent(localParticipantID, communicationSystem, connectionStatusUpdateNotifier, resourceComponent, statistics, frameworkLock)
     {
         localSceneIdInfo = SceneInfo(localSceneId, "sceneName", EScenePublicationMode_LocalOnly);
         localSceneIdInfoVector.push_back(localSceneIdInfo);
@@ -44,6 +44,16 @@ public:
         return collection;
     }
 
+    ManagedResourceVector createResourcesForInterruptedUpdate()
+    {
+        ManagedResourceVector resources{
+            std::make_shared<const ArrayResource>(EResourceType_IndexArray, 4u, EDataType::UInt16, &interruptedData1, ResourceCacheFlag_DoNotCache, "ui16"),
+            std::make_shared<const ArrayResource>(EResourceType_IndexArray, 4u, EDataType::UInt32, &interruptedData2, ResourceCacheFlag_DoNotCache, "ui32"),
+            std::make_shared<const ArrayResource>(EResourceType_VertexArray, 1000u, EDataType::Float, interruptedData3.data(), ResourceCacheFlag_DoNotCache, "fl")
+        };
+        return resources;
+    }
+
     std::vector<std::vector<Byte>> actionsToChunks(const SceneActionCollection& actions, uint32_t chunkSize = 100000, const ManagedResourceVector& resources = {}, const FlushInformation& flushinfo = {})
     {
         SceneUpdate update{actions.copy(), resources, flushinfo.copy()};
@@ -82,9 +92,14 @@ protected:
     StrictMock<CommunicationSystemMock> communicationSystem;
     NiceMock<MockConnectionStatusUpdateNotifier> connectionStatusUpdateNotifier;
     NiceMock<ResourceProviderComponentMock> resourceComponent;
+    StatisticCollectionFramework statistics;
     SceneGraphComponent sceneGraphComponent;
     StrictMock<SceneRendererHandlerMock> consumer;
     StrictMock<SceneProviderEventConsumerMock> eventConsumer;
+
+    const uint16_t interruptedData1[4] = { 16u, 17u, 18u, 19u };
+    const uint32_t interruptedData2[4] = { 1234u, 1235u, 1236u, 1237u };
+    const std::vector<float> interruptedData3 = std::vector<float>(1000u, 0.1f);
 };
 
 
@@ -249,7 +264,7 @@ TEST_F(ASceneGraphComponent, sendsSceneActionToLocalConsumer)
     });
     SceneUpdate update;
     update.actions = list.copy();
-    sceneGraphComponent.sendSceneUpdate({ localParticipantID }, std::move(update), SceneId(666u), EScenePublicationMode_LocalOnly);
+    sceneGraphComponent.sendSceneUpdate({ localParticipantID }, std::move(update), SceneId(666u), EScenePublicationMode_LocalOnly, nullptr);
 }
 
 TEST_F(ASceneGraphComponent, sendsResourcesUnCompressedToLocalConsumer)
@@ -271,7 +286,7 @@ TEST_F(ASceneGraphComponent, sendsResourcesUnCompressedToLocalConsumer)
         });
     SceneUpdate update;
     update.resources = resources;
-    sceneGraphComponent.sendSceneUpdate({ localParticipantID }, std::move(update), SceneId(666u), EScenePublicationMode_LocalOnly);
+    sceneGraphComponent.sendSceneUpdate({ localParticipantID }, std::move(update), SceneId(666u), EScenePublicationMode_LocalOnly, nullptr);
 }
 
 TEST_F(ASceneGraphComponent, sendsResourcesCompressedToRemoteProvider)
@@ -295,7 +310,8 @@ TEST_F(ASceneGraphComponent, sendsResourcesCompressedToRemoteProvider)
         });
     SceneUpdate update;
     update.resources= resourcesToSend;
-    sceneGraphComponent.sendSceneUpdate({ remoteParticipantID }, std::move(update), sceneId, EScenePublicationMode_LocalAndRemote);
+    const SceneUpdateSerializer serializer(update, IResource::CompressionLevel::REALTIME);
+    sceneGraphComponent.sendSceneUpdate({ remoteParticipantID }, std::move(update), sceneId, EScenePublicationMode_LocalAndRemote, &serializer);
 }
 
 
@@ -305,7 +321,7 @@ TEST_F(ASceneGraphComponent, doesntSendSceneActionIfLocalConsumerIsntSet)
     EXPECT_CALL(consumer, handleSceneUpdate_rvr(_, _, _)).Times(0);
     SceneUpdate update;
     update.actions = list.copy();
-    sceneGraphComponent.sendSceneUpdate({ localParticipantID }, std::move(update), SceneId(666u), EScenePublicationMode_LocalOnly);
+    sceneGraphComponent.sendSceneUpdate({ localParticipantID }, std::move(update), SceneId(666u), EScenePublicationMode_LocalOnly, nullptr);
 }
 
 TEST_F(ASceneGraphComponent, sendsSceneActionToRemoteProvider)
@@ -318,7 +334,8 @@ TEST_F(ASceneGraphComponent, sendsSceneActionToRemoteProvider)
     expectSendSceneActionsToNetwork(remoteParticipantID, sceneId, list);
     SceneUpdate update;
     update.actions = list.copy();
-    sceneGraphComponent.sendSceneUpdate({ remoteParticipantID }, std::move(update), sceneId, EScenePublicationMode_LocalAndRemote);
+    const SceneUpdateSerializer serializer(update, IResource::CompressionLevel::REALTIME);
+    sceneGraphComponent.sendSceneUpdate({ remoteParticipantID }, std::move(update), sceneId, EScenePublicationMode_LocalAndRemote, &serializer);
 }
 
 TEST_F(ASceneGraphComponent, sendsAllSceneActionsAtOnceToRemoteProvider)
@@ -331,7 +348,8 @@ TEST_F(ASceneGraphComponent, sendsAllSceneActionsAtOnceToRemoteProvider)
     expectSendSceneActionsToNetwork(remoteParticipantID, sceneId, list);
     SceneUpdate update;
     update.actions = list.copy();
-    sceneGraphComponent.sendSceneUpdate({ remoteParticipantID }, std::move(update), sceneId, EScenePublicationMode_LocalAndRemote);
+    const SceneUpdateSerializer serializer(update, IResource::CompressionLevel::REALTIME);
+    sceneGraphComponent.sendSceneUpdate({ remoteParticipantID }, std::move(update), sceneId, EScenePublicationMode_LocalAndRemote, &serializer);
 }
 
 TEST_F(ASceneGraphComponent, doesNotsendSceneUpdateToRemoteIfSceneWasPublishedLocalOnly)
@@ -342,7 +360,7 @@ TEST_F(ASceneGraphComponent, doesNotsendSceneUpdateToRemoteIfSceneWasPublishedLo
 
     SceneUpdate update;
     update.actions = list.copy();
-    sceneGraphComponent.sendSceneUpdate({ localParticipantID }, std::move(update), sceneId, EScenePublicationMode_LocalOnly);
+    sceneGraphComponent.sendSceneUpdate({ localParticipantID }, std::move(update), sceneId, EScenePublicationMode_LocalOnly, nullptr);
 
     // expect noting for remote, check by strict mock
 }
@@ -363,7 +381,8 @@ TEST_F(ASceneGraphComponent, canSendSceneActionsToLocalAndRemote)
     });
     SceneUpdate update;
     update.actions = list.copy();
-    sceneGraphComponent.sendSceneUpdate({ remoteParticipantID, localParticipantID }, std::move(update), sceneId, EScenePublicationMode_LocalAndRemote);
+    const SceneUpdateSerializer serializer(update, IResource::CompressionLevel::REALTIME);
+    sceneGraphComponent.sendSceneUpdate({ remoteParticipantID, localParticipantID }, std::move(update), sceneId, EScenePublicationMode_LocalAndRemote, &serializer);
 }
 
 TEST_F(ASceneGraphComponent, canRepublishALocalOnlySceneToBeDistributedRemotely)
@@ -505,6 +524,30 @@ TEST_F(ASceneGraphComponent, disconnectDoesNotAffectLocalScenesAtAllButUnpublish
 }
 
 
+TEST_F(ASceneGraphComponent, keepsSceneLogicAliveUntilFlushIsDoneWhenSceneIsRemovedMeanwhile)
+{
+    SceneInfo sceneInfo(SceneInfo(SceneId(1), "foo"));
+    ClientScene scene(sceneInfo);
+
+    sceneGraphComponent.setSceneRendererHandler(&consumer);
+    sceneGraphComponent.handleCreateScene(scene, false, eventConsumer);
+
+    EXPECT_CALL(consumer, handleNewSceneAvailable(sceneInfo, _));
+    EXPECT_CALL(communicationSystem, broadcastNewScenesAvailable(SceneInfoVector{ sceneInfo }));
+    sceneGraphComponent.handlePublishScene(SceneId(1), EScenePublicationMode_LocalAndRemote);
+    sceneGraphComponent.handleSubscribeScene(SceneId(1), localParticipantID);
+
+    // flush does not hold framework lock all the time, scene can be removed by another thread while flush is still sending
+    EXPECT_CALL(consumer, handleInitializeScene(sceneInfo, _));
+    EXPECT_CALL(consumer, handleSceneUpdate_rvr(SceneId(1), _, _)).WillOnce([&](auto, const auto&, auto) {
+        EXPECT_CALL(communicationSystem, broadcastScenesBecameUnavailable(SceneInfoVector{ sceneInfo }));
+        EXPECT_CALL(consumer, handleSceneBecameUnavailable(sceneInfo.sceneID, _));
+        sceneGraphComponent.handleUnpublishScene(SceneId(1));
+        sceneGraphComponent.handleRemoveScene(SceneId(1));
+    });
+    EXPECT_TRUE(sceneGraphComponent.handleFlush(SceneId(1), {}, {}));
+}
+
     TEST_F(ASceneGraphComponent, forwardsResourceAvailabilityEventsToCorrectHandler)
     {
         StrictMock<SceneProviderEventConsumerMock> scene2Consumer;
@@ -1134,6 +1177,123 @@ TEST_F(ASceneGraphComponent, deserializesResourcesFromRemote_SmallChunks)
         sceneGraphComponent.handleSceneUpdate(SceneId(2), b, Guid(22));
 }
 
+TEST_F(ASceneGraphComponent, resumesResourcesOfUpdateInterruptedByReinitialization)
+{
+    sceneGraphComponent.setSceneRendererHandler(&consumer);
+    sceneGraphComponent.newParticipantHasConnected(Guid(22));
+
+    SceneInfo info_22(SceneId(2), "", EScenePublicationMode_LocalAndRemote);
+    EXPECT_CALL(consumer, handleNewSceneAvailable(info_22, Guid(22)));
+    sceneGraphComponent.handleNewScenesAvailable({ info_22 }, Guid(22));
+    EXPECT_CALL(consumer, handleInitializeScene(info_22, Guid(22)));
+    sceneGraphComponent.handleInitializeScene(SceneId(2), Guid(22));
+
+    const auto resources = createResourcesForInterruptedUpdate();
+    SceneActionCollection actions(createFakeSceneActionCollectionFromTypes({ ESceneActionId::TestAction }));
+    const auto actionBlobs = actionsToChunks(actions, 100, resources);
+    ASSERT_GT(actionBlobs.size(), 1u);
+
+    // scene initialized again before last chunk holding end of last (large) resource
+    for (size_t i = 0; i + 1 < actionBlobs.size(); ++i)
+        sceneGraphComponent.handleSceneUpdate(SceneId(2), actionBlobs[i], Guid(22));
+    EXPECT_CALL(consumer, handleInitializeScene(info_22, Guid(22)));
+    sceneGraphComponent.handleInitializeScene(SceneId(2), Guid(22));
+
+    EXPECT_CALL(consumer, handleSceneUpdate_rvr(SceneId(2), _, Guid(22))).WillOnce([&](const auto&, const auto& update, const auto&) {
+        ASSERT_EQ(update.resources.size(), 3u);
+        for (size_t i = 0; i < resources.size(); ++i)
+        {
+            EXPECT_EQ(update.resources[i]->getTypeID(), resources[i]->getTypeID());
+            EXPECT_EQ(update.resources[i]->getHash(), resources[i]->getHash());
+        }
+        });
+    for (const auto& b : actionBlobs)
+        sceneGraphComponent.handleSceneUpdate(SceneId(2), b, Guid(22));
+
+    EXPECT_EQ(1u, statistics.statResourcesReceivedNumber.getCounterValue());
+    EXPECT_EQ(2u, statistics.statResourcesResumedNumber.getCounterValue());
+}
+
+TEST_F(ASceneGraphComponent, resumesResourcesOfUpdateInterruptedByProviderDisconnectAfterReconnect)
+{
+    sceneGraphComponent.setSceneRendererHandler(&consumer);
+    sceneGraphComponent.newParticipantHasConnected(Guid(22));
+
+    SceneInfo info_22(SceneId(2), "", EScenePublicationMode_LocalAndRemote);
+    EXPECT_CALL(consumer, handleNewSceneAvailable(info_22, Guid(22)));
+    sceneGraphComponent.handleNewScenesAvailable({ info_22 }, Guid(22));
+    EXPECT_CALL(consumer, handleInitializeScene(info_22, Guid(22)));
+    sceneGraphComponent.handleInitializeScene(SceneId(2), Guid(22));
+
+    const auto resources = createResourcesForInterruptedUpdate();
+    SceneActionCollection actions(createFakeSceneActionCollectionFromTypes({ ESceneActionId::TestAction }));
+    const auto actionBlobs = actionsToChunks(actions, 100, resources);
+    ASSERT_GT(actionBlobs.size(), 1u);
+
+    // lose connection before last chunk, update is resent after reconnect
+    for (size_t i = 0; i + 1 < actionBlobs.size(); ++i)
+        sceneGraphComponent.handleSceneUpdate(SceneId(2), actionBlobs[i], Guid(22));
+    EXPECT_CALL(consumer, handleSceneBecameUnavailable(SceneId(2), Guid(22)));
+    sceneGraphComponent.participantHasDisconnected(Guid(22));
+
+    sceneGraphComponent.newParticipantHasConnected(Guid(22));
+    EXPECT_CALL(consumer, handleNewSceneAvailable(info_22, Guid(22)));
+    sceneGraphComponent.handleNewScenesAvailable({ info_22 }, Guid(22));
+    EXPECT_CALL(consumer, handleInitializeScene(info_22, Guid(22)));
+    sceneGraphComponent.handleInitializeScene(SceneId(2), Guid(22));
+
+    EXPECT_CALL(consumer, handleSceneUpdate_rvr(SceneId(2), _, Guid(22))).WillOnce([&](const auto&, const auto& update, const auto&) {
+        ASSERT_EQ(update.resources.size(), 3u);
+        for (size_t i = 0; i < resources.size(); ++i)
+        {
+            EXPECT_EQ(update.resources[i]->getTypeID(), resources[i]->getTypeID());
+            EXPECT_EQ(update.resources[i]->getHash(), resources[i]->getHash());
+        }
+        });
+    for (const auto& b : actionBlobs)
+        sceneGraphComponent.handleSceneUpdate(SceneId(2), b, Guid(22));
+
+    EXPECT_EQ(1u, statistics.statResourcesReceivedNumber.getCounterValue());
+    EXPECT_EQ(2u, statistics.statResourcesResumedNumber.getCounterValue());
+}
+
+TEST_F(ASceneGraphComponent, dropsResourcesOfInterruptedUpdateWhenSceneIsProvidedByOtherParticipant)
+{
+    sceneGraphComponent.setSceneRendererHandler(&consumer);
+    sceneGraphComponent.newParticipantHasConnected(Guid(22));
+
+    SceneInfo info_22(SceneId(2), "", EScenePublicationMode_LocalAndRemote);
+    EXPECT_CALL(consumer, handleNewSceneAvailable(info_22, Guid(22)));
+    sceneGraphComponent.handleNewScenesAvailable({ info_22 }, Guid(22));
+    EXPECT_CALL(consumer, handleInitializeScene(info_22, Guid(22)));
+    sceneGraphComponent.handleInitializeScene(SceneId(2), Guid(22));
+
+    const auto resources = createResourcesForInterruptedUpdate();
+    SceneActionCollection actions(createFakeSceneActionCollectionFromTypes({ ESceneActionId::TestAction }));
+    const auto actionBlobs = actionsToChunks(actions, 100, resources);
+    ASSERT_GT(actionBlobs.size(), 1u);
+
+    for (size_t i = 0; i + 1 < actionBlobs.size(); ++i)
+        sceneGraphComponent.handleSceneUpdate(SceneId(2), actionBlobs[i], Guid(22));
+    EXPECT_CALL(consumer, handleSceneBecameUnavailable(SceneId(2), Guid(22)));
+    sceneGraphComponent.participantHasDisconnected(Guid(22));
+
+    sceneGraphComponent.newParticipantHasConnected(Guid(33));
+    EXPECT_CALL(consumer, handleNewSceneAvailable(info_22, Guid(33)));
+    sceneGraphComponent.handleNewScenesAvailable({ info_22 }, Guid(33));
+    EXPECT_CALL(consumer, handleInitializeScene(info_22, Guid(33)));
+    sceneGraphComponent.handleInitializeScene(SceneId(2), Guid(33));
+
+    EXPECT_CALL(consumer, handleSceneUpdate_rvr(SceneId(2), _, Guid(33))).WillOnce([&](const auto&, const auto& update, const auto&) {
+        EXPECT_EQ(update.resources.size(), 3u);
+        });
+    for (const auto& b : actionBlobs)
+        sceneGraphComponent.handleSceneUpdate(SceneId(2), b, Guid(33));
+
+    EXPECT_EQ(3u, statistics.statResourcesReceivedNumber.getCounterValue());
+    EXPECT_EQ(0u, statistics.statResourcesResumedNumber.getCounterValue());
+}
+
 TEST_F(ASceneGraphComponent, returnsFalseForFlushOnWrongResolvedResourceNumber_Shadow)
 {
     const SceneId sceneId(1u);
@@ -0,0 +1,105 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2020 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#ifndef RAMSES_ASYNCLOGDISPATCHER_H
+#define RAMSES_ASYNCLOGDISPATCHER_H
+
+#include "Utils/LogLevel.h"
+#include "PlatformAbstraction/PlatformTypes.h"
+#include "PlatformAbstraction/PlatformThread.h"
+#include "PlatformAbstraction/PlatformEvent.h"
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace ramses_internal
+{
+    class LogContext;
+    class LogMessage;
+
+    enum class ELogOverflowPolicy
+    {
+        DropMessage,    // message is discarded and counted, logging thread never waits
+        WaitForSpace,   // logging thread waits until dispatch thread made space
+    };
+
+    // Decouples logging threads from (possibly slow) log appenders: messages are copied into a bounded
+    // lock-free multi producer / single consumer ring and handed to the dispatch function from a dedicated thread.
+    // Messages of one logging thread keep their order and the time they were logged at. When messages were dropped,
+    // the dispatch thread reports the number of dropped messages as a warning once the ring has space again.
+    class AsyncLogDispatcher final : public Runnable
+    {
+    public:
+        using DispatchFunction = std::function<void(const LogMessage&)>;
+
+        // capacity is rounded up to a power of two
+        AsyncLogDispatcher(UInt32 capacity, ELogOverflowPolicy overflowPolicy, DispatchFunction dispatchFunction);
+        // dispatches all queued messages before returning
+        virtual ~AsyncLogDispatcher() override;
+
+        // returns false if message was dropped
+        bool push(const LogMessage& msg);
+        // blocks until all messages pushed before were dispatched, does not wait when called from dispatch thread
+        void flush();
+
+        UInt32 getCapacity() const;
+        ELogOverflowPolicy getOverflowPolicy() const;
+        UInt64 getNumberOfDroppedMessages() const;
+
+        AsyncLogDispatcher(const AsyncLogDispatcher&) = delete;
+        AsyncLogDispatcher& operator=(const AsyncLogDispatcher&) = delete;
+
+    private:
+        struct Slot
+        {
+            std::atomic<UInt64> sequence{ 0u };
+            const LogContext* context = nullptr;
+            ELogLevel logLevel = ELogLevel::Off;
+            UInt64 timestampMilliseconds = 0u;
+            // buffer is handed back after dispatch, so logging threads reuse its capacity
+            std::string message;
+        };
+
+        virtual void run() override;
+        bool tryPush(const LogMessage& msg, UInt64 timestampMilliseconds);
+        bool dispatchNext();
+        void reportDroppedMessages();
+        void wakeUpDispatchThread();
+        void wakeUpWaitingThreads();
+
+        const ELogOverflowPolicy m_overflowPolicy;
+        const DispatchFunction m_dispatchFunction;
+        std::vector<Slot> m_slots;
+        const UInt64 m_indexMask;
+
+        std::atomic<UInt64> m_enqueuePosition{ 0u };
+        std::atomic<UInt64> m_dispatchedPosition{ 0u };
+        std::atomic<UInt64> m_droppedMessages{ 0u };
+        std::atomic<bool> m_dispatchThreadIdle{ false };
+
+        // only accessed by dispatch thread
+        UInt64 m_dequeuePosition = 0u;
+        UInt64 m_reportedDroppedMessages = 0u;
+
+        PlatformEvent m_event;
+
+        // logging threads waiting for space or flush block here, dispatch thread notifies only if there are any
+        std::mutex m_waitLock;
+        std::condition_variable m_dispatchProgress;
+        std::atomic<UInt32> m_waitingThreads{ 0u };
+
+        PlatformThread m_thread;
+        std::atomic<std::thread::id> m_dispatchThreadId{ std::thread::id() };
+    };
+}
+
+#endif
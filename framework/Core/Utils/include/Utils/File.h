@@ -49,6 +49,8 @@ namespace ramses_internal
         bool createFile();
         bool createDirectory();
         bool remove();
+        // atomically replaces a file existing at newPath, file must not be open
+        RNODISCARD bool renameTo(const String& newPath);
 
         RNODISCARD bool open(const Mode& mode);
         bool close();
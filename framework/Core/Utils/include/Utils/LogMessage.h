@@ -19,22 +19,26 @@ namespace ramses_internal
     class LogMessage
     {
     public:
-        LogMessage(const LogContext& context, ELogLevel logLevel, const StringOutputStream& stream);
+        LogMessage(const LogContext& context, ELogLevel logLevel, const StringOutputStream& stream, UInt64 timestampMilliseconds = 0u);
 
         const StringOutputStream& getStream() const;
         const LogContext& getContext() const;
         ELogLevel getLogLevel() const;
+        // absolute time the message was logged at, 0 if message is handed to appenders right when logged
+        UInt64 getTimestampMilliseconds() const;
 
     private:
         const LogContext& m_context;
         const ELogLevel m_logLevel;
         const StringOutputStream& m_outputStream;
+        const UInt64 m_timestampMilliseconds;
     };
 
-    inline LogMessage::LogMessage(const LogContext& context, ELogLevel logLevel, const StringOutputStream& stream)
+    inline LogMessage::LogMessage(const LogContext& context, ELogLevel logLevel, const StringOutputStream& stream, UInt64 timestampMilliseconds)
         : m_context(context)
         , m_logLevel(logLevel)
         , m_outputStream(stream)
+        , m_timestampMilliseconds(timestampMilliseconds)
     {
     }
 
@@ -52,6 +56,11 @@ namespace ramses_internal
     {
         return m_logLevel;
     }
+
+    inline UInt64 LogMessage::getTimestampMilliseconds() const
+    {
+        return m_timestampMilliseconds;
+    }
 }
 
 #endif
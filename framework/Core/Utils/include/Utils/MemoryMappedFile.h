@@ -0,0 +1,57 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2020 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#ifndef RAMSES_MEMORYMAPPEDFILE_H
+#define RAMSES_MEMORYMAPPEDFILE_H
+
+#include "Collections/String.h"
+#include "PlatformAbstraction/PlatformTypes.h"
+#include "PlatformAbstraction/Macros.h"
+#include <cstdint>
+
+namespace ramses_internal
+{
+    // Read-only view of a whole file mapped into memory. Pages are loaded by the OS on first access,
+    // so only the parts of the file which are actually read occupy memory.
+    // On posix the file may be removed or replaced on disk while mapped, the mapping keeps referring to the original content.
+    // Windows refuses to replace a file which is still mapped, it must be unmapped first.
+    class MemoryMappedFile final
+    {
+    public:
+#ifdef _WIN32
+        static constexpr bool CanBeReplacedWhileMapped = false;
+#else
+        static constexpr bool CanBeReplacedWhileMapped = true;
+#endif
+
+        explicit MemoryMappedFile(String filepath);
+        ~MemoryMappedFile();
+
+        RNODISCARD bool map();
+        void unmap();
+        RNODISCARD bool isMapped() const;
+
+        RNODISCARD const Byte* getData() const;
+        RNODISCARD size_t getSize() const;
+        RNODISCARD const String& getPath() const;
+
+        MemoryMappedFile(const MemoryMappedFile&) = delete;
+        MemoryMappedFile& operator=(const MemoryMappedFile&) = delete;
+
+    private:
+        String m_path;
+        const Byte* m_data = nullptr;
+        size_t m_size = 0u;
+#ifdef _WIN32
+        void* m_fileHandle = nullptr;
+        void* m_mappingHandle = nullptr;
+#endif
+    };
+}
+
+#endif
@@ -13,6 +13,7 @@
 #include "Utils/LogContext.h"
 #include "Utils/ConsoleLogAppender.h"
 #include "Utils/LogAppenderBase.h"
+#include "Utils/AsyncLogDispatcher.h"
 #include "Collections/Vector.h"
 #include "Collections/String.h"
 #include <mutex>
@@ -44,6 +45,11 @@ namespace ramses_internal
 
         void log(const LogMessage& msg);
 
+        // messages are handed to appenders from a separate thread from now on, cannot be disabled again
+        void enableAsyncLogging(UInt32 queueCapacity, ELogOverflowPolicy overflowPolicy);
+        bool isAsyncLoggingEnabled() const;
+        UInt64 getNumberOfDroppedLogMessages() const;
+
         void applyContextFilterCommand(const String& command);
         std::vector<LogContextInformation> getAllContextsInformation() const;
 
@@ -64,6 +70,7 @@ namespace ramses_internal
     private:
         static const ELogLevel LogLevelDefault_Contexts = ELogLevel::Info;
         static const ELogLevel LogLevelDefault_Console = ELogLevel::Info;
+        static const UInt32 AsyncLogQueueCapacityDefault = 4096u;
 
 
         static void UpdateConsoleLogLevelFromDefine(ELogLevel& loglevel);
@@ -71,6 +78,7 @@ namespace ramses_internal
 
         void dltLogLevelChangeCallback(const String& contextId, int logLevelAsInt);
         LogContext* getLogContextById(const String& contextId);
+        void logToAppenders(const LogMessage& msg);
 
         std::mutex m_appenderLock;
         bool m_isInitialized;
@@ -82,6 +90,9 @@ namespace ramses_internal
         std::vector<LogAppenderBase*> m_logAppenders;
         LogContext& m_fileTransferContext;
         ELogLevel m_consoleLogLevelProgrammatically = LogLevelDefault_Console;
+        std::unique_ptr<AsyncLogDispatcher> m_asyncLogDispatcherStorage;
+        std::atomic<AsyncLogDispatcher*> m_asyncLogDispatcher{ nullptr };
+        std::atomic<UInt32> m_asyncLogCallsInProgress{ 0u };
     };
 
     inline RamsesLogger& GetRamsesLogger()
@@ -163,8 +163,11 @@ namespace ramses_internal
         StatisticEntry<UInt32> statResourcesSentNumber;
         StatisticEntry<UInt32> statResourcesSentSize;
         StatisticEntry<UInt32> statResourcesReceivedNumber;
+        StatisticEntry<UInt32> statResourcesResumedNumber; // resources taken over from interrupted transfer instead of received again
         StatisticEntry<UInt32> statResourcesLoadedFromFileNumber;
         StatisticEntry<UInt32> statResourcesLoadedFromFileSize;
+        StatisticEntry<UInt32> statSocketWrites; // one write may contain several messages
+        StatisticEntry<UInt32> statSocketBytesSent;
     };
 
     class StatisticCollectionScene : public StatisticCollection
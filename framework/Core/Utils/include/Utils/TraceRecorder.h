@@ -0,0 +1,139 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2020 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#ifndef RAMSES_TRACERECORDER_H
+#define RAMSES_TRACERECORDER_H
+
+#include "PlatformAbstraction/PlatformTypes.h"
+#include "PlatformAbstraction/PlatformTime.h"
+#include "Collections/String.h"
+#include <atomic>
+#include <mutex>
+#include <memory>
+#include <vector>
+#include <limits>
+
+namespace ramses_internal
+{
+    class StringOutputStream;
+
+    // Opt-in recorder of timeline events which are exported as trace event JSON
+    // (loadable in chrome://tracing or the Perfetto UI).
+    // Events are collected in per thread buffers, nothing is recorded (and almost nothing done) while recording is off.
+    // Timestamps are taken from the monotonic clock so that traces of several processes on the same machine
+    // can be merged, events are correlated by scene id and flush index, flushes additionally by flow events
+    // from client to renderer.
+    // Category and name must be string literals (or otherwise outlive the recorder) which need no JSON escaping.
+    class TraceRecorder
+    {
+    public:
+        static constexpr UInt64 NoValue = std::numeric_limits<UInt64>::max();
+
+        TraceRecorder();
+
+        void startRecording();
+        void stopRecording();
+        bool isRecording() const
+        {
+            return m_recording.load(std::memory_order_relaxed);
+        }
+
+        void addCompleteEvent(const char* category, const char* name, UInt64 startTimeUs, UInt64 durationUs, UInt64 sceneId = NoValue, UInt64 flushIndex = NoValue);
+        void addInstantEvent(const char* category, const char* name, UInt64 sceneId = NoValue, UInt64 flushIndex = NoValue);
+        // flow events connect the enclosing complete events of the same flow id, possibly across processes
+        void addFlowStartEvent(const char* category, const char* name, UInt64 flowId);
+        void addFlowEndEvent(const char* category, const char* name, UInt64 flowId);
+
+        UInt64 getNumberOfEvents() const;
+        UInt64 getNumberOfDroppedEvents() const;
+        void setMaximumNumberOfEventsPerThread(UInt64 maxEvents);
+        void clear();
+
+        String toJson() const;
+        bool writeToFile(const String& filePath) const;
+
+        static UInt64 GetFlushFlowId(UInt64 sceneId, UInt64 flushIndex);
+
+        TraceRecorder(const TraceRecorder&) = delete;
+        TraceRecorder& operator=(const TraceRecorder&) = delete;
+
+    private:
+        struct Event
+        {
+            const char* category;
+            const char* name;
+            char phase;
+            UInt64 timestampUs;
+            UInt64 durationUs;
+            UInt64 sceneId;
+            UInt64 flushIndex;
+            UInt64 flowId;
+        };
+
+        struct ThreadBuffer
+        {
+            UInt32 threadIndex;
+            std::mutex lock;
+            std::vector<Event> events;
+        };
+
+        void addEvent(const Event& event);
+        ThreadBuffer& getThreadBuffer();
+        static void AppendEvent(StringOutputStream& json, const Event& event, UInt32 processId, UInt32 threadIndex);
+
+        const UInt64 m_recorderId;
+        std::atomic<bool> m_recording{ false };
+        std::atomic<UInt64> m_maxEventsPerThread;
+        std::atomic<UInt64> m_droppedEvents{ 0u };
+        mutable std::mutex m_buffersLock;
+        std::vector<std::shared_ptr<ThreadBuffer>> m_threadBuffers;
+    };
+
+    inline TraceRecorder& GetTraceRecorder()
+    {
+        static TraceRecorder recorder;
+        return recorder;
+    }
+
+    // Records a complete event for the lifetime of the scope if recording was on when the scope was entered
+    class TraceScope
+    {
+    public:
+        TraceScope(const char* category, const char* name, UInt64 sceneId = TraceRecorder::NoValue, UInt64 flushIndex = TraceRecorder::NoValue)
+            : m_category(category)
+            , m_name(name)
+            , m_sceneId(sceneId)
+            , m_flushIndex(flushIndex)
+            , m_startTimeUs(GetTraceRecorder().isRecording() ? PlatformTime::GetMicrosecondsMonotonic() : TraceRecorder::NoValue)
+        {
+        }
+
+        ~TraceScope()
+        {
+            if (m_startTimeUs != TraceRecorder::NoValue)
+                GetTraceRecorder().addCompleteEvent(m_category, m_name, m_startTimeUs, PlatformTime::GetMicrosecondsMonotonic() - m_startTimeUs, m_sceneId, m_flushIndex);
+        }
+
+        void setFlushIndex(UInt64 flushIndex)
+        {
+            m_flushIndex = flushIndex;
+        }
+
+        TraceScope(const TraceScope&) = delete;
+        TraceScope& operator=(const TraceScope&) = delete;
+
+    private:
+        const char* m_category;
+        const char* m_name;
+        UInt64 m_sceneId;
+        UInt64 m_flushIndex;
+        const UInt64 m_startTimeUs;
+    };
+}
+
+#endif
@@ -0,0 +1,52 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2020 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#ifndef RAMSES_VARINTENCODING_H
+#define RAMSES_VARINTENCODING_H
+
+#include "PlatformAbstraction/PlatformTypes.h"
+
+namespace ramses_internal
+{
+    // LEB128 style unsigned integers: 7 bits per byte, least significant group first,
+    // high bit set on all bytes but the last. Values below 128 take a single byte.
+    namespace VarIntEncoding
+    {
+        static constexpr UInt MaxEncodedSize = 10u;
+
+        // writes at most MaxEncodedSize bytes to out, returns number of bytes written
+        inline UInt Encode(UInt64 value, Byte* out)
+        {
+            UInt size = 0u;
+            while (value >= 0x80u)
+            {
+                out[size++] = static_cast<Byte>(value | 0x80u);
+                value >>= 7u;
+            }
+            out[size++] = static_cast<Byte>(value);
+            return size;
+        }
+
+        // reads one value starting at data and advances data behind it, data is never read at or beyond end.
+        // Returns false if the value is not terminated before end or has more than MaxEncodedSize bytes.
+        inline bool Decode(const Byte*& data, const Byte* end, UInt64& value)
+        {
+            value = 0u;
+            for (UInt32 shift = 0u; shift < MaxEncodedSize * 7u && data < end; shift += 7u)
+            {
+                const Byte byte = *data++;
+                value |= static_cast<UInt64>(byte & 0x7fu) << shift;
+                if ((byte & 0x80u) == 0u)
+                    return true;
+            }
+            return false;
+        }
+    }
+}
+
+#endif
@@ -0,0 +1,223 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2020 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "Utils/AsyncLogDispatcher.h"
+#include "Utils/LogMessage.h"
+#include "Utils/LogMacros.h"
+#include "PlatformAbstraction/PlatformTime.h"
+#include "fmt/format.h"
+#include <cassert>
+
+namespace ramses_internal
+{
+    namespace
+    {
+        UInt32 RoundUpToPowerOfTwo(UInt32 value)
+        {
+            UInt32 result = 1u;
+            while (result < value)
+                result <<= 1u;
+            return result;
+        }
+    }
+
+    AsyncLogDispatcher::AsyncLogDispatcher(UInt32 capacity, ELogOverflowPolicy overflowPolicy, DispatchFunction dispatchFunction)
+        : m_overflowPolicy(overflowPolicy)
+        , m_dispatchFunction(std::move(dispatchFunction))
+        , m_slots(RoundUpToPowerOfTwo(std::max(capacity, 2u)))
+        , m_indexMask(m_slots.size() - 1u)
+        , m_thread("R_LogDispatch")
+    {
+        // slot i is free for enqueue position i, see tryPush
+        for (UInt64 i = 0u; i < m_slots.size(); ++i)
+            m_slots[i].sequence.store(i, std::memory_order_relaxed);
+        m_thread.start(*this);
+    }
+
+    AsyncLogDispatcher::~AsyncLogDispatcher()
+    {
+        m_thread.cancel();
+        wakeUpDispatchThread();
+        m_thread.join();
+
+        // messages pushed concurrently to shutdown
+        while (dispatchNext())
+        {
+        }
+        reportDroppedMessages();
+    }
+
+    bool AsyncLogDispatcher::push(const LogMessage& msg)
+    {
+        // appenders would otherwise print the time of dispatch
+        const UInt64 timestampMilliseconds = PlatformTime::GetMillisecondsAbsolute();
+        if (tryPush(msg, timestampMilliseconds))
+        {
+            wakeUpDispatchThread();
+            return true;
+        }
+
+        if (m_overflowPolicy == ELogOverflowPolicy::WaitForSpace && m_dispatchThreadId.load() != std::this_thread::get_id())
+        {
+            // pairs with fence in wakeUpWaitingThreads: either dispatch thread sees this thread waiting or we see freed slot
+            m_waitingThreads.fetch_add(1u);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            {
+                std::unique_lock<std::mutex> lock(m_waitLock);
+                while (!tryPush(msg, timestampMilliseconds))
+                {
+                    m_event.signal();
+                    m_dispatchProgress.wait(lock);
+                }
+            }
+            m_waitingThreads.fetch_sub(1u);
+            wakeUpDispatchThread();
+            return true;
+        }
+
+        m_droppedMessages.fetch_add(1u, std::memory_order_relaxed);
+        return false;
+    }
+
+    void AsyncLogDispatcher::flush()
+    {
+        if (m_dispatchThreadId.load() == std::this_thread::get_id())
+            return;
+
+        const UInt64 targetPosition = m_enqueuePosition.load();
+        m_waitingThreads.fetch_add(1u);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        {
+            std::unique_lock<std::mutex> lock(m_waitLock);
+            while (m_dispatchedPosition.load(std::memory_order_acquire) < targetPosition)
+            {
+                m_event.signal();
+                m_dispatchProgress.wait(lock);
+            }
+        }
+        m_waitingThreads.fetch_sub(1u);
+    }
+
+    UInt32 AsyncLogDispatcher::getCapacity() const
+    {
+        return static_cast<UInt32>(m_slots.size());
+    }
+
+    ELogOverflowPolicy AsyncLogDispatcher::getOverflowPolicy() const
+    {
+        return m_overflowPolicy;
+    }
+
+    UInt64 AsyncLogDispatcher::getNumberOfDroppedMessages() const
+    {
+        return m_droppedMessages.load(std::memory_order_relaxed);
+    }
+
+    bool AsyncLogDispatcher::tryPush(const LogMessage& msg, UInt64 timestampMilliseconds)
+    {
+        // bounded queue after D. Vyukov: a slot is free for position pos when its sequence equals pos
+        // and holds a message for the consumer when its sequence equals pos + 1
+        UInt64 position = m_enqueuePosition.load(std::memory_order_relaxed);
+        Slot* slot = nullptr;
+        for (;;)
+        {
+            slot = &m_slots[position & m_indexMask];
+            const UInt64 sequence = slot->sequence.load(std::memory_order_acquire);
+            if (sequence == position)
+            {
+                if (m_enqueuePosition.compare_exchange_weak(position, position + 1u, std::memory_order_relaxed))
+                    break;
+            }
+            else if (sequence < position)
+            {
+                // full
+                return false;
+            }
+            else
+            {
+                position = m_enqueuePosition.load(std::memory_order_relaxed);
+            }
+        }
+
+        slot->context = &msg.getContext();
+        slot->logLevel = msg.getLogLevel();
+        slot->timestampMilliseconds = timestampMilliseconds;
+        slot->message.assign(msg.getStream().c_str(), msg.getStream().size());
+        slot->sequence.store(position + 1u, std::memory_order_release);
+        return true;
+    }
+
+    bool AsyncLogDispatcher::dispatchNext()
+    {
+        Slot& slot = m_slots[m_dequeuePosition & m_indexMask];
+        if (slot.sequence.load(std::memory_order_acquire) != m_dequeuePosition + 1u)
+            return false;
+
+        StringOutputStream stream(std::move(slot.message));
+        m_dispatchFunction(LogMessage(*slot.context, slot.logLevel, stream, slot.timestampMilliseconds));
+        slot.message = std::move(stream.release().stdRef());
+
+        slot.sequence.store(m_dequeuePosition + m_slots.size(), std::memory_order_release);
+        ++m_dequeuePosition;
+        m_dispatchedPosition.store(m_dequeuePosition, std::memory_order_release);
+        wakeUpWaitingThreads();
+        return true;
+    }
+
+    void AsyncLogDispatcher::reportDroppedMessages()
+    {
+        const UInt64 droppedMessages = m_droppedMessages.load(std::memory_order_relaxed);
+        if (droppedMessages != m_reportedDroppedMessages)
+        {
+            const StringOutputStream stream(fmt::format("AsyncLogDispatcher: dropped {} log messages because queue of size {} was full ({} in total)",
+                droppedMessages - m_reportedDroppedMessages, m_slots.size(), droppedMessages));
+            m_dispatchFunction(LogMessage(CONTEXT_FRAMEWORK, ELogLevel::Warn, stream));
+            m_reportedDroppedMessages = droppedMessages;
+        }
+    }
+
+    void AsyncLogDispatcher::wakeUpDispatchThread()
+    {
+        // pairs with fence in run: either dispatch thread sees the new message or we see it idle
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (m_dispatchThreadIdle.load(std::memory_order_relaxed))
+            m_event.signal();
+    }
+
+    void AsyncLogDispatcher::wakeUpWaitingThreads()
+    {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (m_waitingThreads.load(std::memory_order_relaxed) != 0u)
+        {
+            // taking lock ensures waiting thread either did not check for progress yet or already waits
+            {
+                std::lock_guard<std::mutex> lock(m_waitLock);
+            }
+            m_dispatchProgress.notify_all();
+        }
+    }
+
+    void AsyncLogDispatcher::run()
+    {
+        m_dispatchThreadId = std::this_thread::get_id();
+        while (!isCancelRequested())
+        {
+            while (dispatchNext())
+            {
+            }
+            reportDroppedMessages();
+
+            m_dispatchThreadIdle.store(true, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            const Slot& nextSlot = m_slots[m_dequeuePosition & m_indexMask];
+            if (nextSlot.sequence.load(std::memory_order_acquire) != m_dequeuePosition + 1u && !isCancelRequested())
+                m_event.wait(100u);
+            m_dispatchThreadIdle.store(false, std::memory_order_relaxed);
+        }
+    }
+}
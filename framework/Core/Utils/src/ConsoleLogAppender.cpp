@@ -32,7 +32,7 @@ namespace ramses_internal
         // TODO(tobias) make static initializer
         Console::EnsureConsoleInitialized();
 
-        const uint64_t now = PlatformTime::GetMillisecondsAbsolute();
+        const uint64_t now = logMessage.getTimestampMilliseconds() != 0u ? logMessage.getTimestampMilliseconds() : PlatformTime::GetMillisecondsAbsolute();
         const char* logLevelColor = nullptr;
         const char* logLevelStr = nullptr;
 
@@ -270,6 +270,14 @@ namespace ramses_internal
         return false;
     }
 
+    bool File::renameTo(const String& newPath)
+    {
+        if (MoveFileExA(m_path.c_str(), newPath.c_str(), MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH) != TRUE)
+            return false;
+        m_path = newPath;
+        return true;
+    }
+
     bool File::isDirectory() const
     {
         DWORD dwAttributes = GetFileAttributesA(m_path.c_str());
@@ -361,6 +369,14 @@ namespace ramses_internal
         return false;
     }
 
+    bool File::renameTo(const String& newPath)
+    {
+        if (::rename(m_path.c_str(), newPath.c_str()) != 0)
+            return false;
+        m_path = newPath;
+        return true;
+    }
+
     bool File::exists() const
     {
         struct stat fileStats;
@@ -0,0 +1,150 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2020 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "Utils/MemoryMappedFile.h"
+
+namespace ramses_internal
+{
+    MemoryMappedFile::MemoryMappedFile(String filepath)
+        : m_path(std::move(filepath))
+    {
+    }
+
+    MemoryMappedFile::~MemoryMappedFile()
+    {
+        unmap();
+    }
+
+    bool MemoryMappedFile::isMapped() const
+    {
+        return m_data != nullptr;
+    }
+
+    const Byte* MemoryMappedFile::getData() const
+    {
+        return m_data;
+    }
+
+    size_t MemoryMappedFile::getSize() const
+    {
+        return m_size;
+    }
+
+    const String& MemoryMappedFile::getPath() const
+    {
+        return m_path;
+    }
+}
+
+#ifdef _WIN32
+
+#include "PlatformAbstraction/MinimalWindowsH.h"
+
+namespace ramses_internal
+{
+    bool MemoryMappedFile::map()
+    {
+        unmap();
+
+        // allow other handles to delete or rename the file while it is mapped
+        HANDLE fileHandle = CreateFileA(m_path.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (fileHandle == INVALID_HANDLE_VALUE)
+            return false;
+
+        LARGE_INTEGER fileSize;
+        if (GetFileSizeEx(fileHandle, &fileSize) != TRUE || fileSize.QuadPart == 0)
+        {
+            // empty files cannot be mapped
+            CloseHandle(fileHandle);
+            return false;
+        }
+
+        HANDLE mappingHandle = CreateFileMappingA(fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (mappingHandle == nullptr)
+        {
+            CloseHandle(fileHandle);
+            return false;
+        }
+
+        const void* data = MapViewOfFile(mappingHandle, FILE_MAP_READ, 0, 0, 0);
+        if (data == nullptr)
+        {
+            CloseHandle(mappingHandle);
+            CloseHandle(fileHandle);
+            return false;
+        }
+
+        m_fileHandle = fileHandle;
+        m_mappingHandle = mappingHandle;
+        m_data = static_cast<const Byte*>(data);
+        m_size = static_cast<size_t>(fileSize.QuadPart);
+        return true;
+    }
+
+    void MemoryMappedFile::unmap()
+    {
+        if (m_data == nullptr)
+            return;
+
+        UnmapViewOfFile(m_data);
+        CloseHandle(m_mappingHandle);
+        CloseHandle(m_fileHandle);
+        m_fileHandle = nullptr;
+        m_mappingHandle = nullptr;
+        m_data = nullptr;
+        m_size = 0u;
+    }
+}
+
+#else // posix
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+namespace ramses_internal
+{
+    bool MemoryMappedFile::map()
+    {
+        unmap();
+
+        const int fd = ::open(m_path.c_str(), O_RDONLY);
+        if (fd < 0)
+            return false;
+
+        struct stat fileStats;
+        if (fstat(fd, &fileStats) != 0 || fileStats.st_size <= 0)
+        {
+            // empty files cannot be mapped
+            ::close(fd);
+            return false;
+        }
+
+        const size_t size = static_cast<size_t>(fileStats.st_size);
+        void* data = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+        // mapping stays valid after closing the descriptor
+        ::close(fd);
+        if (data == MAP_FAILED)  // NOLINT(cppcoreguidelines-pro-type-cstyle-cast) ignore cast in system macro
+            return false;
+
+        m_data = static_cast<const Byte*>(data);
+        m_size = size;
+        return true;
+    }
+
+    void MemoryMappedFile::unmap()
+    {
+        if (m_data == nullptr)
+            return;
+
+        munmap(const_cast<Byte*>(m_data), m_size);
+        m_data = nullptr;
+        m_size = 0u;
+    }
+}
+#endif
@@ -150,6 +150,10 @@ namespace ramses_internal
                     logStatisticSummaryEntry(output, m_statisticCollection.statRequestResourceMessagesReceived.getSummary(), numberTimeIntervals);
                     output << " msgO ";
                     logStatisticSummaryEntry(output, m_statisticCollection.statMessagesSent.getSummary(), numberTimeIntervals);
+                    output << " wrO ";
+                    logStatisticSummaryEntry(output, m_statisticCollection.statSocketWrites.getSummary(), numberTimeIntervals);
+                    output << " bytesO ";
+                    logStatisticSummaryEntry(output, m_statisticCollection.statSocketBytesSent.getSummary(), numberTimeIntervals);
                     output << " res+ ";
                     logStatisticSummaryEntry(output, m_statisticCollection.statResourcesCreated.getSummary(), numberTimeIntervals);
                     output << " res- ";
@@ -162,6 +166,8 @@ namespace ramses_internal
                     logStatisticSummaryEntry(output, m_statisticCollection.statResourcesSentNumber.getSummary(), numberTimeIntervals);
                     output << " resINr ";
                     logStatisticSummaryEntry(output, m_statisticCollection.statResourcesReceivedNumber.getSummary(), numberTimeIntervals);
+                    output << " resRNr ";
+                    logStatisticSummaryEntry(output, m_statisticCollection.statResourcesResumedNumber.getSummary(), numberTimeIntervals);
                     output << " resF ";
                     logStatisticSummaryEntry(output, m_statisticCollection.statResourcesLoadedFromFileNumber.getSummary(), numberTimeIntervals);
                     output << " resFS ";
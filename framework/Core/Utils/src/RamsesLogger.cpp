@@ -15,6 +15,7 @@
 #include "DltLogAppender/DltLogAppender.h"
 #include "PlatformAbstraction/PlatformEnvironmentVariables.h"
 #include <cassert>
+#include <thread>
 
 #ifdef __ANDROID__
     #include <AndroidLogger/AndroidLogAppender.h>
@@ -22,6 +23,8 @@
 
 namespace ramses_internal
 {
+    const UInt32 RamsesLogger::AsyncLogQueueCapacityDefault;
+
     RamsesLogger::RamsesLogger()
         : m_isInitialized(false)
         , m_consoleLogAppender()
@@ -43,6 +46,13 @@ namespace ramses_internal
 
     RamsesLogger::~RamsesLogger()
     {
+        // stop handing messages to dispatcher, wait for logging threads still using it and
+        // dispatch remaining messages while appenders still exist
+        m_asyncLogDispatcher.store(nullptr);
+        while (m_asyncLogCallsInProgress.load() != 0u)
+            std::this_thread::yield();
+        m_asyncLogDispatcherStorage.reset();
+
         for (auto& ctx : m_logContexts)
         {
             delete ctx;
@@ -187,6 +197,12 @@ namespace ramses_internal
             }
         }
 
+        ArgumentBool asyncLogging(parser, "la", "log-async", "");
+        ArgumentBool asyncLoggingBlocking(parser, "lab", "log-async-blocking", "");
+        ArgumentUInt32 asyncLoggingQueueCapacity(parser, "laq", "log-async-queue-capacity", AsyncLogQueueCapacityDefault);
+        if (asyncLogging || asyncLoggingBlocking)
+            enableAsyncLogging(asyncLoggingQueueCapacity, asyncLoggingBlocking ? ELogOverflowPolicy::WaitForSpace : ELogOverflowPolicy::DropMessage);
+
         ArgumentBool enableSmokeTestContext(parser, "estc", "enableSmokeTestContext", "");
         if (!enableSmokeTestContext.wasDefined())
         {
@@ -195,7 +211,7 @@ namespace ramses_internal
         }
 
         LOG_INFO(CONTEXT_FRAMEWORK, "Ramses log levels: Contexts " << RamsesLogger::GetLogLevelText(logLevelContexts) <<
-                 ", Console " << RamsesLogger::GetLogLevelText(logLevelConsole));
+                 ", Console " << RamsesLogger::GetLogLevelText(logLevelConsole) << (isAsyncLoggingEnabled() ? ", async" : ""));
     }
 
     void RamsesLogger::applyContextFilterCommand(const String& command)
@@ -334,14 +350,58 @@ namespace ramses_internal
     {
         if (msg.getStream().size() > 0)
         {
-            std::lock_guard<std::mutex> guard(m_appenderLock);
-            for (auto& appender : m_logAppenders)
+            // announce use of dispatcher before loading it, destructor waits until no call uses it anymore
+            m_asyncLogCallsInProgress.fetch_add(1u);
+            AsyncLogDispatcher* asyncLogDispatcher = m_asyncLogDispatcher.load();
+            if (!asyncLogDispatcher)
             {
-                appender->log(msg);
+                m_asyncLogCallsInProgress.fetch_sub(1u);
+                logToAppenders(msg);
+            }
+            else if (msg.getLogLevel() == ELogLevel::Fatal)
+            {
+                // application is likely to terminate, make sure this and all previous messages arrive
+                asyncLogDispatcher->flush();
+                m_asyncLogCallsInProgress.fetch_sub(1u);
+                logToAppenders(msg);
+            }
+            else
+            {
+                asyncLogDispatcher->push(msg);
+                m_asyncLogCallsInProgress.fetch_sub(1u);
             }
         }
     }
 
+    void RamsesLogger::logToAppenders(const LogMessage& msg)
+    {
+        std::lock_guard<std::mutex> guard(m_appenderLock);
+        for (auto& appender : m_logAppenders)
+        {
+            appender->log(msg);
+        }
+    }
+
+    void RamsesLogger::enableAsyncLogging(UInt32 queueCapacity, ELogOverflowPolicy overflowPolicy)
+    {
+        std::lock_guard<std::mutex> guard(m_appenderLock);
+        if (m_asyncLogDispatcherStorage)
+            return;
+        m_asyncLogDispatcherStorage.reset(new AsyncLogDispatcher(queueCapacity, overflowPolicy, [this](const LogMessage& msg) { logToAppenders(msg); }));
+        m_asyncLogDispatcher.store(m_asyncLogDispatcherStorage.get(), std::memory_order_release);
+    }
+
+    bool RamsesLogger::isAsyncLoggingEnabled() const
+    {
+        return m_asyncLogDispatcher.load() != nullptr;
+    }
+
+    UInt64 RamsesLogger::getNumberOfDroppedLogMessages() const
+    {
+        const AsyncLogDispatcher* asyncLogDispatcher = m_asyncLogDispatcher.load();
+        return asyncLogDispatcher ? asyncLogDispatcher->getNumberOfDroppedMessages() : 0u;
+    }
+
     const char* RamsesLogger::GetLogLevelText(ELogLevel logLevel)
     {
         switch (logLevel)
@@ -51,8 +51,11 @@ namespace ramses_internal
         statResourcesSentNumber.reset();
         statResourcesSentSize.reset();
         statResourcesReceivedNumber.reset();
+        statResourcesResumedNumber.reset();
         statResourcesLoadedFromFileNumber.reset();
         statResourcesLoadedFromFileSize.reset();
+        statSocketWrites.reset();
+        statSocketBytesSent.reset();
     }
 
     void StatisticCollectionFramework::resetSummaries()
@@ -69,8 +72,11 @@ namespace ramses_internal
         statResourcesSentNumber.getSummary().reset();
         statResourcesSentSize.getSummary().reset();
         statResourcesReceivedNumber.getSummary().reset();
+        statResourcesResumedNumber.getSummary().reset();
         statResourcesLoadedFromFileNumber.getSummary().reset();
         statResourcesLoadedFromFileSize.getSummary().reset();
+        statSocketWrites.getSummary().reset();
+        statSocketBytesSent.getSummary().reset();
     }
 
     void StatisticCollectionFramework::nextTimeInterval()
@@ -86,8 +92,11 @@ namespace ramses_internal
         statResourcesSentNumber.updateSummaryAndResetCounter();
         statResourcesSentSize.updateSummaryAndResetCounter();
         statResourcesReceivedNumber.updateSummaryAndResetCounter();
+        statResourcesResumedNumber.updateSummaryAndResetCounter();
         statResourcesLoadedFromFileNumber.updateSummaryAndResetCounter();
         statResourcesLoadedFromFileSize.updateSummaryAndResetCounter();
+        statSocketWrites.updateSummaryAndResetCounter();
+        statSocketBytesSent.updateSummaryAndResetCounter();
 
         statResourcesNumber.incCounter(resourcesCreated);
         statResourcesNumber.decCounter(resourcesDestroyed);
@@ -0,0 +1,222 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2020 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "Utils/TraceRecorder.h"
+#include "Utils/File.h"
+#include "Collections/StringOutputStream.h"
+
+#ifdef _WIN32
+#include "PlatformAbstraction/MinimalWindowsH.h"
+#else
+#include <unistd.h>
+#endif
+
+namespace ramses_internal
+{
+    namespace
+    {
+        std::atomic<UInt64> nextRecorderId{ 0u };
+
+        UInt32 GetProcessId()
+        {
+#ifdef _WIN32
+            return static_cast<UInt32>(GetCurrentProcessId());
+#else
+            return static_cast<UInt32>(getpid());
+#endif
+        }
+    }
+
+    constexpr UInt64 TraceRecorder::NoValue;
+
+    TraceRecorder::TraceRecorder()
+        : m_recorderId(nextRecorderId++)
+        , m_maxEventsPerThread(1024u * 1024u)
+    {
+    }
+
+    void TraceRecorder::startRecording()
+    {
+        m_recording = true;
+    }
+
+    void TraceRecorder::stopRecording()
+    {
+        m_recording = false;
+    }
+
+    void TraceRecorder::addCompleteEvent(const char* category, const char* name, UInt64 startTimeUs, UInt64 durationUs, UInt64 sceneId, UInt64 flushIndex)
+    {
+        if (isRecording())
+            addEvent({ category, name, 'X', startTimeUs, durationUs, sceneId, flushIndex, NoValue });
+    }
+
+    void TraceRecorder::addInstantEvent(const char* category, const char* name, UInt64 sceneId, UInt64 flushIndex)
+    {
+        if (isRecording())
+            addEvent({ category, name, 'i', PlatformTime::GetMicrosecondsMonotonic(), 0u, sceneId, flushIndex, NoValue });
+    }
+
+    void TraceRecorder::addFlowStartEvent(const char* category, const char* name, UInt64 flowId)
+    {
+        if (isRecording())
+            addEvent({ category, name, 's', PlatformTime::GetMicrosecondsMonotonic(), 0u, NoValue, NoValue, flowId });
+    }
+
+    void TraceRecorder::addFlowEndEvent(const char* category, const char* name, UInt64 flowId)
+    {
+        if (isRecording())
+            addEvent({ category, name, 'f', PlatformTime::GetMicrosecondsMonotonic(), 0u, NoValue, NoValue, flowId });
+    }
+
+    void TraceRecorder::addEvent(const Event& event)
+    {
+        ThreadBuffer& buffer = getThreadBuffer();
+        // only contended while events are exported or cleared
+        std::lock_guard<std::mutex> guard(buffer.lock);
+        if (buffer.events.size() < m_maxEventsPerThread)
+            buffer.events.push_back(event);
+        else
+            ++m_droppedEvents;
+    }
+
+    TraceRecorder::ThreadBuffer& TraceRecorder::getThreadBuffer()
+    {
+        struct ThreadLocalBuffer
+        {
+            UInt64 recorderId = NoValue;
+            std::shared_ptr<ThreadBuffer> buffer;
+        };
+        // buffer is shared with the recorder so that events of finished threads are kept
+        thread_local ThreadLocalBuffer threadLocalBuffer;
+
+        if (threadLocalBuffer.recorderId != m_recorderId)
+        {
+            auto buffer = std::make_shared<ThreadBuffer>();
+            std::lock_guard<std::mutex> guard(m_buffersLock);
+            buffer->threadIndex = static_cast<UInt32>(m_threadBuffers.size());
+            m_threadBuffers.push_back(buffer);
+            threadLocalBuffer.recorderId = m_recorderId;
+            threadLocalBuffer.buffer = std::move(buffer);
+        }
+
+        return *threadLocalBuffer.buffer;
+    }
+
+    UInt64 TraceRecorder::getNumberOfEvents() const
+    {
+        std::lock_guard<std::mutex> guard(m_buffersLock);
+        UInt64 numEvents = 0u;
+        for (const auto& buffer : m_threadBuffers)
+        {
+            std::lock_guard<std::mutex> bufferGuard(buffer->lock);
+            numEvents += buffer->events.size();
+        }
+        return numEvents;
+    }
+
+    UInt64 TraceRecorder::getNumberOfDroppedEvents() const
+    {
+        return m_droppedEvents;
+    }
+
+    void TraceRecorder::setMaximumNumberOfEventsPerThread(UInt64 maxEvents)
+    {
+        m_maxEventsPerThread = maxEvents;
+    }
+
+    void TraceRecorder::clear()
+    {
+        std::lock_guard<std::mutex> guard(m_buffersLock);
+        for (const auto& buffer : m_threadBuffers)
+        {
+            std::lock_guard<std::mutex> bufferGuard(buffer->lock);
+            buffer->events.clear();
+            buffer->events.shrink_to_fit();
+        }
+        m_droppedEvents = 0u;
+    }
+
+    String TraceRecorder::toJson() const
+    {
+        const UInt32 processId = GetProcessId();
+
+        StringOutputStream json(64u * 1024u);
+        json << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+        bool firstEvent = true;
+        {
+            std::lock_guard<std::mutex> guard(m_buffersLock);
+            for (const auto& buffer : m_threadBuffers)
+            {
+                std::lock_guard<std::mutex> bufferGuard(buffer->lock);
+                for (const auto& event : buffer->events)
+                {
+                    if (!firstEvent)
+                        json << ",";
+                    firstEvent = false;
+                    AppendEvent(json, event, processId, buffer->threadIndex);
+                }
+            }
+        }
+        json << "]}";
+
+        return json.release();
+    }
+
+    void TraceRecorder::AppendEvent(StringOutputStream& json, const Event& event, UInt32 processId, UInt32 threadIndex)
+    {
+        json << "\n{\"cat\":\"" << event.category << "\",\"name\":\"" << event.name << "\",\"ph\":\"" << event.phase
+            << "\",\"ts\":" << event.timestampUs << ",\"pid\":" << processId << ",\"tid\":" << threadIndex;
+
+        switch (event.phase)
+        {
+        case 'X':
+            json << ",\"dur\":" << event.durationUs;
+            break;
+        case 'i':
+            json << ",\"s\":\"t\"";
+            break;
+        case 's':
+            json << ",\"id\":" << event.flowId;
+            break;
+        case 'f':
+            // bind to enclosing slice instead of the next one starting
+            json << ",\"id\":" << event.flowId << ",\"bp\":\"e\"";
+            break;
+        default:
+            break;
+        }
+
+        if (event.sceneId != NoValue || event.flushIndex != NoValue)
+        {
+            json << ",\"args\":{";
+            if (event.sceneId != NoValue)
+                json << "\"sceneId\":" << event.sceneId;
+            if (event.flushIndex != NoValue)
+                json << (event.sceneId != NoValue ? "," : "") << "\"flushIndex\":" << event.flushIndex;
+            json << "}";
+        }
+        json << "}";
+    }
+
+    bool TraceRecorder::writeToFile(const String& filePath) const
+    {
+        const String json = toJson();
+        File file(filePath);
+        if (!file.open(File::Mode::WriteOverWriteOld))
+            return false;
+        const bool success = file.write(json.c_str(), json.size());
+        return file.close() && success;
+    }
+
+    UInt64 TraceRecorder::GetFlushFlowId(UInt64 sceneId, UInt64 flushIndex)
+    {
+        // scene ids and flush indices stay well below 2^32 in practice, the id only needs to be unique within a trace
+        return (sceneId << 32u) ^ flushIndex;
+    }
+}
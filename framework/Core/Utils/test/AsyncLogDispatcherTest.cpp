@@ -0,0 +1,177 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2020 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "Utils/AsyncLogDispatcher.h"
+#include "Utils/LogMessage.h"
+#include "Utils/LogContext.h"
+#include "PlatformAbstraction/PlatformTime.h"
+#include <gtest/gtest.h>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+namespace ramses_internal
+{
+    class AnAsyncLogDispatcher : public ::testing::Test
+    {
+    protected:
+        struct DispatchedMessage
+        {
+            const LogContext* context;
+            ELogLevel logLevel;
+            std::string text;
+            UInt64 timestampMilliseconds;
+        };
+
+        AsyncLogDispatcher::DispatchFunction getDispatchFunction()
+        {
+            return [this](const LogMessage& msg) {
+                std::unique_lock<std::mutex> guard(lock);
+                blockedCondition.wait(guard, [this]() { return !blockDispatch; });
+                dispatched.push_back({ &msg.getContext(), msg.getLogLevel(), msg.getStream().c_str(), msg.getTimestampMilliseconds() });
+            };
+        }
+
+        bool push(AsyncLogDispatcher& dispatcher, const std::string& text, ELogLevel logLevel = ELogLevel::Info)
+        {
+            return dispatcher.push(LogMessage(context, logLevel, StringOutputStream(text)));
+        }
+
+        void setBlockDispatch(bool block)
+        {
+            {
+                std::lock_guard<std::mutex> guard(lock);
+                blockDispatch = block;
+            }
+            blockedCondition.notify_all();
+        }
+
+        std::vector<DispatchedMessage> getDispatched()
+        {
+            std::lock_guard<std::mutex> guard(lock);
+            return dispatched;
+        }
+
+        LogContext context{ "Test Context", "TEST" };
+        std::mutex lock;
+        std::condition_variable blockedCondition;
+        bool blockDispatch = false;
+        std::vector<DispatchedMessage> dispatched;
+    };
+
+    TEST_F(AnAsyncLogDispatcher, roundsCapacityUpToPowerOfTwo)
+    {
+        AsyncLogDispatcher dispatcher(100u, ELogOverflowPolicy::DropMessage, getDispatchFunction());
+        EXPECT_EQ(128u, dispatcher.getCapacity());
+        EXPECT_EQ(ELogOverflowPolicy::DropMessage, dispatcher.getOverflowPolicy());
+    }
+
+    TEST_F(AnAsyncLogDispatcher, dispatchesMessagesInOrderWithContextAndLogLevel)
+    {
+        AsyncLogDispatcher dispatcher(8u, ELogOverflowPolicy::WaitForSpace, getDispatchFunction());
+        for (int i = 0; i < 100; ++i)
+            EXPECT_TRUE(push(dispatcher, std::to_string(i), (i % 2 == 0) ? ELogLevel::Info : ELogLevel::Warn));
+        dispatcher.flush();
+
+        const auto messages = getDispatched();
+        ASSERT_EQ(100u, messages.size());
+        for (int i = 0; i < 100; ++i)
+        {
+            EXPECT_EQ(std::to_string(i), messages[i].text);
+            EXPECT_EQ(&context, messages[i].context);
+            EXPECT_EQ((i % 2 == 0) ? ELogLevel::Info : ELogLevel::Warn, messages[i].logLevel);
+        }
+        EXPECT_EQ(0u, dispatcher.getNumberOfDroppedMessages());
+    }
+
+    TEST_F(AnAsyncLogDispatcher, dropsMessagesWhenQueueIsFullAndReportsThemLater)
+    {
+        UInt64 numDropped = 0u;
+        {
+            AsyncLogDispatcher dispatcher(4u, ELogOverflowPolicy::DropMessage, getDispatchFunction());
+            setBlockDispatch(true);
+
+            // queue is full when dispatch thread blocks in first message, whether it took it already or not
+            for (int i = 0; i < 10; ++i)
+            {
+                if (!push(dispatcher, std::to_string(i)))
+                    ++numDropped;
+            }
+            EXPECT_EQ(6u, numDropped);
+            EXPECT_EQ(numDropped, dispatcher.getNumberOfDroppedMessages());
+            setBlockDispatch(false);
+        }
+
+        const auto messages = getDispatched();
+        ASSERT_EQ(5u, messages.size());
+        for (UInt64 i = 0u; i < 4u; ++i)
+            EXPECT_EQ(std::to_string(i), messages[i].text);
+
+        const auto& report = messages.back();
+        EXPECT_EQ(ELogLevel::Warn, report.logLevel);
+        EXPECT_NE(std::string::npos, report.text.find("dropped 6 log messages"));
+    }
+
+    TEST_F(AnAsyncLogDispatcher, waitsForSpaceAndKeepsOrderPerThreadWhenLoggingFromSeveralThreads)
+    {
+        AsyncLogDispatcher dispatcher(16u, ELogOverflowPolicy::WaitForSpace, getDispatchFunction());
+
+        constexpr int NumThreads = 4;
+        constexpr int NumMessagesPerThread = 500;
+        std::vector<std::thread> threads;
+        for (int t = 0; t < NumThreads; ++t)
+        {
+            threads.emplace_back([&, t]() {
+                for (int i = 0; i < NumMessagesPerThread; ++i)
+                    EXPECT_TRUE(push(dispatcher, std::to_string(t) + ":" + std::to_string(i)));
+            });
+        }
+        for (auto& thread : threads)
+            thread.join();
+        dispatcher.flush();
+
+        const auto messages = getDispatched();
+        ASSERT_EQ(static_cast<size_t>(NumThreads * NumMessagesPerThread), messages.size());
+        std::vector<int> nextExpected(NumThreads, 0);
+        for (const auto& message : messages)
+        {
+            const auto separator = message.text.find(':');
+            const int thread = std::stoi(message.text.substr(0, separator));
+            EXPECT_EQ(nextExpected[thread], std::stoi(message.text.substr(separator + 1)));
+            ++nextExpected[thread];
+        }
+        EXPECT_EQ(0u, dispatcher.getNumberOfDroppedMessages());
+    }
+
+    TEST_F(AnAsyncLogDispatcher, keepsTimeMessageWasLoggedAt)
+    {
+        AsyncLogDispatcher dispatcher(8u, ELogOverflowPolicy::DropMessage, getDispatchFunction());
+        setBlockDispatch(true);
+        const UInt64 timeBeforePush = PlatformTime::GetMillisecondsAbsolute();
+        EXPECT_TRUE(push(dispatcher, "msg"));
+        const UInt64 timeAfterPush = PlatformTime::GetMillisecondsAbsolute();
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        setBlockDispatch(false);
+        dispatcher.flush();
+
+        const auto messages = getDispatched();
+        ASSERT_EQ(1u, messages.size());
+        EXPECT_GE(messages[0].timestampMilliseconds, timeBeforePush);
+        EXPECT_LE(messages[0].timestampMilliseconds, timeAfterPush);
+    }
+
+    TEST_F(AnAsyncLogDispatcher, dispatchesPendingMessagesOnDestruction)
+    {
+        {
+            AsyncLogDispatcher dispatcher(64u, ELogOverflowPolicy::DropMessage, getDispatchFunction());
+            for (int i = 0; i < 50; ++i)
+                EXPECT_TRUE(push(dispatcher, std::to_string(i)));
+        }
+        EXPECT_EQ(50u, getDispatched().size());
+    }
+}
@@ -319,6 +319,38 @@ namespace ramses_internal
         EXPECT_FALSE(file.exists());
     }
 
+    TEST_F(AFile, RenameReplacesExistingFile)
+    {
+        addForCleanup({"renamesource.txt", "renametarget.txt"});
+
+        {
+            File target("renametarget.txt");
+            ASSERT_TRUE(target.open(File::Mode::WriteOverWriteOld));
+            ASSERT_TRUE(target.write("old content", 11u));
+        }
+        {
+            File source("renamesource.txt");
+            ASSERT_TRUE(source.open(File::Mode::WriteOverWriteOld));
+            ASSERT_TRUE(source.write("new", 3u));
+        }
+
+        File file("renamesource.txt");
+        EXPECT_TRUE(file.renameTo("renametarget.txt"));
+        EXPECT_EQ(String("renametarget.txt"), file.getPath());
+        EXPECT_FALSE(File("renamesource.txt").exists());
+
+        size_t byteSize = 0u;
+        EXPECT_TRUE(File("renametarget.txt").getSizeInBytes(byteSize));
+        EXPECT_EQ(3u, byteSize);
+    }
+
+    TEST_F(AFile, RenameFailsForNonExistingFile)
+    {
+        File file("doesnotexist.txt");
+        EXPECT_FALSE(file.renameTo("doesnotexisteither.txt"));
+        EXPECT_EQ(String("doesnotexist.txt"), file.getPath());
+    }
+
     TEST_F(AFile, TestExists)
     {
         File file(".");
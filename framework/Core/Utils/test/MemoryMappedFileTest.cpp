@@ -0,0 +1,100 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2020 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "Utils/MemoryMappedFile.h"
+#include "Utils/File.h"
+#include <gtest/gtest.h>
+
+namespace ramses_internal
+{
+    class AMemoryMappedFile : public ::testing::Test
+    {
+    public:
+        void writeFile(const std::vector<Byte>& content)
+        {
+            File file(m_filePath);
+            ASSERT_TRUE(file.open(File::Mode::WriteOverWriteOldBinary));
+            if (!content.empty())
+            {
+                ASSERT_TRUE(file.write(content.data(), content.size()));
+            }
+            file.close();
+        }
+
+        virtual void TearDown() override
+        {
+            File(m_filePath).remove();
+        }
+
+    protected:
+        const String m_filePath{ "memoryMappedFileTest.bin" };
+        const std::vector<Byte> m_content{ 1u, 2u, 3u, 4u, 5u, 250u };
+    };
+
+    TEST_F(AMemoryMappedFile, isNotMappedInitially)
+    {
+        MemoryMappedFile mappedFile(m_filePath);
+        EXPECT_FALSE(mappedFile.isMapped());
+        EXPECT_EQ(nullptr, mappedFile.getData());
+        EXPECT_EQ(0u, mappedFile.getSize());
+        EXPECT_EQ(m_filePath, mappedFile.getPath());
+    }
+
+    TEST_F(AMemoryMappedFile, mapsWholeFileContent)
+    {
+        writeFile(m_content);
+
+        MemoryMappedFile mappedFile(m_filePath);
+        ASSERT_TRUE(mappedFile.map());
+        EXPECT_TRUE(mappedFile.isMapped());
+        ASSERT_EQ(m_content.size(), mappedFile.getSize());
+        EXPECT_EQ(m_content, std::vector<Byte>(mappedFile.getData(), mappedFile.getData() + mappedFile.getSize()));
+
+        mappedFile.unmap();
+        EXPECT_FALSE(mappedFile.isMapped());
+        EXPECT_EQ(0u, mappedFile.getSize());
+    }
+
+    TEST_F(AMemoryMappedFile, failsToMapNonExistingFile)
+    {
+        MemoryMappedFile mappedFile("doesNotExist.bin");
+        EXPECT_FALSE(mappedFile.map());
+        EXPECT_FALSE(mappedFile.isMapped());
+    }
+
+    TEST_F(AMemoryMappedFile, failsToMapEmptyFile)
+    {
+        writeFile({});
+
+        MemoryMappedFile mappedFile(m_filePath);
+        EXPECT_FALSE(mappedFile.map());
+        EXPECT_FALSE(mappedFile.isMapped());
+    }
+
+    TEST_F(AMemoryMappedFile, keepsOriginalContentWhenFileIsReplaced)
+    {
+        if (!MemoryMappedFile::CanBeReplacedWhileMapped)
+            GTEST_SKIP();
+
+        writeFile(m_content);
+        MemoryMappedFile mappedFile(m_filePath);
+        ASSERT_TRUE(mappedFile.map());
+
+        const String otherFilePath("memoryMappedFileTest.tmp");
+        {
+            File otherFile(otherFilePath);
+            ASSERT_TRUE(otherFile.open(File::Mode::WriteOverWriteOldBinary));
+            const Byte otherContent[] = { 9u, 9u };
+            ASSERT_TRUE(otherFile.write(otherContent, sizeof(otherContent)));
+        }
+        ASSERT_TRUE(File(otherFilePath).renameTo(m_filePath));
+
+        ASSERT_EQ(m_content.size(), mappedFile.getSize());
+        EXPECT_EQ(m_content, std::vector<Byte>(mappedFile.getData(), mappedFile.getData() + mappedFile.getSize()));
+    }
+}
@@ -0,0 +1,170 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2020 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "Utils/TraceRecorder.h"
+#include "Utils/File.h"
+#include <gtest/gtest.h>
+#include <thread>
+
+namespace ramses_internal
+{
+    class ATraceRecorder : public ::testing::Test
+    {
+    protected:
+        static bool Contains(const String& json, const char* text)
+        {
+            return json.find(text) >= 0;
+        }
+
+        TraceRecorder recorder;
+    };
+
+    TEST_F(ATraceRecorder, isNotRecordingInitially)
+    {
+        EXPECT_FALSE(recorder.isRecording());
+        recorder.addCompleteEvent("cat", "name", 1u, 2u);
+        recorder.addInstantEvent("cat", "name");
+        EXPECT_EQ(0u, recorder.getNumberOfEvents());
+    }
+
+    TEST_F(ATraceRecorder, recordsEventsOnlyWhileRecording)
+    {
+        recorder.startRecording();
+        EXPECT_TRUE(recorder.isRecording());
+        recorder.addCompleteEvent("cat", "name", 1u, 2u);
+        recorder.addInstantEvent("cat", "name");
+        recorder.stopRecording();
+        EXPECT_FALSE(recorder.isRecording());
+        recorder.addCompleteEvent("cat", "name", 3u, 4u);
+
+        EXPECT_EQ(2u, recorder.getNumberOfEvents());
+    }
+
+    TEST_F(ATraceRecorder, exportsEmptyTraceWithoutEvents)
+    {
+        EXPECT_EQ(String("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[]}"), recorder.toJson());
+    }
+
+    TEST_F(ATraceRecorder, exportsCompleteEventWithSceneIdAndFlushIndex)
+    {
+        recorder.startRecording();
+        recorder.addCompleteEvent("client", "flush", 100u, 25u, 12u, 7u);
+
+        const String json = recorder.toJson();
+        EXPECT_TRUE(Contains(json, "\"cat\":\"client\",\"name\":\"flush\",\"ph\":\"X\",\"ts\":100,"));
+        EXPECT_TRUE(Contains(json, "\"dur\":25,\"args\":{\"sceneId\":12,\"flushIndex\":7}}"));
+    }
+
+    TEST_F(ATraceRecorder, exportsEventWithoutArgsIfNoneGiven)
+    {
+        recorder.startRecording();
+        recorder.addCompleteEvent("renderer", "render", 100u, 25u);
+
+        const String json = recorder.toJson();
+        EXPECT_TRUE(Contains(json, "\"dur\":25}"));
+        EXPECT_FALSE(Contains(json, "args"));
+    }
+
+    TEST_F(ATraceRecorder, exportsFlowEventsWithId)
+    {
+        recorder.startRecording();
+        const UInt64 flowId = TraceRecorder::GetFlushFlowId(3u, 4u);
+        recorder.addFlowStartEvent("flush", "sceneUpdate", flowId);
+        recorder.addFlowEndEvent("flush", "sceneUpdate", flowId);
+
+        const String json = recorder.toJson();
+        const String idText = String("\"id\":") + std::to_string(flowId);
+        EXPECT_TRUE(Contains(json, "\"ph\":\"s\""));
+        EXPECT_TRUE(Contains(json, "\"ph\":\"f\""));
+        EXPECT_TRUE(Contains(json, "\"bp\":\"e\""));
+        EXPECT_TRUE(Contains(json, idText.c_str()));
+    }
+
+    TEST_F(ATraceRecorder, flowIdsDifferForDifferentScenesAndFlushes)
+    {
+        EXPECT_NE(TraceRecorder::GetFlushFlowId(1u, 1u), TraceRecorder::GetFlushFlowId(1u, 2u));
+        EXPECT_NE(TraceRecorder::GetFlushFlowId(1u, 1u), TraceRecorder::GetFlushFlowId(2u, 1u));
+        EXPECT_EQ(TraceRecorder::GetFlushFlowId(5u, 6u), TraceRecorder::GetFlushFlowId(5u, 6u));
+    }
+
+    TEST_F(ATraceRecorder, keepsEventsOfOtherThreadsInSeparateTimelines)
+    {
+        recorder.startRecording();
+        recorder.addInstantEvent("cat", "mainThread");
+        std::thread thread([&]() { recorder.addInstantEvent("cat", "otherThread"); });
+        thread.join();
+
+        EXPECT_EQ(2u, recorder.getNumberOfEvents());
+        const String json = recorder.toJson();
+        EXPECT_TRUE(Contains(json, "\"tid\":0"));
+        EXPECT_TRUE(Contains(json, "\"tid\":1"));
+    }
+
+    TEST_F(ATraceRecorder, dropsEventsOverLimit)
+    {
+        recorder.setMaximumNumberOfEventsPerThread(2u);
+        recorder.startRecording();
+        for (int i = 0; i < 5; ++i)
+            recorder.addInstantEvent("cat", "name");
+
+        EXPECT_EQ(2u, recorder.getNumberOfEvents());
+        EXPECT_EQ(3u, recorder.getNumberOfDroppedEvents());
+    }
+
+    TEST_F(ATraceRecorder, canBeCleared)
+    {
+        recorder.setMaximumNumberOfEventsPerThread(1u);
+        recorder.startRecording();
+        recorder.addInstantEvent("cat", "name");
+        recorder.addInstantEvent("cat", "name");
+        recorder.clear();
+
+        EXPECT_EQ(0u, recorder.getNumberOfEvents());
+        EXPECT_EQ(0u, recorder.getNumberOfDroppedEvents());
+        EXPECT_TRUE(recorder.isRecording());
+        recorder.addInstantEvent("cat", "name");
+        EXPECT_EQ(1u, recorder.getNumberOfEvents());
+    }
+
+    TEST_F(ATraceRecorder, writesTraceToFile)
+    {
+        const String filePath("traceRecorderTest.json");
+        recorder.startRecording();
+        recorder.addCompleteEvent("cat", "name", 1u, 2u);
+        ASSERT_TRUE(recorder.writeToFile(filePath));
+
+        File file(filePath);
+        size_t fileSize = 0u;
+        EXPECT_TRUE(file.getSizeInBytes(fileSize));
+        EXPECT_EQ(recorder.toJson().size(), fileSize);
+        file.remove();
+    }
+
+    TEST(ATraceScope, recordsCompleteEventIntoGlobalRecorderOnlyWhenRecording)
+    {
+        TraceRecorder& recorder = GetTraceRecorder();
+        recorder.clear();
+        {
+            TraceScope scope("cat", "notRecorded");
+        }
+        EXPECT_EQ(0u, recorder.getNumberOfEvents());
+
+        recorder.startRecording();
+        {
+            TraceScope scope("cat", "recorded", 5u);
+            scope.setFlushIndex(9u);
+        }
+        recorder.stopRecording();
+
+        EXPECT_EQ(1u, recorder.getNumberOfEvents());
+        const String json = recorder.toJson();
+        EXPECT_GE(json.find("\"name\":\"recorded\""), 0);
+        EXPECT_GE(json.find("\"args\":{\"sceneId\":5,\"flushIndex\":9}"), 0);
+        recorder.clear();
+    }
+}
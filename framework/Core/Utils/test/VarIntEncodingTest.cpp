@@ -0,0 +1,61 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2020 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "gtest/gtest.h"
+#include "Utils/VarIntEncoding.h"
+#include <limits>
+
+namespace ramses_internal
+{
+    TEST(VarIntEncodingTest, encodesAndDecodesValues)
+    {
+        for (const UInt64 in : { UInt64(0u), UInt64(1u), UInt64(127u), UInt64(128u), UInt64(300u), UInt64(0xffffffffu), std::numeric_limits<UInt64>::max() })
+        {
+            Byte buffer[VarIntEncoding::MaxEncodedSize];
+            const UInt size = VarIntEncoding::Encode(in, buffer);
+            const Byte* position = buffer;
+            UInt64 out = 0u;
+            EXPECT_TRUE(VarIntEncoding::Decode(position, buffer + size, out));
+            EXPECT_EQ(in, out);
+            EXPECT_EQ(buffer + size, position);
+        }
+    }
+
+    TEST(VarIntEncodingTest, usesOneByteForSmallValues)
+    {
+        Byte buffer[VarIntEncoding::MaxEncodedSize];
+        EXPECT_EQ(1u, VarIntEncoding::Encode(127u, buffer));
+        EXPECT_EQ(2u, VarIntEncoding::Encode(128u, buffer));
+        EXPECT_EQ(VarIntEncoding::MaxEncodedSize, VarIntEncoding::Encode(std::numeric_limits<UInt64>::max(), buffer));
+    }
+
+    TEST(VarIntEncodingTest, failsDecodeIfValueNotTerminatedBeforeEnd)
+    {
+        Byte buffer[VarIntEncoding::MaxEncodedSize];
+        const UInt size = VarIntEncoding::Encode(300u, buffer);
+        const Byte* position = buffer;
+        UInt64 out = 0u;
+        EXPECT_FALSE(VarIntEncoding::Decode(position, buffer + size - 1u, out));
+        EXPECT_EQ(buffer + size - 1u, position);
+
+        position = buffer;
+        EXPECT_FALSE(VarIntEncoding::Decode(position, buffer, out));
+        EXPECT_EQ(buffer, position);
+    }
+
+    TEST(VarIntEncodingTest, failsDecodeIfValueIsTooLong)
+    {
+        Byte buffer[VarIntEncoding::MaxEncodedSize + 1u];
+        for (auto& byte : buffer)
+            byte = 0x80u;
+        buffer[VarIntEncoding::MaxEncodedSize] = 0u;
+        const Byte* position = buffer;
+        UInt64 out = 0u;
+        EXPECT_FALSE(VarIntEncoding::Decode(position, buffer + sizeof(buffer), out));
+    }
+}
@@ -15,6 +15,7 @@
 #include "Collections/String.h"
 #include "Ramsh/RamshCommandPrintBuildConfig.h"
 #include "Ramsh/RamshCommandPrintRamsesVersion.h"
+#include "Ramsh/RamshCommandTrace.h"
 #include "Ramsh/RamshCommandSetConsoleLogLevel.h"
 #include "Ramsh/RamshCommandSetContextLogLevel.h"
 #include "Ramsh/RamshCommandSetContextLogLevelFilter.h"
@@ -46,6 +47,7 @@ namespace ramses_internal
         RamshCommandPrintHelp* m_pCmdPrintHelp;
         RamshCommandPrintBuildConfig m_cmdPrintBuildConfig;
         RamshCommandPrintRamsesVersion m_cmdPrintRamsesVersion;
+        RamshCommandTrace m_cmdTrace;
         RamshCommandSetConsoleLogLevel* m_pCmdSetLogLevel;
         RamshCommandSetContextLogLevel* m_pCmdSetContextLogLevel;
         RamshCommandSetContextLogLevelFilter* m_pCmdSetContextLogLevelFilter;
@@ -0,0 +1,25 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2020 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#ifndef RAMSES_RAMSHCOMMANDTRACE_H
+#define RAMSES_RAMSHCOMMANDTRACE_H
+
+#include "Ramsh/RamshCommand.h"
+
+namespace ramses_internal
+{
+    class RamshCommandTrace : public RamshCommand
+    {
+    public:
+        RamshCommandTrace();
+        virtual bool executeInput(const RamshInput& input) override;
+    };
+
+}// namespace ramses_internal
+
+#endif
@@ -15,9 +15,11 @@ namespace ramses_internal
     Ramsh::Ramsh()
         : m_cmdPrintBuildConfig()
         , m_cmdPrintRamsesVersion()
+        , m_cmdTrace()
     {
         add(m_cmdPrintBuildConfig);
         add(m_cmdPrintRamsesVersion);
+        add(m_cmdTrace);
 
         m_pCmdPrintHelp = new RamshCommandPrintHelp(*this);
         add(*m_pCmdPrintHelp);
@@ -0,0 +1,54 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2020 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "Ramsh/RamshCommandTrace.h"
+#include "Ramsh/RamshInput.h"
+#include "Utils/TraceRecorder.h"
+#include "Utils/LogMacros.h"
+
+namespace ramses_internal
+{
+    RamshCommandTrace::RamshCommandTrace()
+    {
+        registerKeyword("trace");
+        description = "Record timeline of flushes, scene updates and rendering as trace event JSON. Usage: trace {start | stop | clear | write <file>}";
+    }
+
+    bool RamshCommandTrace::executeInput(const RamshInput& input)
+    {
+        TraceRecorder& recorder = GetTraceRecorder();
+        if (input.size() == 2u && input[1] == "start")
+        {
+            recorder.startRecording();
+            LOG_INFO(CONTEXT_RAMSH, "RamshCommandTrace: recording started");
+            return true;
+        }
+        if (input.size() == 2u && input[1] == "stop")
+        {
+            recorder.stopRecording();
+            LOG_INFO(CONTEXT_RAMSH, "RamshCommandTrace: recording stopped, " << recorder.getNumberOfEvents() << " events recorded, " << recorder.getNumberOfDroppedEvents() << " dropped");
+            return true;
+        }
+        if (input.size() == 2u && input[1] == "clear")
+        {
+            recorder.clear();
+            return true;
+        }
+        if (input.size() == 3u && input[1] == "write")
+        {
+            if (!recorder.writeToFile(input[2]))
+            {
+                LOG_ERROR(CONTEXT_RAMSH, "RamshCommandTrace: failed to write trace to " << input[2]);
+                return false;
+            }
+            LOG_INFO(CONTEXT_RAMSH, "RamshCommandTrace: written " << recorder.getNumberOfEvents() << " events to " << input[2]);
+            return true;
+        }
+        return false;
+    }
+}
@@ -19,6 +19,7 @@
 #include "PlatformAbstraction/PlatformTypes.h"
 #include "PlatformAbstraction/PlatformMemory.h"
 #include "PlatformAbstraction/Macros.h"
+#include "Utils/VarIntEncoding.h"
 #include <type_traits>
 #include <algorithm>
 #include <iterator>
@@ -26,10 +27,17 @@
 
 namespace ramses_internal
 {
+    enum class ESceneActionEncoding : UInt8
+    {
+        Fixed = 0,  // all values with their in memory size
+        Compact,    // integers (handles, sizes, enums, ids) of 16 bit and more as variable length integers
+    };
+
     class SceneActionCollection
     {
     public:
         SceneActionCollection();
+        explicit SceneActionCollection(ESceneActionEncoding encoding);
         SceneActionCollection(UInt initialDataCapacity, UInt initialNumberOfSceneActionsInformationCapacity);
 
         SceneActionCollection(const SceneActionCollection&) = delete;
@@ -44,6 +52,11 @@ namespace ramses_internal
         bool empty() const;
         void reserveAdditionalCapacity(UInt additionalDataCapacity, UInt additionalSceneActionsInformationCapacity);
 
+        // encoding can only be changed while collection is empty, all writes and reads use it
+        void setEncoding(ESceneActionEncoding encoding);
+        ESceneActionEncoding getEncoding() const;
+
+        // appending to an empty collection takes over encoding of other, otherwise encodings must match
         void append(const SceneActionCollection& other);
 
         bool operator==(const SceneActionCollection& rhs) const;
@@ -140,6 +153,12 @@ namespace ramses_internal
             template<typename T, typename = typename std::enable_if<std::is_trivial<T>::value>::type>
             void readFromByteBlob(T& value);
             void readFromByteBlob(void* data, size_t size);
+            template<typename T>
+            void readValue(T& value);
+            template<typename T>
+            void readValue(T& value, std::true_type isVarIntEncodable);
+            template<typename T>
+            void readValue(T& value, std::false_type isVarIntEncodable);
 
             UInt32 offsetForIndex(UInt idx) const;
 
@@ -183,13 +202,25 @@ namespace ramses_internal
             bool operator==(const ActionInfo&) const;
         };
 
+        template <typename T>
+        struct IsVarIntEncodable : std::integral_constant<bool, std::is_integral<T>::value && !std::is_same<T, bool>::value && (sizeof(T) > 1)>
+        {
+        };
+
         template<typename T, typename = typename std::enable_if<std::is_trivial<T>::value>::type>
         void writeAsByteBlob(const T& value);
         void writeAsByteBlob(const void* value, size_t size);
+        template<typename T>
+        void writeValue(const T& value);
+        template<typename T>
+        void writeValue(const T& value, std::true_type isVarIntEncodable);
+        template<typename T>
+        void writeValue(const T& value, std::false_type isVarIntEncodable);
         void reserveAdditionalDataCapacity(UInt additionalCapacity);
 
         std::vector<Byte> m_data;
         std::vector<ActionInfo> m_actionInfo;
+        ESceneActionEncoding m_encoding = ESceneActionEncoding::Fixed;
     };
 
     static_assert(std::is_nothrow_move_constructible<SceneActionCollection>::value, "SceneActionCollection must be movable");
@@ -199,6 +230,11 @@ namespace ramses_internal
     {
     }
 
+    inline SceneActionCollection::SceneActionCollection(ESceneActionEncoding encoding)
+        : m_encoding(encoding)
+    {
+    }
+
     inline SceneActionCollection::SceneActionCollection(UInt initialCapacity, UInt initialNumberOfSceneActionsInformationCapacity)
     {
         m_data.reserve(initialCapacity);
@@ -210,6 +246,7 @@ namespace ramses_internal
         SceneActionCollection ret;
         ret.m_data = m_data;
         ret.m_actionInfo = m_actionInfo;
+        ret.m_encoding = m_encoding;
         return ret;
     }
 
@@ -235,8 +272,23 @@ namespace ramses_internal
         m_actionInfo.reserve(m_actionInfo.size() + additionalSceneActionsInformationCapacity);
     }
 
+    inline void SceneActionCollection::setEncoding(ESceneActionEncoding encoding)
+    {
+        assert(m_data.empty() && m_actionInfo.empty());
+        m_encoding = encoding;
+    }
+
+    inline ESceneActionEncoding SceneActionCollection::getEncoding() const
+    {
+        return m_encoding;
+    }
+
     inline void SceneActionCollection::append(const SceneActionCollection& other)
     {
+        if (m_data.empty() && m_actionInfo.empty())
+            m_encoding = other.m_encoding;
+        assert(m_encoding == other.m_encoding);
+
         const bool hasIncomplete = !m_actionInfo.empty() &&
             !other.m_actionInfo.empty() &&
             m_actionInfo.back().type == ESceneActionId::Incomplete;
@@ -271,12 +323,12 @@ namespace ramses_internal
 
     inline bool SceneActionCollection::operator==(const SceneActionCollection& rhs) const
     {
-        return m_data == rhs.m_data && m_actionInfo == rhs.m_actionInfo;
+        return m_data == rhs.m_data && m_actionInfo == rhs.m_actionInfo && m_encoding == rhs.m_encoding;
     }
 
     inline bool SceneActionCollection::operator!=(const SceneActionCollection& rhs) const
     {
-        return m_data != rhs.m_data || m_actionInfo != rhs.m_actionInfo;
+        return !operator==(rhs);
     }
 
     inline void SceneActionCollection::swap(SceneActionCollection& second)
@@ -284,6 +336,7 @@ namespace ramses_internal
         using std::swap;
         swap(m_data, second.m_data);
         swap(m_actionInfo, second.m_actionInfo);
+        swap(m_encoding, second.m_encoding);
     }
 
     inline void swap(SceneActionCollection& first, SceneActionCollection& second)
@@ -320,20 +373,20 @@ namespace ramses_internal
     template <typename T>
     void SceneActionCollection::write(TypedMemoryHandle<T> handle)
     {
-        writeAsByteBlob(handle.asMemoryHandle());
+        writeValue(handle.asMemoryHandle());
     }
 
     template <typename T, T D, typename U>
     void SceneActionCollection::write(StronglyTypedValue<T, D, U> value)
     {
-        writeAsByteBlob(value.getValue());
+        writeValue(value.getValue());
     }
 
     template <typename E, typename>
     void SceneActionCollection::write(E enumValue)
     {
         static_assert(!std::is_convertible<E, int>::value, "Use enum class! If need to keep old enum, cast explicitly to integral type.");
-        writeAsByteBlob(enumValue);
+        writeValue(static_cast<typename std::underlying_type<E>::type>(enumValue));
     }
 
     template<typename T, int N, typename>
@@ -347,12 +400,40 @@ namespace ramses_internal
     {
         const UInt32 byteSize = numElements * sizeof(T);
         reserveAdditionalDataCapacity(sizeof(UInt32) + byteSize);
-        writeAsByteBlob(numElements);
+        writeValue(numElements);
         writeAsByteBlob(data, byteSize);
     }
 
     template<typename T, typename>
     void SceneActionCollection::write(const T& value)
+    {
+        writeValue(value);
+    }
+
+    template<typename T>
+    void SceneActionCollection::writeValue(const T& value)
+    {
+        writeValue(value, IsVarIntEncodable<T>());
+    }
+
+    template<typename T>
+    void SceneActionCollection::writeValue(const T& value, std::true_type /*isVarIntEncodable*/)
+    {
+        if (m_encoding == ESceneActionEncoding::Compact)
+        {
+            // negative values keep their two's complement bits and take the maximum size
+            Byte buffer[VarIntEncoding::MaxEncodedSize];
+            const UInt size = VarIntEncoding::Encode(static_cast<typename std::make_unsigned<T>::type>(value), buffer);
+            writeAsByteBlob(buffer, size);
+        }
+        else
+        {
+            writeAsByteBlob(value);
+        }
+    }
+
+    template<typename T>
+    void SceneActionCollection::writeValue(const T& value, std::false_type /*isVarIntEncodable*/)
     {
         writeAsByteBlob(value);
     }
@@ -485,7 +566,7 @@ namespace ramses_internal
     void SceneActionCollection::SceneActionReader::read(T* data, UInt32& numElements)
     {
         // read array size
-        readFromByteBlob(numElements);
+        readValue(numElements);
         const UInt32 byteSize = numElements * sizeof(T);
         PlatformMemory::Copy(data, m_collection->m_data.data() + m_readPosition, byteSize);
         m_readPosition += byteSize;
@@ -494,7 +575,7 @@ namespace ramses_internal
     inline void SceneActionCollection::SceneActionReader::readWithoutCopy(const Byte*& data, UInt32& size)
     {
         // read array size
-        readFromByteBlob(size);
+        readValue(size);
         if (size > 0u)
         {
             data = m_collection->m_data.data() + m_readPosition;
@@ -515,19 +596,21 @@ namespace ramses_internal
     void SceneActionCollection::SceneActionReader::read(E& value)
     {
         static_assert(!std::is_convertible<E, int>::value, "Use enum class! If need to keep old enum, cast explicitly to integral type.");
-        readFromByteBlob(value);
+        typename std::underlying_type<E>::type underlyingValue;
+        readValue(underlyingValue);
+        value = static_cast<E>(underlyingValue);
     }
 
     template <typename T>
     void SceneActionCollection::SceneActionReader::read(TypedMemoryHandle<T>& handle)
     {
-        readFromByteBlob(handle.asMemoryHandleReference());
+        readValue(handle.asMemoryHandleReference());
     }
 
     template <typename T, T D, typename U>
     void SceneActionCollection::SceneActionReader::read(StronglyTypedValue<T, D, U>& value)
     {
-        readFromByteBlob(value.getReference());
+        readValue(value.getReference());
     }
 
     template<typename T, int N, typename>
@@ -538,6 +621,37 @@ namespace ramses_internal
 
     template<typename T, typename std::enable_if<std::is_arithmetic<T>::value && !std::is_enum<T>::value, int>::type>
     void SceneActionCollection::SceneActionReader::read(T& value)
+    {
+        readValue(value);
+    }
+
+    template<typename T>
+    void SceneActionCollection::SceneActionReader::readValue(T& value)
+    {
+        readValue(value, IsVarIntEncodable<T>());
+    }
+
+    template<typename T>
+    void SceneActionCollection::SceneActionReader::readValue(T& value, std::true_type /*isVarIntEncodable*/)
+    {
+        if (m_collection->m_encoding == ESceneActionEncoding::Compact)
+        {
+            const Byte* start = m_collection->m_data.data() + m_readPosition;
+            const Byte* position = start;
+            UInt64 decoded = 0u;
+            const bool valid = VarIntEncoding::Decode(position, m_collection->m_data.data() + m_collection->m_data.size(), decoded);
+            assert(valid);
+            value = valid ? static_cast<T>(static_cast<typename std::make_unsigned<T>::type>(decoded)) : T{};
+            m_readPosition += static_cast<UInt>(position - start);
+        }
+        else
+        {
+            readFromByteBlob(value);
+        }
+    }
+
+    template<typename T>
+    void SceneActionCollection::SceneActionReader::readValue(T& value, std::false_type /*isVarIntEncodable*/)
     {
         readFromByteBlob(value);
     }
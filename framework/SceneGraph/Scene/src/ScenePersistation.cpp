@@ -22,6 +22,7 @@
 namespace ramses_internal
 {
     static const UInt32 gSceneMarker = 0x534d4152;  // {'R', 'A', 'M', 'S'}
+    static const UInt32 gCompactSceneMarker = 0x434d4152;  // {'R', 'A', 'M', 'C'}, scene actions use compact encoding
 
     void ScenePersistation::ReadSceneMetadataFromStream(IInputStream& inStream, SceneCreationInformation& createInfo)
     {
@@ -76,14 +77,14 @@ namespace ramses_internal
 
     void ScenePersistation::WriteSceneToStream(IOutputStream& outStream, const ClientScene& scene)
     {
-        SceneActionCollection collection;
+        SceneActionCollection collection(ESceneActionEncoding::Compact);
         SceneActionCollectionCreator creator(collection);
         creator.preallocateSceneSize(scene.getSceneSizeInformation());
         SceneDescriber::describeScene<ClientScene>(scene, creator);
 
         const std::vector<Byte>& actionData = collection.collectionData();
 
-        outStream << static_cast<UInt32>(gSceneMarker);
+        outStream << static_cast<UInt32>(gCompactSceneMarker);
         outStream << static_cast<UInt32>(collection.numberOfActions());
         outStream << static_cast<UInt32>(actionData.size());
 
@@ -117,7 +118,7 @@ namespace ramses_internal
     {
         UInt32 sceneMarker = 0;
         inStream >> sceneMarker;
-        if (sceneMarker != gSceneMarker)
+        if (sceneMarker != gSceneMarker && sceneMarker != gCompactSceneMarker)
         {
             LOG_ERROR(CONTEXT_FRAMEWORK, "ScenePersistation::ReadSceneFromStream:  could not load scene from file, its not marked as a scene");
             return;
@@ -129,6 +130,7 @@ namespace ramses_internal
         inStream >> sizeOfAllSceneActions;
 
         SceneActionCollection actions(0, numberOfSceneActionsToRead);
+        actions.setEncoding(sceneMarker == gCompactSceneMarker ? ESceneActionEncoding::Compact : ESceneActionEncoding::Fixed);
 
         // read data
         std::vector<Byte>& rawActionData = actions.getRawDataForDirectWriting();
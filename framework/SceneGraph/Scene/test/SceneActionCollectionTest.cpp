@@ -7,6 +7,7 @@
 //  -------------------------------------------------------------------------
 
 #include "Scene/SceneActionCollection.h"
+#include "SceneAPI/Handles.h"
 #include "PlatformAbstraction/PlatformMemory.h"
 #include "gtest/gtest.h"
 
@@ -584,4 +585,109 @@ namespace ramses_internal
         EXPECT_EQ(size_3, reader_3.size());
         EXPECT_EQ(c.collectionData().data() + size_1 + size_2, reader_3.data());
     }
+
+    TEST_F(ASceneActionCollection, usesFixedEncodingByDefault)
+    {
+        SceneActionCollection c;
+        EXPECT_EQ(ESceneActionEncoding::Fixed, c.getEncoding());
+        SceneActionCollection d(ESceneActionEncoding::Compact);
+        EXPECT_EQ(ESceneActionEncoding::Compact, d.getEncoding());
+    }
+
+    TEST_F(ASceneActionCollection, compactEncodingWritesSmallIntegersWithSingleByte)
+    {
+        SceneActionCollection c(ESceneActionEncoding::Compact);
+        c.beginWriteSceneAction(ESceneActionId::TestAction);
+        c.write(UInt32(127u));
+        c.write(NodeHandle(3u));
+        c.write(ESceneActionId::AllocateNode);
+        c.write(UInt64(5u));
+        EXPECT_EQ(4u, c.collectionData().size());
+
+        c.write(UInt32(128u));
+        EXPECT_EQ(6u, c.collectionData().size());
+    }
+
+    TEST_F(ASceneActionCollection, compactEncodingKeepsValuesWhichAreNotVarIntEncoded)
+    {
+        SceneActionCollection c(ESceneActionEncoding::Compact);
+        c.beginWriteSceneAction(ESceneActionId::TestAction);
+        c.write(1.5f);
+        c.write(static_cast<UInt8>(200u));
+        c.write(true);
+        c.write(Guid(0x1234u));
+        EXPECT_EQ(sizeof(Float) + sizeof(UInt8) + sizeof(bool) + sizeof(Guid::value_type), c.collectionData().size());
+    }
+
+    TEST_F(ASceneActionCollection, compactEncodingReadsBackWrittenValues)
+    {
+        const std::vector<Byte> buffer{ 1, 2, 3, 4, 5 };
+        SceneActionCollection c(ESceneActionEncoding::Compact);
+        c.beginWriteSceneAction(ESceneActionId::TestAction);
+        c.write(UInt32(0u));
+        c.write(std::numeric_limits<UInt32>::max());
+        c.write(std::numeric_limits<UInt64>::max());
+        c.write(Int32(-1));
+        c.write(std::numeric_limits<Int64>::min());
+        c.write(UInt16(300u));
+        c.write(NodeHandle(1000000u));
+        c.write(ESceneActionId::AllocateRenderable);
+        c.write(buffer.data(), static_cast<UInt32>(buffer.size()));
+        c.write(2.5f);
+        c.write(String("abc"));
+
+        SceneActionCollection::SceneActionReader reader(c[0]);
+        UInt32 u32 = 1u;
+        reader.read(u32);
+        EXPECT_EQ(0u, u32);
+        reader.read(u32);
+        EXPECT_EQ(std::numeric_limits<UInt32>::max(), u32);
+        UInt64 u64 = 0u;
+        reader.read(u64);
+        EXPECT_EQ(std::numeric_limits<UInt64>::max(), u64);
+        Int32 i32 = 0;
+        reader.read(i32);
+        EXPECT_EQ(-1, i32);
+        Int64 i64 = 0;
+        reader.read(i64);
+        EXPECT_EQ(std::numeric_limits<Int64>::min(), i64);
+        UInt16 u16 = 0u;
+        reader.read(u16);
+        EXPECT_EQ(300u, u16);
+        NodeHandle handle;
+        reader.read(handle);
+        EXPECT_EQ(NodeHandle(1000000u), handle);
+        ESceneActionId actionId = ESceneActionId::TestAction;
+        reader.read(actionId);
+        EXPECT_EQ(ESceneActionId::AllocateRenderable, actionId);
+        const Byte* data = nullptr;
+        UInt32 dataSize = 0u;
+        reader.readWithoutCopy(data, dataSize);
+        ASSERT_EQ(buffer.size(), dataSize);
+        EXPECT_EQ(buffer, std::vector<Byte>(data, data + dataSize));
+        float f = 0.f;
+        reader.read(f);
+        EXPECT_EQ(2.5f, f);
+        String str;
+        reader.read(str);
+        EXPECT_EQ(String("abc"), str);
+        EXPECT_TRUE(reader.isFullyRead());
+    }
+
+    TEST_F(ASceneActionCollection, encodingIsPartOfEqualityCopySwapAndAppend)
+    {
+        SceneActionCollection fixed;
+        SceneActionCollection compact(ESceneActionEncoding::Compact);
+        EXPECT_NE(fixed, compact);
+
+        EXPECT_EQ(ESceneActionEncoding::Compact, compact.copy().getEncoding());
+
+        fixed.swap(compact);
+        EXPECT_EQ(ESceneActionEncoding::Compact, fixed.getEncoding());
+        EXPECT_EQ(ESceneActionEncoding::Fixed, compact.getEncoding());
+
+        SceneActionCollection appended;
+        appended.append(fixed);
+        EXPECT_EQ(ESceneActionEncoding::Compact, appended.getEncoding());
+    }
 }
@@ -59,6 +59,7 @@ namespace ramses
         ERamsesShellType m_shellType;
         ramses_internal::ThreadWatchdogConfig m_watchdogConfig;
         bool m_periodicLogsEnabled;
+        ramses_internal::String m_traceFilePath;
         std::chrono::milliseconds someipKeepAliveInterval{500};
         std::chrono::milliseconds someipKeepAliveTimeout{2500};
 
@@ -115,6 +115,8 @@ namespace ramses
 
         std::unordered_map<RamsesClient*, ClientUniquePtr> m_ramsesClients;
         RendererUniquePtr m_ramsesRenderer;
+
+        ramses_internal::String m_traceFilePath;
     };
 }
 
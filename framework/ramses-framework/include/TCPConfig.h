@@ -35,6 +35,9 @@ namespace ramses
         void setAliveInterval(std::chrono::milliseconds interval);
         void setAliveTimeout(std::chrono::milliseconds timeout);
 
+        bool getSharedMemoryTransportEnabled() const;
+        void setSharedMemoryTransportEnabled(bool enabled);
+
     private:
         static const uint16_t DefaultPort;
         static const uint16_t DefaultDaemonPort;
@@ -46,6 +49,7 @@ namespace ramses
         ramses_internal::String m_daemonIP;
         std::chrono::milliseconds m_aliveInterval;
         std::chrono::milliseconds m_aliveTimeout;
+        bool m_sharedMemoryTransportEnabled;
     };
 }
 
@@ -152,6 +152,7 @@ namespace ramses
         const ArgumentBool enableOffsetPlatformProtocolVersion(m_parser, "pvo", "protocolVersionOffset");
         const ArgumentBool disablePeriodicLogs(m_parser, "disablePeriodicLogs", "disablePeriodicLogs");
         const ArgumentString userProvidedGuid(m_parser, "guid", "guid", "");
+        const ArgumentString traceFilePath(m_parser, "trace", "traceFile", "");
 
         if (enableOffsetPlatformProtocolVersion)
         {
@@ -167,6 +168,11 @@ namespace ramses
             m_periodicLogsEnabled = false;
         }
 
+        if (traceFilePath.wasDefined())
+        {
+            m_traceFilePath = traceFilePath;
+        }
+
         if (someipCommunicationUserID)
         {
             const ArgumentBool someipHuLocalMode(m_parser, "shl", "someip-hu-local");
@@ -201,6 +207,12 @@ namespace ramses
 
             m_tcpConfig.setAliveInterval(std::chrono::milliseconds(ArgumentUInt32(m_parser, "tcpAlive", "tcpAlive", static_cast<uint32_t>(m_tcpConfig.getAliveInterval().count()))));
             m_tcpConfig.setAliveTimeout(std::chrono::milliseconds(ArgumentUInt32(m_parser, "tcpAliveTimeout", "tcpAliveTimeout", static_cast<uint32_t>(m_tcpConfig.getAliveTimeout().count()))));
+
+            const ArgumentBool useSharedMemoryTransport(m_parser, "tcpShm", "tcpSharedMemory");
+            if (useSharedMemoryTransport)
+            {
+                m_tcpConfig.setSharedMemoryTransportEnabled(true);
+            }
         }
 
         if (userProvidedGuid.hasValue())
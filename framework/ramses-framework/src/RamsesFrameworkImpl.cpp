@@ -15,6 +15,7 @@
 #include "TransportCommon/ICommunicationSystem.h"
 #include "TransportCommon/SomeIPAdapter.h"
 #include "Utils/RamsesLogger.h"
+#include "Utils/TraceRecorder.h"
 #include "RamsesFrameworkConfigImpl.h"
 #include "ramses-framework-api/RamsesFrameworkConfig.h"
 #include "Ramsh/RamshStandardSetup.h"
@@ -43,8 +44,8 @@ namespace ramses
         , m_threadWatchdogConfig(config.m_watchdogConfig)
         // NOTE: ThreadedTaskExecutor must always be constructed after CommunicationSystem
         , m_threadedTaskExecutor(3, config.m_watchdogConfig)
-        , m_resourceComponent(m_statisticCollection, m_frameworkLock)
-        , m_scenegraphComponent(m_participantAddress.getParticipantId(), *m_communicationSystem, m_communicationSystem->getRamsesConnectionStatusUpdateNotifier(), m_resourceComponent, m_frameworkLock)
+        , m_resourceComponent(m_statisticCollection)
+        , m_scenegraphComponent(m_participantAddress.getParticipantId(), *m_communicationSystem, m_communicationSystem->getRamsesConnectionStatusUpdateNotifier(), m_resourceComponent, m_statisticCollection, m_frameworkLock)
         , m_dcsmComponent(m_participantAddress.getParticipantId(), *m_communicationSystem, m_communicationSystem->getDcsmConnectionStatusUpdateNotifier(), m_frameworkLock)
         , m_ramshCommandLogConnectionInformation(*m_communicationSystem)
         , m_ramshCommandLogDcsmInformation(m_dcsmComponent)
@@ -56,6 +57,7 @@ namespace ramses
         m_ramsh->add(m_ramshCommandLogDcsmInformation);
         m_periodicLogger.registerPeriodicLogSupplier(m_communicationSystem.get());
         m_periodicLogger.registerPeriodicLogSupplier(&m_dcsmComponent);
+        m_periodicLogger.registerPeriodicLogSupplier(&m_scenegraphComponent);
     }
 
     RamsesFrameworkImpl::~RamsesFrameworkImpl()
@@ -71,6 +73,16 @@ namespace ramses
 
         m_periodicLogger.removePeriodicLogSupplier(m_communicationSystem.get());
         m_periodicLogger.removePeriodicLogSupplier(&m_dcsmComponent);
+        m_periodicLogger.removePeriodicLogSupplier(&m_scenegraphComponent);
+
+        if (!m_traceFilePath.empty())
+        {
+            GetTraceRecorder().stopRecording();
+            if (GetTraceRecorder().writeToFile(m_traceFilePath))
+                LOG_INFO(CONTEXT_FRAMEWORK, "RamsesFramework::~RamsesFramework: trace written to " << m_traceFilePath);
+            else
+                LOG_ERROR(CONTEXT_FRAMEWORK, "RamsesFramework::~RamsesFramework: failed to write trace to " << m_traceFilePath);
+        }
     }
 
     RamsesRenderer* RamsesFrameworkImpl::createRenderer(const RendererConfig& config)
@@ -379,6 +391,12 @@ namespace ramses
         {
             LOG_INFO_P(CONTEXT_FRAMEWORK, "RamsesFramework: periodic logs disabled");
         }
+        if (!config.impl.m_traceFilePath.empty())
+        {
+            LOG_INFO(CONTEXT_FRAMEWORK, "RamsesFramework: recording trace to " << config.impl.m_traceFilePath);
+            impl->m_traceFilePath = config.impl.m_traceFilePath;
+            GetTraceRecorder().startRecording();
+        }
         return *impl;
     }
 
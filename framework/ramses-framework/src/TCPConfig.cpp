@@ -21,6 +21,7 @@ namespace ramses
         , m_daemonIP("127.0.0.1")
         , m_aliveInterval(300)
         , m_aliveTimeout(m_aliveInterval * 6)
+        , m_sharedMemoryTransportEnabled(false)
     {
     }
 
@@ -85,4 +86,14 @@ namespace ramses
     {
         m_aliveTimeout = factor;
     }
+
+    bool TCPConfig::getSharedMemoryTransportEnabled() const
+    {
+        return m_sharedMemoryTransportEnabled;
+    }
+
+    void TCPConfig::setSharedMemoryTransportEnabled(bool enabled)
+    {
+        m_sharedMemoryTransportEnabled = enabled;
+    }
 }
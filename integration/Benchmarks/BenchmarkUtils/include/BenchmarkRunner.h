@@ -0,0 +1,95 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2020 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#ifndef RAMSES_BENCHMARKRUNNER_H
+#define RAMSES_BENCHMARKRUNNER_H
+
+#include "PlatformAbstraction/PlatformTypes.h"
+#include "Collections/String.h"
+#include <functional>
+#include <vector>
+
+namespace ramses_internal
+{
+    struct BenchmarkResult
+    {
+        String name;
+        UInt32 iterations = 0u;
+        UInt64 itemsPerIteration = 0u;
+        UInt64 minNs = 0u;
+        UInt64 medianNs = 0u;
+        UInt64 meanNs = 0u;
+        UInt64 maxNs = 0u;
+    };
+    using BenchmarkResults = std::vector<BenchmarkResult>;
+
+    // Minimal benchmark harness shared by the benchmark executables.
+    // Every benchmark body is run repeatedly (after one untimed warm up run) until both the minimum
+    // number of iterations and the minimum time are reached, statistics are computed over the single iterations.
+    // Results are printed as table and optionally written as JSON (one benchmark per line) which can be
+    // passed back as baseline to a later run, benchmarks whose median got slower than the given tolerance
+    // are then reported as regression and make the executable return non-zero.
+    //
+    // Command line:
+    //   -f, --filter <text>         only run benchmarks whose name contains text
+    //   -s, --scale <n>             size factor for synthetic content (default 1)
+    //   -i, --min-iterations <n>    minimum number of timed iterations (default 5)
+    //   -t, --min-time-ms <n>       minimum timed duration of each benchmark (default 200)
+    //   -o, --output <file>         write results as JSON
+    //   -b, --baseline <file>       compare against results of previous run
+    //   -tol, --tolerance <percent> allowed median slowdown against baseline (default 10)
+    class BenchmarkRunner
+    {
+    public:
+        using Body = std::function<void()>;
+
+        BenchmarkRunner(const char* suiteName, Int argc, char const* const* argv);
+
+        UInt32 getScale() const;
+
+        // runs body as one iteration, itemsPerIteration is used to report throughput
+        void run(const char* name, UInt64 itemsPerIteration, const Body& body);
+        // like run, but calls setup before every iteration without timing it
+        void run(const char* name, UInt64 itemsPerIteration, const Body& setup, const Body& body);
+
+        // prints and writes results, returns process exit code
+        int finish();
+
+        const BenchmarkResults& getResults() const;
+
+        static String ResultsToJson(const char* suiteName, UInt32 scale, const BenchmarkResults& results);
+        static Bool ParseResultsFromJson(const String& json, BenchmarkResults& resultsOut);
+
+    private:
+        Bool isSelected(const char* name) const;
+        Bool compareToBaseline() const;
+
+        const char* m_suiteName;
+        String m_filter;
+        UInt32 m_scale;
+        UInt32 m_minIterations;
+        UInt32 m_minTimeMs;
+        String m_outputFile;
+        String m_baselineFile;
+        UInt32 m_tolerancePercent;
+
+        BenchmarkResults m_results;
+    };
+
+    // Prevents compiler from optimizing away computations whose results are not used otherwise,
+    // value escapes into a function of another translation unit
+    void DoNotOptimizeAway(const void* value);
+
+    template <typename T>
+    inline void DoNotOptimize(const T& value)
+    {
+        DoNotOptimizeAway(&value);
+    }
+}
+
+#endif
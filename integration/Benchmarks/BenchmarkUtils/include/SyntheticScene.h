@@ -0,0 +1,62 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2020 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#ifndef RAMSES_SYNTHETICSCENE_H
+#define RAMSES_SYNTHETICSCENE_H
+
+#include "SceneAPI/Handles.h"
+#include "SceneAPI/ResourceContentHash.h"
+#include "Components/ManagedResource.h"
+#include <vector>
+
+namespace ramses_internal
+{
+    class IScene;
+
+    struct SyntheticSceneConfig
+    {
+        UInt32 renderableCount = 1000u;
+        // renderables are attached to groups of nodes, each group is a chain of this many nodes below root
+        UInt32 hierarchyDepth = 4u;
+        UInt32 renderablesPerGroup = 16u;
+        UInt32 renderPassCount = 1u;
+        // seed of pseudo random values, same seed and config always give same scene
+        UInt32 seed = 1u;
+    };
+
+    // Content created by SyntheticScene, handles needed to modify the scene afterwards
+    struct SyntheticSceneContent
+    {
+        std::vector<TransformHandle> groupTransforms;
+        std::vector<TransformHandle> renderableTransforms;
+        std::vector<RenderableHandle> renderables;
+        std::vector<DataInstanceHandle> uniformInstances;
+        std::vector<RenderPassHandle> renderPasses;
+        ResourceContentHash effectHash;
+        ResourceContentHash indexArrayHash;
+        ResourceContentHash vertexArrayHash;
+    };
+
+    // Reproducible synthetic scene content of configurable size for benchmarks.
+    // Scene is built through IScene only, so it can be created on any scene type (e.g. action collecting scene
+    // to produce scene actions as a client would, or renderer scene directly). Referenced resources are only
+    // identified by hash, create them with CreateResources if resource data is needed.
+    class SyntheticScene
+    {
+    public:
+        static SyntheticSceneContent Create(IScene& scene, const SyntheticSceneConfig& config);
+
+        // changes all renderable transformations and uniforms as an animated frame would
+        static void Animate(IScene& scene, const SyntheticSceneContent& content, UInt32 frame);
+
+        // creates count vertex array resources of given size with pseudo random (but compressible) content
+        static ManagedResourceVector CreateResources(UInt32 count, UInt32 vertexCountPerResource, UInt32 seed);
+    };
+}
+
+#endif
@@ -0,0 +1,266 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2020 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "BenchmarkRunner.h"
+#include "Utils/CommandLineParser.h"
+#include "Utils/Argument.h"
+#include "Utils/File.h"
+#include "Collections/StringOutputStream.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+
+namespace ramses_internal
+{
+    namespace
+    {
+        UInt64 GetNanoseconds()
+        {
+            return static_cast<UInt64>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+        }
+
+        Bool FindJsonValue(const std::string& line, const char* key, std::string& valueOut)
+        {
+            const std::string keyQuoted = std::string("\"") + key + "\":";
+            const size_t keyPos = line.find(keyQuoted);
+            if (keyPos == std::string::npos)
+                return false;
+
+            size_t begin = keyPos + keyQuoted.size();
+            size_t end = 0u;
+            if (begin < line.size() && line[begin] == '"')
+            {
+                ++begin;
+                end = line.find('"', begin);
+            }
+            else
+                end = line.find_first_of(",}", begin);
+
+            if (end == std::string::npos)
+                return false;
+            valueOut = line.substr(begin, end - begin);
+            return true;
+        }
+
+        Bool ReadFile(const String& filePath, String& contentOut)
+        {
+            File file(filePath);
+            size_t fileSize = 0u;
+            if (!file.getSizeInBytes(fileSize) || !file.open(File::Mode::ReadOnlyBinary))
+                return false;
+
+            std::string content(fileSize, '\0');
+            size_t numBytesRead = 0u;
+            const EStatus status = file.read(&content[0], fileSize, numBytesRead);
+            file.close();
+            if (status != EStatus::Ok && status != EStatus::Eof)
+                return false;
+
+            content.resize(numBytesRead);
+            contentOut = String(std::move(content));
+            return true;
+        }
+
+        volatile const void* optimizationSink = nullptr;
+    }
+
+    void DoNotOptimizeAway(const void* value)
+    {
+        optimizationSink = value;
+    }
+
+    BenchmarkRunner::BenchmarkRunner(const char* suiteName, Int argc, char const* const* argv)
+        : m_suiteName(suiteName)
+    {
+        CommandLineParser parser(argc, argv);
+        m_filter           = ArgumentString(parser, "f",   "filter",          "");
+        m_scale            = std::max<UInt32>(ArgumentUInt32(parser, "s", "scale", 1u), 1u);
+        m_minIterations    = std::max<UInt32>(ArgumentUInt32(parser, "i", "min-iterations", 5u), 1u);
+        m_minTimeMs        = ArgumentUInt32(parser, "t",   "min-time-ms",     200u);
+        m_outputFile       = ArgumentString(parser, "o",   "output",          "");
+        m_baselineFile     = ArgumentString(parser, "b",   "baseline",        "");
+        m_tolerancePercent = ArgumentUInt32(parser, "tol", "tolerance",       10u);
+
+        std::printf("%s (scale %u)\n", m_suiteName, m_scale);
+        std::printf("%-52s %10s %14s %14s %14s %16s\n", "benchmark", "iterations", "min [us]", "median [us]", "max [us]", "items/s");
+    }
+
+    UInt32 BenchmarkRunner::getScale() const
+    {
+        return m_scale;
+    }
+
+    void BenchmarkRunner::run(const char* name, UInt64 itemsPerIteration, const Body& body)
+    {
+        run(name, itemsPerIteration, [](){}, body);
+    }
+
+    void BenchmarkRunner::run(const char* name, UInt64 itemsPerIteration, const Body& setup, const Body& body)
+    {
+        if (!isSelected(name))
+            return;
+
+        // warm up caches and lazily allocated memory
+        setup();
+        body();
+
+        std::vector<UInt64> samples;
+        UInt64 totalNs = 0u;
+        const UInt64 minTimeNs = UInt64(m_minTimeMs) * 1000000u;
+        while (samples.size() < m_minIterations || totalNs < minTimeNs)
+        {
+            setup();
+            const UInt64 start = GetNanoseconds();
+            body();
+            const UInt64 duration = GetNanoseconds() - start;
+            samples.push_back(duration);
+            totalNs += duration;
+        }
+
+        std::sort(samples.begin(), samples.end());
+        BenchmarkResult result;
+        result.name = name;
+        result.iterations = static_cast<UInt32>(samples.size());
+        result.itemsPerIteration = itemsPerIteration;
+        result.minNs = samples.front();
+        result.medianNs = samples[samples.size() / 2u];
+        result.meanNs = totalNs / samples.size();
+        result.maxNs = samples.back();
+
+        const Double itemsPerSecond = result.medianNs > 0u ? Double(itemsPerIteration) * 1e9 / Double(result.medianNs) : 0.0;
+        std::printf("%-52s %10u %14.1f %14.1f %14.1f %16.0f\n", name, result.iterations,
+            Double(result.minNs) / 1000.0, Double(result.medianNs) / 1000.0, Double(result.maxNs) / 1000.0, itemsPerSecond);
+        std::fflush(stdout);
+
+        m_results.push_back(std::move(result));
+    }
+
+    int BenchmarkRunner::finish()
+    {
+        int exitCode = 0;
+        if (!m_outputFile.empty())
+        {
+            const String json = ResultsToJson(m_suiteName, m_scale, m_results);
+            File file(m_outputFile);
+            if (!file.open(File::Mode::WriteOverWriteOld) || !file.write(json.c_str(), json.size()) || !file.close())
+            {
+                std::printf("failed to write results to %s\n", m_outputFile.c_str());
+                exitCode = 1;
+            }
+        }
+
+        if (!m_baselineFile.empty() && !compareToBaseline())
+            exitCode = 1;
+
+        return exitCode;
+    }
+
+    const BenchmarkResults& BenchmarkRunner::getResults() const
+    {
+        return m_results;
+    }
+
+    Bool BenchmarkRunner::isSelected(const char* name) const
+    {
+        return m_filter.empty() || String(name).find(m_filter) >= 0;
+    }
+
+    Bool BenchmarkRunner::compareToBaseline() const
+    {
+        String json;
+        BenchmarkResults baseline;
+        if (!ReadFile(m_baselineFile, json) || !ParseResultsFromJson(json, baseline))
+        {
+            std::printf("failed to read baseline from %s\n", m_baselineFile.c_str());
+            return false;
+        }
+
+        Bool noRegression = true;
+        std::printf("\ncomparison to baseline %s (tolerance %u%%)\n", m_baselineFile.c_str(), m_tolerancePercent);
+        for (const auto& result : m_results)
+        {
+            const auto it = std::find_if(baseline.cbegin(), baseline.cend(), [&](const BenchmarkResult& r) { return r.name == result.name; });
+            if (it == baseline.cend() || it->medianNs == 0u)
+            {
+                std::printf("%-52s %12s\n", result.name.c_str(), "new");
+                continue;
+            }
+
+            const Double change = 100.0 * (Double(result.medianNs) - Double(it->medianNs)) / Double(it->medianNs);
+            const Bool regressed = change > Double(m_tolerancePercent);
+            noRegression &= !regressed;
+            std::printf("%-52s %+11.1f%% %s\n", result.name.c_str(), change, regressed ? "REGRESSION" : "");
+        }
+
+        return noRegression;
+    }
+
+    String BenchmarkRunner::ResultsToJson(const char* suiteName, UInt32 scale, const BenchmarkResults& results)
+    {
+        StringOutputStream json;
+        json << "{\"suite\":\"" << suiteName << "\",\"scale\":" << scale << ",\"benchmarks\":[";
+        for (size_t i = 0u; i < results.size(); ++i)
+        {
+            const BenchmarkResult& result = results[i];
+            json << (i == 0u ? "\n" : ",\n");
+            json << "{\"name\":\"" << result.name
+                << "\",\"iterations\":" << result.iterations
+                << ",\"itemsPerIteration\":" << result.itemsPerIteration
+                << ",\"minNs\":" << result.minNs
+                << ",\"medianNs\":" << result.medianNs
+                << ",\"meanNs\":" << result.meanNs
+                << ",\"maxNs\":" << result.maxNs
+                << "}";
+        }
+        json << "\n]}\n";
+        return json.release();
+    }
+
+    Bool BenchmarkRunner::ParseResultsFromJson(const String& json, BenchmarkResults& resultsOut)
+    {
+        // only needs to understand the format written by ResultsToJson
+        resultsOut.clear();
+        const std::string& content = json.stdRef();
+        if (content.find("\"benchmarks\":[") == std::string::npos)
+            return false;
+
+        size_t lineStart = 0u;
+        while (lineStart < content.size())
+        {
+            size_t lineEnd = content.find('\n', lineStart);
+            if (lineEnd == std::string::npos)
+                lineEnd = content.size();
+            const std::string line = content.substr(lineStart, lineEnd - lineStart);
+            lineStart = lineEnd + 1u;
+
+            std::string name;
+            if (line.empty() || line[0] != '{' || !FindJsonValue(line, "name", name))
+                continue;
+
+            BenchmarkResult result;
+            std::string value;
+            result.name = String(name);
+            if (FindJsonValue(line, "iterations", value))
+                result.iterations = static_cast<UInt32>(std::strtoul(value.c_str(), nullptr, 10));
+            if (FindJsonValue(line, "itemsPerIteration", value))
+                result.itemsPerIteration = std::strtoull(value.c_str(), nullptr, 10);
+            if (FindJsonValue(line, "minNs", value))
+                result.minNs = std::strtoull(value.c_str(), nullptr, 10);
+            if (FindJsonValue(line, "medianNs", value))
+                result.medianNs = std::strtoull(value.c_str(), nullptr, 10);
+            if (FindJsonValue(line, "meanNs", value))
+                result.meanNs = std::strtoull(value.c_str(), nullptr, 10);
+            if (FindJsonValue(line, "maxNs", value))
+                result.maxNs = std::strtoull(value.c_str(), nullptr, 10);
+            resultsOut.push_back(std::move(result));
+        }
+
+        return true;
+    }
+}
@@ -0,0 +1,187 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2020 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "SyntheticScene.h"
+#include "SceneAPI/IScene.h"
+#include "SceneAPI/Camera.h"
+#include "SceneAPI/RenderState.h"
+#include "Resource/ArrayResource.h"
+#include "Math3d/Vector2.h"
+#include "Math3d/Vector2i.h"
+#include "Math3d/Vector4.h"
+#include <random>
+#include <algorithm>
+
+namespace ramses_internal
+{
+    namespace
+    {
+        // std::minstd_rand is fully specified, unlike the standard distributions, so values are equal on all platforms
+        class Random
+        {
+        public:
+            explicit Random(UInt32 seed)
+                : m_engine(seed)
+            {
+            }
+
+            Float next(Float minValue, Float maxValue)
+            {
+                const Float unit = Float(m_engine() - std::minstd_rand::min()) / Float(std::minstd_rand::max() - std::minstd_rand::min());
+                return minValue + unit * (maxValue - minValue);
+            }
+
+            Vector3 nextVector(Float minValue, Float maxValue)
+            {
+                const Float x = next(minValue, maxValue);
+                const Float y = next(minValue, maxValue);
+                const Float z = next(minValue, maxValue);
+                return { x, y, z };
+            }
+
+        private:
+            std::minstd_rand m_engine;
+        };
+
+        CameraHandle CreateCamera(IScene& scene)
+        {
+            const NodeHandle cameraNode = scene.allocateNode();
+            scene.allocateTransform(cameraNode);
+
+            const DataLayoutHandle cameraLayout = scene.allocateDataLayout({ DataFieldInfo{ EDataType::DataReference }, DataFieldInfo{ EDataType::DataReference }, DataFieldInfo{ EDataType::DataReference }, DataFieldInfo{ EDataType::DataReference } }, {});
+            const DataLayoutHandle vec2iLayout = scene.allocateDataLayout({ DataFieldInfo{ EDataType::Vector2I } }, {});
+            const DataLayoutHandle vec4fLayout = scene.allocateDataLayout({ DataFieldInfo{ EDataType::Vector4F } }, {});
+            const DataLayoutHandle vec2fLayout = scene.allocateDataLayout({ DataFieldInfo{ EDataType::Vector2F } }, {});
+
+            const DataInstanceHandle cameraData = scene.allocateDataInstance(cameraLayout);
+            const DataInstanceHandle viewportOffset = scene.allocateDataInstance(vec2iLayout);
+            const DataInstanceHandle viewportSize = scene.allocateDataInstance(vec2iLayout);
+            const DataInstanceHandle frustumPlanes = scene.allocateDataInstance(vec4fLayout);
+            const DataInstanceHandle frustumNearFar = scene.allocateDataInstance(vec2fLayout);
+            scene.setDataReference(cameraData, Camera::ViewportOffsetField, viewportOffset);
+            scene.setDataReference(cameraData, Camera::ViewportSizeField, viewportSize);
+            scene.setDataReference(cameraData, Camera::FrustumPlanesField, frustumPlanes);
+            scene.setDataReference(cameraData, Camera::FrustumNearFarPlanesField, frustumNearFar);
+
+            scene.setDataSingleVector2i(viewportOffset, DataFieldHandle{ 0 }, Vector2i(0, 0));
+            scene.setDataSingleVector2i(viewportSize, DataFieldHandle{ 0 }, Vector2i(1280, 480));
+            scene.setDataSingleVector4f(frustumPlanes, DataFieldHandle{ 0 }, { -0.1f, 0.1f, -0.05f, 0.05f });
+            scene.setDataSingleVector2f(frustumNearFar, DataFieldHandle{ 0 }, Vector2(0.1f, 1000.f));
+
+            return scene.allocateCamera(ECameraProjectionType::Perspective, cameraNode, cameraData);
+        }
+    }
+
+    SyntheticSceneContent SyntheticScene::Create(IScene& scene, const SyntheticSceneConfig& config)
+    {
+        Random random(config.seed);
+        SyntheticSceneContent content;
+        content.effectHash = { 0x5EEDu, config.seed };
+        content.indexArrayHash = { 0x1DE0u, config.seed };
+        content.vertexArrayHash = { 0x7E47u, config.seed };
+
+        const DataLayoutHandle uniformLayout = scene.allocateDataLayout({
+            DataFieldInfo{ EDataType::Matrix44F, 1u, EFixedSemantics::ModelViewProjectionMatrix },
+            DataFieldInfo{ EDataType::Matrix44F, 1u, EFixedSemantics::ModelMatrix },
+            DataFieldInfo{ EDataType::Vector4F },
+            DataFieldInfo{ EDataType::Float } }, content.effectHash);
+        const DataLayoutHandle geometryLayout = scene.allocateDataLayout({
+            DataFieldInfo{ EDataType::Indices, 1u, EFixedSemantics::Indices },
+            DataFieldInfo{ EDataType::Vector3Buffer },
+            DataFieldInfo{ EDataType::Vector2Buffer } }, content.effectHash);
+        const RenderStateHandle renderState = scene.allocateRenderState();
+
+        const UInt32 renderPassCount = std::max(config.renderPassCount, 1u);
+        std::vector<RenderGroupHandle> renderGroups;
+        for (UInt32 i = 0u; i < renderPassCount; ++i)
+        {
+            const RenderPassHandle pass = scene.allocateRenderPass();
+            scene.setRenderPassCamera(pass, CreateCamera(scene));
+            scene.setRenderPassClearFlag(pass, EClearFlags_None);
+            scene.setRenderPassRenderOrder(pass, Int32(i));
+            const RenderGroupHandle group = scene.allocateRenderGroup();
+            scene.addRenderGroupToRenderPass(pass, group, 0);
+            content.renderPasses.push_back(pass);
+            renderGroups.push_back(group);
+        }
+
+        const NodeHandle root = scene.allocateNode();
+        const UInt32 renderablesPerGroup = std::max(config.renderablesPerGroup, 1u);
+        NodeHandle groupLeaf;
+        for (UInt32 i = 0u; i < config.renderableCount; ++i)
+        {
+            if (i % renderablesPerGroup == 0u)
+            {
+                groupLeaf = root;
+                for (UInt32 level = 0u; level < config.hierarchyDepth; ++level)
+                {
+                    const NodeHandle node = scene.allocateNode();
+                    scene.addChildToNode(groupLeaf, node);
+                    const TransformHandle transform = scene.allocateTransform(node);
+                    scene.setTranslation(transform, random.nextVector(-1.f, 1.f));
+                    scene.setRotation(transform, random.nextVector(-30.f, 30.f), ERotationConvention::XYZ);
+                    content.groupTransforms.push_back(transform);
+                    groupLeaf = node;
+                }
+            }
+
+            const NodeHandle node = scene.allocateNode();
+            scene.addChildToNode(groupLeaf, node);
+            const TransformHandle transform = scene.allocateTransform(node);
+            scene.setTranslation(transform, random.nextVector(-10.f, 10.f));
+            content.renderableTransforms.push_back(transform);
+
+            const DataInstanceHandle uniforms = scene.allocateDataInstance(uniformLayout);
+            scene.setDataSingleVector4f(uniforms, DataFieldHandle{ 2 }, { random.next(0.f, 1.f), random.next(0.f, 1.f), random.next(0.f, 1.f), 1.f });
+            scene.setDataSingleFloat(uniforms, DataFieldHandle{ 3 }, random.next(0.f, 1.f));
+            content.uniformInstances.push_back(uniforms);
+
+            const DataInstanceHandle geometry = scene.allocateDataInstance(geometryLayout);
+            scene.setDataResource(geometry, DataFieldHandle{ 0 }, content.indexArrayHash, DataBufferHandle::Invalid(), 0u, 0u, 0u);
+            scene.setDataResource(geometry, DataFieldHandle{ 1 }, content.vertexArrayHash, DataBufferHandle::Invalid(), 0u, 0u, 20u);
+            scene.setDataResource(geometry, DataFieldHandle{ 2 }, content.vertexArrayHash, DataBufferHandle::Invalid(), 0u, 12u, 20u);
+
+            const RenderableHandle renderable = scene.allocateRenderable(node);
+            scene.setRenderableDataInstance(renderable, ERenderableDataSlotType_Uniforms, uniforms);
+            scene.setRenderableDataInstance(renderable, ERenderableDataSlotType_Geometry, geometry);
+            scene.setRenderableRenderState(renderable, renderState);
+            scene.setRenderableIndexCount(renderable, 36u);
+            scene.addRenderableToRenderGroup(renderGroups[i % renderPassCount], renderable, Int32(i));
+            content.renderables.push_back(renderable);
+        }
+
+        return content;
+    }
+
+    void SyntheticScene::Animate(IScene& scene, const SyntheticSceneContent& content, UInt32 frame)
+    {
+        const Float phase = Float(frame % 360u);
+        for (size_t i = 0u; i < content.renderableTransforms.size(); ++i)
+        {
+            const Float value = phase + Float(i % 17u);
+            scene.setTranslation(content.renderableTransforms[i], { value * 0.01f, -value * 0.02f, value * 0.005f });
+            scene.setDataSingleFloat(content.uniformInstances[i], DataFieldHandle{ 3 }, value);
+        }
+    }
+
+    ManagedResourceVector SyntheticScene::CreateResources(UInt32 count, UInt32 vertexCountPerResource, UInt32 seed)
+    {
+        Random random(seed);
+        ManagedResourceVector resources;
+        resources.reserve(count);
+        std::vector<Vector3> vertices(vertexCountPerResource);
+        for (UInt32 i = 0u; i < count; ++i)
+        {
+            // mesh like data: smooth values with some noise, similar compression ratio as real content
+            for (UInt32 v = 0u; v < vertexCountPerResource; ++v)
+                vertices[v] = Vector3(Float(v % 64u) * 0.1f, Float(v / 64u) * 0.1f, random.next(0.f, 0.01f));
+            resources.push_back(std::make_shared<const ArrayResource>(EResourceType_VertexArray, vertexCountPerResource, EDataType::Vector3F, vertices.data(), ResourceCacheFlag_DoNotCache, "synthetic"));
+        }
+        return resources;
+    }
+}
@@ -0,0 +1,350 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2020 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "BenchmarkRunner.h"
+#include "SyntheticScene.h"
+#include "Collections/HashMap.h"
+#include "Scene/Scene.h"
+#include "Scene/ActionCollectingScene.h"
+#include "Scene/SceneActionApplier.h"
+#include "Scene/SceneActionCollection.h"
+#include "Scene/TransformationCachedScene.h"
+#include "Scene/SceneDataBinding.h"
+#include "Animation/AnimationSystem.h"
+#include "Resource/LZ4CompressionUtils.h"
+#include "Components/SceneUpdate.h"
+#include "TransportCommon/SceneUpdateSerializer.h"
+#include "TransportCommon/SceneUpdateStreamDeserializer.h"
+#include <memory>
+#include <random>
+#include <algorithm>
+
+using namespace ramses_internal;
+
+namespace
+{
+    void RunHashMapBenchmarks(BenchmarkRunner& runner)
+    {
+        const UInt32 count = 100000u * runner.getScale();
+        // spread keys like memory handles of several scenes would be
+        std::vector<UInt32> keys(count);
+        for (UInt32 i = 0u; i < count; ++i)
+            keys[i] = i * 2654435761u;
+
+        HashMap<UInt32, UInt32> filledMap;
+        for (const auto key : keys)
+            filledMap.put(key, key);
+        // lookups in other order than insertion, otherwise map profits from entries allocated in insertion order
+        std::vector<UInt32> lookupKeys = keys;
+        std::shuffle(lookupKeys.begin(), lookupKeys.end(), std::minstd_rand(1u));
+
+        runner.run("HashMap/put", count, [&]()
+        {
+            HashMap<UInt32, UInt32> map;
+            for (const auto key : keys)
+                map.put(key, key);
+            DoNotOptimize(map);
+        });
+
+        runner.run("HashMap/get", count, [&]()
+        {
+            UInt32 sum = 0u;
+            for (const auto key : lookupKeys)
+                sum += *filledMap.get(key);
+            DoNotOptimize(sum);
+        });
+
+        runner.run("HashMap/getMissing", count, [&]()
+        {
+            UInt32 found = 0u;
+            for (const auto key : lookupKeys)
+                found += filledMap.contains(key + 1u) ? 1u : 0u;
+            DoNotOptimize(found);
+        });
+
+        runner.run("HashMap/iterate", count, [&]()
+        {
+            UInt32 sum = 0u;
+            for (const auto& entry : filledMap)
+                sum += entry.value;
+            DoNotOptimize(sum);
+        });
+
+        HashMap<UInt32, UInt32> mapToClear;
+        runner.run("HashMap/remove", count, [&]() { mapToClear = filledMap; }, [&]()
+        {
+            for (const auto key : lookupKeys)
+                mapToClear.remove(key);
+            DoNotOptimize(mapToClear);
+        });
+
+        // small table with sequential handles like node to transformation lookup of a scene, queried every frame
+        const UInt32 handleCount = 1000u;
+        HashMap<UInt32, UInt32> handleMap;
+        for (UInt32 i = 0u; i < handleCount; i += 2u)
+            handleMap.put(i, i);
+        runner.run("HashMap/getSequentialHandles", handleCount, [&]()
+        {
+            UInt32 found = 0u;
+            for (UInt32 i = 0u; i < handleCount; ++i)
+                found += handleMap.get(i) ? 1u : 0u;
+            DoNotOptimize(found);
+        });
+    }
+
+    void RunSceneActionCollectionBenchmarks(BenchmarkRunner& runner)
+    {
+        const UInt32 count = 100000u * runner.getScale();
+        const Float translation[3] = { 1.f, 2.f, 3.f };
+
+        SceneActionCollection filledCollection;
+        for (UInt32 i = 0u; i < count; ++i)
+        {
+            filledCollection.beginWriteSceneAction(ESceneActionId::SetTransformComponent);
+            filledCollection.write(TransformHandle(i));
+            filledCollection.write(translation);
+        }
+
+        runner.run("SceneActionCollection/write", count, [&]()
+        {
+            SceneActionCollection collection;
+            for (UInt32 i = 0u; i < count; ++i)
+            {
+                collection.beginWriteSceneAction(ESceneActionId::SetTransformComponent);
+                collection.write(TransformHandle(i));
+                collection.write(translation);
+            }
+            DoNotOptimize(collection);
+        });
+
+        runner.run("SceneActionCollection/read", count, [&]()
+        {
+            Float sum = 0.f;
+            for (auto& reader : filledCollection)
+            {
+                TransformHandle handle;
+                Float value[3];
+                reader.read(handle);
+                reader.read(value);
+                sum += value[0];
+            }
+            DoNotOptimize(sum);
+        });
+
+        runner.run("SceneActionCollection/copy", count, [&]()
+        {
+            SceneActionCollection copy = filledCollection.copy();
+            DoNotOptimize(copy);
+        });
+    }
+
+    void RunSceneActionApplierBenchmarks(BenchmarkRunner& runner)
+    {
+        SyntheticSceneConfig config;
+        config.renderableCount = 1000u * runner.getScale();
+
+        ActionCollectingScene creatingScene;
+        const SyntheticSceneContent content = SyntheticScene::Create(creatingScene, config);
+        const SceneActionCollection creationActions = creatingScene.getSceneActionCollection().copy();
+        creatingScene.getSceneActionCollection().clear();
+        SyntheticScene::Animate(creatingScene, content, 1u);
+        const SceneActionCollection animationActions = creatingScene.getSceneActionCollection().copy();
+
+        std::unique_ptr<Scene> scene;
+        runner.run("SceneActionApplier/createScene", creationActions.numberOfActions(), [&]() { scene.reset(new Scene); }, [&]()
+        {
+            SceneActionApplier::ApplyActionsOnScene(*scene, creationActions);
+        });
+
+        scene.reset(new Scene);
+        SceneActionApplier::ApplyActionsOnScene(*scene, creationActions);
+        runner.run("SceneActionApplier/animateScene", animationActions.numberOfActions(), [&]()
+        {
+            SceneActionApplier::ApplyActionsOnScene(*scene, animationActions);
+        });
+    }
+
+    void RunTransformationCachedSceneBenchmarks(BenchmarkRunner& runner)
+    {
+        SyntheticSceneConfig config;
+        config.renderableCount = 1000u * runner.getScale();
+        config.hierarchyDepth = 8u;
+
+        TransformationCachedScene scene;
+        const SyntheticSceneContent content = SyntheticScene::Create(scene, config);
+        NodeHandleVector nodes;
+        for (const auto transform : content.renderableTransforms)
+            nodes.push_back(scene.getTransformNode(transform));
+
+        UInt32 frame = 0u;
+        runner.run("TransformationCachedScene/updateDirtyWorldMatrices", nodes.size(), [&]() { SyntheticScene::Animate(scene, content, ++frame); }, [&]()
+        {
+            Float sum = 0.f;
+            for (const auto node : nodes)
+                sum += scene.updateMatrixCache(ETransformationMatrixType_World, node).m11;
+            DoNotOptimize(sum);
+        });
+
+        // animating the group transformations dirties whole sub trees
+        runner.run("TransformationCachedScene/updateDirtyHierarchy", nodes.size(), [&]()
+        {
+            ++frame;
+            for (const auto transform : content.groupTransforms)
+                scene.setTranslation(transform, { Float(frame % 10u), 0.f, 0.f });
+        }, [&]()
+        {
+            Float sum = 0.f;
+            for (const auto node : nodes)
+                sum += scene.updateMatrixCache(ETransformationMatrixType_World, node).m11;
+            DoNotOptimize(sum);
+        });
+
+        runner.run("TransformationCachedScene/getCleanWorldMatrices", nodes.size(), [&]()
+        {
+            Float sum = 0.f;
+            for (const auto node : nodes)
+                sum += scene.updateMatrixCache(ETransformationMatrixType_World, node).m11;
+            DoNotOptimize(sum);
+        });
+    }
+
+    void RunAnimationSystemBenchmark(BenchmarkRunner& runner, const char* name, ESplineKeyType keyType, EInterpolationType interpolation)
+    {
+        using ContainerTraitsClass = DataBindContainerToTraitsSelector<IScene>::ContainerTraitsClassType;
+
+        SyntheticSceneConfig config;
+        config.renderableCount = 1000u * runner.getScale();
+
+        Scene scene;
+        const SyntheticSceneContent content = SyntheticScene::Create(scene, config);
+        AnimationSystem* animationSystem = new AnimationSystem(EAnimationSystemFlags_FullProcessing, AnimationSystemSizeInformation());
+        scene.addAnimationSystem(animationSystem);
+
+        // one looping translation animation per renderable transform
+        const SplineHandle spline = animationSystem->allocateSpline(keyType, EDataTypeID_Vector3f);
+        if (keyType == ESplineKeyType_Tangents)
+        {
+            animationSystem->setSplineKeyTangentsVector3f(spline, 0u, { 0.f, 0.f, 0.f }, { 300.f, 1.f }, { -300.f, 1.f });
+            animationSystem->setSplineKeyTangentsVector3f(spline, 1000u, { 1.f, 2.f, 3.f }, { -300.f, -1.f }, { 300.f, -1.f });
+        }
+        else
+        {
+            animationSystem->setSplineKeyBasicVector3f(spline, 0u, { 0.f, 0.f, 0.f });
+            animationSystem->setSplineKeyBasicVector3f(spline, 1000u, { 1.f, 2.f, 3.f });
+        }
+
+        for (const auto transform : content.renderableTransforms)
+        {
+            const DataBindHandle dataBind = animationSystem->allocateDataBinding(scene, ContainerTraitsClass::TransformNode_Translation, transform.asMemoryHandle(), InvalidMemoryHandle);
+            const AnimationInstanceHandle animationInstance = animationSystem->allocateAnimationInstance(spline, interpolation, EVectorComponent_All);
+            animationSystem->addDataBindingToAnimationInstance(animationInstance, dataBind);
+            const AnimationHandle animation = animationSystem->allocateAnimation(animationInstance);
+            animationSystem->setAnimationProperties(animation, 1.f, Animation::EAnimationFlags_Looping, 1000u, 0u);
+            animationSystem->setAnimationStartTime(animation, 1u);
+            animationSystem->setAnimationStopTime(animation, 1000000000u);
+        }
+
+        UInt64 time = 1u;
+        runner.run(name, content.renderableTransforms.size(), [&]()
+        {
+            time += 7u;
+            animationSystem->setTime(time);
+        });
+    }
+
+    void RunAnimationSystemBenchmarks(BenchmarkRunner& runner)
+    {
+        RunAnimationSystemBenchmark(runner, "AnimationSystem/processLinearTranslations", ESplineKeyType_Basic, EInterpolationType_Linear);
+        RunAnimationSystemBenchmark(runner, "AnimationSystem/processBezierTranslations", ESplineKeyType_Tangents, EInterpolationType_Bezier);
+    }
+
+    void RunCompressionBenchmarks(BenchmarkRunner& runner)
+    {
+        const ManagedResourceVector resources = SyntheticScene::CreateResources(1u, 100000u * runner.getScale(), 1u);
+        const ResourceBlob& plainData = resources.front()->getResourceData();
+        const CompressedResouceBlob compressedData = LZ4CompressionUtils::compress(plainData, LZ4CompressionUtils::CompressionLevel::Fast);
+        const UInt64 size = plainData.size();
+
+        runner.run("LZ4CompressionUtils/compressFast", size, [&]()
+        {
+            DoNotOptimize(LZ4CompressionUtils::compress(plainData, LZ4CompressionUtils::CompressionLevel::Fast));
+        });
+
+        runner.run("LZ4CompressionUtils/compressHigh", size, [&]()
+        {
+            DoNotOptimize(LZ4CompressionUtils::compress(plainData, LZ4CompressionUtils::CompressionLevel::High));
+        });
+
+        runner.run("LZ4CompressionUtils/decompress", size, [&]()
+        {
+            DoNotOptimize(LZ4CompressionUtils::decompress(compressedData, static_cast<uint32_t>(size)));
+        });
+    }
+
+    void RunSceneUpdateSerializerBenchmarks(BenchmarkRunner& runner)
+    {
+        SyntheticSceneConfig config;
+        config.renderableCount = 1000u * runner.getScale();
+
+        ActionCollectingScene creatingScene;
+        SyntheticScene::Create(creatingScene, config);
+        SceneUpdate update;
+        update.actions = creatingScene.getSceneActionCollection().copy();
+        update.resources = SyntheticScene::CreateResources(10u * runner.getScale(), 10000u, 2u);
+        for (const auto& resource : update.resources)
+            resource->compress(IResource::CompressionLevel::REALTIME);
+
+        // packet size as used by TCP transport
+        std::vector<Byte> packet(1024u * 1024u);
+        std::vector<std::vector<Byte>> packets;
+        const SceneUpdateSerializer serializer(update);
+        UInt64 totalSize = 0u;
+        serializer.writeToPackets({ packet.data(), packet.size() }, [&](size_t size)
+        {
+            packets.emplace_back(packet.begin(), packet.begin() + size);
+            totalSize += size;
+            return true;
+        });
+
+        runner.run("SceneUpdateSerializer/serialize", totalSize, [&]()
+        {
+            UInt64 writtenSize = 0u;
+            serializer.writeToPackets({ packet.data(), packet.size() }, [&](size_t size)
+            {
+                writtenSize += size;
+                return true;
+            });
+            DoNotOptimize(writtenSize);
+        });
+
+        runner.run("SceneUpdateStreamDeserializer/deserialize", totalSize, [&]()
+        {
+            SceneUpdateStreamDeserializer deserializer;
+            for (const auto& data : packets)
+            {
+                auto result = deserializer.processData({ data.data(), data.size() });
+                DoNotOptimize(result);
+            }
+        });
+    }
+}
+
+int main(int argc, const char* argv[])
+{
+    BenchmarkRunner runner("ramses-framework-benchmarks", argc, argv);
+
+    RunHashMapBenchmarks(runner);
+    RunSceneActionCollectionBenchmarks(runner);
+    RunSceneActionApplierBenchmarks(runner);
+    RunTransformationCachedSceneBenchmarks(runner);
+    RunAnimationSystemBenchmarks(runner);
+    RunCompressionBenchmarks(runner);
+    RunSceneUpdateSerializerBenchmarks(runner);
+
+    return runner.finish();
+}
@@ -0,0 +1,376 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2020 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "NullDevice.h"
+
+namespace ramses_internal
+{
+    EDeviceTypeId NullDevice::getDeviceTypeId() const
+    {
+        return EDeviceTypeId_GL_ES_3_0;
+    }
+
+    DeviceResourceHandle NullDevice::allocateHandle()
+    {
+        return DeviceResourceHandle(m_nextHandle++);
+    }
+
+    void NullDevice::setConstant(DataFieldHandle /*field*/, UInt32 /*count*/, const Float* /*value*/)
+    {
+    }
+
+    void NullDevice::setConstant(DataFieldHandle /*field*/, UInt32 /*count*/, const Vector2* /*value*/)
+    {
+    }
+
+    void NullDevice::setConstant(DataFieldHandle /*field*/, UInt32 /*count*/, const Vector3* /*value*/)
+    {
+    }
+
+    void NullDevice::setConstant(DataFieldHandle /*field*/, UInt32 /*count*/, const Vector4* /*value*/)
+    {
+    }
+
+    void NullDevice::setConstant(DataFieldHandle /*field*/, UInt32 /*count*/, const Int32* /*value*/)
+    {
+    }
+
+    void NullDevice::setConstant(DataFieldHandle /*field*/, UInt32 /*count*/, const Vector2i* /*value*/)
+    {
+    }
+
+    void NullDevice::setConstant(DataFieldHandle /*field*/, UInt32 /*count*/, const Vector3i* /*value*/)
+    {
+    }
+
+    void NullDevice::setConstant(DataFieldHandle /*field*/, UInt32 /*count*/, const Vector4i* /*value*/)
+    {
+    }
+
+    void NullDevice::setConstant(DataFieldHandle /*field*/, UInt32 /*count*/, const Matrix22f* /*value*/)
+    {
+    }
+
+    void NullDevice::setConstant(DataFieldHandle /*field*/, UInt32 /*count*/, const Matrix33f* /*value*/)
+    {
+    }
+
+    void NullDevice::setConstant(DataFieldHandle /*field*/, UInt32 /*count*/, const Matrix44f* /*value*/)
+    {
+    }
+
+    void NullDevice::colorMask(Bool /*r*/, Bool /*g*/, Bool /*b*/, Bool /*a*/)
+    {
+    }
+
+    void NullDevice::clearColor(const Vector4& /*clearColor*/)
+    {
+    }
+
+    void NullDevice::blendOperations(EBlendOperation /*colorOperation*/, EBlendOperation /*alphaOperation*/)
+    {
+    }
+
+    void NullDevice::blendFactors(EBlendFactor /*sourceColor*/, EBlendFactor /*destinationColor*/, EBlendFactor /*sourceAlpha*/, EBlendFactor /*destinationAlpha*/)
+    {
+    }
+
+    void NullDevice::blendColor(const Vector4& /*color*/)
+    {
+    }
+
+    void NullDevice::cullMode(ECullMode /*mode*/)
+    {
+    }
+
+    void NullDevice::depthFunc(EDepthFunc /*func*/)
+    {
+    }
+
+    void NullDevice::depthWrite(EDepthWrite /*flag*/)
+    {
+    }
+
+    void NullDevice::scissorTest(EScissorTest /*flag*/, const RenderState::ScissorRegion& /*region*/)
+    {
+    }
+
+    void NullDevice::stencilFunc(EStencilFunc /*func*/, UInt8 /*ref*/, UInt8 /*mask*/)
+    {
+    }
+
+    void NullDevice::stencilOp(EStencilOp /*sfail*/, EStencilOp /*dpfail*/, EStencilOp /*dppass*/)
+    {
+    }
+
+    void NullDevice::drawMode(EDrawMode /*mode*/)
+    {
+    }
+
+    void NullDevice::setViewport(UInt32 /*x*/, UInt32 /*y*/, UInt32 /*width*/, UInt32 /*height*/)
+    {
+    }
+
+    void NullDevice::setTextureSampling(DataFieldHandle /*field*/, EWrapMethod /*wrapU*/, EWrapMethod /*wrapV*/, EWrapMethod /*wrapR*/, ESamplingMethod /*minSampling*/, ESamplingMethod /*magSampling*/, UInt32 /*anisotropyLevel*/)
+    {
+    }
+
+    DeviceResourceHandle NullDevice::allocateVertexBuffer(UInt32 /*totalSizeInBytes*/)
+    {
+        return allocateHandle();
+    }
+
+    void NullDevice::uploadVertexBufferData(DeviceResourceHandle /*handle*/, const Byte* /*data*/, UInt32 /*dataSize*/)
+    {
+    }
+
+    void NullDevice::deleteVertexBuffer(DeviceResourceHandle /*handle*/)
+    {
+    }
+
+    void NullDevice::activateVertexBuffer(DeviceResourceHandle /*handle*/, DataFieldHandle /*field*/, UInt32 /*instancingDivisor*/, UInt32 /*startVertex*/, EDataType /*bufferDataType*/, UInt16 /*offsetWithinElement*/, UInt16 /*stride*/)
+    {
+    }
+
+    DeviceResourceHandle NullDevice::allocateIndexBuffer(EDataType /*dataType*/, UInt32 /*sizeInBytes*/)
+    {
+        return allocateHandle();
+    }
+
+    void NullDevice::uploadIndexBufferData(DeviceResourceHandle /*handle*/, const Byte* /*data*/, UInt32 /*dataSize*/)
+    {
+    }
+
+    void NullDevice::deleteIndexBuffer(DeviceResourceHandle /*handle*/)
+    {
+    }
+
+    void NullDevice::activateIndexBuffer(DeviceResourceHandle /*handle*/)
+    {
+    }
+
+    DeviceResourceHandle NullDevice::uploadShader(const EffectResource& /*effect*/)
+    {
+        return allocateHandle();
+    }
+
+    DeviceResourceHandle NullDevice::uploadBinaryShader(const EffectResource& /*effect*/, const UInt8* /*binaryShaderData*/, UInt32 /*binaryShaderDataSize*/, BinaryShaderFormatID /*binaryShaderFormat*/)
+    {
+        return allocateHandle();
+    }
+
+    Bool NullDevice::getBinaryShader(DeviceResourceHandle /*handle*/, UInt8Vector& /*binaryShader*/, BinaryShaderFormatID& /*binaryShaderFormat*/)
+    {
+        return false;
+    }
+
+    void NullDevice::deleteShader(DeviceResourceHandle /*handle*/)
+    {
+    }
+
+    void NullDevice::activateShader(DeviceResourceHandle /*handle*/)
+    {
+    }
+
+    DeviceResourceHandle NullDevice::startShaderUpload(const EffectResource& /*effect*/)
+    {
+        return allocateHandle();
+    }
+
+    EShaderUploadStatus NullDevice::getShaderUploadStatus(DeviceResourceHandle /*handle*/)
+    {
+        return EShaderUploadStatus::Uploaded;
+    }
+
+    DeviceResourceHandle NullDevice::allocateTexture2D(UInt32 /*width*/, UInt32 /*height*/, ETextureFormat /*textureFormat*/, const TextureSwizzleArray& /*swizzle*/, UInt32 /*mipLevelCount*/, UInt32 /*totalSizeInBytes*/)
+    {
+        return allocateHandle();
+    }
+
+    DeviceResourceHandle NullDevice::allocateTexture3D(UInt32 /*width*/, UInt32 /*height*/, UInt32 /*depth*/, ETextureFormat /*textureFormat*/, UInt32 /*mipLevelCount*/, UInt32 /*dataSize*/)
+    {
+        return allocateHandle();
+    }
+
+    DeviceResourceHandle NullDevice::allocateTextureCube(UInt32 /*faceSize*/, ETextureFormat /*textureFormat*/, const TextureSwizzleArray& /*swizzle*/, UInt32 /*mipLevelCount*/, UInt32 /*dataSize*/)
+    {
+        return allocateHandle();
+    }
+
+    void NullDevice::bindTexture(DeviceResourceHandle /*handle*/)
+    {
+    }
+
+    void NullDevice::generateMipmaps(DeviceResourceHandle /*handle*/)
+    {
+    }
+
+    void NullDevice::uploadTextureData(DeviceResourceHandle /*handle*/, UInt32 /*mipLevel*/, UInt32 /*x*/, UInt32 /*y*/, UInt32 /*z*/, UInt32 /*width*/, UInt32 /*height*/, UInt32 /*depth*/, const Byte* /*data*/, UInt32 /*dataSize*/)
+    {
+    }
+
+    DeviceResourceHandle NullDevice::uploadStreamTexture2D(DeviceResourceHandle handle, UInt32 /*width*/, UInt32 /*height*/, ETextureFormat /*format*/, const UInt8* /*data*/, const TextureSwizzleArray& /*swizzle*/)
+    {
+        return handle;
+    }
+
+    void NullDevice::deleteTexture(DeviceResourceHandle /*handle*/)
+    {
+    }
+
+    void NullDevice::activateTexture(DeviceResourceHandle /*handle*/, DataFieldHandle /*field*/)
+    {
+    }
+
+    DeviceResourceHandle NullDevice::uploadRenderBuffer(const RenderBuffer& /*renderBuffer*/)
+    {
+        return allocateHandle();
+    }
+
+    void NullDevice::deleteRenderBuffer(DeviceResourceHandle /*handle*/)
+    {
+    }
+
+    DeviceResourceHandle NullDevice::uploadTextureSampler(EWrapMethod /*wrapU*/, EWrapMethod /*wrapV*/, EWrapMethod /*wrapR*/, ESamplingMethod /*minSampling*/, ESamplingMethod /*magSampling*/, UInt32 /*anisotropyLevel*/)
+    {
+        return allocateHandle();
+    }
+
+    void NullDevice::deleteTextureSampler(DeviceResourceHandle /*handle*/)
+    {
+    }
+
+    void NullDevice::activateTextureSampler(DeviceResourceHandle /*handle*/, DataFieldHandle /*field*/)
+    {
+    }
+
+    DeviceResourceHandle NullDevice::getFramebufferRenderTarget() const
+    {
+        return DeviceResourceHandle(0u);
+    }
+
+    DeviceResourceHandle NullDevice::uploadRenderTarget(const DeviceHandleVector& /*renderBuffers*/)
+    {
+        return allocateHandle();
+    }
+
+    void NullDevice::activateRenderTarget(DeviceResourceHandle /*handle*/)
+    {
+    }
+
+    void NullDevice::deleteRenderTarget(DeviceResourceHandle /*handle*/)
+    {
+    }
+
+    void NullDevice::blitRenderTargets(DeviceResourceHandle /*rtSrc*/, DeviceResourceHandle /*rtDst*/, const PixelRectangle& /*srcRect*/, const PixelRectangle& /*dstRect*/, Bool /*colorOnly*/)
+    {
+    }
+
+    void NullDevice::drawIndexedTriangles(Int32 /*startOffset*/, Int32 /*elementCount*/, UInt32 /*instanceCount*/)
+    {
+        ++m_drawCallCount;
+    }
+
+    void NullDevice::drawTriangles(Int32 /*startOffset*/, Int32 /*elementCount*/, UInt32 /*instanceCount*/)
+    {
+        ++m_drawCallCount;
+    }
+
+    void NullDevice::clear(UInt32 /*clearFlags*/)
+    {
+    }
+
+    void NullDevice::pairRenderTargetsForDoubleBuffering(DeviceResourceHandle /*renderTargets*/[2], DeviceResourceHandle /*colorBuffers*/[2])
+    {
+    }
+
+    void NullDevice::unpairRenderTargets(DeviceResourceHandle /*renderTarget*/)
+    {
+    }
+
+    void NullDevice::swapDoubleBufferedRenderTarget(DeviceResourceHandle /*renderTarget*/)
+    {
+    }
+
+    void NullDevice::readPixels(UInt8* /*buffer*/, UInt32 /*x*/, UInt32 /*y*/, UInt32 /*width*/, UInt32 /*height*/)
+    {
+    }
+
+    Bool NullDevice::isGpuTimerQuerySupported() const
+    {
+        return false;
+    }
+
+    DeviceResourceHandle NullDevice::allocateGpuTimerQuery()
+    {
+        return allocateHandle();
+    }
+
+    void NullDevice::deleteGpuTimerQuery(DeviceResourceHandle /*handle*/)
+    {
+    }
+
+    void NullDevice::issueGpuTimestamp(DeviceResourceHandle /*handle*/)
+    {
+    }
+
+    Bool NullDevice::getGpuTimestamp(DeviceResourceHandle /*handle*/, UInt64& /*timestampNs*/)
+    {
+        return false;
+    }
+
+    Bool NullDevice::checkAndResetGpuTimerDisjoint()
+    {
+        return false;
+    }
+
+    UInt32 NullDevice::getTotalGpuMemoryUsageInKB() const
+    {
+        return 0u;
+    }
+
+    UInt32 NullDevice::getDrawCallCount() const
+    {
+        return m_drawCallCount;
+    }
+
+    void NullDevice::resetDrawCallCount()
+    {
+        m_drawCallCount = 0u;
+    }
+
+    void NullDevice::clearDepth(Float /*d*/)
+    {
+    }
+
+    void NullDevice::clearStencil(Int32 /*s*/)
+    {
+    }
+
+    Int32 NullDevice::getTextureAddress(DeviceResourceHandle /*handle*/) const
+    {
+        return 0;
+    }
+
+    void NullDevice::validateDeviceStatusHealthy() const
+    {
+    }
+
+    Bool NullDevice::isDeviceStatusHealthy() const
+    {
+        return true;
+    }
+
+    void NullDevice::getSupportedBinaryProgramFormats(std::vector<BinaryShaderFormatID>& /*formats*/) const
+    {
+    }
+
+    void NullDevice::finish()
+    {
+    }
+}
@@ -0,0 +1,207 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2020 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "BenchmarkRunner.h"
+#include "SyntheticScene.h"
+#include "NullDevice.h"
+#include "RenderExecutor.h"
+#include "RendererEventCollector.h"
+#include "RendererLib/RendererScenes.h"
+#include "RendererLib/RendererCachedScene.h"
+#include "RendererLib/IResourceDeviceHandleAccessor.h"
+#include "RendererAPI/IEmbeddedCompositingManager.h"
+#include "Scene/ActionCollectingScene.h"
+#include "Scene/SceneActionApplier.h"
+#include <cstdio>
+
+using namespace ramses_internal;
+
+namespace
+{
+    // every resource is uploaded, every lookup gives the same valid handle
+    class UploadedResourceAccessor : public IResourceDeviceHandleAccessor
+    {
+    public:
+        virtual DeviceResourceHandle getResourceDeviceHandle(const ResourceContentHash& /*resourceHash*/) const override { return ValidHandle; }
+        virtual DeviceResourceHandle getRenderTargetDeviceHandle(RenderTargetHandle /*targetHandle*/, SceneId /*sceneId*/) const override { return ValidHandle; }
+        virtual DeviceResourceHandle getRenderTargetBufferDeviceHandle(RenderBufferHandle /*bufferHandle*/, SceneId /*sceneId*/) const override { return ValidHandle; }
+        virtual void getBlitPassRenderTargetsDeviceHandle(BlitPassHandle /*blitPassHandle*/, SceneId /*sceneId*/, DeviceResourceHandle& srcRT, DeviceResourceHandle& dstRT) const override { srcRT = ValidHandle; dstRT = ValidHandle; }
+        virtual DeviceResourceHandle getOffscreenBufferDeviceHandle(OffscreenBufferHandle /*bufferHandle*/) const override { return ValidHandle; }
+        virtual DeviceResourceHandle getOffscreenBufferColorBufferDeviceHandle(OffscreenBufferHandle /*bufferHandle*/) const override { return ValidHandle; }
+        virtual OffscreenBufferHandle getOffscreenBufferHandle(DeviceResourceHandle /*bufferDeviceHandle*/) const override { return OffscreenBufferHandle::Invalid(); }
+        virtual DeviceResourceHandle getStreamBufferDeviceHandle(StreamBufferHandle /*bufferHandle*/) const override { return ValidHandle; }
+        virtual DeviceResourceHandle getDataBufferDeviceHandle(DataBufferHandle /*dataBufferHandle*/, SceneId /*sceneId*/) const override { return ValidHandle; }
+        virtual DeviceResourceHandle getTextureBufferDeviceHandle(TextureBufferHandle /*textureBufferHandle*/, SceneId /*sceneId*/) const override { return ValidHandle; }
+        virtual DeviceResourceHandle getTextureSamplerDeviceHandle(TextureSamplerHandle /*textureSamplerHandle*/, SceneId /*sceneId*/) const override { return ValidHandle; }
+
+    private:
+        static constexpr DeviceResourceHandle ValidHandle{ 1u };
+    };
+
+    class NullEmbeddedCompositingManager : public IEmbeddedCompositingManager
+    {
+    public:
+        virtual void refStream(StreamTextureHandle /*handle*/, WaylandIviSurfaceId /*source*/, SceneId /*sceneId*/) override {}
+        virtual void unrefStream(StreamTextureHandle /*handle*/, WaylandIviSurfaceId /*source*/, SceneId /*sceneId*/) override {}
+        virtual void refStream(WaylandIviSurfaceId /*source*/) override {}
+        virtual void unrefStream(WaylandIviSurfaceId /*source*/) override {}
+        virtual void dispatchStateChangesOfStreamTexturesAndSources(SceneStreamTextures& /*streamTexturesWithStateChange*/, WaylandIviSurfaceIdVector& /*newStreams*/, WaylandIviSurfaceIdVector& /*obsoleteStreams*/) override {}
+        virtual void processClientRequests() override {}
+        virtual Bool hasUpdatedContentFromStreamSourcesToUpload() const override { return false; }
+        virtual void uploadResourcesAndGetUpdates(UpdatedSceneIdSet& /*updatedScenes*/, StreamTextureBufferUpdates& /*bufferUpdates*/) override {}
+        virtual void notifyClients() override {}
+        virtual DeviceResourceHandle getCompositedTextureDeviceHandleForStreamTexture(WaylandIviSurfaceId /*source*/) const override { return DeviceResourceHandle::Invalid(); }
+        virtual Bool hasRealCompositor() const override { return false; }
+    };
+
+    // Renderer side of a scene: flushes of synthetic client scene are applied on renderer scene,
+    // caches updated and scene rendered to null device, all as the renderer does it every frame.
+    class RendererSceneBenchmark
+    {
+    public:
+        explicit RendererSceneBenchmark(const SyntheticSceneConfig& config)
+            : m_rendererScenes(m_eventCollector)
+        {
+            ActionCollectingScene clientScene;
+            m_content = SyntheticScene::Create(clientScene, config);
+            m_creationActions = clientScene.getSceneActionCollection().copy();
+            clientScene.getSceneActionCollection().clear();
+            SyntheticScene::Animate(clientScene, m_content, 1u);
+            m_animationActions = clientScene.getSceneActionCollection().copy();
+            m_sizeInformation = clientScene.getSceneSizeInformation();
+
+            recreateScene();
+        }
+
+        void resetScene()
+        {
+            if (m_scene)
+                m_rendererScenes.destroyScene(SceneId(1u));
+            m_scene = &m_rendererScenes.createScene(SceneInfo(SceneId(1u)));
+            // renderer scenes use explicit memory pools, sized up front as the renderer does from flush size info
+            m_scene->preallocateSceneSize(m_sizeInformation);
+        }
+
+        void recreateScene()
+        {
+            resetScene();
+            applyCreationActions();
+        }
+
+        void applyCreationActions()
+        {
+            SceneActionApplier::ApplyActionsOnScene(*m_scene, m_creationActions);
+        }
+
+        void applyAnimationActions()
+        {
+            SceneActionApplier::ApplyActionsOnScene(*m_scene, m_animationActions);
+        }
+
+        void updateCaches()
+        {
+            m_scene->updateRenderablesAndResourceCache(m_resourceAccessor, m_embeddedCompositingManager);
+            m_scene->updateRenderableWorldMatrices();
+        }
+
+        void render()
+        {
+            const RenderExecutor executor(m_device, { m_device.getFramebufferRenderTarget(), 1280u, 480u });
+            executor.executeScene(*m_scene);
+        }
+
+        UInt32 getAndResetDrawCallCount()
+        {
+            const UInt32 drawCalls = m_device.getDrawCallCount();
+            m_device.resetDrawCallCount();
+            return drawCalls;
+        }
+
+        UInt32 getNumberOfCreationActions() const
+        {
+            return m_creationActions.numberOfActions();
+        }
+
+        UInt32 getNumberOfAnimationActions() const
+        {
+            return m_animationActions.numberOfActions();
+        }
+
+    private:
+        SyntheticSceneContent m_content;
+        SceneActionCollection m_creationActions;
+        SceneActionCollection m_animationActions;
+        SceneSizeInformation m_sizeInformation;
+
+        RendererEventCollector m_eventCollector;
+        RendererScenes m_rendererScenes;
+        RendererCachedScene* m_scene = nullptr;
+
+        NullDevice m_device;
+        UploadedResourceAccessor m_resourceAccessor;
+        NullEmbeddedCompositingManager m_embeddedCompositingManager;
+    };
+
+    constexpr DeviceResourceHandle UploadedResourceAccessor::ValidHandle;
+}
+
+int main(int argc, const char* argv[])
+{
+    BenchmarkRunner runner("ramses-renderer-benchmarks", argc, argv);
+
+    SyntheticSceneConfig config;
+    config.renderableCount = 1000u * runner.getScale();
+    config.renderPassCount = 4u;
+    const UInt64 renderableCount = config.renderableCount;
+
+    RendererSceneBenchmark benchmark(config);
+    benchmark.updateCaches();
+    benchmark.render();
+    if (benchmark.getAndResetDrawCallCount() != config.renderableCount)
+    {
+        std::printf("synthetic scene was not rendered completely\n");
+        return 1;
+    }
+
+    runner.run("RendererScene/applyCreationActions", benchmark.getNumberOfCreationActions(), [&]() { benchmark.resetScene(); }, [&]()
+    {
+        benchmark.applyCreationActions();
+    });
+
+    benchmark.recreateScene();
+    runner.run("RendererScene/initialCacheUpdate", renderableCount, [&]() { benchmark.recreateScene(); }, [&]()
+    {
+        benchmark.updateCaches();
+    });
+
+    runner.run("RendererScene/applyAnimationActions", benchmark.getNumberOfAnimationActions(), [&]()
+    {
+        benchmark.applyAnimationActions();
+    });
+
+    runner.run("RendererScene/animatedCacheUpdate", renderableCount, [&]() { benchmark.applyAnimationActions(); }, [&]()
+    {
+        benchmark.updateCaches();
+    });
+
+    benchmark.updateCaches();
+    runner.run("RenderExecutor/executeScene", renderableCount, [&]()
+    {
+        benchmark.render();
+    });
+
+    // whole renderer CPU cost of an animated frame of the scene
+    runner.run("RendererFrame/animatedScene", renderableCount, [&]()
+    {
+        benchmark.applyAnimationActions();
+        benchmark.updateCaches();
+        benchmark.render();
+    });
+
+    return runner.finish();
+}
@@ -207,6 +207,44 @@ namespace ramses_internal
         testDevice->deleteShader(handle);
     }
 
+    TEST_F(ADevice, CreatesShaderFromEffectWithoutBlocking)
+    {
+        ASSERT_TRUE(testDevice != nullptr);
+
+        const std::unique_ptr<EffectResource> testEffect(CreateTestEffectResource());
+        const DeviceResourceHandle handle = testDevice->startShaderUpload(*testEffect);
+        ASSERT_TRUE(handle.isValid());
+
+        EShaderUploadStatus status = testDevice->getShaderUploadStatus(handle);
+        while (status == EShaderUploadStatus::Pending)
+            status = testDevice->getShaderUploadStatus(handle);
+        EXPECT_EQ(EShaderUploadStatus::Uploaded, status);
+
+        testDevice->deleteShader(handle);
+    }
+
+    TEST_F(ADevice, ReportsFailureOfNonBlockingUploadOfEffectWithInvalidVertexShader)
+    {
+        const std::unique_ptr<EffectResource> templateEffect(CreateTestEffectResource());
+        const EffectResource invalidEffect(
+            "--this is some invalide shader source code--",
+            templateEffect->getFragmentShader(),
+            "",
+            templateEffect->getUniformInputs(),
+            templateEffect->getAttributeInputs(),
+            "invalid effect", ResourceCacheFlag_DoNotCache);
+        const DeviceResourceHandle handle = testDevice->startShaderUpload(invalidEffect);
+
+        // device without parallel compilation fails already when starting upload
+        if (handle.isValid())
+        {
+            EShaderUploadStatus status = testDevice->getShaderUploadStatus(handle);
+            while (status == EShaderUploadStatus::Pending)
+                status = testDevice->getShaderUploadStatus(handle);
+            EXPECT_EQ(EShaderUploadStatus::Failed, status);
+        }
+    }
+
     TEST_F(ADevice, RefusesToUploadEffectWithInvalidVertexShader)
     {
         const std::unique_ptr<EffectResource> templateEffect(CreateTestEffectResource());
@@ -0,0 +1,180 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2020 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "ramses-client.h"
+#include "ramses-framework-api/RamsesFramework.h"
+#include "ramses-renderer-api/RamsesRenderer.h"
+#include "ramses-renderer-api/RendererConfig.h"
+#include "ramses-renderer-api/RendererSceneControl.h"
+#include "ramses-renderer-api/IRendererSceneControlEventHandler.h"
+#include "Utils/CommandLineParser.h"
+#include "Utils/Argument.h"
+#include "PlatformAbstraction/PlatformTime.h"
+#include <thread>
+#include <atomic>
+#include <vector>
+#include <memory>
+#include <cstdio>
+
+using namespace ramses_internal;
+
+namespace
+{
+    class SubscriptionCounter : public ramses::RendererSceneControlEventHandlerEmpty
+    {
+    public:
+        virtual void sceneStateChanged(ramses::sceneId_t, ramses::RendererSceneState state) override
+        {
+            if (state == ramses::RendererSceneState::Available)
+                ++subscribedScenes;
+        }
+
+        UInt32 subscribedScenes = 0u;
+    };
+
+    // Renderer in its own framework subscribing all scenes remotely, so that flushes are
+    // also serialized and sent to a subscriber instead of only being applied locally.
+    class RemoteSubscriber
+    {
+    public:
+        RemoteSubscriber(int argc, const char* argv[])
+            : m_framework(ramses::RamsesFrameworkConfig(argc, argv))
+            , m_renderer(*m_framework.createRenderer(ramses::RendererConfig(argc, argv)))
+        {
+            m_framework.connect();
+        }
+
+        ~RemoteSubscriber()
+        {
+            m_renderer.stopThread();
+            m_framework.disconnect();
+        }
+
+        bool subscribe(UInt32 sceneCount)
+        {
+            ramses::RendererSceneControl& sceneControl = *m_renderer.getSceneControlAPI();
+            for (UInt32 i = 0u; i < sceneCount; ++i)
+                sceneControl.setSceneState(ramses::sceneId_t(i + 1u), ramses::RendererSceneState::Available);
+            sceneControl.flush();
+            m_renderer.startThread();
+
+            SubscriptionCounter counter;
+            const UInt64 timeout = PlatformTime::GetMillisecondsMonotonic() + 10000u;
+            while (counter.subscribedScenes < sceneCount && PlatformTime::GetMillisecondsMonotonic() < timeout)
+            {
+                sceneControl.dispatchEvents(counter);
+                std::this_thread::sleep_for(std::chrono::milliseconds(10));
+            }
+            return counter.subscribedScenes == sceneCount;
+        }
+
+    private:
+        ramses::RamsesFramework m_framework;
+        ramses::RamsesRenderer& m_renderer;
+    };
+
+    // Every thread owns one scene and flushes it as fast as possible. Scenes are independent,
+    // so flush throughput should scale with the number of threads as long as the client does
+    // not serialize flushes of different scenes.
+    UInt64 RunFlushThreads(UInt32 threadCount, UInt32 durationMs, UInt32 nodesPerScene, UInt32 resourceEveryNthFlush, UInt32 remoteSubscriberCount, int argc, const char* argv[])
+    {
+        ramses::RamsesFramework framework(ramses::RamsesFrameworkConfig(argc, argv));
+        ramses::RamsesClient& client = *framework.createClient("flush-stress-test");
+        if (remoteSubscriberCount > 0u)
+            framework.connect();
+
+        std::vector<ramses::Scene*> scenes;
+        for (UInt32 i = 0u; i < threadCount; ++i)
+        {
+            ramses::Scene* scene = client.createScene(ramses::sceneId_t(i + 1u));
+            scene->flush();
+            scene->publish(remoteSubscriberCount > 0u ? ramses::EScenePublicationMode_LocalAndRemote : ramses::EScenePublicationMode_LocalOnly);
+            scenes.push_back(scene);
+        }
+
+        std::vector<std::unique_ptr<RemoteSubscriber>> subscribers;
+        for (UInt32 i = 0u; i < remoteSubscriberCount; ++i)
+        {
+            subscribers.push_back(std::make_unique<RemoteSubscriber>(argc, argv));
+            if (!subscribers.back()->subscribe(threadCount))
+                std::printf("remote subscriber %u failed to subscribe all scenes\n", i);
+        }
+
+        std::atomic<UInt64> totalFlushes{ 0u };
+        std::atomic<bool> start{ false };
+        std::vector<std::thread> threads;
+        for (UInt32 i = 0u; i < threadCount; ++i)
+        {
+            threads.emplace_back([&, i]()
+            {
+                ramses::Scene& scene = *scenes[i];
+                std::vector<ramses::Node*> nodes;
+                for (UInt32 n = 0u; n < nodesPerScene; ++n)
+                    nodes.push_back(scene.createNode());
+
+                while (!start)
+                    std::this_thread::yield();
+
+                const UInt64 endTime = PlatformTime::GetMillisecondsMonotonic() + durationMs;
+                UInt64 flushes = 0u;
+                while (PlatformTime::GetMillisecondsMonotonic() < endTime)
+                {
+                    const float value = static_cast<float>(flushes % 100u);
+                    for (auto node : nodes)
+                        node->setTranslation(value, 0.f, 0.f);
+
+                    if (resourceEveryNthFlush != 0u && flushes % resourceEveryNthFlush == 0u)
+                    {
+                        const float data[] = { value, static_cast<float>(i), 1.f, 2.f };
+                        ramses::ArrayResource* resource = scene.createArrayResource(ramses::EDataType::Float, 4u, data);
+                        scene.destroy(*resource);
+                    }
+
+                    scene.flush();
+                    ++flushes;
+                }
+                totalFlushes += flushes;
+            });
+        }
+
+        start = true;
+        for (auto& thread : threads)
+            thread.join();
+
+        subscribers.clear();
+        for (auto scene : scenes)
+            client.destroy(*scene);
+        framework.destroyClient(client);
+
+        return totalFlushes;
+    }
+}
+
+int main(int argc, const char* argv[])
+{
+    CommandLineParser parser(argc, argv);
+    const UInt32 maxThreads             = ArgumentUInt32(parser, "t"    , "max-threads"                 , 8);
+    const UInt32 durationEachRun        = ArgumentUInt32(parser, "dur"  , "duration-each-run-ms"        , 3000);
+    const UInt32 nodesPerScene          = ArgumentUInt32(parser, "n"    , "nodes-per-scene"             , 100);
+    const UInt32 resourceEveryNthFlush  = ArgumentUInt32(parser, "res"  , "resource-every-nth-flush"    , 10);
+    // remote subscribers need the communication daemon running, same as for any other remote connection
+    const UInt32 remoteSubscribers      = ArgumentUInt32(parser, "rs"   , "remote-subscribers"          , 1);
+
+    Float singleThreadRate = 0.f;
+    for (UInt32 threadCount = 1u; threadCount <= maxThreads; threadCount *= 2u)
+    {
+        const UInt64 flushes = RunFlushThreads(threadCount, durationEachRun, nodesPerScene, resourceEveryNthFlush, remoteSubscribers, argc, argv);
+        const Float rate = static_cast<Float>(flushes) * 1000.f / static_cast<Float>(durationEachRun);
+        if (threadCount == 1u)
+            singleThreadRate = rate;
+        const Float speedup = singleThreadRate > 0.f ? rate / singleThreadRate : 0.f;
+        std::printf("threads: %2u  flushes/s: %10.1f  speedup: %5.2fx\n", threadCount, rate, speedup);
+    }
+
+    return 0;
+}
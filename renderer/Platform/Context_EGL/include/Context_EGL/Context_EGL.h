@@ -10,6 +10,7 @@
 #define RAMSES_CONTEXT_EGL_H
 
 #include <EGL/egl.h>
+#include <EGL/eglext.h>
 
 #undef Bool // Xlib.h (included from EGL/egl.h) defines Bool as int - this collides with ramses_internal::Bool
 #undef Status
@@ -62,11 +63,17 @@ namespace ramses_internal
         bool enable() override final;
         bool disable() override final;
 
+        UInt32 getBufferAge() const override final;
+        bool setDamageRegion(const Viewport& region) override final;
+        bool swapBuffersWithDamage(const Viewport& region) override final;
+
         void* getProcAddress(const char* name) const override;
 
         EGLDisplay getEglDisplay() const;
 
     private:
+        void initPartialUpdateExtensions();
+
         EglSurfaceData m_eglSurfaceData;
         Generic_EGLNativeDisplayType m_nativeDisplay;
         Generic_EGLNativeWindowType m_nativeWindow;
@@ -74,6 +81,10 @@ namespace ramses_internal
         const EGLint* m_surfaceAttributes;
         const EGLint* m_windowSurfaceAttributes;
         const EGLint m_swapInterval;
+
+        Bool m_bufferAgeSupported = false;
+        PFNEGLSETDAMAGEREGIONKHRPROC m_eglSetDamageRegion = nullptr;
+        PFNEGLSWAPBUFFERSWITHDAMAGEKHRPROC m_eglSwapBuffersWithDamage = nullptr;
     };
 
 }
@@ -7,6 +7,7 @@
 //  -------------------------------------------------------------------------
 
 #include "Context_EGL/Context_EGL.h"
+#include "SceneAPI/Viewport.h"
 #include "Utils/LogMacros.h"
 
 namespace ramses_internal
@@ -117,6 +118,8 @@ namespace ramses_internal
         LOG_DEBUG(CONTEXT_RENDERER, "Context_EGL::init(): Setting egl swap interval to :" << m_swapInterval);
         eglSwapInterval(m_eglSurfaceData.eglDisplay, m_swapInterval);
 
+        initPartialUpdateExtensions();
+
         LOG_INFO(CONTEXT_RENDERER, "Context_EGL::init(): EGL context creation succeeded");
         return true;
     }
@@ -159,6 +162,67 @@ namespace ramses_internal
         return true;
     }
 
+    UInt32 Context_EGL::getBufferAge() const
+    {
+        if (!m_bufferAgeSupported)
+            return 0u;
+
+        EGLint bufferAge = 0;
+        if (!eglQuerySurface(m_eglSurfaceData.eglDisplay, m_eglSurfaceData.eglSurface, EGL_BUFFER_AGE_EXT, &bufferAge))
+        {
+            LOG_ERROR(CONTEXT_RENDERER, "Context_EGL::getBufferAge eglQuerySurface() failed. Error code: " << eglGetError());
+            return 0u;
+        }
+
+        return static_cast<UInt32>(bufferAge);
+    }
+
+    bool Context_EGL::setDamageRegion(const Viewport& region)
+    {
+        if (m_eglSetDamageRegion == nullptr)
+            return false;
+
+        EGLint rect[] = { region.posX, region.posY, static_cast<EGLint>(region.width), static_cast<EGLint>(region.height) };
+        if (!m_eglSetDamageRegion(m_eglSurfaceData.eglDisplay, m_eglSurfaceData.eglSurface, rect, 1))
+        {
+            LOG_ERROR(CONTEXT_RENDERER, "Context_EGL::setDamageRegion eglSetDamageRegionKHR() failed. Error code: " << eglGetError());
+            return false;
+        }
+
+        return true;
+    }
+
+    bool Context_EGL::swapBuffersWithDamage(const Viewport& region)
+    {
+        if (m_eglSwapBuffersWithDamage == nullptr)
+            return swapBuffers();
+
+        LOG_TRACE(CONTEXT_RENDERER, "Context_EGL swapping buffers with damage");
+        const EGLint rect[] = { region.posX, region.posY, static_cast<EGLint>(region.width), static_cast<EGLint>(region.height) };
+        m_eglSwapBuffersWithDamage(m_eglSurfaceData.eglDisplay, m_eglSurfaceData.eglSurface, rect, 1);
+        return true;
+    }
+
+    void Context_EGL::initPartialUpdateExtensions()
+    {
+        // buffer age is required to know which part of back buffer is outdated, both other extensions are optional hints
+        m_bufferAgeSupported = m_contextExtensions.contains("EGL_EXT_buffer_age") || m_contextExtensions.contains("EGL_KHR_partial_update");
+        if (!m_bufferAgeSupported)
+            return;
+
+        if (m_contextExtensions.contains("EGL_KHR_partial_update"))
+            m_eglSetDamageRegion = reinterpret_cast<PFNEGLSETDAMAGEREGIONKHRPROC>(eglGetProcAddress("eglSetDamageRegionKHR"));
+
+        // KHR and EXT variants have same signature and semantics
+        if (m_contextExtensions.contains("EGL_KHR_swap_buffers_with_damage"))
+            m_eglSwapBuffersWithDamage = reinterpret_cast<PFNEGLSWAPBUFFERSWITHDAMAGEKHRPROC>(eglGetProcAddress("eglSwapBuffersWithDamageKHR"));
+        else if (m_contextExtensions.contains("EGL_EXT_swap_buffers_with_damage"))
+            m_eglSwapBuffersWithDamage = reinterpret_cast<PFNEGLSWAPBUFFERSWITHDAMAGEKHRPROC>(eglGetProcAddress("eglSwapBuffersWithDamageEXT"));
+
+        LOG_INFO(CONTEXT_RENDERER, "Context_EGL::init(): partial update support: buffer age yes, set damage region " << (m_eglSetDamageRegion != nullptr)
+            << ", swap with damage " << (m_eglSwapBuffersWithDamage != nullptr));
+    }
+
     Bool Context_EGL::enable()
     {
         assert (m_eglSurfaceData.eglDisplay);
@@ -13,6 +13,8 @@
 #include "Platform_Base/DeviceResourceMapper.h"
 #include "Types_GL.h"
 #include "DebugOutput.h"
+#include "TimerQuery_GL.h"
+#include "Collections/HashMap.h"
 
 namespace ramses_internal
 {
@@ -68,6 +70,13 @@ namespace ramses_internal
 
         virtual void readPixels(UInt8* buffer, UInt32 x, UInt32 y, UInt32 width, UInt32 height) override;
 
+        virtual Bool                    isGpuTimerQuerySupported() const override;
+        virtual DeviceResourceHandle    allocateGpuTimerQuery() override;
+        virtual void                    deleteGpuTimerQuery(DeviceResourceHandle handle) override;
+        virtual void                    issueGpuTimestamp(DeviceResourceHandle handle) override;
+        virtual Bool                    getGpuTimestamp(DeviceResourceHandle handle, UInt64& timestampNs) override;
+        virtual Bool                    checkAndResetGpuTimerDisjoint() override;
+
         virtual DeviceResourceHandle    allocateVertexBuffer  (UInt32 totalSizeInBytes) override;
         virtual void                    uploadVertexBufferData(DeviceResourceHandle handle, const Byte* data, UInt32 dataSize) override;
         virtual void                    deleteVertexBuffer    (DeviceResourceHandle handle) override;
@@ -83,6 +92,8 @@ namespace ramses_internal
         virtual Bool                    getBinaryShader     (DeviceResourceHandle handleconst, UInt8Vector& binaryShader, BinaryShaderFormatID& binaryShaderFormat) override;
         virtual void                    deleteShader        (DeviceResourceHandle handle) override;
         virtual void                    activateShader      (DeviceResourceHandle handle) override;
+        virtual DeviceResourceHandle    startShaderUpload   (const EffectResource& effect) override;
+        virtual EShaderUploadStatus     getShaderUploadStatus(DeviceResourceHandle handle) override;
 
         virtual DeviceResourceHandle    allocateTexture2D   (UInt32 width, UInt32 height, ETextureFormat textureFormat, const TextureSwizzleArray& swizzle, UInt32 mipLevelCount, UInt32 totalSizeInBytes) override;
         virtual DeviceResourceHandle    allocateTexture3D   (UInt32 width, UInt32 height, UInt32 depth, ETextureFormat textureFormat, UInt32 mipLevelCount, UInt32 totalSizeInBytes) override;
@@ -144,7 +155,16 @@ namespace ramses_internal
         const UInt8                 m_minorApiVersion;
         const bool                  m_isEmbedded;
         DebugOutput                 m_debugOutput;
+        TimerQuery_GL               m_timerQuery;
         StringSet                   m_apiExtensions;
+        Bool                        m_parallelShaderCompileSupported = false;
+
+        struct PendingShaderUpload
+        {
+            const EffectResource* effect;
+            ShaderGPUResource_GL* resource;
+        };
+        HashMap<DeviceResourceHandle, PendingShaderUpload> m_pendingShaderUploads;
         std::vector<GLint>          m_supportedBinaryProgramFormats;
 
         Bool getUniformLocation(DataFieldHandle field, GLInputLocation& location) const;
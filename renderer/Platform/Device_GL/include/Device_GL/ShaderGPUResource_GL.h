@@ -32,6 +32,8 @@ namespace ramses_internal
     {
     public:
         ShaderGPUResource_GL(const EffectResource& effect, ShaderProgramInfo shaderProgramInfo);
+        // variable locations are not loaded, program may still be compiling
+        explicit ShaderGPUResource_GL(ShaderProgramInfo shaderProgramInfo);
         ~ShaderGPUResource_GL();
 
         GLInputLocation     getUniformLocation(DataFieldHandle) const;
@@ -39,9 +41,11 @@ namespace ramses_internal
         TextureSlotInfo     getTextureSlot(DataFieldHandle) const;
 
         bool                getBinaryInfo(UInt8Vector& binaryShader, BinaryShaderFormatID& binaryShaderFormat) const;
+        const ShaderProgramInfo& getProgramInfo() const;
 
-    private:
         void                preloadVariableLocations(const EffectResource& effect);
+
+    private:
         GLInputLocation     loadUniformLocation(const EffectResource& effect, const EffectInputInformation& input) const;
         GLInputLocation     loadAttributeLocation(const EffectResource& effect, const EffectInputInformation& input) const;
 
@@ -66,6 +70,13 @@ namespace ramses_internal
         preloadVariableLocations(effect);
     }
 
+    inline
+    ShaderGPUResource_GL::ShaderGPUResource_GL(ShaderProgramInfo shaderProgramInfo)
+        : ShaderGPUResource(shaderProgramInfo.shaderProgramHandle)
+        , m_shaderProgramInfo(shaderProgramInfo)
+    {
+    }
+
     inline
     ShaderGPUResource_GL::~ShaderGPUResource_GL()
     {
@@ -87,6 +98,16 @@ namespace ramses_internal
         {
             glDeleteShader(m_shaderProgramInfo.fragmentShaderHandle);
         }
+
+        if (0 != m_shaderProgramInfo.geometryShaderHandle)
+        {
+            glDeleteShader(m_shaderProgramInfo.geometryShaderHandle);
+        }
+    }
+
+    inline const ShaderProgramInfo& ShaderGPUResource_GL::getProgramInfo() const
+    {
+        return m_shaderProgramInfo;
     }
 
     inline GLInputLocation ShaderGPUResource_GL::getUniformLocation(DataFieldHandle field) const
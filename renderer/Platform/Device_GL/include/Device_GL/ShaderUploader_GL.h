@@ -24,8 +24,17 @@ namespace ramses_internal
         static Bool UploadShaderProgramFromSource(const EffectResource& effect, ShaderProgramInfo& programShaderInfoOut, String& debugErrorLog);
         static Bool UploadShaderProgramFromBinary(const UInt8* binaryShaderData, UInt32 binaryShaderDataSize, BinaryShaderFormatID binaryShaderFormat, ShaderProgramInfo& programShaderInfoOut, String& debugErrorLog);
 
+        // Compile and link are only submitted without querying their status, so that driver can process them in parallel
+        // (KHR_parallel_shader_compile). Upload is finished once completion status of program is set, on failure
+        // all handles in program info have to be deleted by caller.
+        static Bool StartShaderProgramUploadFromSource(const EffectResource& effect, ShaderProgramInfo& programShaderInfoOut, String& debugErrorLog);
+        static Bool IsShaderProgramUploadCompleted(const ShaderProgramInfo& programShaderInfo);
+        static Bool FinishShaderProgramUploadFromSource(const EffectResource& effect, const ShaderProgramInfo& programShaderInfo, String& debugErrorLog);
+
     private:
         static GLHandle CompileShaderStage(const char* stageSource, GLenum shaderType, String& errorLogOut);
+        static GLHandle SubmitShaderStage(const char* stageSource, GLenum shaderType);
+        static Bool CheckShaderStageCompileStatus(GLHandle shaderHandle, const char* stageSource, String& errorLogOut);
         static Bool CheckShaderProgramLinkStatus(GLHandle shaderProgram, String& errorLogOut);
         static void PrintShaderSourceWithLineNumbers(const String& source);
     };
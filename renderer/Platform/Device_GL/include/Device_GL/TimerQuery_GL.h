@@ -0,0 +1,53 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2020 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#ifndef RAMSES_TIMERQUERY_GL_H
+#define RAMSES_TIMERQUERY_GL_H
+
+#include "PlatformAbstraction/PlatformTypes.h"
+#include "Device_GL/Device_GL_platform.h"
+
+namespace ramses_internal
+{
+    class IContext;
+
+    // GPU timestamp queries, GL_EXT_disjoint_timer_query on embedded GL and GL_ARB_timer_query (core since 3.3) on desktop GL
+    class TimerQuery_GL
+    {
+    public:
+        Bool load(const IContext& context, Bool extensionAvailable, Bool isEmbedded);
+        Bool isAvailable() const;
+
+        GLuint generateQuery() const;
+        void deleteQuery(GLuint query) const;
+        void queryTimestamp(GLuint query) const;
+        Bool getTimestamp(GLuint query, UInt64& timestampNs) const;
+        Bool checkAndResetDisjoint() const;
+
+    private:
+#if defined(__linux__) || defined(__ghs__)
+        PFNGLGENQUERIESEXTPROC          glGenQueriesTimer       = nullptr;
+        PFNGLDELETEQUERIESEXTPROC       glDeleteQueriesTimer    = nullptr;
+        PFNGLQUERYCOUNTEREXTPROC        glQueryCounterTimer     = nullptr;
+        PFNGLGETQUERYIVEXTPROC          glGetQueryivTimer       = nullptr;
+        PFNGLGETQUERYOBJECTUIVEXTPROC   glGetQueryObjectuivTimer = nullptr;
+        PFNGLGETQUERYOBJECTUI64VEXTPROC glGetQueryObjectui64vTimer = nullptr;
+#else
+        PFNGLGENQUERIESPROC             glGenQueriesTimer       = nullptr;
+        PFNGLDELETEQUERIESPROC          glDeleteQueriesTimer    = nullptr;
+        PFNGLQUERYCOUNTERPROC           glQueryCounterTimer     = nullptr;
+        PFNGLGETQUERYIVPROC             glGetQueryivTimer       = nullptr;
+        PFNGLGETQUERYOBJECTUIVPROC      glGetQueryObjectuivTimer = nullptr;
+        PFNGLGETQUERYOBJECTUI64VPROC    glGetQueryObjectui64vTimer = nullptr;
+#endif
+        Bool m_available = false;
+        Bool m_isEmbedded = true;
+    };
+}
+
+#endif
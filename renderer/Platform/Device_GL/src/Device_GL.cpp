@@ -1129,6 +1129,54 @@ namespace ramses_internal
         }
     }
 
+    DeviceResourceHandle Device_GL::startShaderUpload(const EffectResource& effect)
+    {
+        if (!m_parallelShaderCompileSupported)
+            return uploadShader(effect);
+
+        ShaderProgramInfo programInfo;
+        String debugErrorLog;
+        const Bool submitSuccessful = ShaderUploader_GL::StartShaderProgramUploadFromSource(effect, programInfo, debugErrorLog);
+
+        // resource takes ownership of all GL handles, also in case of failure
+        ShaderGPUResource_GL* shaderGpuResource = new ShaderGPUResource_GL(programInfo);
+        if (!submitSuccessful)
+        {
+            LOG_ERROR(CONTEXT_RENDERER, "Device_GL::startShaderUpload: shader upload failed: " << debugErrorLog);
+            delete shaderGpuResource;
+            return DeviceResourceHandle::Invalid();
+        }
+
+        const DeviceResourceHandle handle = m_resourceMapper.registerResource(*shaderGpuResource);
+        m_pendingShaderUploads.put(handle, { &effect, shaderGpuResource });
+        return handle;
+    }
+
+    EShaderUploadStatus Device_GL::getShaderUploadStatus(DeviceResourceHandle handle)
+    {
+        const auto it = m_pendingShaderUploads.find(handle);
+        if (it == m_pendingShaderUploads.end())
+            return EShaderUploadStatus::Uploaded;
+
+        const EffectResource& effect = *it->value.effect;
+        ShaderGPUResource_GL& shaderGpuResource = *it->value.resource;
+        if (!ShaderUploader_GL::IsShaderProgramUploadCompleted(shaderGpuResource.getProgramInfo()))
+            return EShaderUploadStatus::Pending;
+
+        m_pendingShaderUploads.remove(handle);
+
+        String debugErrorLog;
+        if (!ShaderUploader_GL::FinishShaderProgramUploadFromSource(effect, shaderGpuResource.getProgramInfo(), debugErrorLog))
+        {
+            LOG_ERROR(CONTEXT_RENDERER, "Device_GL::getShaderUploadStatus: shader upload failed: " << debugErrorLog);
+            deleteShader(handle);
+            return EShaderUploadStatus::Failed;
+        }
+
+        shaderGpuResource.preloadVariableLocations(effect);
+        return EShaderUploadStatus::Uploaded;
+    }
+
     DeviceResourceHandle Device_GL::uploadBinaryShader(const EffectResource& effect, const UInt8* binaryShaderData, UInt32 binaryShaderDataSize, BinaryShaderFormatID binaryShaderFormat)
     {
         ShaderProgramInfo programInfo;
@@ -1159,6 +1207,8 @@ namespace ramses_internal
 
     void Device_GL::deleteShader(DeviceResourceHandle handle)
     {
+        m_pendingShaderUploads.remove(handle);
+
         const ShaderGPUResource_GL& shaderProgramGL = m_resourceMapper.getResourceAs<ShaderGPUResource_GL>(handle);
         if (m_activeShader == &shaderProgramGL)
         {
@@ -1335,6 +1385,13 @@ namespace ramses_internal
             }));
         }
 
+        // compile and link run in parallel to rendering if driver reports completion status of programs
+        m_parallelShaderCompileSupported = isApiExtensionAvailable("GL_KHR_parallel_shader_compile") || isApiExtensionAvailable("GL_ARB_parallel_shader_compile");
+        LOG_INFO(CONTEXT_RENDERER, "Device_GL::queryDeviceDependentFeatures: parallel shader compilation " << (m_parallelShaderCompileSupported ? "supported" : "not supported"));
+
+        // timer queries are core in all supported desktop GL versions
+        m_timerQuery.load(m_context, !m_isEmbedded || isApiExtensionAvailable("GL_EXT_disjoint_timer_query"), m_isEmbedded);
+
         if (isApiExtensionAvailable("GL_EXT_texture_filter_anisotropic"))
         {
             GLint anisotropy = 0;
@@ -1352,6 +1409,39 @@ namespace ramses_internal
         glReadPixels(x, y, width, height, GL_RGBA, GL_UNSIGNED_BYTE, static_cast<void*>(buffer));
     }
 
+    Bool Device_GL::isGpuTimerQuerySupported() const
+    {
+        return m_timerQuery.isAvailable();
+    }
+
+    DeviceResourceHandle Device_GL::allocateGpuTimerQuery()
+    {
+        assert(m_timerQuery.isAvailable());
+        const GLHandle query = m_timerQuery.generateQuery();
+        return m_resourceMapper.registerResource(*new GPUResource(query, 0u));
+    }
+
+    void Device_GL::deleteGpuTimerQuery(DeviceResourceHandle handle)
+    {
+        m_timerQuery.deleteQuery(m_resourceMapper.getResource(handle).getGPUAddress());
+        m_resourceMapper.deleteResource(handle);
+    }
+
+    void Device_GL::issueGpuTimestamp(DeviceResourceHandle handle)
+    {
+        m_timerQuery.queryTimestamp(m_resourceMapper.getResource(handle).getGPUAddress());
+    }
+
+    Bool Device_GL::getGpuTimestamp(DeviceResourceHandle handle, UInt64& timestampNs)
+    {
+        return m_timerQuery.getTimestamp(m_resourceMapper.getResource(handle).getGPUAddress(), timestampNs);
+    }
+
+    Bool Device_GL::checkAndResetGpuTimerDisjoint()
+    {
+        return m_timerQuery.isAvailable() && m_timerQuery.checkAndResetDisjoint();
+    }
+
     UInt32 Device_GL::getTotalGpuMemoryUsageInKB() const
     {
         return m_resourceMapper.getTotalGpuMemoryUsageInKB();
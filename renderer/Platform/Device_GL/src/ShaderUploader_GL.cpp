@@ -12,6 +12,10 @@
 #include "Resource/EffectResource.h"
 #include "Device_GL/ShaderProgramInfo.h"
 
+#ifndef GL_COMPLETION_STATUS_KHR
+#define GL_COMPLETION_STATUS_KHR 0x91B1
+#endif
+
 namespace ramses_internal
 {
     Bool ShaderUploader_GL::UploadShaderProgramFromBinary(const UInt8* binaryShaderData, UInt32 binaryShaderDataSize, BinaryShaderFormatID binaryShaderFormat, ShaderProgramInfo& programShaderInfoOut, String& debugErrorLog)
@@ -154,37 +158,120 @@ namespace ramses_internal
         }
     }
 
+    Bool ShaderUploader_GL::StartShaderProgramUploadFromSource(const EffectResource& effect, ShaderProgramInfo& programShaderInfoOut, String& debugErrorLog)
+    {
+        LOG_DEBUG(CONTEXT_RENDERER, "ShaderUploader_GL::StartShaderProgramUploadFromSource:  submitting shaders for effect " << effect.getName());
+
+        const bool hasGeometryShader = (std::strcmp(effect.getGeometryShader(), "") != 0);
+        programShaderInfoOut.vertexShaderHandle = SubmitShaderStage(effect.getVertexShader(), GL_VERTEX_SHADER);
+        programShaderInfoOut.fragmentShaderHandle = SubmitShaderStage(effect.getFragmentShader(), GL_FRAGMENT_SHADER);
+        if (hasGeometryShader)
+            programShaderInfoOut.geometryShaderHandle = SubmitShaderStage(effect.getGeometryShader(), GL_GEOMETRY_SHADER_EXT);
+        programShaderInfoOut.shaderProgramHandle = glCreateProgram();
+
+        if (InvalidGLHandle == programShaderInfoOut.vertexShaderHandle ||
+            InvalidGLHandle == programShaderInfoOut.fragmentShaderHandle ||
+            (hasGeometryShader && InvalidGLHandle == programShaderInfoOut.geometryShaderHandle) ||
+            InvalidGLHandle == programShaderInfoOut.shaderProgramHandle)
+        {
+            debugErrorLog = "Unable to create shader stages or shader program";
+            return false;
+        }
+
+        // link status is not queried here, it would wait for compilation to finish
+        glAttachShader(programShaderInfoOut.shaderProgramHandle, programShaderInfoOut.fragmentShaderHandle);
+        glAttachShader(programShaderInfoOut.shaderProgramHandle, programShaderInfoOut.vertexShaderHandle);
+        if (hasGeometryShader)
+            glAttachShader(programShaderInfoOut.shaderProgramHandle, programShaderInfoOut.geometryShaderHandle);
+        glLinkProgram(programShaderInfoOut.shaderProgramHandle);
+
+        return true;
+    }
+
+    Bool ShaderUploader_GL::IsShaderProgramUploadCompleted(const ShaderProgramInfo& programShaderInfo)
+    {
+        GLint completed = GL_FALSE;
+        glGetProgramiv(programShaderInfo.shaderProgramHandle, GL_COMPLETION_STATUS_KHR, &completed);
+        return completed != GL_FALSE;
+    }
+
+    Bool ShaderUploader_GL::FinishShaderProgramUploadFromSource(const EffectResource& effect, const ShaderProgramInfo& programShaderInfo, String& debugErrorLog)
+    {
+        if (!CheckShaderStageCompileStatus(programShaderInfo.vertexShaderHandle, effect.getVertexShader(), debugErrorLog))
+        {
+            LOG_ERROR(CONTEXT_RENDERER, "ShaderUploader_GL::FinishShaderProgramUploadFromSource:  vertex shader failed to compile " << debugErrorLog.c_str());
+            return false;
+        }
+
+        if (!CheckShaderStageCompileStatus(programShaderInfo.fragmentShaderHandle, effect.getFragmentShader(), debugErrorLog))
+        {
+            LOG_ERROR(CONTEXT_RENDERER, "ShaderUploader_GL::FinishShaderProgramUploadFromSource:  fragment shader failed to compile " << debugErrorLog.c_str());
+            return false;
+        }
+
+        if (InvalidGLHandle != programShaderInfo.geometryShaderHandle && !CheckShaderStageCompileStatus(programShaderInfo.geometryShaderHandle, effect.getGeometryShader(), debugErrorLog))
+        {
+            LOG_ERROR(CONTEXT_RENDERER, "ShaderUploader_GL::FinishShaderProgramUploadFromSource:  geometry shader failed to compile " << debugErrorLog.c_str());
+            return false;
+        }
+
+        if (!CheckShaderProgramLinkStatus(programShaderInfo.shaderProgramHandle, debugErrorLog))
+        {
+            LOG_ERROR(CONTEXT_RENDERER, "ShaderUploader_GL::FinishShaderProgramUploadFromSource:  CheckShaderProgramLinkStatus failed");
+            return false;
+        }
+
+        return true;
+    }
+
     GLHandle ShaderUploader_GL::CompileShaderStage(const char* stageSource, GLenum shaderType, String& errorLogOut)
     {
-        GLHandle shaderHandle = glCreateShader(shaderType);
+        GLHandle shaderHandle = SubmitShaderStage(stageSource, shaderType);
+
+        if (InvalidGLHandle != shaderHandle && !CheckShaderStageCompileStatus(shaderHandle, stageSource, errorLogOut))
+        {
+            glDeleteShader(shaderHandle);
+            shaderHandle = InvalidGLHandle;
+        }
+
+        return shaderHandle;
+    }
+
+    GLHandle ShaderUploader_GL::SubmitShaderStage(const char* stageSource, GLenum shaderType)
+    {
+        const GLHandle shaderHandle = glCreateShader(shaderType);
 
         if (InvalidGLHandle != shaderHandle)
         {
             glShaderSource(shaderHandle, 1, &stageSource, nullptr);
             glCompileShader(shaderHandle);
+        }
 
-            GLint compilationResult = GL_FALSE;
-            glGetShaderiv(shaderHandle, GL_COMPILE_STATUS, &compilationResult);
+        return shaderHandle;
+    }
 
-            if (compilationResult == GL_FALSE)
-            {
-                Int32 infoLength;
-                Int32 numberChars;
-                glGetShaderiv(shaderHandle, GL_INFO_LOG_LENGTH, &infoLength);
-
-                // Allocate Log Space
-                Char* info = new Char[infoLength];
-                glGetShaderInfoLog(shaderHandle, infoLength, &numberChars, info);
-                errorLogOut = String("Unable to compile shader stage: ") + String(info);
-                delete[] info;
-
-                PrintShaderSourceWithLineNumbers(stageSource);
-                glDeleteShader(shaderHandle);
-                shaderHandle = InvalidGLHandle;
-            }
+    Bool ShaderUploader_GL::CheckShaderStageCompileStatus(GLHandle shaderHandle, const char* stageSource, String& errorLogOut)
+    {
+        GLint compilationResult = GL_FALSE;
+        glGetShaderiv(shaderHandle, GL_COMPILE_STATUS, &compilationResult);
+
+        if (compilationResult == GL_FALSE)
+        {
+            Int32 infoLength;
+            Int32 numberChars;
+            glGetShaderiv(shaderHandle, GL_INFO_LOG_LENGTH, &infoLength);
+
+            // Allocate Log Space
+            Char* info = new Char[infoLength];
+            glGetShaderInfoLog(shaderHandle, infoLength, &numberChars, info);
+            errorLogOut = String("Unable to compile shader stage: ") + String(info);
+            delete[] info;
+
+            PrintShaderSourceWithLineNumbers(stageSource);
+            return false;
         }
 
-        return shaderHandle;
+        return true;
     }
 
     void ShaderUploader_GL::PrintShaderSourceWithLineNumbers(const String& source)
@@ -0,0 +1,120 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2020 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "Device_GL/TimerQuery_GL.h"
+#include "RendererAPI/IContext.h"
+#include "Utils/LogMacros.h"
+#include "Collections/String.h"
+#include <cassert>
+
+namespace ramses_internal
+{
+#if defined(__linux__) || defined(__ghs__)
+    #define GL_TIMER_QUERY_COUNTER_BITS         GL_QUERY_COUNTER_BITS_EXT
+    #define GL_TIMER_QUERY_RESULT               GL_QUERY_RESULT_EXT
+    #define GL_TIMER_QUERY_RESULT_AVAILABLE     GL_QUERY_RESULT_AVAILABLE_EXT
+    #define GL_TIMER_TIMESTAMP                  GL_TIMESTAMP_EXT
+#else
+    #define GL_TIMER_QUERY_COUNTER_BITS         GL_QUERY_COUNTER_BITS
+    #define GL_TIMER_QUERY_RESULT               GL_QUERY_RESULT
+    #define GL_TIMER_QUERY_RESULT_AVAILABLE     GL_QUERY_RESULT_AVAILABLE
+    #define GL_TIMER_TIMESTAMP                  GL_TIMESTAMP
+#endif
+
+    Bool TimerQuery_GL::load(const IContext& context, Bool extensionAvailable, Bool isEmbedded)
+    {
+        m_available = false;
+        m_isEmbedded = isEmbedded;
+        if (!extensionAvailable)
+        {
+            LOG_INFO(CONTEXT_RENDERER, "TimerQuery_GL::load: timer query extension not available, GPU timings will not be collected");
+            return false;
+        }
+
+        // GL_EXT_disjoint_timer_query procs are suffixed, GL_ARB_timer_query procs are core procs
+        const String suffix = isEmbedded ? "EXT" : "";
+        glGenQueriesTimer = reinterpret_cast<decltype(glGenQueriesTimer)>(context.getProcAddress(("glGenQueries" + suffix).c_str()));
+        glDeleteQueriesTimer = reinterpret_cast<decltype(glDeleteQueriesTimer)>(context.getProcAddress(("glDeleteQueries" + suffix).c_str()));
+        glQueryCounterTimer = reinterpret_cast<decltype(glQueryCounterTimer)>(context.getProcAddress(("glQueryCounter" + suffix).c_str()));
+        glGetQueryivTimer = reinterpret_cast<decltype(glGetQueryivTimer)>(context.getProcAddress(("glGetQueryiv" + suffix).c_str()));
+        glGetQueryObjectuivTimer = reinterpret_cast<decltype(glGetQueryObjectuivTimer)>(context.getProcAddress(("glGetQueryObjectuiv" + suffix).c_str()));
+        glGetQueryObjectui64vTimer = reinterpret_cast<decltype(glGetQueryObjectui64vTimer)>(context.getProcAddress(("glGetQueryObjectui64v" + suffix).c_str()));
+
+        if (!glGenQueriesTimer || !glDeleteQueriesTimer || !glQueryCounterTimer || !glGetQueryivTimer || !glGetQueryObjectuivTimer || !glGetQueryObjectui64vTimer)
+        {
+            LOG_WARN(CONTEXT_RENDERER, "TimerQuery_GL::load: could not load timer query procs, GPU timings will not be collected");
+            return false;
+        }
+
+        // timestamp queries are optional even when the extension is present
+        GLint timestampBits = 0;
+        glGetQueryivTimer(GL_TIMER_TIMESTAMP, GL_TIMER_QUERY_COUNTER_BITS, &timestampBits);
+        if (timestampBits == 0)
+        {
+            LOG_INFO(CONTEXT_RENDERER, "TimerQuery_GL::load: timestamp queries not supported, GPU timings will not be collected");
+            return false;
+        }
+
+        m_available = true;
+        return true;
+    }
+
+    Bool TimerQuery_GL::isAvailable() const
+    {
+        return m_available;
+    }
+
+    GLuint TimerQuery_GL::generateQuery() const
+    {
+        assert(m_available);
+        GLuint query = 0u;
+        glGenQueriesTimer(1, &query);
+        return query;
+    }
+
+    void TimerQuery_GL::deleteQuery(GLuint query) const
+    {
+        assert(m_available);
+        glDeleteQueriesTimer(1, &query);
+    }
+
+    void TimerQuery_GL::queryTimestamp(GLuint query) const
+    {
+        assert(m_available);
+        glQueryCounterTimer(query, GL_TIMER_TIMESTAMP);
+    }
+
+    Bool TimerQuery_GL::getTimestamp(GLuint query, UInt64& timestampNs) const
+    {
+        assert(m_available);
+        GLuint available = GL_FALSE;
+        glGetQueryObjectuivTimer(query, GL_TIMER_QUERY_RESULT_AVAILABLE, &available);
+        if (available == GL_FALSE)
+            return false;
+
+        GLuint64 result = 0u;
+        glGetQueryObjectui64vTimer(query, GL_TIMER_QUERY_RESULT, &result);
+        timestampNs = result;
+        return true;
+    }
+
+    Bool TimerQuery_GL::checkAndResetDisjoint() const
+    {
+#if defined(__linux__) || defined(__ghs__)
+        if (m_isEmbedded)
+        {
+            // reading the flag resets it
+            GLint disjoint = GL_FALSE;
+            glGetIntegerv(GL_GPU_DISJOINT_EXT, &disjoint);
+            return disjoint != GL_FALSE;
+        }
+#endif
+        // desktop GL timer queries have no disjoint notion
+        return false;
+    }
+}
@@ -25,6 +25,10 @@ namespace ramses_internal
 
         DeviceResourceMapper& getResources() override;
 
+        UInt32 getBufferAge() const override;
+        bool setDamageRegion(const Viewport& region) override;
+        bool swapBuffersWithDamage(const Viewport& region) override;
+
         // TODO Violin this is not beautiful, but is needed because windows parses
         // extensions non-conform to EGL standard (read up about WGL on the net,
         // search terms "WGL extensions")
@@ -31,6 +31,9 @@ namespace ramses_internal
         IContext& getContext() override final;
 
         bool swapBuffers() override;
+        bool swapBuffersWithDamage(const Viewport& region) override;
+        UInt32 getBufferAge() const override;
+        bool setDamageRegion(const Viewport& region) override;
         bool enable() override final;
         bool disable() override final;
 
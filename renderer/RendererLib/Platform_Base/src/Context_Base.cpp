@@ -21,6 +21,21 @@ namespace ramses_internal
         return m_resources;
     }
 
+    UInt32 Context_Base::getBufferAge() const
+    {
+        return 0u;
+    }
+
+    bool Context_Base::setDamageRegion(const Viewport& /*region*/)
+    {
+        return false;
+    }
+
+    bool Context_Base::swapBuffersWithDamage(const Viewport& /*region*/)
+    {
+        return swapBuffers();
+    }
+
     void Context_Base::ParseContextExtensionsHelper(const Char* extensionNativeString, StringSet& extensionsOut)
     {
         LOG_DEBUG(CONTEXT_RENDERER, "Context_Base::ParseContextExtensionsHelper:  parsing context extensions");
@@ -58,6 +58,21 @@ namespace ramses_internal
         return m_context.swapBuffers();
     }
 
+    Bool Surface::swapBuffersWithDamage(const Viewport& region)
+    {
+        return m_context.swapBuffersWithDamage(region);
+    }
+
+    UInt32 Surface::getBufferAge() const
+    {
+        return m_context.getBufferAge();
+    }
+
+    Bool Surface::setDamageRegion(const Viewport& region)
+    {
+        return m_context.setDamageRegion(region);
+    }
+
     Bool Surface::enable()
     {
         return m_context.enable();
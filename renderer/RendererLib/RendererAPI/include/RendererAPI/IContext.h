@@ -14,6 +14,7 @@
 namespace ramses_internal
 {
     class DeviceResourceMapper;
+    struct Viewport;
 
     class IContext
     {
@@ -25,6 +26,13 @@ namespace ramses_internal
         virtual bool disable() = 0;
         virtual DeviceResourceMapper& getResources() = 0;
 
+        // number of frames since content of back buffer was presented, 0 if content is undefined or age not supported
+        virtual UInt32 getBufferAge() const = 0;
+        // announces that only region of back buffer will be modified till next swap, false if not supported
+        virtual bool setDamageRegion(const Viewport& region) = 0;
+        // presents back buffer with hint that only region changed since last swap, plain swap if not supported
+        virtual bool swapBuffersWithDamage(const Viewport& region) = 0;
+
         // TODO Violin this should be removed - provides access to platform-specific data
         virtual void* getProcAddress(const Char* name) const = 0;
     };
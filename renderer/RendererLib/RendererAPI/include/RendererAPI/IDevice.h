@@ -93,6 +93,10 @@ namespace ramses_internal
         virtual Bool                    getBinaryShader             (DeviceResourceHandle handle, UInt8Vector& binaryShader, BinaryShaderFormatID& binaryShaderFormat) = 0;
         virtual void                    deleteShader                (DeviceResourceHandle handle) = 0;
         virtual void                    activateShader              (DeviceResourceHandle handle) = 0;
+        // non-blocking shader upload, compile and link are only submitted and status has to be polled until not pending,
+        // effect must stay alive until then. Devices which cannot compile in parallel finish the upload already here.
+        virtual DeviceResourceHandle    startShaderUpload           (const EffectResource& effect) = 0;
+        virtual EShaderUploadStatus     getShaderUploadStatus       (DeviceResourceHandle handle) = 0;
 
         virtual DeviceResourceHandle    allocateTexture2D           (UInt32 width, UInt32 height, ETextureFormat textureFormat, const TextureSwizzleArray& swizzle, UInt32 mipLevelCount, UInt32 totalSizeInBytes) = 0;
         virtual DeviceResourceHandle    allocateTexture3D           (UInt32 width, UInt32 height, UInt32 depth, ETextureFormat textureFormat, UInt32 mipLevelCount, UInt32 totalSizeInBytes) = 0;
@@ -128,6 +132,16 @@ namespace ramses_internal
         // read back data, statistics, info
         virtual void readPixels(UInt8* buffer, UInt32 x, UInt32 y, UInt32 width, UInt32 height) = 0;
 
+        // GPU timestamp queries, results become available asynchronously (typically a few frames later)
+        virtual Bool                    isGpuTimerQuerySupported    () const = 0;
+        virtual DeviceResourceHandle    allocateGpuTimerQuery       () = 0;
+        virtual void                    deleteGpuTimerQuery         (DeviceResourceHandle handle) = 0;
+        virtual void                    issueGpuTimestamp           (DeviceResourceHandle handle) = 0;
+        // returns false without waiting if result is not available yet
+        virtual Bool                    getGpuTimestamp             (DeviceResourceHandle handle, UInt64& timestampNs) = 0;
+        // true if timings since last check are unreliable (e.g. GPU frequency change)
+        virtual Bool                    checkAndResetGpuTimerDisjoint() = 0;
+
         virtual UInt32  getTotalGpuMemoryUsageInKB() const = 0;
         virtual UInt32  getDrawCallCount() const = 0;
         virtual void    resetDrawCallCount() = 0;
@@ -24,6 +24,7 @@ namespace ramses_internal
     class WarpingMeshData;
     class ProjectionParams;
     class FrameTimer;
+    struct GpuTiming;
 
     class IDisplayController
     {
@@ -34,10 +35,16 @@ namespace ramses_internal
         virtual Bool                    canRenderNewFrame() const = 0;
         virtual void                    enableContext() = 0;
         virtual void                    swapBuffers() = 0;
+        virtual void                    swapBuffersWithDamage(const Viewport& damageRegion) = 0;
         virtual SceneRenderExecutionIterator renderScene(const RendererCachedScene& scene, DeviceResourceHandle buffer, const Viewport& viewport, const SceneRenderExecutionIterator& renderFrom = {}, const FrameTimer* frameTimer = nullptr) = 0;
         virtual void                    executePostProcessing() = 0;
         virtual void                    clearBuffer(DeviceResourceHandle buffer, const Vector4& clearColor) = 0;
 
+        // number of frames since current content of display buffer was presented, 0 if undefined
+        virtual UInt32                  getDisplayBufferAge() const = 0;
+        // confines clearing and rendering into display buffer to region until next swap
+        virtual void                    setDisplayBufferRepaintRegion(const Viewport& region) = 0;
+
         virtual DeviceResourceHandle    getDisplayBuffer() const = 0;
         virtual IRenderBackend&         getRenderBackend() const = 0;
         virtual IEmbeddedCompositingManager& getEmbeddedCompositingManager() = 0;
@@ -49,6 +56,8 @@ namespace ramses_internal
         virtual void                    setWarpingMeshData(const WarpingMeshData& warpingMeshData) = 0;
 
         virtual void                    validateRenderingStatusHealthy() const = 0;
+        // moves out GPU timings of frames which finished rendering since last call, empty if not supported by device
+        virtual void                    collectGpuTimings(std::vector<GpuTiming>& timingsOut) = 0;
     };
 }
 
@@ -15,6 +15,7 @@ namespace ramses_internal
 {
     class IWindow;
     class IContext;
+    struct Viewport;
 
     class ISurface
     {
@@ -24,6 +25,9 @@ namespace ramses_internal
         virtual Bool enable() = 0;
         virtual Bool disable() = 0;
         virtual Bool swapBuffers() = 0;
+        virtual Bool swapBuffersWithDamage(const Viewport& region) = 0;
+        virtual UInt32 getBufferAge() const = 0;
+        virtual Bool setDamageRegion(const Viewport& region) = 0;
         virtual Bool canRenderNewFrame() const = 0;
         virtual void frameRendered() = 0;
 
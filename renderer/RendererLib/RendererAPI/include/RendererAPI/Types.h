@@ -33,6 +33,13 @@ namespace ramses_internal
         EPostProcessingEffect_Warping = BIT(0)
     };
 
+    enum class EShaderUploadStatus
+    {
+        Pending = 0,    ///< Shader is still being compiled and linked, it must not be used yet
+        Uploaded,       ///< Shader is ready for rendering
+        Failed          ///< Compilation or linking failed, device resource was released
+    };
+
     struct DisplayHandleTag {};
     using DisplayHandle = TypedMemoryHandle<DisplayHandleTag>;
     using DisplayHandleVector = std::vector<DisplayHandle>;
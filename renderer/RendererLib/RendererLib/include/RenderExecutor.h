@@ -18,13 +18,15 @@ namespace ramses_internal
     class IDevice;
     class RendererLogContext;
     class FrameTimer;
+    class GpuTimerQueries;
 
     class RenderExecutor
     {
     public:
-        RenderExecutor(IDevice& device, const TargetBufferInfo& bufferInfo, const SceneRenderExecutionIterator& renderFrom = {}, const FrameTimer* frameTimer = nullptr);
+        RenderExecutor(IDevice& device, const TargetBufferInfo& bufferInfo, const SceneRenderExecutionIterator& renderFrom = {}, const FrameTimer* frameTimer = nullptr, GpuTimerQueries* gpuTimerQueries = nullptr);
 
         SceneRenderExecutionIterator executeScene(const RendererCachedScene& scene) const;
+        void setFramebufferRepaintRegion(const RenderState::ScissorRegion& region);
 
         // This is exposed and can be modified but acts as a global parameter
         static constexpr const UInt32 DefaultNumRenderablesToRenderInBetweenTimeBudgetChecks = 10u;
@@ -32,6 +34,7 @@ namespace ramses_internal
 
     protected:
         mutable RenderExecutorInternalState m_state;
+        GpuTimerQueries* const m_gpuTimerQueries;
 
         void executeRenderable      () const;
         void executeRenderTarget    (RenderTargetHandle renderTarget) const;
@@ -110,6 +110,10 @@ namespace ramses_internal
 
         SceneRenderExecutionIterator            m_currentRenderIterator;
 
+        // if set, rendering into framebuffer is confined to this region (partial update of display buffer)
+        Bool                                    m_limitToRepaintRegion = false;
+        RenderState::ScissorRegion              m_repaintRegion;
+
     private:
         IDevice&                    m_device;
         const RendererCachedScene*  m_scene;
@@ -71,6 +71,9 @@ namespace ramses_internal
         Bool getKeepEffectsUploaded() const;
         void setKeepEffectsUploaded(Bool enable);
 
+        Bool isPartialFramebufferUpdateEnabled() const;
+        void setPartialFramebufferUpdateEnabled(Bool enable);
+
         Bool isResizable() const;
         void setResizable(Bool resizable);
 
@@ -106,6 +109,7 @@ namespace ramses_internal
         UInt32 m_antiAliasingSamples = 1;
 
         Bool m_keepEffectsUploaded = true;
+        Bool m_partialFramebufferUpdateEnabled = false;
         UInt64 m_gpuMemoryCacheSize = 0u;
         Vector4 m_clearColor{ 0.f, 0.f, 0.f, 1.0f };
     };
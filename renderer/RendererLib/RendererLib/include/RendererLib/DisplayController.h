@@ -14,6 +14,8 @@
 #include "Math3d/CameraMatrixHelper.h"
 #include "RendererLib/Postprocessing.h"
 #include "EmbeddedCompositingManager.h"
+#include "RendererLib/GpuTimerQueries.h"
+#include "SceneAPI/Viewport.h"
 #include <memory>
 
 
@@ -37,9 +39,12 @@ namespace ramses_internal
         virtual Bool                    canRenderNewFrame() const override;
         virtual void                    enableContext() override;
         virtual void                    swapBuffers() override;
+        virtual void                    swapBuffersWithDamage(const Viewport& damageRegion) override;
         virtual SceneRenderExecutionIterator renderScene(const RendererCachedScene& scene, DeviceResourceHandle buffer, const Viewport& viewport, const SceneRenderExecutionIterator& renderFrom = {}, const FrameTimer* frameTimer = nullptr) override;
         virtual void                    executePostProcessing() override;
         virtual void                    clearBuffer(DeviceResourceHandle buffer, const Vector4& clearColor) override;
+        virtual UInt32                  getDisplayBufferAge() const override;
+        virtual void                    setDisplayBufferRepaintRegion(const Viewport& region) override;
 
         virtual DeviceResourceHandle    getDisplayBuffer() const override final;
         virtual IRenderBackend&         getRenderBackend() const override;
@@ -52,6 +57,7 @@ namespace ramses_internal
         virtual void                    setWarpingMeshData(const WarpingMeshData& warpingMeshData) override;
 
         virtual void validateRenderingStatusHealthy() const override;
+        virtual void collectGpuTimings(GpuTimings& timingsOut) override;
 
     private:
         IRenderBackend&         m_renderBackend;
@@ -62,6 +68,10 @@ namespace ramses_internal
         const UInt32            m_displayHeight;
 
         std::unique_ptr<Postprocessing> m_postProcessing;
+        GpuTimerQueries         m_gpuTimerQueries;
+
+        Bool                    m_hasRepaintRegion = false;
+        Viewport                m_repaintRegion;
     };
 }
 
@@ -0,0 +1,48 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2020 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#ifndef RAMSES_FRAMEDEADLINESCHEDULER_H
+#define RAMSES_FRAMEDEADLINESCHEDULER_H
+
+#include "PlatformAbstraction/PlatformTypes.h"
+#include <chrono>
+
+namespace ramses_internal
+{
+    // Plans render loop frames against presentation deadlines spaced by the minimum frame duration.
+    // Each frame owns the time slot between the previous deadline and its own deadline and is planned
+    // to start as late as possible within it, i.e. its deadline minus the estimated loop duration,
+    // so that flushes arriving meanwhile are still applied in it. A frame may also start as soon as
+    // its slot opens (e.g. when a flush arrived), there is never more than one frame per slot.
+    // All times are monotonic microseconds (PlatformTime::GetMicrosecondsMonotonic).
+    class FrameDeadlineScheduler
+    {
+    public:
+        void setFrameDuration(std::chrono::microseconds frameDuration);
+        std::chrono::microseconds getFrameDuration() const;
+
+        // time when next frame starts just in time for its deadline
+        UInt64 getPlannedFrameStart() const;
+        // time when slot of next frame opens, frame must not start before
+        UInt64 getEarliestFrameStart() const;
+        UInt64 getFrameDeadline() const;
+        std::chrono::microseconds getEstimatedLoopDuration() const;
+
+        void frameStarted(UInt64 timeStamp);
+        void frameFinished(UInt64 timeStamp);
+
+    private:
+        std::chrono::microseconds m_frameDuration{ std::chrono::microseconds(std::chrono::seconds(1)) / 60 };
+        std::chrono::microseconds m_estimatedLoopDuration{ 0 };
+        UInt64 m_previousDeadline = 0u;
+        UInt64 m_deadline = 0u;
+        UInt64 m_frameStart = 0u;
+    };
+}
+
+#endif
@@ -0,0 +1,56 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2020 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#ifndef RAMSES_FRAMEBUFFERDAMAGETRACKER_H
+#define RAMSES_FRAMEBUFFERDAMAGETRACKER_H
+
+#include "SceneAPI/Viewport.h"
+#include <deque>
+
+namespace ramses_internal
+{
+    // Collects regions of display buffer changed in current frame and keeps those of recently presented frames.
+    // Given the age of back buffer content (number of frames since it was presented) only the regions changed
+    // since then have to be repainted. Regions are approximated by their bounding rectangle.
+    class FramebufferDamageTracker
+    {
+    public:
+        // swap chains rarely have more than 3 buffers, older content is repainted fully
+        static constexpr UInt32 MaxBufferAge = 4u;
+
+        void addDamage(const Viewport& region);
+        void setFullyDamaged();
+
+        Bool isFullyDamaged() const;
+        // damage of current frame compared to last presented frame
+        const Viewport& getDamage() const;
+
+        // region to repaint in back buffer of given age to show current frame, returns false if everything has to be repainted
+        Bool getRepaintRegion(UInt32 bufferAge, Viewport& regionOut) const;
+
+        // current frame was presented, its damage becomes part of history
+        void framePresented();
+
+        static Bool IsEmpty(const Viewport& region);
+        static Viewport Unite(const Viewport& region1, const Viewport& region2);
+        static Viewport Intersect(const Viewport& region1, const Viewport& region2);
+
+    private:
+        struct FrameDamage
+        {
+            Bool fullyDamaged = false;
+            Viewport region;
+        };
+
+        FrameDamage m_currentFrame;
+        // most recently presented frame first
+        std::deque<FrameDamage> m_presentedFrames;
+    };
+}
+
+#endif
@@ -27,6 +27,7 @@ namespace ramses_internal
         UInt64 getTextureMemoryUsage() const;
         UInt64 getGeometryMemoryUsage() const;
         UInt64 getRenderbufferMemoryUsage() const;
+        UInt64 getSharedRenderbufferMemorySaving() const;
 
         SceneIdVector getSampledScenes() const;
         UInt64 getTotalSceneMemoryUsage(SceneId sceneId) const;
@@ -97,6 +98,14 @@ namespace ramses_internal
             m_totalMemoryUsage += memUsageBytes;
         }
 
+        // render buffers sharing storage are counted once in total usage, usage per scene still counts them fully
+        void decreaseMemUsageForSharedRenderBuffers(UInt64 savedMemoryBytes)
+        {
+            m_renderbufferMemoryUsage -= savedMemoryBytes;
+            m_totalMemoryUsage -= savedMemoryBytes;
+            m_sharedRenderbufferMemorySaving += savedMemoryBytes;
+        }
+
     private:
         struct SceneMemoryUsage
         {
@@ -114,6 +123,7 @@ namespace ramses_internal
         UInt64 m_textureMemoryUsage = 0u;
         UInt64 m_geometryMemoryUsage = 0u;
         UInt64 m_renderbufferMemoryUsage = 0u;
+        UInt64 m_sharedRenderbufferMemorySaving = 0u;
     };
 }
 
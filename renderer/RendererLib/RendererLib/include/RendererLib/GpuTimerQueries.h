@@ -0,0 +1,104 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2020 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#ifndef RAMSES_GPUTIMERQUERIES_H
+#define RAMSES_GPUTIMERQUERIES_H
+
+#include "RendererAPI/Types.h"
+#include "SceneAPI/SceneId.h"
+#include "SceneAPI/Handles.h"
+#include <array>
+#include <vector>
+#include <limits>
+
+namespace ramses_internal
+{
+    class IDevice;
+
+    // GPU time of a whole frame (invalid scene), of a scene (invalid render pass) or of a render pass of a scene
+    struct GpuTiming
+    {
+        SceneId sceneId;
+        RenderPassHandle renderPass;
+        UInt64 durationNs;
+    };
+    using GpuTimings = std::vector<GpuTiming>;
+
+    // Measures GPU execution time of frames, scenes and render passes of a display using timestamp queries.
+    // Results are read back without stalling once they become available, a few frames later. Frames whose results
+    // are not available when their queries have to be reused, or which were affected by a disjoint GPU operation, are dropped.
+    // Does nothing if device does not support timer queries.
+    class GpuTimerQueries
+    {
+    public:
+        static constexpr UInt32 NumFramesInFlight = 4u;
+        static constexpr UInt32 MaximumIntervalsPerFrame = 512u;
+
+        explicit GpuTimerQueries(IDevice& device);
+        ~GpuTimerQueries();
+
+        Bool isEnabled() const;
+
+        // marks start of frame, scenes and render passes are measured only within begun frame
+        void beginFrame();
+        void beginScene(SceneId sceneId);
+        void endScene();
+        void beginRenderPass(RenderPassHandle renderPass);
+        void endRenderPass();
+
+        // marks end of frame and collects results of previous frames that became available
+        void finishFrame();
+        // moves out timings collected so far
+        void collectTimings(GpuTimings& timingsOut);
+
+        UInt32 getNumberOfDroppedFrames() const;
+
+        GpuTimerQueries(const GpuTimerQueries&) = delete;
+        GpuTimerQueries& operator=(const GpuTimerQueries&) = delete;
+
+    private:
+        struct Interval
+        {
+            SceneId sceneId;
+            RenderPassHandle renderPass;
+            UInt32 startQuery;
+            UInt32 endQuery;
+        };
+
+        struct Frame
+        {
+            std::vector<DeviceResourceHandle> queries;
+            UInt32 numQueriesUsed = 0u;
+            std::vector<Interval> intervals;
+            Bool pending = false;
+        };
+
+        UInt32 issueTimestamp();
+        Bool beginInterval(SceneId sceneId, RenderPassHandle renderPass, UInt32& intervalIndexOut);
+        void endInterval(UInt32 intervalIndex);
+        Bool tryCollectFrame(Frame& frame);
+        void resetFrame(Frame& frame);
+
+        IDevice& m_device;
+        const Bool m_enabled;
+
+        std::array<Frame, NumFramesInFlight> m_frames;
+        UInt32 m_currentFrame = 0u;
+
+        static constexpr UInt32 NoInterval = std::numeric_limits<UInt32>::max();
+        UInt32 m_openSceneInterval = NoInterval;
+        UInt32 m_openRenderPassInterval = NoInterval;
+
+        // read back buffer reused across frames
+        std::vector<UInt64> m_timestamps;
+        GpuTimings m_finishedTimings;
+        UInt32 m_droppedFrames = 0u;
+    };
+}
+
+#endif
@@ -23,6 +23,7 @@ namespace ramses_internal
 {
     struct RenderTarget;
     class IRendererResourceCache;
+    class IScene;
     enum class EDataBufferType : UInt8;
 
     class IRendererResourceManager : public IResourceDeviceHandleAccessor
@@ -62,6 +63,10 @@ namespace ramses_internal
         virtual void             unloadTextureBuffer(TextureBufferHandle textureBufferHandle, SceneId sceneId) = 0;
         virtual void             updateTextureBuffer(TextureBufferHandle textureBufferHandle, UInt32 mipLevel, UInt32 x, UInt32 y, UInt32 width, UInt32 height, const Byte* data, SceneId sceneId) = 0;
 
+        // let transient render buffers of scene share storage with other scenes, move other write-only buffers to own storage,
+        // returns true if any render buffer storage changed, i.e. render targets of scene were re-created
+        virtual Bool             updateTransientRenderBuffers(const IScene& scene, const RenderBufferHandleVector& transientBuffers) = 0;
+
         virtual void             unloadAllSceneResourcesForScene(SceneId sceneId) = 0;
         virtual void             unreferenceAllResourcesForScene(SceneId sceneId) = 0;
         virtual const ResourceContentHashVector* getResourcesInUseByScene(SceneId sceneId) const = 0;
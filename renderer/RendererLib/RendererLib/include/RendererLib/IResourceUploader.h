@@ -27,6 +27,8 @@ namespace ramses_internal
 
         virtual DeviceResourceHandle uploadResource(IRenderBackend& renderBackend, const ResourceDescriptor& resourceObject, UInt32& outVRAMSize) = 0;
         virtual void                 unloadResource(IRenderBackend& renderBackend, EResourceType type, ResourceContentHash hash, DeviceResourceHandle handle) = 0;
+        // effect upload can finish asynchronously, uploaded effect must not be used until status is not pending anymore
+        virtual EShaderUploadStatus  getEffectUploadStatus(IRenderBackend& renderBackend, ResourceContentHash hash, DeviceResourceHandle handle) = 0;
     };
 }
 
@@ -63,6 +63,8 @@ namespace ramses_internal
         virtual Bool getBinaryShader(DeviceResourceHandle handle, UInt8Vector& binaryShader, BinaryShaderFormatID& binaryShaderFormat) override;
         virtual void deleteShader(DeviceResourceHandle handle) override;
         virtual void activateShader(DeviceResourceHandle handle) override;
+        virtual DeviceResourceHandle startShaderUpload(const EffectResource& effect) override;
+        virtual EShaderUploadStatus getShaderUploadStatus(DeviceResourceHandle handle) override;
         virtual DeviceResourceHandle allocateTexture2D(UInt32 width, UInt32 height, ETextureFormat textureFormat, const TextureSwizzleArray& swizzle, UInt32 mipLevelCount, UInt32 totalSizeInBytes) override;
         virtual DeviceResourceHandle allocateTexture3D(UInt32 width, UInt32 height, UInt32 depth, ETextureFormat textureFormat, UInt32 mipLevelCount, UInt32 dataSize) override;
         virtual DeviceResourceHandle allocateTextureCube(UInt32 faceSize, ETextureFormat textureFormat, const TextureSwizzleArray& swizzle, UInt32 mipLevelCount, UInt32 dataSize) override;
@@ -94,6 +96,13 @@ namespace ramses_internal
 
         virtual void readPixels(UInt8* buffer, UInt32 x, UInt32 y, UInt32 width, UInt32 height) override;
 
+        virtual Bool isGpuTimerQuerySupported() const override;
+        virtual DeviceResourceHandle allocateGpuTimerQuery() override;
+        virtual void deleteGpuTimerQuery(DeviceResourceHandle handle) override;
+        virtual void issueGpuTimestamp(DeviceResourceHandle handle) override;
+        virtual Bool getGpuTimestamp(DeviceResourceHandle handle, UInt64& timestampNs) override;
+        virtual Bool checkAndResetGpuTimerDisjoint() override;
+
         virtual UInt32 getTotalGpuMemoryUsageInKB() const override;
         virtual UInt32 getDrawCallCount() const override;
         virtual void resetDrawCallCount() override;
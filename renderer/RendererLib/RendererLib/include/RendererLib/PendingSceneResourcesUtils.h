@@ -10,6 +10,7 @@
 #define RAMSES_PENDINGSCENERESOURCESUTILS_H
 
 #include "Scene/ResourceChanges.h"
+#include "RendererLib/SceneResourceUploader.h"
 
 namespace ramses_internal
 {
@@ -21,7 +22,7 @@ namespace ramses_internal
     {
     public:
         static void ConsolidateSceneResourceActions(const SceneResourceActionVector& newActions, SceneResourceActionVector& currentActionsInOut);
-        static bool ApplySceneResourceActions(const SceneResourceActionVector& actions, const IScene& scene, IRendererResourceManager& resourceManager, const FrameTimer* frameTimer = nullptr);
+        static bool ApplySceneResourceActions(const SceneResourceActionVector& actions, const IScene& scene, IRendererResourceManager& resourceManager, const FrameTimer* frameTimer = nullptr, const TextureBufferDirtyRegions* textureBufferDirtyRegions = nullptr);
 
     private:
         static Bool RemoveSceneResourceActionIfContained(SceneResourceActionVector& actions, MemoryHandle handle, ESceneResourceAction action);
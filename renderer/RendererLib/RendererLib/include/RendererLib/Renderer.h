@@ -17,6 +17,8 @@
 #include "RendererLib/DisplayEventHandlerManager.h"
 #include "RendererLib/RendererInterruptState.h"
 #include "RendererLib/DisplaySetup.h"
+#include "RendererLib/GpuTimerQueries.h"
+#include "RendererLib/FramebufferDamageTracker.h"
 #include "FrameProfileRenderer.h"
 #include "MemoryStatistics.h"
 #include "Collections/Vector.h"
@@ -104,7 +106,7 @@ namespace ramses_internal
         static const Vector4 DefaultClearColor;
 
     protected:
-        void addDisplayController(IDisplayController& display, DisplayHandle displayHandle);
+        void addDisplayController(IDisplayController& display, DisplayHandle displayHandle, Bool partialFramebufferUpdateEnabled = false);
         void removeDisplayController(DisplayHandle display);
 
     private:
@@ -116,9 +118,18 @@ namespace ramses_internal
         void processScheduledScreenshots(DeviceResourceHandle renderTargetHandle, IDisplayController& controller, DisplayHandle displayHandle);
         Bool hasAnyOffscreenBufferToRerender(DisplayHandle display, Bool interruptible) const;
         void onSceneWasRendered(const RendererCachedScene& scene);
+        void updateFramebufferDamage(DisplayHandle displayHandle);
 
         static void ActivateDisplayContext(DisplayHandle displayToActivate, DisplayHandle& activeDisplay, IDisplayController& dispController);
         static void ReorderDisplaysToStartWith(std::vector<DisplayHandle>& displays, DisplayHandle displayToStartWith);
+        static Viewport GetSceneFramebufferRegion(const RendererCachedScene& scene);
+
+        struct FramebufferSceneRegion
+        {
+            SceneId  sceneId;
+            Viewport region;
+        };
+        using FramebufferSceneRegions = std::vector<FramebufferSceneRegion>;
 
         struct DisplayInfo
         {
@@ -127,6 +138,13 @@ namespace ramses_internal
             DeviceResourceHandle frameBufferDeviceHandle;
             DisplaySetup         buffersSetup;
             std::unordered_map<DeviceResourceHandle, ScreenshotInfo> screenshots;
+
+            // partial framebuffer update, only framebuffer regions changed by scenes are repainted
+            Bool                     partialFramebufferUpdateEnabled = false;
+            Bool                     framebufferFullyDamaged = false;
+            FramebufferDamageTracker framebufferDamage;
+            std::vector<SceneId>     modifiedFramebufferScenes;
+            FramebufferSceneRegions  framebufferScenesRendered;
         };
         using Displays = std::map<DisplayHandle, DisplayInfo>;
 
@@ -154,7 +172,9 @@ namespace ramses_internal
         // temporary containers kept to avoid re-allocations
         std::vector<DisplayHandle> m_tempDisplaysToRender; // used in RendererLogger - adapt if changing behavior
         std::vector<DisplayHandle> m_tempDisplaysToSwapBuffers;
+        GpuTimings m_tempGpuTimings;
         std::vector<SceneId> m_tempScenesRendered;
+        FramebufferSceneRegions m_tempFramebufferScenes;
     };
 }
 
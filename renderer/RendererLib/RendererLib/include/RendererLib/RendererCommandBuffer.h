@@ -13,6 +13,7 @@
 #include "PlatformAbstraction/PlatformLock.h"
 #include "RendererLogger.h"
 #include "SceneAPI/Handles.h"
+#include <functional>
 
 namespace ramses_internal
 {
@@ -23,6 +24,10 @@ namespace ramses_internal
     class RendererCommandBuffer
     {
     public:
+        // called with scene ID of every enqueued scene update, from thread enqueueing it
+        using SceneUpdateListener = std::function<void(SceneId)>;
+        void setSceneUpdateListener(SceneUpdateListener listener);
+
         void publishScene(SceneId sceneId, EScenePublicationMode mode);
         void unpublishScene(SceneId sceneId);
         void receiveScene(const SceneInfo& sceneInfo);
@@ -87,6 +92,7 @@ namespace ramses_internal
     private:
         PlatformLock m_lock;
         RendererCommands m_commands;
+        SceneUpdateListener m_sceneUpdateListener;
     };
 }
 
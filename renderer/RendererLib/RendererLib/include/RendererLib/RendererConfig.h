@@ -41,6 +41,10 @@ namespace ramses_internal
         void setFrameCallbackMaxPollTime(std::chrono::microseconds pollTime);
         void setRenderthreadLooptimingReportingPeriod(std::chrono::milliseconds period);
         std::chrono::milliseconds getRenderThreadLoopTimingReportingPeriod() const;
+        void setSceneUpdateThreadCount(UInt32 threadCount);
+        UInt32 getSceneUpdateThreadCount() const;
+        void setDeadlineFrameSchedulingEnabled(Bool enable);
+        Bool getDeadlineFrameSchedulingEnabled() const;
     private:
         String m_waylandSocketEmbedded;
         String m_waylandSocketEmbeddedGroupName;
@@ -51,6 +55,8 @@ namespace ramses_internal
         String m_kpiFilename;
         std::chrono::microseconds m_frameCallbackMaxPollTime{10000u};
         std::chrono::milliseconds m_renderThreadLoopTimingReportingPeriod { 0 }; // zero deactivates reporting
+        UInt32 m_sceneUpdateThreadCount = 0u; // zero updates all scenes on render thread
+        Bool m_deadlineFrameSchedulingEnabled = false;
     };
 }
 
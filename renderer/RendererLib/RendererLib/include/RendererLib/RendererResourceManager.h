@@ -13,6 +13,7 @@
 #include "RendererLib/RendererResourceRegistry.h"
 #include "RendererLib/RendererSceneResourceRegistry.h"
 #include "RendererLib/ResourceUploadingManager.h"
+#include "RendererLib/TransientRenderBufferPool.h"
 #include "RendererResourceManagerUtils.h"
 #include "Collections/HashMap.h"
 #include "Collections/Vector.h"
@@ -89,6 +90,8 @@ namespace ramses_internal
         virtual void                 updateTextureBuffer(TextureBufferHandle textureBufferHandle, UInt32 mipLevel, UInt32 x, UInt32 y, UInt32 width, UInt32 height, const Byte* data, SceneId sceneId) override;
         virtual DeviceResourceHandle getTextureBufferDeviceHandle(TextureBufferHandle textureBufferHandle, SceneId sceneId) const override;
 
+        virtual Bool                 updateTransientRenderBuffers(const IScene& scene, const RenderBufferHandleVector& transientBuffers) override;
+
         virtual void                 unloadAllSceneResourcesForScene(SceneId sceneId) override;
         virtual void                 unreferenceAllResourcesForScene(SceneId sceneId) override;
         virtual const ResourceContentHashVector* getResourcesInUseByScene(SceneId sceneId) const override;
@@ -99,11 +102,17 @@ namespace ramses_internal
         virtual OffscreenBufferHandle getOffscreenBufferHandle(DeviceResourceHandle bufferDeviceHandle) const override;
         virtual DeviceResourceHandle getStreamBufferDeviceHandle(StreamBufferHandle bufferHandle) const override;
 
+        // memory of render buffers and offscreen buffers reducing resource cache, shared storage counted once
+        UInt64 getRenderTargetMemorySize() const;
+
     private:
         using SceneResourceRegistryMap = HashMap<SceneId, RendererSceneResourceRegistry>;
 
         RendererSceneResourceRegistry& getSceneResourceRegistry(SceneId sceneId);
 
+        DeviceResourceHandle uploadTransientRenderBuffer(TransientRenderBufferPool& pool, const RenderBuffer& renderBuffer, UInt32 byteSize, TransientRenderBufferPool::OwnerId owner);
+        void unloadTransientRenderBuffer(TransientRenderBufferPool& pool, DeviceResourceHandle deviceHandle, TransientRenderBufferPool::OwnerId owner);
+
         struct OffscreenBufferDescriptor
         {
             // Second render target and color buffer are only used for double-buffered offscreen buffers, otherwise just the first
@@ -125,6 +134,11 @@ namespace ramses_internal
         ResourceUploadingManager       m_resourceUploadingManager;
         RendererStatistics&            m_stats;
 
+        // write-only buffers of different scenes and depth buffers of different offscreen buffers which are not interruptible
+        // are never used at the same time, storage is shared between scenes or offscreen buffers respectively
+        TransientRenderBufferPool      m_sceneTransientRenderBuffers;
+        TransientRenderBufferPool      m_offscreenBufferDepthBuffers;
+
         friend class RendererLogger;
         // TODO Violin remove this after KPI monitor is reworked
         friend class GpuMemorySample;
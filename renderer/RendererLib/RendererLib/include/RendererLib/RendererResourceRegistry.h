@@ -34,6 +34,7 @@ namespace ramses_internal
 
         const ResourceDescriptors& getAllResourceDescriptors() const;
         const ResourceContentHashVector& getAllProvidedResources() const;
+        // ordered by the time resource stopped being used by any scene, least recently used first
         const ResourceContentHashVector& getAllResourcesNotInUseByScenes() const;
         const ResourceContentHashVector* getResourcesInUseByScene(SceneId sceneId) const;
 
@@ -39,6 +39,7 @@ namespace ramses_internal
         void                            addRenderBuffer             (RenderBufferHandle handle, DeviceResourceHandle deviceHandle, UInt32 size, bool writeOnly);
         void                            removeRenderBuffer          (RenderBufferHandle handle);
         DeviceResourceHandle            getRenderBufferDeviceHandle (RenderBufferHandle handle) const;
+        void                            setRenderBufferDeviceHandle (RenderBufferHandle handle, DeviceResourceHandle deviceHandle);
         UInt32                          getRenderBufferByteSize     (RenderBufferHandle handle) const;
         void                            getAllRenderBuffers         (RenderBufferHandleVector& renderBuffers) const;
 
@@ -18,6 +18,7 @@
 #include "RendererLib/FrameTimer.h"
 #include "RendererLib/IRendererSceneControl.h"
 #include "RendererLib/IRendererResourceManager.h"
+#include "RendererLib/SceneUpdateScheduler.h"
 #include "Scene/EScenePublicationMode.h"
 #include <unordered_map>
 
@@ -91,6 +92,8 @@ namespace ramses_internal
         void setLimitFlushesForceUnsubscribe(UInt limitForPendingFlushesForceUnsubscribe);
 
         void setSceneReferenceLogicHandler(ISceneReferenceLogic& sceneRefLogic);
+        // zero (default) updates all scenes on the calling thread
+        void setSceneUpdateThreadCount(UInt32 threadCount);
 
     protected:
         virtual std::unique_ptr<IRendererResourceManager> createResourceManager(
@@ -110,6 +113,7 @@ namespace ramses_internal
         void applySceneActions(RendererCachedScene& scene, PendingFlush& flushInfo);
         UInt32 applyPendingFlushes(SceneId sceneID, StagingInfo& stagingInfo);
         void processStagedResourceChanges(SceneId sceneID, StagingInfo& stagingInfo, DisplayHandle& activeDisplay);
+        void updateTransientRenderBuffers(SceneId sceneId, DisplayHandle& activeDisplay);
 
         Bool areResourcesFromPendingFlushesUploaded(SceneId sceneId) const;
         Bool areClientResourcesInUseUploaded(SceneId sceneId) const;
@@ -127,6 +131,7 @@ namespace ramses_internal
         void updateScenesRealTimeAnimationSystems();
         void updateScenesTransformationCache();
         void updateScenesDataLinks();
+        SceneId findTransformationLinkedSceneGroup(SceneId sceneId) const;
         void updateScenesStates();
 
         void activateDisplayContext(DisplayHandle& activeDisplay, DisplayHandle displayToActivate);
@@ -160,8 +165,13 @@ namespace ramses_internal
         using SceneMapRequests = HashMap<SceneId, SceneMapRequest>;
         SceneMapRequests m_scenesToBeMapped;
 
+        std::unique_ptr<SceneUpdateScheduler>             m_sceneUpdateScheduler;
+
         // extracted from RendererSceneUpdater::updateScenesTransformationCache to avoid per frame allocation
         HashSet<SceneId> m_scenesNeedingTransformationCacheUpdate;
+        HashSet<SceneId> m_scenesWithTransformationLinks;
+        HashMap<SceneId, SceneId> m_transformationLinkedSceneGroups;
+        HashMap<SceneId, SceneId> m_lastScheduledSceneOfTransformationGroup;
 
         HashSet<SceneId> m_modifiedScenesToRerender;
         //used as caches for algorithms that mark scenes as modified
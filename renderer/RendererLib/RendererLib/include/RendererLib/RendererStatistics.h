@@ -15,6 +15,7 @@
 #include "Utils/StatisticCollection.h"
 #include "PlatformAbstraction/PlatformTime.h"
 #include "Components/FlushTimeInformation.h"
+#include "RendererLib/GpuTimerQueries.h"
 #include <map>
 
 namespace ramses_internal
@@ -31,12 +32,16 @@ namespace ramses_internal
         void trackArrivedFlush(SceneId sceneId, UInt numSceneActions, UInt numAddedResources, UInt numRemovedResources, UInt numSceneResourceActions, std::chrono::milliseconds latency);
         void flushApplied(SceneId sceneId);
         void flushBlocked(SceneId sceneId);
+        void flushPresented(SceneId sceneId, std::chrono::microseconds arrivalToSwapLatency);
 
         void offscreenBufferSwapped(DisplayHandle displayHandle, DeviceResourceHandle offscreenBuffer, bool isInterruptible);
         void offscreenBufferInterrupted(DisplayHandle displayHandle, DeviceResourceHandle offscreenBuffer);
         void framebufferSwapped(DisplayHandle display);
+        void gpuTimingsCollected(DisplayHandle display, const GpuTimings& timings);
 
         void resourceUploaded(UInt byteSize);
+        void resourceResidencyHit();
+        void resourceEvicted(UInt byteSize);
         void sceneResourceUploaded(SceneId sceneId, UInt byteSize);
         void streamTextureUpdated(WaylandIviSurfaceId sourceId, UInt numUpdates);
         void shaderCompiled(std::chrono::microseconds microsecondsUsed, const String& name, SceneId sceneid);
@@ -59,6 +64,9 @@ namespace ramses_internal
         UInt32 m_frameDurationMax = 0u;
         UInt m_resourcesUploaded = 0u;
         UInt m_resourcesBytesUploaded = 0u;
+        UInt m_resourceResidencyHits = 0u;
+        UInt m_resourcesEvicted = 0u;
+        UInt m_resourcesBytesEvicted = 0u;
         UInt m_shadersCompiled = 0u;
         UInt64 m_microsecondsForShaderCompilation = 0u;
         String m_maximumDurationShaderName;
@@ -84,11 +92,18 @@ namespace ramses_internal
             SummaryEntry<UInt> numResourcesRemovedPerFlush;
             SummaryEntry<UInt> numSceneResourceActionsPerFlush;
             SummaryEntry<int64_t> flushLatency;
+            UInt numFlushesPresented = 0u;
+            SummaryEntry<int64_t> flushArrivalToSwapLatencyUs;
 
             UInt sceneResourcesUploaded = 0u;
             UInt sceneResourcesBytesUploaded = 0u;
 
             UInt numRendered = 0u;
+
+            UInt numGpuTimesMeasured = 0u;
+            SummaryEntry<UInt64> gpuTimeUs;
+            RenderPassHandle mostExpensiveRenderPass;
+            UInt64 mostExpensiveRenderPassGpuTimeUs = 0u;
         };
 
         struct OffscreenBufferStatistics
@@ -101,6 +116,8 @@ namespace ramses_internal
         struct DisplayStatistics
         {
             UInt numFrameBufferSwapped = 0;
+            UInt numGpuFramesMeasured = 0u;
+            SummaryEntry<UInt64> gpuFrameTimeUs;
             std::map<DeviceResourceHandle, OffscreenBufferStatistics> offscreenBufferStatistics;
         };
 
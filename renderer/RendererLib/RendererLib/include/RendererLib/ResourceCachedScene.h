@@ -11,6 +11,7 @@
 
 #include "RendererAPI/Types.h"
 #include "RendererLib/DataReferenceLinkCachedScene.h"
+#include "RendererLib/SceneResourceUploader.h"
 
 namespace ramses_internal
 {
@@ -50,7 +51,12 @@ namespace ramses_internal
         virtual RenderTargetHandle          allocateRenderTarget        (RenderTargetHandle targetHandle = RenderTargetHandle::Invalid()) override;
         virtual BlitPassHandle              allocateBlitPass            (RenderBufferHandle sourceRenderBufferHandle, RenderBufferHandle destinationRenderBufferHandle, BlitPassHandle passHandle = BlitPassHandle::Invalid()) override;
 
+        virtual TextureBufferHandle         allocateTextureBuffer       (ETextureFormat textureFormat, const MipMapDimensions& mipMapDimensions, TextureBufferHandle handle = TextureBufferHandle::Invalid()) override;
+        virtual void                        releaseTextureBuffer        (TextureBufferHandle handle) override;
+        virtual void                        updateTextureBuffer         (TextureBufferHandle handle, UInt32 mipLevel, UInt32 x, UInt32 y, UInt32 width, UInt32 height, const Byte* data) override;
+
         void                                resetResourceCache();
+        void                                resetRenderTargetCache();
 
         Bool                                renderableResourcesDirty    (RenderableHandle handle) const;
         Bool                                renderableResourcesDirty    (const RenderableVector& handles) const;
@@ -66,6 +72,10 @@ namespace ramses_internal
         void setRenderableResourcesDirtyByTextureSampler(TextureSamplerHandle textureSamplerHandle) const;
         void setRenderableResourcesDirtyByStreamTexture(StreamTextureHandle streamTextureHandle) const;
 
+        // texture buffer regions updated since last call to clearTextureBufferDirtyRegions, used to upload only modified texels
+        const TextureBufferDirtyRegions&    getTextureBufferDirtyRegions() const;
+        void                                clearTextureBufferDirtyRegions();
+
     protected:
         Bool resolveTextureSamplerResourceDeviceHandle(const IResourceDeviceHandleAccessor& resourceAccessor, TextureSamplerHandle sampler, DeviceResourceHandle& deviceHandleInOut);
 
@@ -107,6 +117,8 @@ namespace ramses_internal
 
         Bool m_renderTargetsDirty;
         Bool m_blitPassesDirty;
+
+        TextureBufferDirtyRegions m_textureBufferDirtyRegions;
     };
 }
 
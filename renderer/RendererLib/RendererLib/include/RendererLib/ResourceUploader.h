@@ -12,6 +12,9 @@
 #include "IResourceUploader.h"
 #include "Components/ManagedResource.h"
 #include "SceneAPI/SceneId.h"
+#include "Collections/HashMap.h"
+#include "Collections/String.h"
+#include <chrono>
 
 namespace ramses_internal
 {
@@ -29,16 +32,27 @@ namespace ramses_internal
 
         virtual DeviceResourceHandle uploadResource(IRenderBackend& renderBackend, const ResourceDescriptor& resourceObject, UInt32& outVRAMSize) override;
         virtual void                 unloadResource(IRenderBackend& renderBackend, EResourceType type, ResourceContentHash hash, DeviceResourceHandle handle) override;
+        virtual EShaderUploadStatus  getEffectUploadStatus(IRenderBackend& renderBackend, ResourceContentHash hash, DeviceResourceHandle handle) override;
 
     private:
         DeviceResourceHandle uploadTexture(IDevice& device, const TextureResource& texture, UInt32& vramSize);
         DeviceResourceHandle queryBinaryShaderCacheAndUploadEffect(IRenderBackend& renderBackend, const EffectResource& effect, ResourceContentHash hash, SceneId sceneid);
+        DeviceResourceHandle startEffectCompilation(IDevice& device, const EffectResource& effect, ResourceContentHash hash, SceneId sceneid);
 
         static UInt32 EstimateGPUAllocatedSizeOfTexture(const TextureResource& texture, UInt32 numMipLevelsToAllocate);
 
         IBinaryShaderCache* const m_binaryShaderCache;
         bool m_supportedFormatsReported = false;
         RendererStatistics& m_stats;
+
+        // effects compiled from source, statistics and binary shader cache are updated once compilation finished
+        struct EffectCompilation
+        {
+            std::chrono::steady_clock::time_point startTime;
+            String effectName;
+            SceneId sceneId;
+        };
+        HashMap<ResourceContentHash, EffectCompilation> m_pendingEffectCompilations;
     };
 }
 
@@ -37,6 +37,12 @@ namespace ramses_internal
         Bool hasAnythingToUpload() const;
         void uploadAndUnloadPendingResources();
 
+        // memory used by render target backing (render buffers, offscreen buffers) cannot be evicted
+        // but reduces the cache available for resources
+        void addRenderTargetMemory(UInt64 byteSize);
+        void removeRenderTargetMemory(UInt64 byteSize);
+        UInt64 getRenderTargetMemorySize() const;
+
         static const UInt32 NumResourcesToUploadInBetweenTimeBudgetChecks = 10u;
         static const UInt32 LargeResourceByteSizeThreshold = 250000u;
 
@@ -45,6 +51,8 @@ namespace ramses_internal
         void uploadResources(const ResourceContentHashVector& resourcesToUpload);
         void uploadResource(const ResourceDescriptor& rd);
         void unloadResource(const ResourceDescriptor& rd);
+        void markResourceUploaded(const ResourceContentHash& hash, DeviceResourceHandle deviceHandle, UInt32 vramSize);
+        void updatePendingShaderUploads();
         void getResourcesToUnloadNext(ResourceContentHashVector& resourcesToUnload, Bool keepEffects, UInt64 sizeToBeFreed) const;
         void getAndPrepareResourcesToUploadNext(ResourceContentHashVector& resourcesToUpload, UInt64& totalSize) const;
         UInt64 getAmountOfMemoryToBeFreedForNewResources(UInt64 sizeToUpload) const;
@@ -56,11 +64,23 @@ namespace ramses_internal
         const Bool   m_keepEffects;
         const FrameTimer& m_frameTimer;
 
+        // GPU memory footprint of uploaded resources as reported by uploader
         using SizeMap = HashMap<ResourceContentHash, UInt32>;
         SizeMap       m_resourceSizes;
         UInt64        m_resourceTotalUploadedSize = 0u;
+        UInt64        m_renderTargetMemorySize = 0u;
         const UInt64  m_resourceCacheSize = 0u;
 
+        // effects being compiled by device in parallel to rendering, they stay in provided state until compiled
+        struct PendingShaderUpload
+        {
+            ManagedResource resource;
+            DeviceResourceHandle deviceHandle;
+            UInt32 vramSize;
+        };
+        Bool finishShaderUploadIfCompleted(const ResourceContentHash& hash, const PendingShaderUpload& pendingUpload);
+        HashMap<ResourceContentHash, PendingShaderUpload> m_pendingShaderUploads;
+
         RendererStatistics& m_stats;
     };
 }
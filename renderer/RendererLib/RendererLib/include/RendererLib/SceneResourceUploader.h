@@ -10,12 +10,18 @@
 #define RAMSES_SCENERESOURCEUPLOADER_H
 
 #include "SceneAPI/Handles.h"
+#include "Collections/HashMap.h"
+#include "Math3d/Quad.h"
+#include <vector>
 
 namespace ramses_internal
 {
     class IScene;
     class IRendererResourceManager;
 
+    // regions of texture buffer mip levels modified since their last upload, indexed by mip level, empty quad if mip is unchanged
+    using TextureBufferDirtyRegions = HashMap<TextureBufferHandle, std::vector<Quad>>;
+
     class SceneResourceUploader
     {
     public:
@@ -23,7 +29,8 @@ namespace ramses_internal
         static void UploadRenderBuffer(const IScene& scene, RenderBufferHandle renderBuffer, IRendererResourceManager& resourceManager);
         static void UploadBlitPassRenderTargets(const IScene& scene, BlitPassHandle blitPass, IRendererResourceManager& resourceManager);
         static void UploadTextureBuffer(const IScene& scene, TextureBufferHandle textureBuffer, IRendererResourceManager& resourceManager);
-        static void UpdateTextureBuffer(const IScene& scene, TextureBufferHandle textureBuffer, IRendererResourceManager& resourceManager);
+        // uploads only dirty regions if given dirty regions contain the texture buffer, whole mip levels otherwise
+        static void UpdateTextureBuffer(const IScene& scene, TextureBufferHandle textureBuffer, IRendererResourceManager& resourceManager, const TextureBufferDirtyRegions* dirtyRegions = nullptr);
     };
 }
 
@@ -0,0 +1,80 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2020 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#ifndef RAMSES_SCENEUPDATESCHEDULER_H
+#define RAMSES_SCENEUPDATESCHEDULER_H
+
+#include "SceneAPI/SceneId.h"
+#include "Collections/HashMap.h"
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <condition_variable>
+#include <vector>
+
+namespace ramses_internal
+{
+    class ThreadedTaskExecutor;
+
+    // Executes one update stage for a set of scenes as a task graph.
+    // Scenes without dependency between each other are updated concurrently on worker threads,
+    // a scene is only started once all scenes it depends on finished their update.
+    // With zero worker threads all scenes are updated on the calling thread in the order they were added.
+    class SceneUpdateScheduler
+    {
+    public:
+        using UpdateFunction = std::function<void(SceneId)>;
+
+        explicit SceneUpdateScheduler(UInt32 threadCount);
+        ~SceneUpdateScheduler();
+
+        UInt32 getThreadCount() const;
+
+        // scenes must be added in an order satisfying all dependencies added later
+        void addScene(SceneId sceneId);
+        // both scenes must have been added before
+        void addDependency(SceneId sceneToUpdateFirst, SceneId sceneToUpdateAfter);
+
+        // runs update for all added scenes and blocks until all are done, graph is cleared afterwards
+        void execute(const UpdateFunction& update);
+
+        SceneUpdateScheduler(const SceneUpdateScheduler&) = delete;
+        SceneUpdateScheduler& operator=(const SceneUpdateScheduler&) = delete;
+
+    private:
+        class SceneUpdateTask;
+
+        struct Node
+        {
+            SceneId sceneId;
+            UInt32 numDependencies = 0u;
+            std::vector<UInt32> successors;
+        };
+
+        void clear();
+        void executeSerially(const UpdateFunction& update);
+        void executeConcurrently(const UpdateFunction& update);
+        void onSceneUpdated(UInt32 nodeIndex);
+        void enqueue(UInt32 nodeIndex);
+
+        const UInt32 m_threadCount;
+        std::unique_ptr<ThreadedTaskExecutor> m_executor;
+
+        std::vector<Node> m_nodes;
+        HashMap<SceneId, UInt32> m_sceneToNode;
+
+        std::vector<std::unique_ptr<SceneUpdateTask>> m_tasks;
+        const UpdateFunction* m_update = nullptr;
+        std::vector<UInt32> m_pendingDependencies;
+        UInt32 m_numScenesFinished = 0u;
+        std::mutex m_lock;
+        std::condition_variable m_allScenesFinished;
+    };
+}
+
+#endif
@@ -0,0 +1,56 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2020 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#ifndef RAMSES_TRANSIENTRENDERBUFFERPOOL_H
+#define RAMSES_TRANSIENTRENDERBUFFERPOOL_H
+
+#include "RendererAPI/Types.h"
+#include "SceneAPI/RenderBuffer.h"
+#include <vector>
+
+namespace ramses_internal
+{
+    // Keeps track of render buffer storage shared by several owners whose use of the buffer content never overlaps
+    // within a frame, e.g. scenes rendered one after another. Storage is shared only between buffers of same
+    // properties (type, format, size, sample count) and never between two buffers of the same owner.
+    // The pool does not create or delete any device resources, it only tells when storage can be reused or deleted.
+    class TransientRenderBufferPool
+    {
+    public:
+        using OwnerId = UInt64;
+
+        // returns storage of matching properties not used by owner yet and adds owner to its users, invalid if none
+        DeviceResourceHandle acquire(const RenderBuffer& renderBuffer, OwnerId owner);
+        // adds newly created storage used by owner
+        void add(const RenderBuffer& renderBuffer, DeviceResourceHandle deviceHandle, UInt32 byteSize, OwnerId owner);
+        // removes owner from users of storage, returns true if there are no users left and storage can be deleted
+        Bool release(DeviceResourceHandle deviceHandle, OwnerId owner);
+
+        Bool contains(DeviceResourceHandle deviceHandle) const;
+        UInt32 getUserCount(DeviceResourceHandle deviceHandle) const;
+        UInt32 getByteSize(DeviceResourceHandle deviceHandle) const;
+        // memory which would be needed additionally if every user had its own storage
+        UInt64 getSavedMemory() const;
+
+    private:
+        struct Entry
+        {
+            RenderBuffer renderBuffer;
+            DeviceResourceHandle deviceHandle;
+            UInt32 byteSize;
+            std::vector<OwnerId> owners;
+        };
+
+        std::vector<Entry>::iterator findEntry(DeviceResourceHandle deviceHandle);
+        std::vector<Entry>::const_iterator findEntry(DeviceResourceHandle deviceHandle) const;
+
+        std::vector<Entry> m_entries;
+    };
+}
+
+#endif
@@ -0,0 +1,35 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2020 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#ifndef RAMSES_TRANSIENTRENDERBUFFERUTILS_H
+#define RAMSES_TRANSIENTRENDERBUFFERUTILS_H
+
+#include "SceneAPI/SceneTypes.h"
+#include "SceneAPI/TextureEnums.h"
+
+namespace ramses_internal
+{
+    class IScene;
+
+    class TransientRenderBufferUtils
+    {
+    public:
+        static Bool HasWriteOnlyRenderBuffers(const IScene& scene);
+
+        // Collects write-only render buffers whose content is produced and consumed within single rendering of the scene,
+        // i.e. every render target containing the buffer is cleared by its first render pass, the buffer is not used in any blit pass
+        // and no render pass into it is rendered only once. Such buffers can share storage with buffers of other scenes.
+        static void GetTransientRenderBuffers(const IScene& scene, RenderBufferHandleVector& transientBuffers);
+
+    private:
+        static UInt32 GetClearFlagsBeforeUse(const IScene& scene, RenderTargetHandle renderTarget);
+        static UInt32 GetRequiredClearFlags(ERenderBufferType bufferType);
+    };
+}
+
+#endif
@@ -59,7 +59,8 @@ namespace ramses_internal
             IRendererSceneEventSender& rendererSceneSender,
             IPlatform& platform,
             RendererStatistics& m_rendererStatistics,
-            const String& monitorFilename = String());
+            const String& monitorFilename = String(),
+            UInt32 sceneUpdateThreadCount = 0u);
 
         void doOneLoop(ELoopMode loopMode, std::chrono::microseconds sleepTime = std::chrono::microseconds{0});
 
@@ -24,6 +24,7 @@ namespace ramses_internal
         Bool addDependency(SceneId providerScene, SceneId consumerScene);
         void removeDependency(SceneId providerScene, SceneId consumerScene);
         Bool hasDependencyAsConsumer(SceneId scene) const;
+        const SceneIdVector* getProviderScenes(SceneId consumerScene) const;
         void removeScene(SceneId scene);
         const SceneIdVector& getDependentScenesInOrder() const;
         Bool isEmpty() const;
@@ -163,6 +163,16 @@ namespace ramses_internal
         return m_keepEffectsUploaded;
     }
 
+    Bool DisplayConfig::isPartialFramebufferUpdateEnabled() const
+    {
+        return m_partialFramebufferUpdateEnabled;
+    }
+
+    void DisplayConfig::setPartialFramebufferUpdateEnabled(Bool enable)
+    {
+        m_partialFramebufferUpdateEnabled = enable;
+    }
+
     Bool DisplayConfig::isResizable() const
     {
         return m_resizable;
@@ -230,6 +240,7 @@ namespace ramses_internal
             m_integrityRGLDeviceUnit     == other.m_integrityRGLDeviceUnit &&
             m_startVisibleIvi            == other.m_startVisibleIvi &&
             m_resizable                  == other.m_resizable &&
+            m_partialFramebufferUpdateEnabled == other.m_partialFramebufferUpdateEnabled &&
             m_gpuMemoryCacheSize         == other.m_gpuMemoryCacheSize &&
             m_clearColor                 == other.m_clearColor &&
             m_windowsWindowHandle        == other.m_windowsWindowHandle &&
@@ -21,6 +21,14 @@
 
 namespace ramses_internal
 {
+    namespace
+    {
+        RenderState::ScissorRegion ToScissorRegion(const Viewport& region)
+        {
+            return { static_cast<Int16>(region.posX), static_cast<Int16>(region.posY), static_cast<UInt16>(region.width), static_cast<UInt16>(region.height) };
+        }
+    }
+
     DisplayController::DisplayController(IRenderBackend& renderer, UInt32 /*samples*/, UInt32 postProcessingEffectIds)
         : m_renderBackend(renderer)
         , m_device(m_renderBackend.getDevice())
@@ -28,6 +36,7 @@ namespace ramses_internal
         , m_displayWidth(m_renderBackend.getSurface().getWindow().getWidth())
         , m_displayHeight(m_renderBackend.getSurface().getWindow().getHeight())
         , m_postProcessing(new Postprocessing(postProcessingEffectIds, m_displayWidth, m_displayHeight, m_device))
+        , m_gpuTimerQueries(m_device)
     {
     }
 
@@ -44,13 +53,30 @@ namespace ramses_internal
     void DisplayController::enableContext()
     {
         m_renderBackend.getSurface().enable();
+        // context is enabled before anything is rendered to display in a frame
+        m_gpuTimerQueries.beginFrame();
     }
 
     void DisplayController::swapBuffers()
     {
+        m_gpuTimerQueries.finishFrame();
+
         ISurface& surface = m_renderBackend.getSurface();
         surface.swapBuffers();
         surface.frameRendered();
+        m_hasRepaintRegion = false;
+
+        validateRenderingStatusHealthy();
+    }
+
+    void DisplayController::swapBuffersWithDamage(const Viewport& damageRegion)
+    {
+        m_gpuTimerQueries.finishFrame();
+
+        ISurface& surface = m_renderBackend.getSurface();
+        surface.swapBuffersWithDamage(damageRegion);
+        surface.frameRendered();
+        m_hasRepaintRegion = false;
 
         validateRenderingStatusHealthy();
     }
@@ -58,9 +84,18 @@ namespace ramses_internal
     SceneRenderExecutionIterator DisplayController::renderScene(const RendererCachedScene& scene, DeviceResourceHandle buffer, const Viewport& viewport, const SceneRenderExecutionIterator& renderFrom, const FrameTimer* frameTimer)
     {
         const TargetBufferInfo bufferInfo{ buffer, viewport.width, viewport.height };
-        RenderExecutor executor(m_renderBackend.getDevice(), bufferInfo, renderFrom, frameTimer);
+        GpuTimerQueries* gpuTimerQueries = m_gpuTimerQueries.isEnabled() ? &m_gpuTimerQueries : nullptr;
+        RenderExecutor executor(m_renderBackend.getDevice(), bufferInfo, renderFrom, frameTimer, gpuTimerQueries);
+        if (m_hasRepaintRegion && buffer == getDisplayBuffer())
+            executor.setFramebufferRepaintRegion(ToScissorRegion(m_repaintRegion));
 
-        return executor.executeScene(scene);
+        if (gpuTimerQueries)
+            gpuTimerQueries->beginScene(scene.getSceneId());
+        const SceneRenderExecutionIterator renderedUntil = executor.executeScene(scene);
+        if (gpuTimerQueries)
+            gpuTimerQueries->endScene();
+
+        return renderedUntil;
     }
 
     void DisplayController::executePostProcessing()
@@ -74,10 +109,26 @@ namespace ramses_internal
         m_device.colorMask(true, true, true, true);
         m_device.clearColor(clearColor);
         m_device.depthWrite(EDepthWrite::Enabled);
-        m_device.scissorTest(EScissorTest::Disabled, {});
+        if (m_hasRepaintRegion && buffer == getDisplayBuffer())
+            m_device.scissorTest(EScissorTest::Enabled, ToScissorRegion(m_repaintRegion));
+        else
+            m_device.scissorTest(EScissorTest::Disabled, {});
         m_device.clear(EClearFlags_All);
     }
 
+    UInt32 DisplayController::getDisplayBufferAge() const
+    {
+        return m_renderBackend.getSurface().getBufferAge();
+    }
+
+    void DisplayController::setDisplayBufferRepaintRegion(const Viewport& region)
+    {
+        m_hasRepaintRegion = true;
+        m_repaintRegion = region;
+        // lets platform skip preserving content outside of region, only a hint
+        m_renderBackend.getSurface().setDamageRegion(region);
+    }
+
     void DisplayController::readPixels(DeviceResourceHandle renderTargetHandle, UInt32 x, UInt32 y, UInt32 width, UInt32 height, std::vector<UInt8>& dataOut)
     {
         // if readPixels requested from display buffer we need to query actual framebuffer's device handle
@@ -127,6 +178,11 @@ namespace ramses_internal
         return m_embeddedCompositingManager;
     }
 
+    void DisplayController::collectGpuTimings(GpuTimings& timingsOut)
+    {
+        m_gpuTimerQueries.collectTimings(timingsOut);
+    }
+
     void DisplayController::validateRenderingStatusHealthy() const
     {
         m_renderBackend.getDevice().validateDeviceStatusHealthy();
@@ -0,0 +1,71 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2020 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "RendererLib/FrameDeadlineScheduler.h"
+#include <algorithm>
+
+namespace ramses_internal
+{
+    void FrameDeadlineScheduler::setFrameDuration(std::chrono::microseconds frameDuration)
+    {
+        m_frameDuration = frameDuration;
+    }
+
+    std::chrono::microseconds FrameDeadlineScheduler::getFrameDuration() const
+    {
+        return m_frameDuration;
+    }
+
+    UInt64 FrameDeadlineScheduler::getPlannedFrameStart() const
+    {
+        // keep 1/8 of estimated loop duration as safety margin against jitter
+        const UInt64 budget = static_cast<UInt64>((m_estimatedLoopDuration + m_estimatedLoopDuration / 8).count());
+        const UInt64 justInTimeStart = (m_deadline > budget ? m_deadline - budget : 0u);
+        return std::max(m_previousDeadline, justInTimeStart);
+    }
+
+    UInt64 FrameDeadlineScheduler::getEarliestFrameStart() const
+    {
+        return m_previousDeadline;
+    }
+
+    UInt64 FrameDeadlineScheduler::getFrameDeadline() const
+    {
+        return m_deadline;
+    }
+
+    std::chrono::microseconds FrameDeadlineScheduler::getEstimatedLoopDuration() const
+    {
+        return m_estimatedLoopDuration;
+    }
+
+    void FrameDeadlineScheduler::frameStarted(UInt64 timeStamp)
+    {
+        m_frameStart = timeStamp;
+        if (timeStamp >= m_deadline)
+        {
+            // first frame or deadline already missed (e.g. stalled or long loop),
+            // aim for earliest possible presentation and continue deadline grid from there
+            const auto loopDuration = std::min(m_estimatedLoopDuration, m_frameDuration);
+            m_deadline = timeStamp + static_cast<UInt64>(loopDuration.count());
+        }
+    }
+
+    void FrameDeadlineScheduler::frameFinished(UInt64 timeStamp)
+    {
+        const std::chrono::microseconds loopDuration{ timeStamp > m_frameStart ? timeStamp - m_frameStart : 0u };
+        // follow longer loops immediately, shorter ones slowly to not miss deadlines on occasional spikes
+        if (loopDuration >= m_estimatedLoopDuration)
+            m_estimatedLoopDuration = loopDuration;
+        else
+            m_estimatedLoopDuration -= (m_estimatedLoopDuration - loopDuration) / 8;
+
+        m_previousDeadline = m_deadline;
+        m_deadline += static_cast<UInt64>(m_frameDuration.count());
+    }
+}
@@ -10,6 +10,7 @@
 #include "Collections/StringOutputStream.h"
 #include "Utils/LoggingUtils.h"
 #include "PlatformAbstraction/PlatformMath.h"
+#include "Utils/TraceRecorder.h"
 
 namespace ramses_internal
 {
@@ -51,6 +52,7 @@ namespace ramses_internal
 
         const UInt totalRegionTime = static_cast<UInt>(PlatformTime::GetMicrosecondsMonotonic() - m_regionStartTimes[regionId]);
         m_frameTimings[m_frameTimings.size() - NumberOfRegions + regionId] = totalRegionTime;
+        GetTraceRecorder().addCompleteEvent("renderer", EnumToString(region), m_regionStartTimes[regionId], totalRegionTime);
 
         // add previous region time to current region to get stacked accumulated values which can be used directly by the FrameProfileRenderer
         const UInt entryId = getEntryIdForCurrentRegion();
@@ -0,0 +1,90 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2020 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "RendererLib/FramebufferDamageTracker.h"
+#include <algorithm>
+
+namespace ramses_internal
+{
+    void FramebufferDamageTracker::addDamage(const Viewport& region)
+    {
+        m_currentFrame.region = Unite(m_currentFrame.region, region);
+    }
+
+    void FramebufferDamageTracker::setFullyDamaged()
+    {
+        m_currentFrame.fullyDamaged = true;
+    }
+
+    Bool FramebufferDamageTracker::isFullyDamaged() const
+    {
+        return m_currentFrame.fullyDamaged;
+    }
+
+    const Viewport& FramebufferDamageTracker::getDamage() const
+    {
+        return m_currentFrame.region;
+    }
+
+    Bool FramebufferDamageTracker::getRepaintRegion(UInt32 bufferAge, Viewport& regionOut) const
+    {
+        // content of age 1 is the last presented frame, older content misses also damage of frames presented since
+        if (bufferAge == 0u || bufferAge > MaxBufferAge || bufferAge - 1u > m_presentedFrames.size() || m_currentFrame.fullyDamaged)
+            return false;
+
+        Viewport region = m_currentFrame.region;
+        for (UInt32 i = 0u; i < bufferAge - 1u; ++i)
+        {
+            const FrameDamage& presentedFrame = m_presentedFrames[i];
+            if (presentedFrame.fullyDamaged)
+                return false;
+            region = Unite(region, presentedFrame.region);
+        }
+
+        regionOut = region;
+        return true;
+    }
+
+    void FramebufferDamageTracker::framePresented()
+    {
+        m_presentedFrames.push_front(m_currentFrame);
+        if (m_presentedFrames.size() >= MaxBufferAge)
+            m_presentedFrames.pop_back();
+        m_currentFrame = {};
+    }
+
+    Bool FramebufferDamageTracker::IsEmpty(const Viewport& region)
+    {
+        return region.width == 0u || region.height == 0u;
+    }
+
+    Viewport FramebufferDamageTracker::Unite(const Viewport& region1, const Viewport& region2)
+    {
+        if (IsEmpty(region1))
+            return region2;
+        if (IsEmpty(region2))
+            return region1;
+
+        const Int32 left = std::min(region1.posX, region2.posX);
+        const Int32 bottom = std::min(region1.posY, region2.posY);
+        const Int32 right = std::max(region1.posX + Int32(region1.width), region2.posX + Int32(region2.width));
+        const Int32 top = std::max(region1.posY + Int32(region1.height), region2.posY + Int32(region2.height));
+        return { left, bottom, UInt32(right - left), UInt32(top - bottom) };
+    }
+
+    Viewport FramebufferDamageTracker::Intersect(const Viewport& region1, const Viewport& region2)
+    {
+        const Int32 left = std::max(region1.posX, region2.posX);
+        const Int32 bottom = std::max(region1.posY, region2.posY);
+        const Int32 right = std::min(region1.posX + Int32(region1.width), region2.posX + Int32(region2.width));
+        const Int32 top = std::min(region1.posY + Int32(region1.height), region2.posY + Int32(region2.height));
+        if (right <= left || top <= bottom)
+            return {};
+        return { left, bottom, UInt32(right - left), UInt32(top - bottom) };
+    }
+}
@@ -57,6 +57,8 @@ namespace ramses_internal
                     increaseMemUsageForOffscreenBuffer(resourceManager->m_offscreenBuffers.getMemory(i)->m_estimatedVRAMUsage);
                 }
             }
+
+            decreaseMemUsageForSharedRenderBuffers(resourceManager->m_sceneTransientRenderBuffers.getSavedMemory() + resourceManager->m_offscreenBufferDepthBuffers.getSavedMemory());
         }
     }
 
@@ -91,6 +93,11 @@ namespace ramses_internal
         return m_renderbufferMemoryUsage;
     }
 
+    UInt64 GpuMemorySample::getSharedRenderbufferMemorySaving() const
+    {
+        return m_sharedRenderbufferMemorySaving;
+    }
+
     SceneIdVector GpuMemorySample::getSampledScenes() const
     {
         SceneIdVector sampledScenes;
@@ -0,0 +1,204 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2020 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "RendererLib/GpuTimerQueries.h"
+#include "RendererAPI/IDevice.h"
+#include <cassert>
+
+namespace ramses_internal
+{
+    constexpr UInt32 GpuTimerQueries::NumFramesInFlight;
+    constexpr UInt32 GpuTimerQueries::MaximumIntervalsPerFrame;
+    constexpr UInt32 GpuTimerQueries::NoInterval;
+
+    GpuTimerQueries::GpuTimerQueries(IDevice& device)
+        : m_device(device)
+        , m_enabled(device.isGpuTimerQuerySupported())
+    {
+    }
+
+    GpuTimerQueries::~GpuTimerQueries()
+    {
+        for (const auto& frame : m_frames)
+        {
+            for (const auto query : frame.queries)
+                m_device.deleteGpuTimerQuery(query);
+        }
+    }
+
+    Bool GpuTimerQueries::isEnabled() const
+    {
+        return m_enabled;
+    }
+
+    void GpuTimerQueries::beginFrame()
+    {
+        if (!m_enabled)
+            return;
+
+        Frame& frame = m_frames[m_currentFrame];
+        assert(!frame.pending);
+        // frame might be begun multiple times before it is finished, first call marks its start
+        if (!frame.intervals.empty())
+            return;
+
+        // first interval of frame spans whole frame
+        const UInt32 frameStart = issueTimestamp();
+        frame.intervals.push_back({ SceneId::Invalid(), RenderPassHandle::Invalid(), frameStart, frameStart });
+    }
+
+    void GpuTimerQueries::beginScene(SceneId sceneId)
+    {
+        assert(m_openSceneInterval == NoInterval);
+        if (!m_enabled || !beginInterval(sceneId, RenderPassHandle::Invalid(), m_openSceneInterval))
+            m_openSceneInterval = NoInterval;
+    }
+
+    void GpuTimerQueries::endScene()
+    {
+        endInterval(m_openSceneInterval);
+        m_openSceneInterval = NoInterval;
+    }
+
+    void GpuTimerQueries::beginRenderPass(RenderPassHandle renderPass)
+    {
+        assert(m_openRenderPassInterval == NoInterval);
+        // render passes are attributed to scene they belong to, not measured outside of scene
+        if (m_openSceneInterval == NoInterval)
+            return;
+
+        const SceneId sceneId = m_frames[m_currentFrame].intervals[m_openSceneInterval].sceneId;
+        if (!beginInterval(sceneId, renderPass, m_openRenderPassInterval))
+            m_openRenderPassInterval = NoInterval;
+    }
+
+    void GpuTimerQueries::endRenderPass()
+    {
+        endInterval(m_openRenderPassInterval);
+        m_openRenderPassInterval = NoInterval;
+    }
+
+    void GpuTimerQueries::finishFrame()
+    {
+        if (!m_enabled)
+            return;
+        assert(m_openSceneInterval == NoInterval && m_openRenderPassInterval == NoInterval);
+
+        Frame& frame = m_frames[m_currentFrame];
+        if (!frame.intervals.empty())
+        {
+            // first interval of frame spans whole frame
+            frame.intervals.front().endQuery = issueTimestamp();
+            frame.pending = true;
+            m_currentFrame = (m_currentFrame + 1u) % NumFramesInFlight;
+        }
+
+        // results of frames in flight might be unreliable if there was a disjoint operation meanwhile
+        const Bool disjoint = m_device.checkAndResetGpuTimerDisjoint();
+
+        // collect oldest first, frames complete in order so stop at first one not available yet
+        for (UInt32 i = 0u; i < NumFramesInFlight; ++i)
+        {
+            Frame& frameInFlight = m_frames[(m_currentFrame + i) % NumFramesInFlight];
+            if (!frameInFlight.pending)
+                continue;
+
+            if (disjoint)
+            {
+                ++m_droppedFrames;
+                resetFrame(frameInFlight);
+            }
+            else if (!tryCollectFrame(frameInFlight))
+                break;
+        }
+
+        // queries of next frame slot are about to be reused, never wait for its results
+        Frame& nextFrame = m_frames[m_currentFrame];
+        if (nextFrame.pending)
+        {
+            ++m_droppedFrames;
+            resetFrame(nextFrame);
+        }
+    }
+
+    void GpuTimerQueries::collectTimings(GpuTimings& timingsOut)
+    {
+        timingsOut.clear();
+        timingsOut.swap(m_finishedTimings);
+    }
+
+    UInt32 GpuTimerQueries::getNumberOfDroppedFrames() const
+    {
+        return m_droppedFrames;
+    }
+
+    UInt32 GpuTimerQueries::issueTimestamp()
+    {
+        Frame& frame = m_frames[m_currentFrame];
+        if (frame.numQueriesUsed == frame.queries.size())
+            frame.queries.push_back(m_device.allocateGpuTimerQuery());
+
+        const UInt32 queryIndex = frame.numQueriesUsed++;
+        m_device.issueGpuTimestamp(frame.queries[queryIndex]);
+        return queryIndex;
+    }
+
+    Bool GpuTimerQueries::beginInterval(SceneId sceneId, RenderPassHandle renderPass, UInt32& intervalIndexOut)
+    {
+        Frame& frame = m_frames[m_currentFrame];
+        assert(!frame.pending);
+        // nothing is measured outside of begun frame
+        if (frame.intervals.empty() || frame.intervals.size() >= MaximumIntervalsPerFrame)
+            return false;
+
+        intervalIndexOut = static_cast<UInt32>(frame.intervals.size());
+        const UInt32 start = issueTimestamp();
+        frame.intervals.push_back({ sceneId, renderPass, start, start });
+        return true;
+    }
+
+    void GpuTimerQueries::endInterval(UInt32 intervalIndex)
+    {
+        if (intervalIndex == NoInterval)
+            return;
+
+        Frame& frame = m_frames[m_currentFrame];
+        assert(intervalIndex < frame.intervals.size());
+        frame.intervals[intervalIndex].endQuery = issueTimestamp();
+    }
+
+    Bool GpuTimerQueries::tryCollectFrame(Frame& frame)
+    {
+        assert(frame.pending && frame.numQueriesUsed > 0u);
+
+        m_timestamps.resize(frame.numQueriesUsed);
+        // last query is frame end, check it first to avoid reading anything if frame not finished yet
+        for (UInt32 i = frame.numQueriesUsed; i > 0u; --i)
+        {
+            if (!m_device.getGpuTimestamp(frame.queries[i - 1u], m_timestamps[i - 1u]))
+                return false;
+        }
+
+        for (const auto& interval : frame.intervals)
+        {
+            const UInt64 start = m_timestamps[interval.startQuery];
+            const UInt64 end = m_timestamps[interval.endQuery];
+            m_finishedTimings.push_back({ interval.sceneId, interval.renderPass, end > start ? end - start : 0u });
+        }
+
+        resetFrame(frame);
+        return true;
+    }
+
+    void GpuTimerQueries::resetFrame(Frame& frame)
+    {
+        frame.numQueriesUsed = 0u;
+        frame.intervals.clear();
+        frame.pending = false;
+    }
+}
@@ -274,6 +274,18 @@ namespace ramses_internal
         m_logContext << "activate shader [handle: " << handle << "]" << RendererLogContext::NewLine;
     }
 
+    DeviceResourceHandle LoggingDevice::startShaderUpload(const EffectResource& effect)
+    {
+        m_logContext << "upload shader " << effect.getName() << RendererLogContext::NewLine;
+        return DeviceResourceHandle::Invalid();
+    }
+
+    EShaderUploadStatus LoggingDevice::getShaderUploadStatus(DeviceResourceHandle handle)
+    {
+        UNUSED(handle);
+        return EShaderUploadStatus::Uploaded;
+    }
+
     DeviceResourceHandle LoggingDevice::allocateTexture2D(UInt32 width, UInt32 height, ETextureFormat format, const TextureSwizzleArray& swizzle, UInt32 mipLevelCount, UInt32 totalSizeInBytes)
     {
         m_logContext << "allocate texture2d [ (w,h):(" << width << "," << height << ") mipLevelCount:" << mipLevelCount << " format:" << EnumToString(format) << "textureSwizzle:"<< EnumToString(swizzle[0]) << ";" << EnumToString(swizzle[1]) << ";" << EnumToString(swizzle[2]) << ";" << EnumToString(swizzle[3]) << ";" << " totalSizeInBytes:" << totalSizeInBytes << "]" << RendererLogContext::NewLine;
@@ -410,6 +422,35 @@ namespace ramses_internal
     {
     }
 
+    Bool LoggingDevice::isGpuTimerQuerySupported() const
+    {
+        // logging does not execute anything on GPU, there is nothing to time
+        return false;
+    }
+
+    DeviceResourceHandle LoggingDevice::allocateGpuTimerQuery()
+    {
+        return DeviceResourceHandle::Invalid();
+    }
+
+    void LoggingDevice::deleteGpuTimerQuery(DeviceResourceHandle /*handle*/)
+    {
+    }
+
+    void LoggingDevice::issueGpuTimestamp(DeviceResourceHandle /*handle*/)
+    {
+    }
+
+    Bool LoggingDevice::getGpuTimestamp(DeviceResourceHandle /*handle*/, UInt64& /*timestampNs*/)
+    {
+        return false;
+    }
+
+    Bool LoggingDevice::checkAndResetGpuTimerDisjoint()
+    {
+        return false;
+    }
+
     UInt32 LoggingDevice::getTotalGpuMemoryUsageInKB() const
     {
         return m_deviceDelegate.getTotalGpuMemoryUsageInKB();
@@ -38,6 +38,7 @@ namespace ramses_internal
         SummaryEntry<UInt64> memoryUsageTexturesMB;
         SummaryEntry<UInt64> memoryUsageGeometryMB;
         SummaryEntry<UInt64> memoryUsageRenderBuffersMB;
+        SummaryEntry<UInt64> memorySavedBySharedRenderBuffersMB;
         HashMap<SceneId, SummaryEntry<UInt64>> memoryUsagePerScene;
 
         for (const auto& memSample : m_memorySamples)
@@ -46,6 +47,7 @@ namespace ramses_internal
             memoryUsageTexturesMB.update(memSample.getTextureMemoryUsage() >> 20);
             memoryUsageGeometryMB.update(memSample.getGeometryMemoryUsage() >> 20);
             memoryUsageRenderBuffersMB.update(memSample.getRenderbufferMemoryUsage() >> 20);
+            memorySavedBySharedRenderBuffersMB.update(memSample.getSharedRenderbufferMemorySaving() >> 20);
 
             const SceneIdVector& sampledScenes = memSample.getSampledScenes();
             for (const auto& scene : sampledScenes)
@@ -60,6 +62,7 @@ namespace ramses_internal
         str << "Tex (Avg:" << memoryUsageTexturesMB.sum / m_memorySamples.size() << ";Min:" << memoryUsageTexturesMB.minValue << ";Max:" << memoryUsageTexturesMB.maxValue << "); ";
         str << "Geom (Avg:" << memoryUsageGeometryMB.sum / m_memorySamples.size() << ";Min:" << memoryUsageGeometryMB.minValue << ";Max:" << memoryUsageGeometryMB.maxValue << "); ";
         str << "RendBuf (Avg:" << memoryUsageRenderBuffersMB.sum / m_memorySamples.size() << ";Min:" << memoryUsageRenderBuffersMB.minValue << ";Max:" << memoryUsageRenderBuffersMB.maxValue << "); ";
+        str << "RendBufSaved (Avg:" << memorySavedBySharedRenderBuffersMB.sum / m_memorySamples.size() << ";Min:" << memorySavedBySharedRenderBuffersMB.minValue << ";Max:" << memorySavedBySharedRenderBuffersMB.maxValue << "); ";
         for (const auto& scene : memoryUsagePerScene)
         {
             const SummaryEntry<UInt64>& sceneMemorySample = scene.value;
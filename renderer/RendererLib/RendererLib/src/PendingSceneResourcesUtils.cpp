@@ -75,7 +75,7 @@ namespace ramses_internal
         }
     }
 
-    bool PendingSceneResourcesUtils::ApplySceneResourceActions(const SceneResourceActionVector& actions, const IScene& scene, IRendererResourceManager& resourceManager, const FrameTimer* frameTimer)
+    bool PendingSceneResourcesUtils::ApplySceneResourceActions(const SceneResourceActionVector& actions, const IScene& scene, IRendererResourceManager& resourceManager, const FrameTimer* frameTimer, const TextureBufferDirtyRegions* textureBufferDirtyRegions)
     {
         constexpr size_t TimeCheckPeriod = 20u;
         constexpr size_t ThresholdForTimeChecking = 100u;
@@ -129,7 +129,7 @@ namespace ramses_internal
                 SceneResourceUploader::UploadTextureBuffer(scene, TextureBufferHandle(handle), resourceManager);
                 break;
             case ESceneResourceAction_UpdateTextureBuffer:
-                SceneResourceUploader::UpdateTextureBuffer(scene, TextureBufferHandle(handle), resourceManager);
+                SceneResourceUploader::UpdateTextureBuffer(scene, TextureBufferHandle(handle), resourceManager, textureBufferDirtyRegions);
                 break;
             case ESceneResourceAction_DestroyTextureBuffer:
                 resourceManager.unloadTextureBuffer(TextureBufferHandle(handle), scene.getSceneId());
@@ -10,18 +10,43 @@
 #include "RendererLib/RendererCachedScene.h"
 #include "RendererAPI/IDevice.h"
 #include "SceneAPI/BlitPass.h"
+#include "RendererLib/GpuTimerQueries.h"
+#include "Utils/TraceRecorder.h"
+#include <algorithm>
 
 namespace ramses_internal
 {
+    namespace
+    {
+        RenderState::ScissorRegion IntersectScissorRegions(const RenderState::ScissorRegion& a, const RenderState::ScissorRegion& b)
+        {
+            const Int32 left = std::max<Int32>(a.x, b.x);
+            const Int32 bottom = std::max<Int32>(a.y, b.y);
+            const Int32 right = std::min<Int32>(a.x + a.width, b.x + b.width);
+            const Int32 top = std::min<Int32>(a.y + a.height, b.y + b.height);
+            if (right <= left || top <= bottom)
+                return { static_cast<Int16>(left), static_cast<Int16>(bottom), 0u, 0u };
+            return { static_cast<Int16>(left), static_cast<Int16>(bottom), static_cast<UInt16>(right - left), static_cast<UInt16>(top - bottom) };
+        }
+    }
+
     UInt32 RenderExecutor::NumRenderablesToRenderInBetweenTimeBudgetChecks = RenderExecutor::DefaultNumRenderablesToRenderInBetweenTimeBudgetChecks;
 
-    RenderExecutor::RenderExecutor(IDevice& device, const TargetBufferInfo& bufferInfo, const SceneRenderExecutionIterator& renderFrom, const FrameTimer* frameTimer)
+    RenderExecutor::RenderExecutor(IDevice& device, const TargetBufferInfo& bufferInfo, const SceneRenderExecutionIterator& renderFrom, const FrameTimer* frameTimer, GpuTimerQueries* gpuTimerQueries)
         : m_state(device, bufferInfo, renderFrom, frameTimer)
+        , m_gpuTimerQueries(gpuTimerQueries)
     {
     }
 
+    void RenderExecutor::setFramebufferRepaintRegion(const RenderState::ScissorRegion& region)
+    {
+        m_state.m_limitToRepaintRegion = true;
+        m_state.m_repaintRegion = region;
+    }
+
     SceneRenderExecutionIterator RenderExecutor::executeScene(const RendererCachedScene& scene) const
     {
+        TraceScope traceScope("renderer", "executeScene", scene.getSceneId().getValue());
         setGlobalInternalStates(scene);
 
         const RenderingPassInfoVector& orderedPasses = scene.getSortedRenderingPasses();
@@ -31,12 +56,19 @@ namespace ramses_internal
             switch (passInfo.getType())
             {
             case ERenderingPassType::RenderPass:
-                if (!executeRenderPass(scene, passInfo.getRenderPassHandle()))
+            {
+                if (m_gpuTimerQueries)
+                    m_gpuTimerQueries->beginRenderPass(passInfo.getRenderPassHandle());
+                const Bool passFinished = executeRenderPass(scene, passInfo.getRenderPassHandle());
+                if (m_gpuTimerQueries)
+                    m_gpuTimerQueries->endRenderPass();
+                if (!passFinished)
                 {
                     assert(m_state.m_currentRenderIterator.getFlattenedRenderableIdx() > 0);
                     return m_state.m_currentRenderIterator;
                 }
                 break;
+            }
             case ERenderingPassType::BlitPass:
                 executeBlitPass(scene, passInfo.getBlitPassHandle());
                 break;
@@ -50,6 +82,7 @@ namespace ramses_internal
 
     Bool RenderExecutor::executeRenderPass(const RendererCachedScene& scene, const RenderPassHandle pass) const
     {
+        TraceScope traceScope("renderer", "renderPass", scene.getSceneId().getValue());
         const RenderPass& renderPass = scene.getRenderPass(pass);
         executeRenderTarget(renderPass.renderTarget);
         executeCamera(renderPass.camera);
@@ -138,7 +171,15 @@ namespace ramses_internal
         IDevice& device = m_state.getDevice();
 
         // TODO Mohamed: merge with rasterizer cached state, first check wrong cached states due to explicit state change on clear
-        device.scissorTest(m_state.scissorState.m_scissorTest, m_state.scissorState.m_scissorRegion);
+        if (m_state.m_limitToRepaintRegion && !m_state.renderTargetState.getState().isValid())
+        {
+            RenderState::ScissorRegion region = m_state.m_repaintRegion;
+            if (m_state.scissorState.m_scissorTest == EScissorTest::Enabled)
+                region = IntersectScissorRegions(region, m_state.scissorState.m_scissorRegion);
+            device.scissorTest(EScissorTest::Enabled, region);
+        }
+        else
+            device.scissorTest(m_state.scissorState.m_scissorTest, m_state.scissorState.m_scissorRegion);
 
         if (m_state.depthStencilState.hasChanged())
         {
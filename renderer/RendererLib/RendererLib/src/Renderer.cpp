@@ -99,9 +99,10 @@ namespace ramses_internal
         // re-render framebuffer of the display
         auto& displayInfo = m_displays.find(display)->second;
         displayInfo.buffersSetup.setDisplayBufferToBeRerendered(displayInfo.frameBufferDeviceHandle, true);
+        displayInfo.framebufferFullyDamaged = true;
     }
 
-    void Renderer::addDisplayController(IDisplayController& display, DisplayHandle displayHandle)
+    void Renderer::addDisplayController(IDisplayController& display, DisplayHandle displayHandle, Bool partialFramebufferUpdateEnabled)
     {
         assert(m_displays.find(displayHandle) == m_displays.cend());
         assert(!hasAnyBufferWithInterruptedRendering());
@@ -111,6 +112,9 @@ namespace ramses_internal
         displayInfo.frameBufferDeviceHandle = display.getDisplayBuffer();
         displayInfo.buffersSetup.registerDisplayBuffer(displayInfo.frameBufferDeviceHandle, { 0, 0, display.getDisplayWidth(), display.getDisplayHeight() }, DefaultClearColor, false, false);
         displayInfo.couldRenderLastFrame = true;
+        displayInfo.partialFramebufferUpdateEnabled = partialFramebufferUpdateEnabled;
+        // framebuffer content is undefined until first frame presented
+        displayInfo.framebufferFullyDamaged = true;
 
         auto profileRenderer = new FrameProfileRenderer(display.getRenderBackend().getDevice(), display.getDisplayWidth(), display.getDisplayHeight());
         m_frameProfileRenderer.put(displayHandle, profileRenderer);
@@ -128,7 +132,7 @@ namespace ramses_internal
             return;
         }
 
-        addDisplayController(*displayController, display);
+        addDisplayController(*displayController, display, displayConfig.isPartialFramebufferUpdateEnabled());
         setClearColor(display, displayController->getDisplayBuffer(), displayConfig.getClearColor());
 
         LOG_TRACE(CONTEXT_PROFILING, "RamsesRenderer::createDisplayContext finished creating display");
@@ -338,6 +342,9 @@ namespace ramses_internal
 
         ActivateDisplayContext(displayHandle, activeDisplay, display);
 
+        if (displayInfo.partialFramebufferUpdateEnabled)
+            updateFramebufferDamage(displayHandle);
+
         display.clearBuffer(displayInfo.frameBufferDeviceHandle, displayBufferInfo.clearColor);
 
         m_tempScenesRendered.clear();
@@ -477,6 +484,7 @@ namespace ramses_internal
 
             //re-render framebuffer in next frame to reflect (finished!) changes in OB
             displayInfo.buffersSetup.setDisplayBufferToBeRerendered(displayInfo.frameBufferDeviceHandle, true);
+            displayInfo.framebufferFullyDamaged = true;
         }
     }
 
@@ -492,6 +500,7 @@ namespace ramses_internal
                 auto& displayBufferSetup = display.second.buffersSetup;
                 for (const auto& buffer : displayBufferSetup.getDisplayBuffers())
                     displayBufferSetup.setDisplayBufferToBeRerendered(buffer.first, true);
+                display.second.framebufferFullyDamaged = true;
             }
         }
 
@@ -548,10 +557,24 @@ namespace ramses_internal
         ReorderDisplaysToStartWith(m_tempDisplaysToSwapBuffers, activeDisplay);
         for (auto displayHandle : m_tempDisplaysToSwapBuffers)
         {
-            IDisplayController& displayController = getDisplayController(displayHandle);
+            auto& displayInfo = m_displays.find(displayHandle)->second;
+            IDisplayController& displayController = *displayInfo.displayController;
             ActivateDisplayContext(displayHandle, activeDisplay, displayController);
-            displayController.swapBuffers();
+            if (displayInfo.partialFramebufferUpdateEnabled)
+            {
+                auto& damage = displayInfo.framebufferDamage;
+                if (damage.isFullyDamaged())
+                    displayController.swapBuffers();
+                else
+                    displayController.swapBuffersWithDamage(damage.getDamage());
+                damage.framePresented();
+            }
+            else
+                displayController.swapBuffers();
             m_statistics.framebufferSwapped(displayHandle);
+            displayController.collectGpuTimings(m_tempGpuTimings);
+            if (!m_tempGpuTimings.empty())
+                m_statistics.gpuTimingsCollected(displayHandle, m_tempGpuTimings);
             displayController.getEmbeddedCompositingManager().notifyClients();
             LOG_TRACE(CONTEXT_PROFILING, "Renderer::doOneRenderLoop swapBuffers on display " << displayHandle.asMemoryHandle());
         }
@@ -567,6 +590,89 @@ namespace ramses_internal
         m_statistics.sceneRendered(scene.getSceneId());
     }
 
+    void Renderer::updateFramebufferDamage(DisplayHandle displayHandle)
+    {
+        auto& displayInfo = m_displays.find(displayHandle)->second;
+        IDisplayController& display = *displayInfo.displayController;
+        const DisplayBufferInfo& displayBufferInfo = displayInfo.buffersSetup.getDisplayBuffer(displayInfo.frameBufferDeviceHandle);
+        auto& damage = displayInfo.framebufferDamage;
+
+        // content not coming from scenes or re-rendering for other reason than scene changes cannot be tracked
+        if (displayInfo.framebufferFullyDamaged || display.isWarpingEnabled() || (*m_frameProfileRenderer.get(displayHandle))->isEnabled())
+            damage.setFullyDamaged();
+
+        m_tempFramebufferScenes.clear();
+        for (const auto& sceneInfo : displayBufferInfo.scenes)
+        {
+            if (sceneInfo.shown)
+            {
+                const Viewport sceneRegion = GetSceneFramebufferRegion(m_rendererScenes.getScene(sceneInfo.sceneId));
+                m_tempFramebufferScenes.push_back({ sceneInfo.sceneId, FramebufferDamageTracker::Intersect(sceneRegion, displayBufferInfo.viewport) });
+            }
+        }
+
+        // damage is previous and current region of every scene shown, hidden, moved or modified since last rendered
+        const auto& renderedScenes = displayInfo.framebufferScenesRendered;
+        const auto& modifiedScenes = displayInfo.modifiedFramebufferScenes;
+        std::ptrdiff_t lastRenderedIdx = -1;
+        for (const auto& scene : m_tempFramebufferScenes)
+        {
+            const auto renderedIt = std::find_if(renderedScenes.cbegin(), renderedScenes.cend(), [&scene](const FramebufferSceneRegion& s) { return s.sceneId == scene.sceneId; });
+            if (renderedIt == renderedScenes.cend())
+            {
+                damage.addDamage(scene.region);
+                continue;
+            }
+
+            // scenes have to keep their order, otherwise overlapping content is composited differently
+            const std::ptrdiff_t renderedIdx = std::distance(renderedScenes.cbegin(), renderedIt);
+            if (renderedIdx < lastRenderedIdx)
+                damage.setFullyDamaged();
+            lastRenderedIdx = renderedIdx;
+
+            if (renderedIt->region != scene.region || std::find(modifiedScenes.cbegin(), modifiedScenes.cend(), scene.sceneId) != modifiedScenes.cend())
+            {
+                damage.addDamage(renderedIt->region);
+                damage.addDamage(scene.region);
+            }
+        }
+        for (const auto& renderedScene : renderedScenes)
+        {
+            if (std::none_of(m_tempFramebufferScenes.cbegin(), m_tempFramebufferScenes.cend(), [&renderedScene](const FramebufferSceneRegion& s) { return s.sceneId == renderedScene.sceneId; }))
+                damage.addDamage(renderedScene.region);
+        }
+
+        displayInfo.framebufferScenesRendered = m_tempFramebufferScenes;
+        displayInfo.modifiedFramebufferScenes.clear();
+        displayInfo.framebufferFullyDamaged = false;
+
+        // back buffer has to be fully repainted if its content age is unknown, damage of current frame is still valid for presentation
+        Viewport repaintRegion;
+        if (damage.getRepaintRegion(display.getDisplayBufferAge(), repaintRegion))
+            display.setDisplayBufferRepaintRegion(repaintRegion);
+    }
+
+    Viewport Renderer::GetSceneFramebufferRegion(const RendererCachedScene& scene)
+    {
+        Viewport region;
+        for (RenderPassHandle pass(0u); pass < scene.getRenderPassCount(); ++pass)
+        {
+            if (!scene.isRenderPassAllocated(pass))
+                continue;
+
+            const RenderPass& renderPass = scene.getRenderPass(pass);
+            if (!renderPass.isEnabled || renderPass.renderTarget.isValid() || !renderPass.camera.isValid())
+                continue;
+
+            const Camera& camera = scene.getCamera(renderPass.camera);
+            const auto& vpOffset = scene.getDataSingleVector2i(scene.getDataReference(camera.dataInstance, Camera::ViewportOffsetField), DataFieldHandle{ 0 });
+            const auto& vpSize = scene.getDataSingleVector2i(scene.getDataReference(camera.dataInstance, Camera::ViewportSizeField), DataFieldHandle{ 0 });
+            region = FramebufferDamageTracker::Unite(region, { vpOffset.x, vpOffset.y, UInt32(vpSize.x), UInt32(vpSize.y) });
+        }
+
+        return region;
+    }
+
     void Renderer::ActivateDisplayContext(DisplayHandle displayToActivate, DisplayHandle& activeDisplay, IDisplayController& dispController)
     {
         if (displayToActivate != activeDisplay)
@@ -623,6 +729,10 @@ namespace ramses_internal
         assert(displayBuffer.isValid());
         auto& displayInfo = m_displays.find(displayHandle)->second;
         displayInfo.buffersSetup.setDisplayBufferToBeRerendered(displayBuffer, true);
+
+        auto& modifiedScenes = displayInfo.modifiedFramebufferScenes;
+        if (displayInfo.partialFramebufferUpdateEnabled && displayBuffer == displayInfo.frameBufferDeviceHandle && !contains_c(modifiedScenes, sceneId))
+            modifiedScenes.push_back(sceneId);
     }
 
     void Renderer::setSkippingOfUnmodifiedBuffers(Bool enable)
@@ -736,6 +846,8 @@ namespace ramses_internal
         assert(m_displays.find(displayHandle) != m_displays.cend());
         auto& displayInfo = m_displays.find(displayHandle)->second;
         displayInfo.buffersSetup.setClearColor(bufferDeviceHandle, clearColor);
+        if (bufferDeviceHandle == displayInfo.frameBufferDeviceHandle)
+            displayInfo.framebufferFullyDamaged = true;
     }
 
     void Renderer::scheduleScreenshot(DisplayHandle display, DeviceResourceHandle renderTargetHandle, ScreenshotInfo&& screenshot)
@@ -14,6 +14,12 @@
 
 namespace ramses_internal
 {
+    void RendererCommandBuffer::setSceneUpdateListener(SceneUpdateListener listener)
+    {
+        PlatformGuard guard(m_lock);
+        m_sceneUpdateListener = std::move(listener);
+    }
+
     void RendererCommandBuffer::publishScene(SceneId sceneId, EScenePublicationMode mode)
     {
         PlatformGuard guard(m_lock);
@@ -66,6 +72,8 @@ namespace ramses_internal
     {
         PlatformGuard guard(m_lock);
         m_commands.enqueueActionsForScene(sceneId, std::move(sceneUpdate));
+        if (m_sceneUpdateListener)
+            m_sceneUpdateListener(sceneId);
     }
 
     void RendererCommandBuffer::createDisplay(const DisplayConfig& displayConfig, IResourceUploader& resourceUploader, DisplayHandle handle)
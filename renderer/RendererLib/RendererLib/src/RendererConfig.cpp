@@ -103,4 +103,24 @@ namespace ramses_internal
     {
         return m_renderThreadLoopTimingReportingPeriod;
     }
+
+    void RendererConfig::setSceneUpdateThreadCount(UInt32 threadCount)
+    {
+        m_sceneUpdateThreadCount = threadCount;
+    }
+
+    UInt32 RendererConfig::getSceneUpdateThreadCount() const
+    {
+        return m_sceneUpdateThreadCount;
+    }
+
+    void RendererConfig::setDeadlineFrameSchedulingEnabled(Bool enable)
+    {
+        m_deadlineFrameSchedulingEnabled = enable;
+    }
+
+    Bool RendererConfig::getDeadlineFrameSchedulingEnabled() const
+    {
+        return m_deadlineFrameSchedulingEnabled;
+    }
 }
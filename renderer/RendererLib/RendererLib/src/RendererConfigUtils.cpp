@@ -24,6 +24,8 @@ namespace ramses_internal
             , waylandSocketEmbeddedPermissions("wsep", "wayland-socket-embedded-permissions", config.getWaylandSocketEmbeddedPermissions(), "permissions for embedded compositing socket")
             , systemCompositorControllerEnabled("scc", "enable-system-compositor-controller", "enable system compositor controller")
             , kpiFilename("kpi", "kpioutputfile", config.getKPIFileName(), "KPI filename")
+            , sceneUpdateThreadCount("sut", "scene-update-threads", config.getSceneUpdateThreadCount(), "number of worker threads updating independent scenes concurrently (0 updates on render thread)")
+            , deadlineFrameScheduling("dfs", "deadline-frame-scheduling", "start frames just in time for their deadline and early when flushes for shown scenes arrive")
         {
         }
 
@@ -32,6 +34,8 @@ namespace ramses_internal
         ArgumentUInt32 waylandSocketEmbeddedPermissions;
         ArgumentBool   systemCompositorControllerEnabled;
         ArgumentString kpiFilename;
+        ArgumentUInt32 sceneUpdateThreadCount;
+        ArgumentBool   deadlineFrameScheduling;
 
         void print()
         {
@@ -42,6 +46,8 @@ namespace ramses_internal
                         sos << waylandSocketEmbeddedGroup.getHelpString();
                         sos << kpiFilename.getHelpString();
                         sos << systemCompositorControllerEnabled.getHelpString();
+                        sos << sceneUpdateThreadCount.getHelpString();
+                        sos << deadlineFrameScheduling.getHelpString();
                     }));
 
         }
@@ -58,6 +64,7 @@ namespace ramses_internal
             , borderless("bl", "borderless", "disable window borders")
             , enableWarping("warp", "enable-warping", "enable warping")
             , deleteEffects("de", "delete-effects", "do not keep effects uploaded")
+            , partialFramebufferUpdate("pfu", "partial-framebuffer-update", "repaint only changed regions of framebuffer")
             , antialiasingMethod("aa", "antialiasing-method", "", "set antialiasing method (options: MSAA)")
             , antialiasingSampleCount("as", "aa-samples", config.getAntialiasingSampleCount(), "set antialiasing sample count")
             , waylandIviLayerId("lid", "waylandIviLayerId", config.getWaylandIviLayerID().getValue(), "set id of IVI layer the display surface will be added to")
@@ -81,6 +88,7 @@ namespace ramses_internal
 
         ArgumentBool enableWarping;
         ArgumentBool deleteEffects;
+        ArgumentBool partialFramebufferUpdate;
         ArgumentString antialiasingMethod;
         ArgumentUInt32 antialiasingSampleCount;
         ArgumentUInt32 waylandIviLayerId;
@@ -116,6 +124,7 @@ namespace ramses_internal
                         {
                             sos << enableWarping.getHelpString();
                             sos << deleteEffects.getHelpString();
+                            sos << partialFramebufferUpdate.getHelpString();
                             sos << antialiasingMethod.getHelpString();
                             sos << antialiasingSampleCount.getHelpString();
                         }
@@ -130,6 +139,12 @@ namespace ramses_internal
         config.setWaylandEmbeddedCompositingSocketGroup(rendererArgs.waylandSocketEmbeddedGroup.parseValueFromCmdLine(parser));
         config.setWaylandEmbeddedCompositingSocketPermissions(rendererArgs.waylandSocketEmbeddedPermissions.parseValueFromCmdLine(parser));
         config.setKPIFileName(rendererArgs.kpiFilename.parseValueFromCmdLine(parser));
+        config.setSceneUpdateThreadCount(rendererArgs.sceneUpdateThreadCount.parseValueFromCmdLine(parser));
+
+        if (rendererArgs.deadlineFrameScheduling.parseFromCmdLine(parser))
+        {
+            config.setDeadlineFrameSchedulingEnabled(true);
+        }
 
         if(rendererArgs.systemCompositorControllerEnabled.parseFromCmdLine(parser))
         {
@@ -145,6 +160,7 @@ namespace ramses_internal
         config.setBorderlessState(rendererArgs.borderless.parseFromCmdLine(parser));
         config.setWarpingEnabled(rendererArgs.enableWarping.parseFromCmdLine(parser));
         config.setKeepEffectsUploaded(!rendererArgs.deleteEffects.parseFromCmdLine(parser));
+        config.setPartialFramebufferUpdateEnabled(rendererArgs.partialFramebufferUpdate.parseFromCmdLine(parser));
         config.setDesiredWindowWidth(rendererArgs.windowWidth.parseValueFromCmdLine(parser));
         config.setDesiredWindowHeight(rendererArgs.windowHeight.parseValueFromCmdLine(parser));
         config.setWindowPositionX(rendererArgs.windowPositionX.parseValueFromCmdLine(parser));
@@ -16,6 +16,8 @@
 #include "RendererAPI/IEmbeddedCompositingManager.h"
 #include "RendererAPI/IRendererResourceCache.h"
 #include "SceneAPI/RenderBuffer.h"
+#include "SceneAPI/BlitPass.h"
+#include "SceneAPI/IScene.h"
 #include "SceneAPI/EDataBufferType.h"
 #include "Components/ManagedResource.h"
 #include "Resource/ResourceInfo.h"
@@ -70,6 +72,13 @@ namespace ramses_internal
         {
             if (!m_resourceRegistry.containsResource(resHash))
                 m_resourceRegistry.registerResource(resHash);
+            else
+            {
+                // resource kept uploaded in cache while unused can be used again without re-upload
+                const ResourceDescriptor& rd = m_resourceRegistry.getResourceDescriptor(resHash);
+                if (rd.status == EResourceStatus::Uploaded && rd.sceneUsage.empty())
+                    m_stats.resourceResidencyHit();
+            }
 
             m_resourceRegistry.addResourceRef(resHash, sceneId);
         }
@@ -250,6 +259,11 @@ namespace ramses_internal
         return m_embeddedCompositingManager.getCompositedTextureDeviceHandleForStreamTexture(surfaceId);
     }
 
+    UInt64 RendererResourceManager::getRenderTargetMemorySize() const
+    {
+        return m_resourceUploadingManager.getRenderTargetMemorySize();
+    }
+
     void RendererResourceManager::uploadRenderTargetBuffer(RenderBufferHandle renderBufferHandle, SceneId sceneId, const RenderBuffer& renderBuffer)
     {
         RendererSceneResourceRegistry& sceneResources = getSceneResourceRegistry(sceneId);
@@ -264,6 +278,7 @@ namespace ramses_internal
         }
 
         sceneResources.addRenderBuffer(renderBufferHandle, deviceHandle, memSize, ERenderBufferAccessMode_WriteOnly == renderBuffer.accessMode);
+        m_resourceUploadingManager.addRenderTargetMemory(memSize);
         m_stats.sceneResourceUploaded(sceneId, memSize);
     }
 
@@ -273,7 +288,16 @@ namespace ramses_internal
         RendererSceneResourceRegistry& sceneResources = *m_sceneResourceRegistryMap.get(sceneId);
 
         IDevice& device = m_renderBackend.getDevice();
-        device.deleteRenderBuffer(sceneResources.getRenderBufferDeviceHandle(renderBufferHandle));
+        const DeviceResourceHandle deviceHandle = sceneResources.getRenderBufferDeviceHandle(renderBufferHandle);
+        if (m_sceneTransientRenderBuffers.contains(deviceHandle))
+        {
+            unloadTransientRenderBuffer(m_sceneTransientRenderBuffers, deviceHandle, sceneId.getValue());
+        }
+        else
+        {
+            device.deleteRenderBuffer(deviceHandle);
+            m_resourceUploadingManager.removeRenderTargetMemory(sceneResources.getRenderBufferByteSize(renderBufferHandle));
+        }
         sceneResources.removeRenderBuffer(renderBufferHandle);
     }
 
@@ -317,9 +341,22 @@ namespace ramses_internal
         OffscreenBufferDescriptor& offscreenBufferDesc = *m_offscreenBuffers.getMemory(bufferHandle);
 
         offscreenBufferDesc.m_colorBufferHandle[0] = device.uploadRenderBuffer(RenderBuffer(width, height, ERenderBufferType_ColorBuffer, ETextureFormat::RGBA8, ERenderBufferAccessMode_ReadWrite, sampleCount));
-        offscreenBufferDesc.m_depthBufferHandle = device.uploadRenderBuffer(RenderBuffer(width, height, ERenderBufferType_DepthStencilBuffer, ETextureFormat::Depth24_Stencil8, ERenderBufferAccessMode_WriteOnly, sampleCount));
         const UInt32 sampleMultiplier = (sampleCount == 0) ? 1u : sampleCount;
-        offscreenBufferDesc.m_estimatedVRAMUsage = width * height * ((isDoubleBuffered ? 2u : 1u) * GetTexelSizeFromFormat(ETextureFormat::RGBA8) * sampleMultiplier + GetTexelSizeFromFormat(ETextureFormat::Depth24_Stencil8) * sampleMultiplier);
+        const RenderBuffer depthBuffer(width, height, ERenderBufferType_DepthStencilBuffer, ETextureFormat::Depth24_Stencil8, ERenderBufferAccessMode_WriteOnly, sampleCount);
+        const UInt32 depthBufferSize = width * height * GetTexelSizeFromFormat(ETextureFormat::Depth24_Stencil8) * sampleMultiplier;
+        // estimate as if depth buffer was not shared, shared storage is accounted for in memory statistics
+        offscreenBufferDesc.m_estimatedVRAMUsage = width * height * (isDoubleBuffered ? 2u : 1u) * GetTexelSizeFromFormat(ETextureFormat::RGBA8) * sampleMultiplier + depthBufferSize;
+        if (isDoubleBuffered)
+        {
+            offscreenBufferDesc.m_depthBufferHandle = device.uploadRenderBuffer(depthBuffer);
+            m_resourceUploadingManager.addRenderTargetMemory(offscreenBufferDesc.m_estimatedVRAMUsage);
+        }
+        else
+        {
+            // offscreen buffer is cleared and rendered as a whole before next one, depth is not needed afterwards
+            offscreenBufferDesc.m_depthBufferHandle = uploadTransientRenderBuffer(m_offscreenBufferDepthBuffers, depthBuffer, depthBufferSize, bufferHandle.asMemoryHandle());
+            m_resourceUploadingManager.addRenderTargetMemory(offscreenBufferDesc.m_estimatedVRAMUsage - depthBufferSize);
+        }
 
         DeviceHandleVector bufferDeviceHandles;
         bufferDeviceHandles.push_back(offscreenBufferDesc.m_colorBufferHandle[0]);
@@ -370,7 +407,17 @@ namespace ramses_internal
             device.unpairRenderTargets(offscreenBufferDesc.m_renderTargetHandle[0]);
         }
         device.deleteRenderBuffer(offscreenBufferDesc.m_colorBufferHandle[0]);
-        device.deleteRenderBuffer(offscreenBufferDesc.m_depthBufferHandle);
+        if (m_offscreenBufferDepthBuffers.contains(offscreenBufferDesc.m_depthBufferHandle))
+        {
+            const UInt32 depthBufferSize = m_offscreenBufferDepthBuffers.getByteSize(offscreenBufferDesc.m_depthBufferHandle);
+            unloadTransientRenderBuffer(m_offscreenBufferDepthBuffers, offscreenBufferDesc.m_depthBufferHandle, bufferHandle.asMemoryHandle());
+            m_resourceUploadingManager.removeRenderTargetMemory(offscreenBufferDesc.m_estimatedVRAMUsage - depthBufferSize);
+        }
+        else
+        {
+            device.deleteRenderBuffer(offscreenBufferDesc.m_depthBufferHandle);
+            m_resourceUploadingManager.removeRenderTargetMemory(offscreenBufferDesc.m_estimatedVRAMUsage);
+        }
         if (offscreenBufferDesc.m_colorBufferHandle[1].isValid())
         {
             device.deleteRenderBuffer(offscreenBufferDesc.m_colorBufferHandle[1]);
@@ -379,6 +426,105 @@ namespace ramses_internal
         m_offscreenBuffers.release(bufferHandle);
     }
 
+    Bool RendererResourceManager::updateTransientRenderBuffers(const IScene& scene, const RenderBufferHandleVector& transientBuffers)
+    {
+        const SceneId sceneId = scene.getSceneId();
+        if (!m_sceneResourceRegistryMap.contains(sceneId))
+            return false;
+
+        RendererSceneResourceRegistry& sceneResources = *m_sceneResourceRegistryMap.get(sceneId);
+        IDevice& device = m_renderBackend.getDevice();
+
+        RenderBufferHandleVector renderBuffers;
+        sceneResources.getAllRenderBuffers(renderBuffers);
+        RenderBufferHandleVector reboundBuffers;
+        for (const auto rb : renderBuffers)
+        {
+            const DeviceResourceHandle deviceHandle = sceneResources.getRenderBufferDeviceHandle(rb);
+            const Bool isShared = m_sceneTransientRenderBuffers.contains(deviceHandle);
+            const Bool canBeShared = contains_c(transientBuffers, rb);
+            if (isShared == canBeShared)
+                continue;
+
+            const RenderBuffer& renderBuffer = scene.getRenderBuffer(rb);
+            const UInt32 byteSize = sceneResources.getRenderBufferByteSize(rb);
+            DeviceResourceHandle newDeviceHandle;
+            if (canBeShared)
+            {
+                newDeviceHandle = uploadTransientRenderBuffer(m_sceneTransientRenderBuffers, renderBuffer, byteSize, sceneId.getValue());
+                device.deleteRenderBuffer(deviceHandle);
+                m_resourceUploadingManager.removeRenderTargetMemory(byteSize);
+            }
+            else
+            {
+                newDeviceHandle = device.uploadRenderBuffer(renderBuffer);
+                m_resourceUploadingManager.addRenderTargetMemory(byteSize);
+                unloadTransientRenderBuffer(m_sceneTransientRenderBuffers, deviceHandle, sceneId.getValue());
+            }
+
+            sceneResources.setRenderBufferDeviceHandle(rb, newDeviceHandle);
+            reboundBuffers.push_back(rb);
+        }
+
+        if (reboundBuffers.empty())
+            return false;
+
+        // render targets and blit render targets have to be re-created with new storage
+        RenderTargetHandleVector renderTargets;
+        sceneResources.getAllRenderTargets(renderTargets);
+        for (const auto rt : renderTargets)
+        {
+            RenderBufferHandleVector rtBufferHandles;
+            const UInt32 rtBufferCount = scene.getRenderTargetRenderBufferCount(rt);
+            for (UInt32 i = 0u; i < rtBufferCount; ++i)
+                rtBufferHandles.push_back(scene.getRenderTargetRenderBuffer(rt, i));
+
+            if (std::any_of(rtBufferHandles.cbegin(), rtBufferHandles.cend(), [&reboundBuffers](RenderBufferHandle rb) { return contains_c(reboundBuffers, rb); }))
+            {
+                unloadRenderTarget(rt, sceneId);
+                uploadRenderTarget(rt, rtBufferHandles, sceneId);
+            }
+        }
+
+        BlitPassHandleVector blitPasses;
+        sceneResources.getAllBlitPasses(blitPasses);
+        for (const auto bp : blitPasses)
+        {
+            const BlitPass& blitPass = scene.getBlitPass(bp);
+            if (contains_c(reboundBuffers, blitPass.sourceRenderBuffer) || contains_c(reboundBuffers, blitPass.destinationRenderBuffer))
+            {
+                unloadBlitPassRenderTargets(bp, sceneId);
+                uploadBlitPassRenderTargets(bp, blitPass.sourceRenderBuffer, blitPass.destinationRenderBuffer, sceneId);
+            }
+        }
+
+        return true;
+    }
+
+    DeviceResourceHandle RendererResourceManager::uploadTransientRenderBuffer(TransientRenderBufferPool& pool, const RenderBuffer& renderBuffer, UInt32 byteSize, TransientRenderBufferPool::OwnerId owner)
+    {
+        DeviceResourceHandle deviceHandle = pool.acquire(renderBuffer, owner);
+        if (!deviceHandle.isValid())
+        {
+            deviceHandle = m_renderBackend.getDevice().uploadRenderBuffer(renderBuffer);
+            pool.add(renderBuffer, deviceHandle, byteSize, owner);
+            // shared storage is charged only once, by its first user
+            m_resourceUploadingManager.addRenderTargetMemory(byteSize);
+        }
+
+        return deviceHandle;
+    }
+
+    void RendererResourceManager::unloadTransientRenderBuffer(TransientRenderBufferPool& pool, DeviceResourceHandle deviceHandle, TransientRenderBufferPool::OwnerId owner)
+    {
+        const UInt32 byteSize = pool.getByteSize(deviceHandle);
+        if (pool.release(deviceHandle, owner))
+        {
+            m_renderBackend.getDevice().deleteRenderBuffer(deviceHandle);
+            m_resourceUploadingManager.removeRenderTargetMemory(byteSize);
+        }
+    }
+
     void RendererResourceManager::uploadStreamBuffer(StreamBufferHandle bufferHandle, WaylandIviSurfaceId surfaceId)
     {
         assert(!m_streamBuffers.isAllocated(bufferHandle));
@@ -20,7 +20,9 @@ namespace ramses_internal
     {
         std::vector<Byte> readBuffer(resourceSize);
 
-        cache->getResourceData(resourceId, readBuffer.data(), resourceSize);
+        // cache can fail to provide data eg. if it detects corruption only when reading data
+        if (!cache->getResourceData(resourceId, readBuffer.data(), resourceSize))
+            return {};
 
         BinaryInputStream resourceStream(readBuffer.data());
         const IResource* resourceObject = SingleResourceSerialization::DeserializeResource(resourceStream, resourceId);
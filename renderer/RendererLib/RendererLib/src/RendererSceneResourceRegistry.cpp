@@ -42,6 +42,12 @@ namespace ramses_internal
         return m_renderBuffers.get(handle)->deviceHandle;
     }
 
+    void RendererSceneResourceRegistry::setRenderBufferDeviceHandle(RenderBufferHandle handle, DeviceResourceHandle deviceHandle)
+    {
+        assert(m_renderBuffers.contains(handle));
+        m_renderBuffers.get(handle)->deviceHandle = deviceHandle;
+    }
+
     UInt32 RendererSceneResourceRegistry::getRenderBufferByteSize(RenderBufferHandle handle) const
     {
         assert(m_renderBuffers.contains(handle));
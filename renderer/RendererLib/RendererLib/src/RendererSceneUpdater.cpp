@@ -30,14 +30,17 @@
 #include "RendererLib/RendererLogger.h"
 #include "RendererLib/IntersectionUtils.h"
 #include "RendererLib/SceneReferenceLogic.h"
+#include "RendererLib/TransientRenderBufferUtils.h"
 #include "RendererEventCollector.h"
 #include "Components/FlushTimeInformation.h"
 #include "Components/SceneUpdate.h"
 #include "Utils/LogMacros.h"
 #include "Utils/Image.h"
+#include "Utils/TraceRecorder.h"
 #include "PlatformAbstraction/PlatformTime.h"
 #include "PlatformAbstraction/Macros.h"
 #include "absl/algorithm/container.h"
+#include <mutex>
 
 namespace ramses_internal
 {
@@ -57,6 +60,7 @@ namespace ramses_internal
         , m_expirationMonitor(expirationMonitor)
         , m_rendererResourceCache(rendererResourceCache)
         , m_animationSystemFactory(EAnimationSystemOwner_Renderer)
+        , m_sceneUpdateScheduler(std::make_unique<SceneUpdateScheduler>(0u))
     {
     }
 
@@ -78,6 +82,7 @@ namespace ramses_internal
 
     void RendererSceneUpdater::handleSceneUpdate(SceneId sceneId, SceneUpdate&& sceneUpdate)
     {
+        TraceScope traceScope("renderer", "handleSceneUpdate", sceneId.getValue(), sceneUpdate.flushInfos.flushCounter);
         ESceneState sceneState = m_sceneStateExecutor.getSceneState(sceneId);
 
         if (sceneState == ESceneState::SubscriptionPending)
@@ -549,6 +554,8 @@ namespace ramses_internal
         UInt numActionsApplied = 0u;
         for (auto& pendingFlush : pendingFlushes)
         {
+            TraceScope traceScope("renderer", "applyFlush", sceneID.getValue(), pendingFlush.flushIndex);
+            GetTraceRecorder().addFlowEndEvent("flush", "sceneUpdate", TraceRecorder::GetFlushFlowId(sceneID.getValue(), pendingFlush.flushIndex));
             applySceneActions(rendererScene, pendingFlush);
 
             numActionsApplied += pendingFlush.sceneActions.numberOfActions();
@@ -607,6 +614,7 @@ namespace ramses_internal
         // and execute collected scene resource actions
         const DisplayHandle displayHandle = m_renderer.getDisplaySceneIsAssignedTo(sceneID);
         PendingData& pendingData = stagingInfo.pendingData;
+        RendererCachedScene& scene = m_rendererScenes.getScene(sceneID);
         if (displayHandle.isValid())
         {
             IRendererResourceManager& resourceManager = *m_displayResourceManagers.find(displayHandle)->second;
@@ -617,9 +625,32 @@ namespace ramses_internal
             if (!pendingSceneResourceActions.empty())
             {
                 activateDisplayContext(activeDisplay, displayHandle);
-                PendingSceneResourcesUtils::ApplySceneResourceActions(pendingSceneResourceActions, m_rendererScenes.getScene(sceneID), resourceManager);
+                PendingSceneResourcesUtils::ApplySceneResourceActions(pendingSceneResourceActions, scene, resourceManager, nullptr, &scene.getTextureBufferDirtyRegions());
             }
+            // applied flushes can change how render buffers are used
+            updateTransientRenderBuffers(sceneID, activeDisplay);
         }
+        // texture buffers of unmapped scene are uploaded as a whole when mapped
+        scene.clearTextureBufferDirtyRegions();
+    }
+
+    void RendererSceneUpdater::updateTransientRenderBuffers(SceneId sceneId, DisplayHandle& activeDisplay)
+    {
+        RendererCachedScene& scene = m_rendererScenes.getScene(sceneId);
+        if (!TransientRenderBufferUtils::HasWriteOnlyRenderBuffers(scene))
+            return;
+
+        // rendering of scene in interruptible offscreen buffer can be interleaved with rendering of other scenes
+        RenderBufferHandleVector transientBuffers;
+        if (!m_renderer.isSceneAssignedToInterruptibleOffscreenBuffer(sceneId))
+            TransientRenderBufferUtils::GetTransientRenderBuffers(scene, transientBuffers);
+
+        const DisplayHandle displayHandle = m_renderer.getDisplaySceneIsAssignedTo(sceneId);
+        assert(displayHandle.isValid());
+        activateDisplayContext(activeDisplay, displayHandle);
+        IRendererResourceManager& resourceManager = *m_displayResourceManagers.find(displayHandle)->second;
+        if (resourceManager.updateTransientRenderBuffers(scene, transientBuffers))
+            scene.resetRenderTargetCache();
     }
 
     void RendererSceneUpdater::updateSceneStreamTexturesDirtiness()
@@ -673,15 +704,19 @@ namespace ramses_internal
             const SceneId sceneId = sceneIt.key;
             // update resource cache only if scene is actually rendered
             if (m_sceneStateExecutor.getSceneState(sceneId) == ESceneState::Rendered)
-            {
-                const DisplayHandle displayHandle = m_renderer.getDisplaySceneIsAssignedTo(sceneId);
-                assert(displayHandle.isValid());
-                const IRendererResourceManager& resourceManager = *m_displayResourceManagers.find(displayHandle)->second;
-                const IEmbeddedCompositingManager& embeddedCompositingManager = m_renderer.getDisplayController(displayHandle).getEmbeddedCompositingManager();
-                RendererCachedScene& rendererScene = *(sceneIt.value.scene);
-                rendererScene.updateRenderablesAndResourceCache(resourceManager, embeddedCompositingManager);
-            }
+                m_sceneUpdateScheduler->addScene(sceneId);
         }
+
+        // every scene only modifies its own caches, resource manager and embedded compositing manager are only read
+        m_sceneUpdateScheduler->execute([this](SceneId sceneId)
+        {
+            const DisplayHandle displayHandle = m_renderer.getDisplaySceneIsAssignedTo(sceneId);
+            assert(displayHandle.isValid());
+            const IRendererResourceManager& resourceManager = *m_displayResourceManagers.find(displayHandle)->second;
+            const IEmbeddedCompositingManager& embeddedCompositingManager = m_renderer.getDisplayController(displayHandle).getEmbeddedCompositingManager();
+            RendererCachedScene& rendererScene = m_rendererScenes.getScene(sceneId);
+            rendererScene.updateRenderablesAndResourceCache(resourceManager, embeddedCompositingManager);
+        });
     }
 
     void RendererSceneUpdater::updateScenesStates()
@@ -910,6 +945,7 @@ namespace ramses_internal
             const bool sceneIsRemote = (m_sceneStateExecutor.getScenePublicationMode(sceneId) != EScenePublicationMode_LocalOnly);
             if (!PendingSceneResourcesUtils::ApplySceneResourceActions(sceneResourceActions, scene, resourceManager, sceneIsRemote ? &m_frameTimer : nullptr))
                 return false;
+            updateTransientRenderBuffers(sceneId, activeDisplay);
         }
 
         // reference all the resources in use by the scene to be mapped
@@ -1227,6 +1263,9 @@ namespace ramses_internal
 
         m_renderer.resetRenderInterruptState();
         m_renderer.assignSceneToDisplayBuffer(sceneId, display, bufferDeviceHandle, sceneRenderOrder);
+        // render buffers cannot be shared while scene is in interruptible offscreen buffer
+        DisplayHandle activeDisplay;
+        updateTransientRenderBuffers(sceneId, activeDisplay);
 
         return true;
     }
@@ -1344,6 +1383,15 @@ namespace ramses_internal
         m_sceneReferenceLogic = &sceneRefLogic;
     }
 
+    void RendererSceneUpdater::setSceneUpdateThreadCount(UInt32 threadCount)
+    {
+        if (threadCount != m_sceneUpdateScheduler->getThreadCount())
+        {
+            LOG_INFO(CONTEXT_RENDERER, "RendererSceneUpdater: using " << threadCount << " worker threads for scene updates");
+            m_sceneUpdateScheduler = std::make_unique<SceneUpdateScheduler>(threadCount);
+        }
+    }
+
     Bool RendererSceneUpdater::areResourcesFromPendingFlushesUploaded(SceneId sceneId) const
     {
         const DisplayHandle displayHandle = m_renderer.getDisplaySceneIsAssignedTo(sceneId);
@@ -1366,24 +1414,33 @@ namespace ramses_internal
         {
             const SceneId sceneID = scene.key;
             if (m_sceneStateExecutor.getSceneState(sceneID) == ESceneState::Rendered)
+                m_sceneUpdateScheduler->addScene(sceneID);
+        }
+
+        std::mutex modifiedScenesLock;
+        m_sceneUpdateScheduler->execute([&](SceneId sceneID)
+        {
+            RendererCachedScene& renderScene = m_rendererScenes.getScene(sceneID);
+            bool hasActiveAnimations = false;
+            for (auto handle = AnimationSystemHandle(0); handle < renderScene.getAnimationSystemCount(); ++handle)
             {
-                RendererCachedScene& renderScene = m_rendererScenes.getScene(sceneID);
-                for (auto handle = AnimationSystemHandle(0); handle < renderScene.getAnimationSystemCount(); ++handle)
+                if (renderScene.isAnimationSystemAllocated(handle))
                 {
-                    if (renderScene.isAnimationSystemAllocated(handle))
+                    IAnimationSystem* animationSystem = renderScene.getAnimationSystem(handle);
+                    if (animationSystem->isRealTime())
                     {
-                        IAnimationSystem* animationSystem = renderScene.getAnimationSystem(handle);
-                        if (animationSystem->isRealTime())
-                        {
-                            animationSystem->setTime(systemTime);
-
-                            if (animationSystem->hasActiveAnimations())
-                                m_modifiedScenesToRerender.put(sceneID);
-                        }
+                        animationSystem->setTime(systemTime);
+                        hasActiveAnimations |= animationSystem->hasActiveAnimations();
                     }
                 }
             }
-        }
+
+            if (hasActiveAnimations)
+            {
+                std::lock_guard<std::mutex> guard(modifiedScenesLock);
+                m_modifiedScenesToRerender.put(sceneID);
+            }
+        });
     }
 
     void RendererSceneUpdater::updateScenesTransformationCache()
@@ -1398,23 +1455,71 @@ namespace ramses_internal
             }
         }
 
-        const SceneIdVector& dependencyOrderedScenes = m_rendererScenes.getSceneLinksManager().getTransformationLinkManager().getDependencyChecker().getDependentScenesInOrder();
+        const auto& dependencyChecker = m_rendererScenes.getSceneLinksManager().getTransformationLinkManager().getDependencyChecker();
+        const SceneIdVector& dependencyOrderedScenes = dependencyChecker.getDependentScenesInOrder();
+
+        // updating a consumer also updates matrix caches of its providers, therefore all scenes linked to each other
+        // (directly or indirectly) form a group which is updated one after another in dependency order
+        m_transformationLinkedSceneGroups.clear();
+        for (const auto sceneId : dependencyOrderedScenes)
+        {
+            const SceneIdVector* providers = dependencyChecker.getProviderScenes(sceneId);
+            if (providers != nullptr)
+            {
+                const SceneId group = findTransformationLinkedSceneGroup(sceneId);
+                for (const auto provider : *providers)
+                {
+                    const SceneId providerGroup = findTransformationLinkedSceneGroup(provider);
+                    if (providerGroup != group)
+                        m_transformationLinkedSceneGroups.put(providerGroup, group);
+                }
+            }
+        }
+
+        m_scenesWithTransformationLinks.clear();
+        m_lastScheduledSceneOfTransformationGroup.clear();
         for(const auto sceneId : dependencyOrderedScenes)
         {
-            if (m_scenesNeedingTransformationCacheUpdate.contains(sceneId))
+            if (m_scenesNeedingTransformationCacheUpdate.remove(sceneId))
             {
-                RendererCachedScene& renderScene = m_rendererScenes.getScene(sceneId);
-                renderScene.updateRenderableWorldMatricesWithLinks();
-                m_scenesNeedingTransformationCacheUpdate.remove(sceneId);
+                m_scenesWithTransformationLinks.put(sceneId);
+                m_sceneUpdateScheduler->addScene(sceneId);
+
+                const SceneId group = findTransformationLinkedSceneGroup(sceneId);
+                SceneId* lastScheduledScene = m_lastScheduledSceneOfTransformationGroup.get(group);
+                if (lastScheduledScene != nullptr)
+                {
+                    m_sceneUpdateScheduler->addDependency(*lastScheduledScene, sceneId);
+                    *lastScheduledScene = sceneId;
+                }
+                else
+                    m_lastScheduledSceneOfTransformationGroup.put(group, sceneId);
             }
         }
 
-        // update rest of scenes that have no dependencies
+        // rest of scenes have no dependencies
         for(const auto sceneId : m_scenesNeedingTransformationCacheUpdate)
+            m_sceneUpdateScheduler->addScene(sceneId);
+
+        m_sceneUpdateScheduler->execute([this](SceneId sceneId)
         {
             RendererCachedScene& renderScene = m_rendererScenes.getScene(sceneId);
-            renderScene.updateRenderableWorldMatrices();
+            if (m_scenesWithTransformationLinks.contains(sceneId))
+                renderScene.updateRenderableWorldMatricesWithLinks();
+            else
+                renderScene.updateRenderableWorldMatrices();
+        });
+    }
+
+    SceneId RendererSceneUpdater::findTransformationLinkedSceneGroup(SceneId sceneId) const
+    {
+        const SceneId* parent = m_transformationLinkedSceneGroups.get(sceneId);
+        while (parent != nullptr)
+        {
+            sceneId = *parent;
+            parent = m_transformationLinkedSceneGroups.get(sceneId);
         }
+        return sceneId;
     }
 
     void RendererSceneUpdater::updateScenesDataLinks()
@@ -50,12 +50,52 @@ namespace ramses_internal
         m_displayStatistics[display].numFrameBufferSwapped++;
     }
 
+    void RendererStatistics::gpuTimingsCollected(DisplayHandle display, const GpuTimings& timings)
+    {
+        for (const auto& timing : timings)
+        {
+            const UInt64 durationUs = timing.durationNs / 1000u;
+            if (!timing.sceneId.isValid())
+            {
+                auto& dispStat = m_displayStatistics[display];
+                dispStat.numGpuFramesMeasured++;
+                dispStat.gpuFrameTimeUs.update(durationUs);
+            }
+            else if (!timing.renderPass.isValid())
+            {
+                auto& sceneStats = m_sceneStatistics[timing.sceneId];
+                sceneStats.numGpuTimesMeasured++;
+                sceneStats.gpuTimeUs.update(durationUs);
+            }
+            else
+            {
+                auto& sceneStats = m_sceneStatistics[timing.sceneId];
+                if (durationUs >= sceneStats.mostExpensiveRenderPassGpuTimeUs)
+                {
+                    sceneStats.mostExpensiveRenderPass = timing.renderPass;
+                    sceneStats.mostExpensiveRenderPassGpuTimeUs = durationUs;
+                }
+            }
+        }
+    }
+
     void RendererStatistics::resourceUploaded(UInt byteSize)
     {
         m_resourcesUploaded++;
         m_resourcesBytesUploaded += byteSize;
     }
 
+    void RendererStatistics::resourceResidencyHit()
+    {
+        m_resourceResidencyHits++;
+    }
+
+    void RendererStatistics::resourceEvicted(UInt byteSize)
+    {
+        m_resourcesEvicted++;
+        m_resourcesBytesEvicted += byteSize;
+    }
+
     void RendererStatistics::sceneResourceUploaded(SceneId sceneId, UInt byteSize)
     {
         auto& sceneStats = m_sceneStatistics[sceneId];
@@ -130,6 +170,13 @@ namespace ramses_internal
         }
     }
 
+    void RendererStatistics::flushPresented(SceneId sceneId, std::chrono::microseconds arrivalToSwapLatency)
+    {
+        auto& sceneStats = m_sceneStatistics[sceneId];
+        sceneStats.numFlushesPresented++;
+        sceneStats.flushArrivalToSwapLatencyUs.update(static_cast<int64_t>(arrivalToSwapLatency.count()));
+    }
+
     void RendererStatistics::untrackScene(SceneId sceneId)
     {
         m_sceneStatistics.erase(sceneId);
@@ -182,6 +229,9 @@ namespace ramses_internal
         m_frameDurationMax = 0u;
         m_resourcesUploaded = 0u;
         m_resourcesBytesUploaded = 0u;
+        m_resourceResidencyHits = 0u;
+        m_resourcesEvicted = 0u;
+        m_resourcesBytesEvicted = 0u;
         m_shadersCompiled = 0u;
         m_microsecondsForShaderCompilation = 0u;
         m_maximumDurationShaderName = "";
@@ -206,14 +256,22 @@ namespace ramses_internal
             sceneStat.numResourcesRemovedPerFlush.reset();
             sceneStat.numSceneResourceActionsPerFlush.reset();
             sceneStat.flushLatency.reset();
+            sceneStat.numFlushesPresented = 0u;
+            sceneStat.flushArrivalToSwapLatencyUs.reset();
             sceneStat.sceneResourcesUploaded = 0u;
             sceneStat.sceneResourcesBytesUploaded = 0u;
             sceneStat.numRendered = 0u;
+            sceneStat.numGpuTimesMeasured = 0u;
+            sceneStat.gpuTimeUs.reset();
+            sceneStat.mostExpensiveRenderPass = RenderPassHandle::Invalid();
+            sceneStat.mostExpensiveRenderPassGpuTimeUs = 0u;
         }
 
         for (auto& dispStat : m_displayStatistics)
         {
             dispStat.second.numFrameBufferSwapped = 0u;
+            dispStat.second.numGpuFramesMeasured = 0u;
+            dispStat.second.gpuFrameTimeUs.reset();
             for (auto& obStat : dispStat.second.offscreenBufferStatistics)
             {
                 obStat.second.numSwapped = 0u;
@@ -243,6 +301,8 @@ namespace ramses_internal
             ", numFrames " << m_frameNumber;
         if (m_resourcesUploaded > 0u)
             str << ", resUploaded " << m_resourcesUploaded << " (" << m_resourcesBytesUploaded << " B)";
+        if (m_resourceResidencyHits > 0u || m_resourcesEvicted > 0u)
+            str << ", resCache hits " << m_resourceResidencyHits << " misses " << m_resourcesUploaded << " evicted " << m_resourcesEvicted << " (" << m_resourcesBytesEvicted << " B)";
         if (m_shadersCompiled > 0u)
         {
             str << ", shadersCompiled " << m_shadersCompiled << " for total ms:" << m_microsecondsForShaderCompilation / 1000;
@@ -254,6 +314,11 @@ namespace ramses_internal
         for (const auto& dbStat : m_displayStatistics)
         {
             str << "FB" << dbStat.first << ": " << dbStat.second.numFrameBufferSwapped;
+            if (dbStat.second.numGpuFramesMeasured > 0u)
+            {
+                const auto& gpuFrameTime = dbStat.second.gpuFrameTimeUs;
+                str << " (gpuFrameTime us " << gpuFrameTime.minValue << "/" << gpuFrameTime.maxValue << "/" << gpuFrameTime.sum / dbStat.second.numGpuFramesMeasured << ")";
+            }
             for (const auto& obStat : dbStat.second.offscreenBufferStatistics)
             {
                 str << "; OB" << obStat.first << ": " << obStat.second.numSwapped;
@@ -289,8 +354,20 @@ namespace ramses_internal
                 str << ", RC-/F (" << numResourcesRemovedPerFlush.minValue << "/" << numResourcesRemovedPerFlush.maxValue << "/" << static_cast<float>(numResourcesRemovedPerFlush.sum) / sceneStats.numFlushesArrived << ")";
                 str << ", RS/F (" << numSceneResourceActionsPerFlush.minValue << "/" << numSceneResourceActionsPerFlush.maxValue << "/" << static_cast<float>(numSceneResourceActionsPerFlush.sum) / sceneStats.numFlushesArrived << ")";
             }
+            if (sceneStats.numFlushesPresented > 0u)
+            {
+                const auto& arrivalToSwap = sceneStats.flushArrivalToSwapLatencyUs;
+                str << ", arrivalToSwap us (" << arrivalToSwap.minValue << "/" << arrivalToSwap.maxValue << "/" << arrivalToSwap.sum / static_cast<int64_t>(sceneStats.numFlushesPresented) << ")";
+            }
             if (sceneStats.sceneResourcesUploaded > 0u)
                 str << ", RSUploaded " << sceneStats.sceneResourcesUploaded << " (" << sceneStats.sceneResourcesBytesUploaded << " B)";
+            if (sceneStats.numGpuTimesMeasured > 0u)
+            {
+                const auto& gpuTime = sceneStats.gpuTimeUs;
+                str << ", gpuTime us (" << gpuTime.minValue << "/" << gpuTime.maxValue << "/" << gpuTime.sum / sceneStats.numGpuTimesMeasured << ")";
+                if (sceneStats.mostExpensiveRenderPass.isValid())
+                    str << ", maxGpuRP " << sceneStats.mostExpensiveRenderPass << " (" << sceneStats.mostExpensiveRenderPassGpuTimeUs << " us)";
+            }
             str << "\n";
         }
 
@@ -187,6 +187,48 @@ namespace ramses_internal
         return blitPassHandle;
     }
 
+    TextureBufferHandle ResourceCachedScene::allocateTextureBuffer(ETextureFormat textureFormat, const MipMapDimensions& mipMapDimensions, TextureBufferHandle handle)
+    {
+        const TextureBufferHandle textureBufferHandle = DataReferenceLinkCachedScene::allocateTextureBuffer(textureFormat, mipMapDimensions, handle);
+
+        // whole new texture buffer has to be uploaded
+        std::vector<Quad> mipRegions;
+        mipRegions.reserve(mipMapDimensions.size());
+        for (const auto& mipSize : mipMapDimensions)
+            mipRegions.emplace_back(0, 0, static_cast<Int32>(mipSize.width), static_cast<Int32>(mipSize.height));
+        m_textureBufferDirtyRegions.put(textureBufferHandle, std::move(mipRegions));
+
+        return textureBufferHandle;
+    }
+
+    void ResourceCachedScene::releaseTextureBuffer(TextureBufferHandle handle)
+    {
+        m_textureBufferDirtyRegions.remove(handle);
+        DataReferenceLinkCachedScene::releaseTextureBuffer(handle);
+    }
+
+    void ResourceCachedScene::updateTextureBuffer(TextureBufferHandle handle, UInt32 mipLevel, UInt32 x, UInt32 y, UInt32 width, UInt32 height, const Byte* data)
+    {
+        DataReferenceLinkCachedScene::updateTextureBuffer(handle, mipLevel, x, y, width, height, data);
+
+        auto it = m_textureBufferDirtyRegions.find(handle);
+        if (it == m_textureBufferDirtyRegions.end())
+            it = m_textureBufferDirtyRegions.put(handle, std::vector<Quad>(getTextureBuffer(handle).mipMaps.size()));
+        assert(mipLevel < it->value.size());
+        Quad& dirtyRegion = it->value[mipLevel];
+        dirtyRegion = dirtyRegion.getBoundingQuad({ static_cast<Int32>(x), static_cast<Int32>(y), static_cast<Int32>(width), static_cast<Int32>(height) });
+    }
+
+    const TextureBufferDirtyRegions& ResourceCachedScene::getTextureBufferDirtyRegions() const
+    {
+        return m_textureBufferDirtyRegions;
+    }
+
+    void ResourceCachedScene::clearTextureBufferDirtyRegions()
+    {
+        m_textureBufferDirtyRegions.clear();
+    }
+
     Bool ResourceCachedScene::renderableResourcesDirty(RenderableHandle handle) const
     {
         UInt32 renderableAsIndex = handle.asMemoryHandle();
@@ -655,13 +697,18 @@ namespace ramses_internal
 
         std::fill(m_effectDeviceHandleCache.begin(), m_effectDeviceHandleCache.end(), DeviceResourceHandle::Invalid());
         std::fill(m_deviceHandleCacheForTextures.begin(), m_deviceHandleCacheForTextures.end(), DeviceResourceHandle::Invalid());
-        std::fill(m_renderTargetCache.begin(), m_renderTargetCache.end(), DeviceResourceHandle::Invalid());
-        std::fill(m_blitPassCache.begin(), m_blitPassCache.end(), DeviceResourceHandle::Invalid());
 
         for (auto& vtxCache : m_deviceHandleCacheForVertexAttributes)
             for (auto& attribCache : vtxCache)
                 attribCache.deviceHandle = DeviceResourceHandle::Invalid();
 
+        resetRenderTargetCache();
+    }
+
+    void ResourceCachedScene::resetRenderTargetCache()
+    {
+        std::fill(m_renderTargetCache.begin(), m_renderTargetCache.end(), DeviceResourceHandle::Invalid());
+        std::fill(m_blitPassCache.begin(), m_blitPassCache.end(), DeviceResourceHandle::Invalid());
         m_renderTargetsDirty = !m_renderTargetCache.empty();
         m_blitPassesDirty = !m_blitPassCache.empty();
     }
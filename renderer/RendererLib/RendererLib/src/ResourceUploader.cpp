@@ -68,7 +68,7 @@ namespace ramses_internal
         }
     }
 
-    void ResourceUploader::unloadResource(IRenderBackend& rendererBackend, EResourceType type, ResourceContentHash, const DeviceResourceHandle handle)
+    void ResourceUploader::unloadResource(IRenderBackend& rendererBackend, EResourceType type, ResourceContentHash hash, const DeviceResourceHandle handle)
     {
         switch (type)
         {
@@ -84,6 +84,7 @@ namespace ramses_internal
             rendererBackend.getDevice().deleteTexture(handle);
             break;
         case EResourceType_Effect:
+            m_pendingEffectCompilations.remove(hash);
             rendererBackend.getDevice().deleteShader(handle);
             break;
         default:
@@ -91,6 +92,36 @@ namespace ramses_internal
         }
     }
 
+    EShaderUploadStatus ResourceUploader::getEffectUploadStatus(IRenderBackend& renderBackend, ResourceContentHash hash, DeviceResourceHandle handle)
+    {
+        IDevice& device = renderBackend.getDevice();
+        const EShaderUploadStatus status = device.getShaderUploadStatus(handle);
+        if (status == EShaderUploadStatus::Pending)
+            return status;
+
+        const auto it = m_pendingEffectCompilations.find(hash);
+        if (it == m_pendingEffectCompilations.end())
+            return status;
+
+        const EffectCompilation& compilation = it->value;
+        const auto compileTime = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - compilation.startTime);
+        m_stats.shaderCompiled(compileTime, compilation.effectName, compilation.sceneId);
+
+        if (status == EShaderUploadStatus::Uploaded && m_binaryShaderCache && m_binaryShaderCache->shouldBinaryShaderBeCached(hash, compilation.sceneId))
+        {
+            UInt8Vector binaryShader;
+            BinaryShaderFormatID format;
+            if (device.getBinaryShader(handle, binaryShader, format))
+            {
+                assert(binaryShader.size() != 0u);
+                m_binaryShaderCache->storeBinaryShader(hash, compilation.sceneId, &binaryShader.front(), static_cast<UInt32>(binaryShader.size()), format);
+            }
+        }
+
+        m_pendingEffectCompilations.remove(it);
+        return status;
+    }
+
     DeviceResourceHandle ResourceUploader::uploadTexture(IDevice& device, const TextureResource& texture, UInt32& vramSize)
     {
         const Bool generateMipsFlag = texture.getGenerateMipChainFlag();
@@ -166,11 +197,7 @@ namespace ramses_internal
         if (!m_binaryShaderCache)
         {
             LOG_TRACE(CONTEXT_RENDERER, "ResourceUploader::queryBinaryShaderCacheAndUploadEffect: no binary shader cache present");
-            auto steadyNow = std::chrono::steady_clock::now();
-            auto handle = device.uploadShader(effect);
-            auto steadyDiff = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - steadyNow);
-            m_stats.shaderCompiled(steadyDiff, effect.getName(), sceneid);
-            return handle;
+            return startEffectCompilation(device, effect, hash, sceneid);
         }
 
         if (!m_supportedFormatsReported)
@@ -206,23 +233,25 @@ namespace ramses_internal
         }
 
         // If this point is reached, we either have no cache or the cache was broken.
-        auto steadyNow = std::chrono::steady_clock::now();
-        const DeviceResourceHandle sourceShaderHandle = device.uploadShader(effect);
-        auto steadyDiff = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - steadyNow);
-        m_stats.shaderCompiled(steadyDiff, effect.getName(), sceneid);
+        // Binary shader is stored to cache once compilation finished, see getEffectUploadStatus
+        return startEffectCompilation(device, effect, hash, sceneid);
+    }
 
-        if (sourceShaderHandle.isValid() && m_binaryShaderCache->shouldBinaryShaderBeCached(hash, sceneid))
+    DeviceResourceHandle ResourceUploader::startEffectCompilation(IDevice& device, const EffectResource& effect, ResourceContentHash hash, SceneId sceneid)
+    {
+        const auto startTime = std::chrono::steady_clock::now();
+        const DeviceResourceHandle handle = device.startShaderUpload(effect);
+        if (handle.isValid())
         {
-            UInt8Vector binaryShader;
-            BinaryShaderFormatID format;
-            if (device.getBinaryShader(sourceShaderHandle, binaryShader, format))
-            {
-                assert(binaryShader.size() != 0u);
-                m_binaryShaderCache->storeBinaryShader(hash, sceneid, &binaryShader.front(), static_cast<UInt32>(binaryShader.size()), format);
-            }
+            m_pendingEffectCompilations.put(hash, { startTime, effect.getName(), sceneid });
+        }
+        else
+        {
+            const auto compileTime = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - startTime);
+            m_stats.shaderCompiled(compileTime, effect.getName(), sceneid);
         }
 
-        return sourceShaderHandle;
+        return handle;
     }
 
     UInt32 ResourceUploader::EstimateGPUAllocatedSizeOfTexture(const TextureResource& texture, UInt32 numMipLevelsToAllocate)
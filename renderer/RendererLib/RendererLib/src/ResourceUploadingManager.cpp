@@ -15,6 +15,7 @@
 #include "RendererAPI/IEmbeddedCompositingManager.h"
 #include "RendererAPI/IDevice.h"
 #include "Utils/LogMacros.h"
+#include "Utils/TraceRecorder.h"
 #include "PlatformAbstraction/PlatformTime.h"
 
 namespace ramses_internal
@@ -42,6 +43,10 @@ namespace ramses_internal
         // Unload all remaining resources that were kept due to caching strategy.
         // Or in case display is being destructed together with scenes and there is no more rendering,
         // ie. no more deferred upload/unloads
+        for (const auto& pendingUpload : m_pendingShaderUploads)
+            m_uploader.unloadResource(m_renderBackend, EResourceType_Effect, pendingUpload.key, pendingUpload.value.deviceHandle);
+        m_pendingShaderUploads.clear();
+
         ResourceContentHashVector resourcesToUnload;
         getResourcesToUnloadNext(resourcesToUnload, false, std::numeric_limits<UInt64>::max());
         unloadResources(resourcesToUnload);
@@ -60,6 +65,8 @@ namespace ramses_internal
 
     void ResourceUploadingManager::uploadAndUnloadPendingResources()
     {
+        updatePendingShaderUploads();
+
         ResourceContentHashVector resourcesToUpload;
         UInt64 sizeToUpload = 0u;
         getAndPrepareResourcesToUploadNext(resourcesToUpload, sizeToUpload);
@@ -67,11 +74,29 @@ namespace ramses_internal
 
         ResourceContentHashVector resourcesToUnload;
         getResourcesToUnloadNext(resourcesToUnload, m_keepEffects, sizeToBeFreed);
+        for (const auto& hash : resourcesToUnload)
+            m_stats.resourceEvicted(*m_resourceSizes.get(hash));
 
         unloadResources(resourcesToUnload);
         uploadResources(resourcesToUpload);
     }
 
+    void ResourceUploadingManager::addRenderTargetMemory(UInt64 byteSize)
+    {
+        m_renderTargetMemorySize += byteSize;
+    }
+
+    void ResourceUploadingManager::removeRenderTargetMemory(UInt64 byteSize)
+    {
+        assert(m_renderTargetMemorySize >= byteSize);
+        m_renderTargetMemorySize -= byteSize;
+    }
+
+    UInt64 ResourceUploadingManager::getRenderTargetMemorySize() const
+    {
+        return m_renderTargetMemorySize;
+    }
+
     void ResourceUploadingManager::unloadResources(const ResourceContentHashVector& resourcesToUnload)
     {
         for(const auto& resource : resourcesToUnload)
@@ -83,6 +108,7 @@ namespace ramses_internal
 
     void ResourceUploadingManager::uploadResources(const ResourceContentHashVector& resourcesToUpload)
     {
+        TraceScope traceScope("resources", "uploadResources");
         UInt32 sizeUploaded = 0u;
         for (size_t i = 0; i < resourcesToUpload.size(); ++i)
         {
@@ -119,19 +145,23 @@ namespace ramses_internal
     {
         assert(rd.resource);
         assert(!rd.deviceHandle.isValid());
+        TraceScope traceScope("resources", EnumToString(rd.type));
         LOG_TRACE(CONTEXT_PROFILING, "        ResourceUploadingManager::uploadResource upload resource of type " << EnumToString(rd.type));
 
         const IResource* pResource = rd.resource.get();
         assert(pResource->isDeCompressedAvailable());
 
-        const UInt32 resourceSize = pResource->getDecompressedDataSize();
         UInt32 vramSize = 0;
         const DeviceResourceHandle deviceHandle = m_uploader.uploadResource(m_renderBackend, rd, vramSize);
-        if (deviceHandle.isValid())
+        if (deviceHandle.isValid() && rd.type == EResourceType_Effect)
+        {
+            const PendingShaderUpload pendingUpload{ rd.resource, deviceHandle, vramSize };
+            if (!finishShaderUploadIfCompleted(rd.hash, pendingUpload))
+                m_pendingShaderUploads.put(rd.hash, pendingUpload);
+        }
+        else if (deviceHandle.isValid())
         {
-            m_resourceSizes.put(rd.hash, resourceSize);
-            m_resourceTotalUploadedSize += resourceSize;
-            m_resources.setResourceUploaded(rd.hash, deviceHandle, vramSize);
+            markResourceUploaded(rd.hash, deviceHandle, vramSize);
         }
         else
         {
@@ -140,6 +170,58 @@ namespace ramses_internal
         }
     }
 
+    void ResourceUploadingManager::markResourceUploaded(const ResourceContentHash& hash, DeviceResourceHandle deviceHandle, UInt32 vramSize)
+    {
+        m_resourceSizes.put(hash, vramSize);
+        m_resourceTotalUploadedSize += vramSize;
+        m_resources.setResourceUploaded(hash, deviceHandle, vramSize);
+    }
+
+    Bool ResourceUploadingManager::finishShaderUploadIfCompleted(const ResourceContentHash& hash, const PendingShaderUpload& pendingUpload)
+    {
+        switch (m_uploader.getEffectUploadStatus(m_renderBackend, hash, pendingUpload.deviceHandle))
+        {
+        case EShaderUploadStatus::Pending:
+            return false;
+        case EShaderUploadStatus::Uploaded:
+            markResourceUploaded(hash, pendingUpload.deviceHandle, pendingUpload.vramSize);
+            return true;
+        case EShaderUploadStatus::Failed:
+            LOG_ERROR(CONTEXT_RENDERER, "ResourceUploadingManager::finishShaderUploadIfCompleted failed to compile effect #" << hash);
+            m_resources.setResourceBroken(hash);
+            return true;
+        }
+
+        assert(false);
+        return true;
+    }
+
+    void ResourceUploadingManager::updatePendingShaderUploads()
+    {
+        if (m_pendingShaderUploads.size() == 0u)
+            return;
+
+        TraceScope traceScope("resources", "updatePendingShaderUploads");
+        ResourceContentHashVector finishedUploads;
+        for (const auto& pendingUpload : m_pendingShaderUploads)
+        {
+            const ResourceContentHash& hash = pendingUpload.key;
+            // resource can be unregistered by scenes while still compiling, device resource is not needed anymore then
+            if (!m_resources.containsResource(hash) || m_resources.getResourceDescriptor(hash).status != EResourceStatus::Provided)
+            {
+                m_uploader.unloadResource(m_renderBackend, EResourceType_Effect, hash, pendingUpload.value.deviceHandle);
+                finishedUploads.push_back(hash);
+            }
+            else if (finishShaderUploadIfCompleted(hash, pendingUpload.value))
+            {
+                finishedUploads.push_back(hash);
+            }
+        }
+
+        for (const auto& hash : finishedUploads)
+            m_pendingShaderUploads.remove(hash);
+    }
+
     void ResourceUploadingManager::unloadResource(const ResourceDescriptor& rd)
     {
         assert(rd.sceneUsage.empty());
@@ -165,7 +247,7 @@ namespace ramses_internal
         const ResourceContentHashVector& unusedResources = m_resources.getAllResourcesNotInUseByScenes();
         UInt64 sizeToUnload = 0u;
 
-        // collect unused resources to be unloaded
+        // collect unused resources to be unloaded, least recently used first
         // if total size of resources to be unloaded is enough
         // we stop adding more unused resources, they can be kept uploaded as long as not more memory is needed
         for (const auto& hash : unusedResources)
@@ -197,11 +279,16 @@ namespace ramses_internal
         const ResourceContentHashVector& providedResources = m_resources.getAllProvidedResources();
         for(const auto& resource : providedResources)
         {
+            // effect already uploaded but still being compiled
+            if (m_pendingShaderUploads.contains(resource))
+                continue;
+
             const ResourceDescriptor& rd = m_resources.getResourceDescriptor(resource);
             assert(rd.status == EResourceStatus::Provided);
             assert(rd.resource);
             const IResource* resourceObj = rd.resource.get();
             resourceObj->decompress();
+            // actual GPU memory footprint is only known after upload, decompressed size is used as estimate
             totalSize += resourceObj->getDecompressedDataSize();
 
             resourcesToUpload.push_back(resource);
@@ -216,9 +303,10 @@ namespace ramses_internal
             return std::numeric_limits<UInt64>::max();
         }
 
-        if (m_resourceCacheSize > m_resourceTotalUploadedSize)
+        const UInt64 totalUsedSize = m_resourceTotalUploadedSize + m_renderTargetMemorySize;
+        if (m_resourceCacheSize > totalUsedSize)
         {
-            const UInt64 remainingCacheSize = m_resourceCacheSize - m_resourceTotalUploadedSize;
+            const UInt64 remainingCacheSize = m_resourceCacheSize - totalUsedSize;
             if (remainingCacheSize < sizeToUpload)
             {
                 return sizeToUpload - remainingCacheSize;
@@ -231,7 +319,7 @@ namespace ramses_internal
         else
         {
             // cache already exceeded, try unloading all that is above cache limit plus size for new resources to be uploaded
-            return sizeToUpload + m_resourceTotalUploadedSize - m_resourceCacheSize;
+            return sizeToUpload + totalUsedSize - m_resourceCacheSize;
         }
     }
 }
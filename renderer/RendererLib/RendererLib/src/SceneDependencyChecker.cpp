@@ -56,6 +56,11 @@ namespace ramses_internal
         return m_consumerToProvidersMap.contains(scene);
     }
 
+    const SceneIdVector* SceneDependencyChecker::getProviderScenes(SceneId consumerScene) const
+    {
+        return m_consumerToProvidersMap.get(consumerScene);
+    }
+
     const SceneIdVector& SceneDependencyChecker::getDependentScenesInOrder() const
     {
         if (m_dirty)
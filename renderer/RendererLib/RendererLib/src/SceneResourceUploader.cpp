@@ -12,6 +12,8 @@
 #include "SceneAPI/IScene.h"
 #include "SceneAPI/TextureBuffer.h"
 #include "SceneAPI/BlitPass.h"
+#include "SceneAPI/TextureEnums.h"
+#include "PlatformAbstraction/PlatformMemory.h"
 
 namespace ramses_internal
 {
@@ -52,14 +54,52 @@ namespace ramses_internal
         resourceManager.uploadTextureBuffer(handle, mip0.width, mip0.height, texBuffer.textureFormat, static_cast<UInt32>(mipMaps.size()), scene.getSceneId());
     }
 
-    void SceneResourceUploader::UpdateTextureBuffer(const IScene& scene, TextureBufferHandle handle, IRendererResourceManager& resourceManager)
+    void SceneResourceUploader::UpdateTextureBuffer(const IScene& scene, TextureBufferHandle handle, IRendererResourceManager& resourceManager, const TextureBufferDirtyRegions* dirtyRegions)
     {
         const TextureBuffer& texBuffer = scene.getTextureBuffer(handle);
         const auto& mipMaps = texBuffer.mipMaps;
+        const std::vector<Quad>* mipDirtyRegions = (dirtyRegions != nullptr ? dirtyRegions->get(handle) : nullptr);
+        if (mipDirtyRegions == nullptr)
+        {
+            for (UInt32 mipLevel = 0u; mipLevel < static_cast<uint32_t>(mipMaps.size()); ++mipLevel)
+            {
+                const auto& mip = mipMaps[mipLevel];
+                resourceManager.updateTextureBuffer(handle, mipLevel, 0u, 0u, mip.width, mip.height, mip.data.data(), scene.getSceneId());
+            }
+            return;
+        }
+
+        assert(mipDirtyRegions->size() == mipMaps.size());
+        const UInt32 texelSize = GetTexelSizeFromFormat(texBuffer.textureFormat);
+        std::vector<Byte> regionData;
         for (UInt32 mipLevel = 0u; mipLevel < static_cast<uint32_t>(mipMaps.size()); ++mipLevel)
         {
             const auto& mip = mipMaps[mipLevel];
-            resourceManager.updateTextureBuffer(handle, mipLevel, 0u, 0u, mip.width, mip.height, texBuffer.mipMaps[mipLevel].data.data(), scene.getSceneId());
+            const Quad& region = (*mipDirtyRegions)[mipLevel];
+            if (region.getArea() == 0)
+                continue;
+
+            const auto x = static_cast<UInt32>(region.x);
+            const auto y = static_cast<UInt32>(region.y);
+            const auto width = static_cast<UInt32>(region.width);
+            const auto height = static_cast<UInt32>(region.height);
+            assert(x + width <= mip.width && y + height <= mip.height);
+
+            if (width == mip.width && height == mip.height)
+            {
+                resourceManager.updateTextureBuffer(handle, mipLevel, 0u, 0u, width, height, mip.data.data(), scene.getSceneId());
+                continue;
+            }
+
+            // device expects tightly packed rows of the uploaded region, same layout as given to IScene::updateTextureBuffer
+            const UInt32 regionRowSize = width * texelSize;
+            const UInt32 mipRowSize = mip.width * texelSize;
+            regionData.resize(regionRowSize * height);
+            const Byte* srcPtr = mip.data.data() + y * mipRowSize + x * texelSize;
+            for (UInt32 row = 0u; row < height; ++row)
+                PlatformMemory::Copy(regionData.data() + row * regionRowSize, srcPtr + row * mipRowSize, regionRowSize);
+
+            resourceManager.updateTextureBuffer(handle, mipLevel, x, y, width, height, regionData.data(), scene.getSceneId());
         }
     }
 }
@@ -0,0 +1,151 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2020 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "RendererLib/SceneUpdateScheduler.h"
+#include "TaskFramework/ThreadedTaskExecutor.h"
+#include "TaskFramework/ITask.h"
+#include <cassert>
+
+namespace ramses_internal
+{
+    class SceneUpdateScheduler::SceneUpdateTask final : public ITask
+    {
+    public:
+        SceneUpdateTask(SceneUpdateScheduler& scheduler, UInt32 nodeIndex)
+            : m_scheduler(scheduler)
+            , m_nodeIndex(nodeIndex)
+        {
+        }
+
+        virtual void execute() override
+        {
+            (*m_scheduler.m_update)(m_scheduler.m_nodes[m_nodeIndex].sceneId);
+            m_scheduler.onSceneUpdated(m_nodeIndex);
+        }
+
+    private:
+        SceneUpdateScheduler& m_scheduler;
+        const UInt32 m_nodeIndex;
+    };
+
+    SceneUpdateScheduler::SceneUpdateScheduler(UInt32 threadCount)
+        : m_threadCount(threadCount)
+    {
+        if (m_threadCount > 0u)
+            m_executor = std::make_unique<ThreadedTaskExecutor>(static_cast<UInt16>(m_threadCount));
+    }
+
+    SceneUpdateScheduler::~SceneUpdateScheduler()
+    {
+        // worker threads release the tasks after executing them, they must be gone before the tasks are destroyed
+        m_executor.reset();
+    }
+
+    UInt32 SceneUpdateScheduler::getThreadCount() const
+    {
+        return m_threadCount;
+    }
+
+    void SceneUpdateScheduler::addScene(SceneId sceneId)
+    {
+        assert(!m_sceneToNode.contains(sceneId));
+        m_sceneToNode.put(sceneId, static_cast<UInt32>(m_nodes.size()));
+        m_nodes.push_back({ sceneId, 0u, {} });
+    }
+
+    void SceneUpdateScheduler::addDependency(SceneId sceneToUpdateFirst, SceneId sceneToUpdateAfter)
+    {
+        const UInt32* firstNode = m_sceneToNode.get(sceneToUpdateFirst);
+        const UInt32* afterNode = m_sceneToNode.get(sceneToUpdateAfter);
+        assert(firstNode != nullptr && afterNode != nullptr);
+        assert(*firstNode < *afterNode);
+
+        m_nodes[*firstNode].successors.push_back(*afterNode);
+        ++m_nodes[*afterNode].numDependencies;
+    }
+
+    void SceneUpdateScheduler::execute(const UpdateFunction& update)
+    {
+        // not worth distributing, single scene would be executed on worker while this thread waits
+        if (!m_executor || m_nodes.size() <= 1u)
+            executeSerially(update);
+        else
+            executeConcurrently(update);
+
+        clear();
+    }
+
+    void SceneUpdateScheduler::clear()
+    {
+        m_nodes.clear();
+        m_sceneToNode.clear();
+    }
+
+    void SceneUpdateScheduler::executeSerially(const UpdateFunction& update)
+    {
+        for (const auto& node : m_nodes)
+            update(node.sceneId);
+    }
+
+    void SceneUpdateScheduler::executeConcurrently(const UpdateFunction& update)
+    {
+        const UInt32 numNodes = static_cast<UInt32>(m_nodes.size());
+        while (m_tasks.size() < numNodes)
+            m_tasks.push_back(std::make_unique<SceneUpdateTask>(*this, static_cast<UInt32>(m_tasks.size())));
+
+        std::vector<UInt32> readyNodes;
+        {
+            std::lock_guard<std::mutex> guard(m_lock);
+            m_update = &update;
+            m_numScenesFinished = 0u;
+            m_pendingDependencies.resize(numNodes);
+            for (UInt32 i = 0u; i < numNodes; ++i)
+            {
+                m_pendingDependencies[i] = m_nodes[i].numDependencies;
+                if (m_nodes[i].numDependencies == 0u)
+                    readyNodes.push_back(i);
+            }
+        }
+        assert(!readyNodes.empty());
+
+        for (const auto nodeIndex : readyNodes)
+            enqueue(nodeIndex);
+
+        std::unique_lock<std::mutex> lock(m_lock);
+        m_allScenesFinished.wait(lock, [&]() { return m_numScenesFinished == numNodes; });
+        m_update = nullptr;
+    }
+
+    void SceneUpdateScheduler::onSceneUpdated(UInt32 nodeIndex)
+    {
+        std::vector<UInt32> readyNodes;
+        bool allFinished = false;
+        {
+            std::lock_guard<std::mutex> guard(m_lock);
+            for (const auto successor : m_nodes[nodeIndex].successors)
+            {
+                assert(m_pendingDependencies[successor] > 0u);
+                if (--m_pendingDependencies[successor] == 0u)
+                    readyNodes.push_back(successor);
+            }
+            ++m_numScenesFinished;
+            allFinished = (m_numScenesFinished == m_nodes.size());
+        }
+
+        for (const auto readyNode : readyNodes)
+            enqueue(readyNode);
+
+        if (allFinished)
+            m_allScenesFinished.notify_one();
+    }
+
+    void SceneUpdateScheduler::enqueue(UInt32 nodeIndex)
+    {
+        m_executor->enqueue(*m_tasks[nodeIndex]);
+    }
+}
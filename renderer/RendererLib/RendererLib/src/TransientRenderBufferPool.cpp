@@ -0,0 +1,87 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2020 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "RendererLib/TransientRenderBufferPool.h"
+#include <algorithm>
+#include <cassert>
+
+namespace ramses_internal
+{
+    DeviceResourceHandle TransientRenderBufferPool::acquire(const RenderBuffer& renderBuffer, OwnerId owner)
+    {
+        for (auto& entry : m_entries)
+        {
+            if (entry.renderBuffer == renderBuffer && std::find(entry.owners.cbegin(), entry.owners.cend(), owner) == entry.owners.cend())
+            {
+                entry.owners.push_back(owner);
+                return entry.deviceHandle;
+            }
+        }
+
+        return DeviceResourceHandle::Invalid();
+    }
+
+    void TransientRenderBufferPool::add(const RenderBuffer& renderBuffer, DeviceResourceHandle deviceHandle, UInt32 byteSize, OwnerId owner)
+    {
+        assert(deviceHandle.isValid());
+        assert(!contains(deviceHandle));
+        m_entries.push_back({ renderBuffer, deviceHandle, byteSize, { owner } });
+    }
+
+    Bool TransientRenderBufferPool::release(DeviceResourceHandle deviceHandle, OwnerId owner)
+    {
+        const auto entryIt = findEntry(deviceHandle);
+        assert(entryIt != m_entries.end());
+        auto& owners = entryIt->owners;
+        const auto ownerIt = std::find(owners.begin(), owners.end(), owner);
+        assert(ownerIt != owners.end());
+        owners.erase(ownerIt);
+
+        if (!owners.empty())
+            return false;
+
+        m_entries.erase(entryIt);
+        return true;
+    }
+
+    Bool TransientRenderBufferPool::contains(DeviceResourceHandle deviceHandle) const
+    {
+        return findEntry(deviceHandle) != m_entries.cend();
+    }
+
+    UInt32 TransientRenderBufferPool::getUserCount(DeviceResourceHandle deviceHandle) const
+    {
+        const auto entryIt = findEntry(deviceHandle);
+        return (entryIt != m_entries.cend() ? static_cast<UInt32>(entryIt->owners.size()) : 0u);
+    }
+
+    UInt32 TransientRenderBufferPool::getByteSize(DeviceResourceHandle deviceHandle) const
+    {
+        const auto entryIt = findEntry(deviceHandle);
+        return (entryIt != m_entries.cend() ? entryIt->byteSize : 0u);
+    }
+
+    UInt64 TransientRenderBufferPool::getSavedMemory() const
+    {
+        UInt64 savedMemory = 0u;
+        for (const auto& entry : m_entries)
+            savedMemory += UInt64(entry.byteSize) * (entry.owners.size() - 1u);
+
+        return savedMemory;
+    }
+
+    std::vector<TransientRenderBufferPool::Entry>::iterator TransientRenderBufferPool::findEntry(DeviceResourceHandle deviceHandle)
+    {
+        return std::find_if(m_entries.begin(), m_entries.end(), [deviceHandle](const Entry& entry) { return entry.deviceHandle == deviceHandle; });
+    }
+
+    std::vector<TransientRenderBufferPool::Entry>::const_iterator TransientRenderBufferPool::findEntry(DeviceResourceHandle deviceHandle) const
+    {
+        return std::find_if(m_entries.cbegin(), m_entries.cend(), [deviceHandle](const Entry& entry) { return entry.deviceHandle == deviceHandle; });
+    }
+}
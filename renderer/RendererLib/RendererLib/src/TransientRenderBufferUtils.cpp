@@ -0,0 +1,122 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2020 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "RendererLib/TransientRenderBufferUtils.h"
+#include "SceneAPI/IScene.h"
+#include "SceneAPI/RenderBuffer.h"
+#include "SceneAPI/RenderPass.h"
+#include "SceneAPI/BlitPass.h"
+#include <algorithm>
+#include <limits>
+
+namespace ramses_internal
+{
+    Bool TransientRenderBufferUtils::HasWriteOnlyRenderBuffers(const IScene& scene)
+    {
+        const UInt32 rbCount = scene.getRenderBufferCount();
+        for (RenderBufferHandle rb(0u); rb < rbCount; ++rb)
+        {
+            if (scene.isRenderBufferAllocated(rb) && scene.getRenderBuffer(rb).accessMode == ERenderBufferAccessMode_WriteOnly)
+                return true;
+        }
+
+        return false;
+    }
+
+    void TransientRenderBufferUtils::GetTransientRenderBuffers(const IScene& scene, RenderBufferHandleVector& transientBuffers)
+    {
+        transientBuffers.clear();
+        const UInt32 rbCount = scene.getRenderBufferCount();
+        for (RenderBufferHandle rb(0u); rb < rbCount; ++rb)
+        {
+            if (scene.isRenderBufferAllocated(rb) && scene.getRenderBuffer(rb).accessMode == ERenderBufferAccessMode_WriteOnly)
+                transientBuffers.push_back(rb);
+        }
+
+        const auto removeBuffer = [&transientBuffers](RenderBufferHandle rb)
+        {
+            transientBuffers.erase(std::remove(transientBuffers.begin(), transientBuffers.end(), rb), transientBuffers.end());
+        };
+
+        // blitting reads or keeps buffer content across render passes of different render targets
+        const UInt32 bpCount = scene.getBlitPassCount();
+        for (BlitPassHandle bp(0u); bp < bpCount && !transientBuffers.empty(); ++bp)
+        {
+            if (scene.isBlitPassAllocated(bp))
+            {
+                const BlitPass& blitPass = scene.getBlitPass(bp);
+                removeBuffer(blitPass.sourceRenderBuffer);
+                removeBuffer(blitPass.destinationRenderBuffer);
+            }
+        }
+
+        const UInt32 rtCount = scene.getRenderTargetCount();
+        for (RenderTargetHandle rt(0u); rt < rtCount && !transientBuffers.empty(); ++rt)
+        {
+            if (!scene.isRenderTargetAllocated(rt))
+                continue;
+
+            const UInt32 clearFlags = GetClearFlagsBeforeUse(scene, rt);
+            const UInt32 rtBufferCount = scene.getRenderTargetRenderBufferCount(rt);
+            for (UInt32 i = 0u; i < rtBufferCount; ++i)
+            {
+                const RenderBufferHandle rb = scene.getRenderTargetRenderBuffer(rt, i);
+                const UInt32 requiredClearFlags = GetRequiredClearFlags(scene.getRenderBuffer(rb).type);
+                if ((clearFlags & requiredClearFlags) != requiredClearFlags)
+                    removeBuffer(rb);
+            }
+        }
+    }
+
+    UInt32 TransientRenderBufferUtils::GetClearFlagsBeforeUse(const IScene& scene, RenderTargetHandle renderTarget)
+    {
+        Int32 firstRenderOrder = std::numeric_limits<Int32>::max();
+        const UInt32 rpCount = scene.getRenderPassCount();
+        for (RenderPassHandle rp(0u); rp < rpCount; ++rp)
+        {
+            if (!scene.isRenderPassAllocated(rp) || scene.getRenderPass(rp).renderTarget != renderTarget)
+                continue;
+
+            const RenderPass& renderPass = scene.getRenderPass(rp);
+            // render pass rendered only once keeps its result across frames
+            if (renderPass.isRenderOnce)
+                return EClearFlags_None;
+            if (renderPass.isEnabled)
+                firstRenderOrder = std::min(firstRenderOrder, renderPass.renderOrder);
+        }
+
+        // order of render passes with same render order is undefined, all of them have to clear
+        UInt32 clearFlags = EClearFlags_All;
+        for (RenderPassHandle rp(0u); rp < rpCount; ++rp)
+        {
+            if (!scene.isRenderPassAllocated(rp))
+                continue;
+
+            const RenderPass& renderPass = scene.getRenderPass(rp);
+            if (renderPass.renderTarget == renderTarget && renderPass.isEnabled && renderPass.renderOrder == firstRenderOrder)
+                clearFlags &= renderPass.clearFlags;
+        }
+
+        return clearFlags;
+    }
+
+    UInt32 TransientRenderBufferUtils::GetRequiredClearFlags(ERenderBufferType bufferType)
+    {
+        switch (bufferType)
+        {
+        case ERenderBufferType_ColorBuffer:
+            return EClearFlags_Color;
+        case ERenderBufferType_DepthBuffer:
+            return EClearFlags_Depth;
+        case ERenderBufferType_DepthStencilBuffer:
+            return EClearFlags_Depth | EClearFlags_Stencil;
+        default:
+            return EClearFlags_All;
+        }
+    }
+}
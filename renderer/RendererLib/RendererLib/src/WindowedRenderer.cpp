@@ -30,7 +30,8 @@ namespace ramses_internal
         IRendererSceneEventSender& rendererSceneSender,
         IPlatform& platform,
         RendererStatistics& rendererStatistics,
-        const String& monitorFilename)
+        const String& monitorFilename,
+        UInt32 sceneUpdateThreadCount)
         : m_rendererCommandBuffer(commandBuffer)
         , m_rendererScenes(m_rendererEventCollector)
         , m_expirationMonitor(m_rendererScenes, m_rendererEventCollector)
@@ -62,6 +63,7 @@ namespace ramses_internal
         , m_cmdSetFrametimerValues(m_frameTimer)
     {
         m_rendererSceneUpdater.setSceneReferenceLogicHandler(m_sceneReferenceLogic);
+        m_rendererSceneUpdater.setSceneUpdateThreadCount(sceneUpdateThreadCount);
         m_cmdShowSceneOnDisplayInternal.reset(new ShowSceneCommand(*this));
     }
 
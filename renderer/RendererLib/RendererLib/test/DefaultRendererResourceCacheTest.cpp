@@ -38,18 +38,6 @@ public:
 
     void createTestFile()
     {
-        ramses::resourceCacheFlag_t cacheFlag(12345u);
-        ramses::sceneId_t           sceneId(0x2288FFFF44);
-
-        uint8_t                      data_1[] = {17u, 37u, 12u, 23u, 123u, 21u};
-        ramses::rendererResourceId_t resId_1(0xFFFFFFFF123, 0x321FFFFFFFF);
-
-        uint8_t data_2[] = {18u, 32u, 13u, 22u, 13u, 221u, 1u, 2u, 3u, 4u, 5u, 6u, 7u, 8u, 9u, 123u, 110u};
-        ramses::rendererResourceId_t resId_2(0x0, 0x1);
-
-        uint8_t                      data_3[] = {22u};
-        ramses::rendererResourceId_t resId_3(0x123456, 0x12345);
-
         ramses::DefaultRendererResourceCache cache(100);
         cache.storeResource(resId_1, data_1, sizeof(data_1), cacheFlag, sceneId);
         cache.storeResource(resId_2, data_2, sizeof(data_2), cacheFlag, sceneId);
@@ -57,6 +45,29 @@ public:
         cache.saveToFile(m_saveFilePath.c_str());
     }
 
+    UInt getTestFileSize() const
+    {
+        ramses_internal::File file(m_saveFilePath);
+        UInt fileSize(0);
+        EXPECT_TRUE(file.getSizeInBytes(fileSize));
+        return fileSize;
+    }
+
+    // resource must either not be available or its data must be correct
+    static void CheckItemNotCorrupted(const ramses::DefaultRendererResourceCache& cache, ramses::rendererResourceId_t id, const uint8_t* expectedData, uint32_t expectedDataSize)
+    {
+        uint32_t foundSize = 0u;
+        if (!cache.hasResource(id, foundSize))
+            return;
+        ASSERT_EQ(expectedDataSize, foundSize);
+
+        std::vector<uint8_t> readBuffer(foundSize);
+        if (cache.getResourceData(id, readBuffer.data(), foundSize))
+        {
+            EXPECT_EQ(std::vector<uint8_t>(expectedData, expectedData + expectedDataSize), readBuffer);
+        }
+    }
+
     void enlargeTestFile()
     {
         ramses_internal::File file(m_saveFilePath);
@@ -139,6 +150,18 @@ protected:
     }
 
     const String m_saveFilePath;
+
+    const ramses::resourceCacheFlag_t cacheFlag{ 12345u };
+    const ramses::sceneId_t sceneId{ 0x2288FFFF44 };
+
+    uint8_t data_1[6] = { 17u, 37u, 12u, 23u, 123u, 21u };
+    const ramses::rendererResourceId_t resId_1{ 0xFFFFFFFF123, 0x321FFFFFFFF };
+
+    uint8_t data_2[17] = { 18u, 32u, 13u, 22u, 13u, 221u, 1u, 2u, 3u, 4u, 5u, 6u, 7u, 8u, 9u, 123u, 110u };
+    const ramses::rendererResourceId_t resId_2{ 0x0, 0x1 };
+
+    uint8_t data_3[1] = { 22u };
+    const ramses::rendererResourceId_t resId_3{ 0x123456, 0x12345 };
 };
 
 TEST_F(ADefaultRendererResourceCache, canStoreAndGetResource)
@@ -252,20 +275,48 @@ TEST_F(ADefaultRendererResourceCache, reportsSuccessOnCorrectFile)
     EXPECT_TRUE(cache.loadFromFile(m_saveFilePath.c_str()));
 }
 
-TEST_F(ADefaultRendererResourceCache, reportsFailOnFileToLarge)
+TEST_F(ADefaultRendererResourceCache, ignoresIncompleteDataAtEndOfFile)
 {
     ramses::DefaultRendererResourceCache cache(100);
     createTestFile();
     enlargeTestFile();
-    EXPECT_FALSE(cache.loadFromFile(m_saveFilePath.c_str()));
+    EXPECT_TRUE(cache.loadFromFile(m_saveFilePath.c_str()));
+    CheckItemInCache(cache, resId_1, data_1, sizeof(data_1));
+    CheckItemInCache(cache, resId_2, data_2, sizeof(data_2));
+    CheckItemInCache(cache, resId_3, data_3, sizeof(data_3));
 }
 
-TEST_F(ADefaultRendererResourceCache, reportsFailOnFileToShort)
+TEST_F(ADefaultRendererResourceCache, loadsAllCompleteEntriesOfTruncatedFile)
 {
     ramses::DefaultRendererResourceCache cache(100);
     createTestFile();
     truncateTestFile(-1);
-    EXPECT_FALSE(cache.loadFromFile(m_saveFilePath.c_str()));
+    EXPECT_TRUE(cache.loadFromFile(m_saveFilePath.c_str()));
+    CheckItemInCache(cache, resId_1, data_1, sizeof(data_1));
+    CheckItemInCache(cache, resId_2, data_2, sizeof(data_2));
+    uint32_t size = 0u;
+    EXPECT_FALSE(cache.hasResource(resId_3, size));
+}
+
+TEST_F(ADefaultRendererResourceCache, rewritesTruncatedFileOnSave)
+{
+    createTestFile();
+    const UInt originalFileSize = getTestFileSize();
+    truncateTestFile(-1);
+
+    {
+        ramses::DefaultRendererResourceCache cache(100);
+        EXPECT_TRUE(cache.loadFromFile(m_saveFilePath.c_str()));
+        cache.storeResource(resId_3, data_3, sizeof(data_3), cacheFlag, sceneId);
+        cache.saveToFile(m_saveFilePath.c_str());
+    }
+    EXPECT_EQ(originalFileSize, getTestFileSize());
+
+    ramses::DefaultRendererResourceCache loadedCache(100);
+    EXPECT_TRUE(loadedCache.loadFromFile(m_saveFilePath.c_str()));
+    CheckItemInCache(loadedCache, resId_1, data_1, sizeof(data_1));
+    CheckItemInCache(loadedCache, resId_2, data_2, sizeof(data_2));
+    CheckItemInCache(loadedCache, resId_3, data_3, sizeof(data_3));
 }
 
 TEST_F(ADefaultRendererResourceCache, reportsFailOnFileShorterThanHeader)
@@ -276,24 +327,33 @@ TEST_F(ADefaultRendererResourceCache, reportsFailOnFileShorterThanHeader)
     EXPECT_FALSE(cache.loadFromFile(m_saveFilePath.c_str()));
 }
 
-TEST_F(ADefaultRendererResourceCache, reportsFailForAnyByteCorruptionInFile)
+TEST_F(ADefaultRendererResourceCache, reportsFailForAnyByteCorruptionInFileHeader)
 {
     ramses::DefaultRendererResourceCache cache(100);
 
-    createTestFile();
+    for (size_t offset = 0; offset < sizeof(ramses::DefaultRendererResourceCacheImpl::FileHeader); offset++)
+    {
+        createTestFile();
+        corruptTestFile(static_cast<uint32_t>(offset));
+        EXPECT_FALSE(cache.loadFromFile(m_saveFilePath.c_str()));
+    }
+}
 
-    ramses_internal::File file(m_saveFilePath);
-    UInt                  fileSize(0);
-    EXPECT_TRUE(file.getSizeInBytes(fileSize));
+TEST_F(ADefaultRendererResourceCache, neverProvidesCorruptedDataForAnyByteCorruptionInFile)
+{
+    createTestFile();
+    const UInt fileSize = getTestFileSize();
 
-    for (size_t offset = 0; offset < fileSize; offset++)
+    for (size_t offset = sizeof(ramses::DefaultRendererResourceCacheImpl::FileHeader); offset < fileSize; offset++)
     {
-        if (offset > 0)
-        {
-            createTestFile();
-        }
+        createTestFile();
         corruptTestFile(static_cast<uint32_t>(offset));
-        EXPECT_FALSE(cache.loadFromFile(m_saveFilePath.c_str()));
+
+        ramses::DefaultRendererResourceCache cache(100);
+        EXPECT_TRUE(cache.loadFromFile(m_saveFilePath.c_str()));
+        CheckItemNotCorrupted(cache, resId_1, data_1, sizeof(data_1));
+        CheckItemNotCorrupted(cache, resId_2, data_2, sizeof(data_2));
+        CheckItemNotCorrupted(cache, resId_3, data_3, sizeof(data_3));
     }
 }
 
@@ -305,9 +365,107 @@ TEST_F(ADefaultRendererResourceCache, reportsFailOnInvalidFileVersion)
     EXPECT_FALSE(cache.loadFromFile(m_saveFilePath.c_str()));
 }
 
-TEST_F(ADefaultRendererResourceCache, reportsFailWhenCacheTooSmall)
+TEST_F(ADefaultRendererResourceCache, loadsOnlyNewestEntriesFittingIntoCache)
 {
-    ramses::DefaultRendererResourceCache cache(1);
+    ramses::DefaultRendererResourceCache cache(20);
     createTestFile();
-    EXPECT_FALSE(cache.loadFromFile(m_saveFilePath.c_str()));
+    EXPECT_TRUE(cache.loadFromFile(m_saveFilePath.c_str()));
+
+    uint32_t size = 0u;
+    EXPECT_FALSE(cache.hasResource(resId_1, size));
+    CheckItemInCache(cache, resId_2, data_2, sizeof(data_2));
+    CheckItemInCache(cache, resId_3, data_3, sizeof(data_3));
+}
+
+TEST_F(ADefaultRendererResourceCache, doesNotChangeLoadedFileWhenStoringResourceWithoutSaving)
+{
+    uint8_t data_4[] = { 1u, 2u, 3u, 4u };
+    const ramses::rendererResourceId_t resId_4(0x44, 0x4);
+
+    createTestFile();
+    const UInt originalFileSize = getTestFileSize();
+
+    {
+        ramses::DefaultRendererResourceCache cache(100);
+        EXPECT_TRUE(cache.loadFromFile(m_saveFilePath.c_str()));
+        cache.storeResource(resId_4, data_4, sizeof(data_4), cacheFlag, sceneId);
+        CheckItemInCache(cache, resId_4, data_4, sizeof(data_4));
+    }
+    EXPECT_EQ(originalFileSize, getTestFileSize());
+
+    ramses::DefaultRendererResourceCache loadedCache(100);
+    EXPECT_TRUE(loadedCache.loadFromFile(m_saveFilePath.c_str()));
+    uint32_t size = 0u;
+    EXPECT_FALSE(loadedCache.hasResource(resId_4, size));
+}
+
+TEST_F(ADefaultRendererResourceCache, appendsStoredResourcesToLoadedFileOnSave)
+{
+    uint8_t data_4[] = { 1u, 2u, 3u, 4u };
+    const ramses::rendererResourceId_t resId_4(0x44, 0x4);
+    uint8_t data_5[] = { 5u, 6u };
+    const ramses::rendererResourceId_t resId_5(0x55, 0x5);
+    const UInt entrySize_4 = sizeof(ramses::DefaultRendererResourceCacheImpl::EntryHeader) + sizeof(data_4);
+    const UInt entrySize_5 = sizeof(ramses::DefaultRendererResourceCacheImpl::EntryHeader) + sizeof(data_5);
+
+    createTestFile();
+    const UInt originalFileSize = getTestFileSize();
+
+    {
+        ramses::DefaultRendererResourceCache cache(100);
+        EXPECT_TRUE(cache.loadFromFile(m_saveFilePath.c_str()));
+        cache.storeResource(resId_4, data_4, sizeof(data_4), cacheFlag, sceneId);
+        EXPECT_EQ(originalFileSize, getTestFileSize());
+
+        cache.saveToFile(m_saveFilePath.c_str());
+        EXPECT_EQ(originalFileSize + entrySize_4, getTestFileSize());
+
+        // only entries not in file yet are appended
+        cache.storeResource(resId_5, data_5, sizeof(data_5), cacheFlag, sceneId);
+        cache.saveToFile(m_saveFilePath.c_str());
+        EXPECT_EQ(originalFileSize + entrySize_4 + entrySize_5, getTestFileSize());
+
+        // nothing to write
+        cache.saveToFile(m_saveFilePath.c_str());
+        EXPECT_EQ(originalFileSize + entrySize_4 + entrySize_5, getTestFileSize());
+    }
+
+    ramses::DefaultRendererResourceCache loadedCache(100);
+    EXPECT_TRUE(loadedCache.loadFromFile(m_saveFilePath.c_str()));
+    CheckItemInCache(loadedCache, resId_1, data_1, sizeof(data_1));
+    CheckItemInCache(loadedCache, resId_2, data_2, sizeof(data_2));
+    CheckItemInCache(loadedCache, resId_3, data_3, sizeof(data_3));
+    CheckItemInCache(loadedCache, resId_4, data_4, sizeof(data_4));
+    CheckItemInCache(loadedCache, resId_5, data_5, sizeof(data_5));
+}
+
+TEST_F(ADefaultRendererResourceCache, rewritesLoadedFileOnSaveWithoutRemovedEntries)
+{
+    uint8_t data_4[] = { 1u, 2u, 3u, 4u, 5u, 6u, 7u, 8u, 9u, 10u };
+    const ramses::rendererResourceId_t resId_4(0x44, 0x4);
+
+    createTestFile();
+    const UInt originalFileSize = getTestFileSize();
+
+    {
+        // adding resource 4 removes resource 1 from cache
+        ramses::DefaultRendererResourceCache cache(30);
+        EXPECT_TRUE(cache.loadFromFile(m_saveFilePath.c_str()));
+        cache.storeResource(resId_4, data_4, sizeof(data_4), cacheFlag, sceneId);
+
+        // resources still available from loaded file after it was rewritten
+        cache.saveToFile(m_saveFilePath.c_str());
+        EXPECT_EQ(originalFileSize - sizeof(ramses::DefaultRendererResourceCacheImpl::EntryHeader) - sizeof(data_1) + sizeof(ramses::DefaultRendererResourceCacheImpl::EntryHeader) + sizeof(data_4), getTestFileSize());
+        EXPECT_FALSE(File(m_saveFilePath + ".tmp").exists());
+        CheckItemInCache(cache, resId_2, data_2, sizeof(data_2));
+        CheckItemInCache(cache, resId_3, data_3, sizeof(data_3));
+    }
+
+    ramses::DefaultRendererResourceCache loadedCache(100);
+    EXPECT_TRUE(loadedCache.loadFromFile(m_saveFilePath.c_str()));
+    uint32_t size = 0u;
+    EXPECT_FALSE(loadedCache.hasResource(resId_1, size));
+    CheckItemInCache(loadedCache, resId_2, data_2, sizeof(data_2));
+    CheckItemInCache(loadedCache, resId_3, data_3, sizeof(data_3));
+    CheckItemInCache(loadedCache, resId_4, data_4, sizeof(data_4));
 }
@@ -31,6 +31,7 @@ TEST_F(AInternalDisplayConfig, hasDefaultValues)
     EXPECT_EQ(0, m_config.getWindowPositionY());
     EXPECT_FALSE(m_config.isWarpingEnabled());
     EXPECT_TRUE(m_config.getKeepEffectsUploaded());
+    EXPECT_FALSE(m_config.isPartialFramebufferUpdateEnabled());
     EXPECT_TRUE(!m_config.getWaylandIviLayerID().isValid());
     EXPECT_TRUE(!m_config.getIntegrityRGLDeviceUnit().isValid());
     EXPECT_FALSE(m_config.getStartVisibleIvi());
@@ -84,6 +85,9 @@ TEST_F(AInternalDisplayConfig, setAndGetValues)
     m_config.setKeepEffectsUploaded(false);
     EXPECT_FALSE(m_config.getKeepEffectsUploaded());
 
+    m_config.setPartialFramebufferUpdateEnabled(true);
+    EXPECT_TRUE(m_config.isPartialFramebufferUpdateEnabled());
+
     m_config.setGPUMemoryCacheSize(256u);
     EXPECT_EQ(256u, m_config.getGPUMemoryCacheSize());
 
@@ -111,6 +115,7 @@ TEST_F(AInternalDisplayConfig, getsValuesAssignedFromCommandLine)
         "-bl",
         "-warp",
         "-de",
+        "-pfu",
         "-aa", "MSAA",
         "-as", "4",
         "-lid", "101",
@@ -142,6 +147,7 @@ TEST_F(AInternalDisplayConfig, getsValuesAssignedFromCommandLine)
     EXPECT_TRUE(config.getStartVisibleIvi());
     EXPECT_TRUE(config.isWarpingEnabled());
     EXPECT_FALSE(config.getKeepEffectsUploaded());
+    EXPECT_TRUE(config.isPartialFramebufferUpdateEnabled());
     EXPECT_TRUE(config.isResizable());
 }
 
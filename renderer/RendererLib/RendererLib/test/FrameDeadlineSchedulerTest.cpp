@@ -0,0 +1,107 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2020 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "renderer_common_gmock_header.h"
+#include "gtest/gtest.h"
+#include "RendererLib/FrameDeadlineScheduler.h"
+
+using namespace testing;
+using namespace ramses_internal;
+
+class AFrameDeadlineScheduler : public ::testing::Test
+{
+public:
+    AFrameDeadlineScheduler()
+    {
+        scheduler.setFrameDuration(std::chrono::microseconds{ 10000u });
+    }
+
+protected:
+    void doFrame(UInt64 start, UInt64 end)
+    {
+        scheduler.frameStarted(start);
+        scheduler.frameFinished(end);
+    }
+
+    FrameDeadlineScheduler scheduler;
+};
+
+TEST_F(AFrameDeadlineScheduler, startsFirstFrameImmediately)
+{
+    EXPECT_EQ(0u, scheduler.getPlannedFrameStart());
+    EXPECT_EQ(0u, scheduler.getEarliestFrameStart());
+    EXPECT_EQ(std::chrono::microseconds{ 10000u }, scheduler.getFrameDuration());
+}
+
+TEST_F(AFrameDeadlineScheduler, plansFrameStartBeforeDeadlineByEstimatedLoopDurationAndMargin)
+{
+    doFrame(1000u, 3000u);
+    EXPECT_EQ(std::chrono::microseconds{ 2000u }, scheduler.getEstimatedLoopDuration());
+    EXPECT_EQ(1000u, scheduler.getEarliestFrameStart());
+    EXPECT_EQ(11000u, scheduler.getFrameDeadline());
+    EXPECT_EQ(11000u - 2250u, scheduler.getPlannedFrameStart());
+
+    doFrame(8750u, 10750u);
+    EXPECT_EQ(11000u, scheduler.getEarliestFrameStart());
+    EXPECT_EQ(21000u, scheduler.getFrameDeadline());
+    EXPECT_EQ(21000u - 2250u, scheduler.getPlannedFrameStart());
+}
+
+TEST_F(AFrameDeadlineScheduler, allowsEarlyStartOnlyOncePerFrameSlot)
+{
+    doFrame(1000u, 3000u);
+    doFrame(8750u, 10750u);
+
+    // start early as soon as slot opens
+    doFrame(scheduler.getEarliestFrameStart(), 13000u);
+    EXPECT_EQ(21000u, scheduler.getEarliestFrameStart());
+    EXPECT_EQ(31000u, scheduler.getFrameDeadline());
+    EXPECT_EQ(31000u - 2250u, scheduler.getPlannedFrameStart());
+}
+
+TEST_F(AFrameDeadlineScheduler, neverPlansStartBeforeSlotOpensWhenLoopIsLongerThanFrameDuration)
+{
+    doFrame(1000u, 16000u);
+    EXPECT_EQ(std::chrono::microseconds{ 15000u }, scheduler.getEstimatedLoopDuration());
+    EXPECT_EQ(scheduler.getEarliestFrameStart(), scheduler.getPlannedFrameStart());
+}
+
+TEST_F(AFrameDeadlineScheduler, continuesDeadlinesFromFrameStartAfterMissingDeadline)
+{
+    doFrame(1000u, 3000u);
+    EXPECT_EQ(11000u, scheduler.getFrameDeadline());
+
+    // stalled, frame started after its deadline
+    scheduler.frameStarted(50000u);
+    EXPECT_EQ(52000u, scheduler.getFrameDeadline());
+    scheduler.frameFinished(52000u);
+    EXPECT_EQ(52000u, scheduler.getEarliestFrameStart());
+    EXPECT_EQ(62000u, scheduler.getFrameDeadline());
+}
+
+TEST_F(AFrameDeadlineScheduler, followsLongerLoopsImmediatelyAndShorterLoopsSlowly)
+{
+    doFrame(0u, 8000u);
+    EXPECT_EQ(std::chrono::microseconds{ 8000u }, scheduler.getEstimatedLoopDuration());
+
+    doFrame(10000u, 10000u);
+    EXPECT_EQ(std::chrono::microseconds{ 7000u }, scheduler.getEstimatedLoopDuration());
+
+    doFrame(20000u, 29000u);
+    EXPECT_EQ(std::chrono::microseconds{ 9000u }, scheduler.getEstimatedLoopDuration());
+}
+
+TEST_F(AFrameDeadlineScheduler, usesNewFrameDurationForNextDeadline)
+{
+    doFrame(1000u, 3000u);
+    EXPECT_EQ(11000u, scheduler.getFrameDeadline());
+
+    scheduler.setFrameDuration(std::chrono::microseconds{ 20000u });
+    doFrame(8750u, 10750u);
+    EXPECT_EQ(31000u, scheduler.getFrameDeadline());
+}
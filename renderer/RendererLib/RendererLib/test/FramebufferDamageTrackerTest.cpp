@@ -0,0 +1,142 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2020 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "renderer_common_gmock_header.h"
+#include "gtest/gtest.h"
+#include "RendererLib/FramebufferDamageTracker.h"
+
+using namespace testing;
+using namespace ramses_internal;
+
+class AFramebufferDamageTracker : public ::testing::Test
+{
+protected:
+    void presentFrameWithDamage(const Viewport& region)
+    {
+        tracker.addDamage(region);
+        tracker.framePresented();
+    }
+
+    FramebufferDamageTracker tracker;
+};
+
+TEST_F(AFramebufferDamageTracker, hasNoDamageInitially)
+{
+    EXPECT_FALSE(tracker.isFullyDamaged());
+    EXPECT_TRUE(FramebufferDamageTracker::IsEmpty(tracker.getDamage()));
+}
+
+TEST_F(AFramebufferDamageTracker, unitesRegionsToBoundingRectangle)
+{
+    EXPECT_EQ(Viewport(0, 0, 30, 40), FramebufferDamageTracker::Unite({ 0, 0, 10, 10 }, { 20, 30, 10, 10 }));
+    EXPECT_EQ(Viewport(-5, 5, 15, 10), FramebufferDamageTracker::Unite({ -5, 5, 5, 5 }, { 5, 10, 5, 5 }));
+    EXPECT_EQ(Viewport(1, 2, 3, 4), FramebufferDamageTracker::Unite({}, { 1, 2, 3, 4 }));
+    EXPECT_EQ(Viewport(1, 2, 3, 4), FramebufferDamageTracker::Unite({ 1, 2, 3, 4 }, { 10, 10, 0, 5 }));
+}
+
+TEST_F(AFramebufferDamageTracker, intersectsRegions)
+{
+    EXPECT_EQ(Viewport(5, 5, 5, 5), FramebufferDamageTracker::Intersect({ 0, 0, 10, 10 }, { 5, 5, 10, 10 }));
+    EXPECT_EQ(Viewport(2, 3, 4, 5), FramebufferDamageTracker::Intersect({ 0, 0, 100, 100 }, { 2, 3, 4, 5 }));
+    EXPECT_TRUE(FramebufferDamageTracker::IsEmpty(FramebufferDamageTracker::Intersect({ 0, 0, 10, 10 }, { 10, 0, 10, 10 })));
+    EXPECT_TRUE(FramebufferDamageTracker::IsEmpty(FramebufferDamageTracker::Intersect({ 0, 0, 10, 10 }, { 20, 20, 10, 10 })));
+}
+
+TEST_F(AFramebufferDamageTracker, accumulatesDamageOfCurrentFrame)
+{
+    tracker.addDamage({ 0, 0, 10, 10 });
+    tracker.addDamage({ 20, 0, 10, 10 });
+    EXPECT_EQ(Viewport(0, 0, 30, 10), tracker.getDamage());
+
+    tracker.framePresented();
+    EXPECT_TRUE(FramebufferDamageTracker::IsEmpty(tracker.getDamage()));
+}
+
+TEST_F(AFramebufferDamageTracker, repaintsOnlyCurrentDamageForBufferOfAgeOne)
+{
+    presentFrameWithDamage({ 0, 0, 10, 10 });
+    tracker.addDamage({ 50, 50, 10, 10 });
+
+    Viewport region;
+    ASSERT_TRUE(tracker.getRepaintRegion(1u, region));
+    EXPECT_EQ(Viewport(50, 50, 10, 10), region);
+}
+
+TEST_F(AFramebufferDamageTracker, repaintsAlsoDamageOfFramesPresentedSinceBufferContentWasShown)
+{
+    presentFrameWithDamage({ 0, 0, 10, 10 });
+    presentFrameWithDamage({ 20, 20, 10, 10 });
+    tracker.addDamage({ 40, 40, 10, 10 });
+
+    Viewport region;
+    ASSERT_TRUE(tracker.getRepaintRegion(2u, region));
+    EXPECT_EQ(Viewport(20, 20, 30, 30), region);
+    ASSERT_TRUE(tracker.getRepaintRegion(3u, region));
+    EXPECT_EQ(Viewport(0, 0, 50, 50), region);
+}
+
+TEST_F(AFramebufferDamageTracker, repaintsEmptyRegionIfNothingChanged)
+{
+    presentFrameWithDamage({});
+
+    Viewport region{ 1, 2, 3, 4 };
+    ASSERT_TRUE(tracker.getRepaintRegion(2u, region));
+    EXPECT_TRUE(FramebufferDamageTracker::IsEmpty(region));
+}
+
+TEST_F(AFramebufferDamageTracker, repaintsFullyIfBufferAgeUnknown)
+{
+    presentFrameWithDamage({ 0, 0, 10, 10 });
+    tracker.addDamage({ 0, 0, 10, 10 });
+
+    Viewport region;
+    EXPECT_FALSE(tracker.getRepaintRegion(0u, region));
+}
+
+TEST_F(AFramebufferDamageTracker, repaintsFullyIfBufferOlderThanKnownHistory)
+{
+    presentFrameWithDamage({ 0, 0, 10, 10 });
+    tracker.addDamage({ 0, 0, 10, 10 });
+
+    Viewport region;
+    EXPECT_TRUE(tracker.getRepaintRegion(2u, region));
+    EXPECT_FALSE(tracker.getRepaintRegion(3u, region));
+}
+
+TEST_F(AFramebufferDamageTracker, keepsHistoryOnlyUpToMaximumBufferAge)
+{
+    for (UInt32 i = 0u; i < 2 * FramebufferDamageTracker::MaxBufferAge; ++i)
+        presentFrameWithDamage({ 0, 0, 10, 10 });
+
+    Viewport region;
+    EXPECT_TRUE(tracker.getRepaintRegion(FramebufferDamageTracker::MaxBufferAge, region));
+    EXPECT_FALSE(tracker.getRepaintRegion(FramebufferDamageTracker::MaxBufferAge + 1u, region));
+}
+
+TEST_F(AFramebufferDamageTracker, repaintsFullyIfCurrentFrameFullyDamaged)
+{
+    presentFrameWithDamage({ 0, 0, 10, 10 });
+    tracker.setFullyDamaged();
+    EXPECT_TRUE(tracker.isFullyDamaged());
+
+    Viewport region;
+    EXPECT_FALSE(tracker.getRepaintRegion(1u, region));
+}
+
+TEST_F(AFramebufferDamageTracker, repaintsFullyUntilFullyDamagedFrameIsOlderThanBufferContent)
+{
+    tracker.setFullyDamaged();
+    tracker.framePresented();
+    EXPECT_FALSE(tracker.isFullyDamaged());
+    presentFrameWithDamage({ 0, 0, 10, 10 });
+
+    Viewport region;
+    EXPECT_TRUE(tracker.getRepaintRegion(1u, region));
+    EXPECT_TRUE(tracker.getRepaintRegion(2u, region));
+    EXPECT_FALSE(tracker.getRepaintRegion(3u, region));
+}
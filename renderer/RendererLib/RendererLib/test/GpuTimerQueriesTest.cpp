@@ -0,0 +1,291 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2020 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "renderer_common_gmock_header.h"
+#include "gtest/gtest.h"
+#include "RendererLib/GpuTimerQueries.h"
+#include "RendererLib/LoggingDevice.h"
+#include "RendererLib/RendererLogContext.h"
+#include "DeviceMock.h"
+#include <map>
+
+using namespace testing;
+using namespace ramses_internal;
+
+class AGpuTimerQueries : public ::testing::Test
+{
+public:
+    AGpuTimerQueries()
+    {
+        ON_CALL(device, isGpuTimerQuerySupported()).WillByDefault(Return(true));
+        ON_CALL(device, allocateGpuTimerQuery()).WillByDefault(Invoke([this]() { return DeviceResourceHandle(++numQueriesAllocated); }));
+        // fake GPU: timestamp of query is issue order times 1ms
+        ON_CALL(device, issueGpuTimestamp(_)).WillByDefault(Invoke([this](DeviceResourceHandle query) { issuedTimestamps[query] = ++numTimestampsIssued * 1000000u; }));
+        ON_CALL(device, getGpuTimestamp(_, _)).WillByDefault(Invoke([this](DeviceResourceHandle query, UInt64& timestampNs)
+        {
+            if (!resultsAvailable)
+                return false;
+            timestampNs = issuedTimestamps[query];
+            return true;
+        }));
+        ON_CALL(device, checkAndResetGpuTimerDisjoint()).WillByDefault(Return(false));
+        EXPECT_CALL(device, allocateGpuTimerQuery()).Times(AnyNumber());
+        EXPECT_CALL(device, issueGpuTimestamp(_)).Times(AnyNumber());
+        EXPECT_CALL(device, getGpuTimestamp(_, _)).Times(AnyNumber());
+        EXPECT_CALL(device, checkAndResetGpuTimerDisjoint()).Times(AnyNumber());
+        EXPECT_CALL(device, deleteGpuTimerQuery(_)).Times(AnyNumber());
+    }
+
+protected:
+    void renderFrameWithSceneWithTwoPasses(GpuTimerQueries& queries)
+    {
+        queries.beginFrame();
+        renderSceneWithTwoPasses(queries);
+        queries.finishFrame();
+    }
+
+    void renderSceneWithTwoPasses(GpuTimerQueries& queries)
+    {
+        queries.beginScene(sceneId);
+        queries.beginRenderPass(pass1);
+        queries.endRenderPass();
+        queries.beginRenderPass(pass2);
+        queries.endRenderPass();
+        queries.endScene();
+    }
+
+    NiceMock<DeviceMock> device;
+    UInt32 numQueriesAllocated = 0u;
+    UInt64 numTimestampsIssued = 0u;
+    std::map<DeviceResourceHandle, UInt64> issuedTimestamps;
+    bool resultsAvailable = true;
+
+    const SceneId sceneId{ 12u };
+    const RenderPassHandle pass1{ 1u };
+    const RenderPassHandle pass2{ 2u };
+};
+
+TEST_F(AGpuTimerQueries, isDisabledAndDoesNothingIfDeviceDoesNotSupportTimerQueries)
+{
+    RendererLogContext logContext(ERendererLogLevelFlag_Details);
+    LoggingDevice loggingDevice(device, logContext);
+    GpuTimerQueries queries(loggingDevice);
+    EXPECT_FALSE(queries.isEnabled());
+
+    renderFrameWithSceneWithTwoPasses(queries);
+
+    GpuTimings timings;
+    queries.collectTimings(timings);
+    EXPECT_TRUE(timings.empty());
+}
+
+TEST_F(AGpuTimerQueries, doesNotUseDeviceIfNotSupported)
+{
+    StrictMock<DeviceMock> strictDevice;
+    GpuTimerQueries queries(strictDevice);
+    EXPECT_FALSE(queries.isEnabled());
+
+    renderFrameWithSceneWithTwoPasses(queries);
+}
+
+TEST_F(AGpuTimerQueries, reportsFrameSceneAndRenderPassTimes)
+{
+    GpuTimerQueries queries(device);
+    EXPECT_TRUE(queries.isEnabled());
+
+    renderFrameWithSceneWithTwoPasses(queries);
+
+    GpuTimings timings;
+    queries.collectTimings(timings);
+    // timestamps: frame 1, scene 2, pass1 3-4, pass2 5-6, scene 7, frame 8
+    ASSERT_EQ(4u, timings.size());
+    EXPECT_FALSE(timings[0].sceneId.isValid());
+    EXPECT_EQ(7000000u, timings[0].durationNs);
+    EXPECT_EQ(sceneId, timings[1].sceneId);
+    EXPECT_FALSE(timings[1].renderPass.isValid());
+    EXPECT_EQ(5000000u, timings[1].durationNs);
+    EXPECT_EQ(sceneId, timings[2].sceneId);
+    EXPECT_EQ(pass1, timings[2].renderPass);
+    EXPECT_EQ(1000000u, timings[2].durationNs);
+    EXPECT_EQ(pass2, timings[3].renderPass);
+    EXPECT_EQ(1000000u, timings[3].durationNs);
+
+    queries.collectTimings(timings);
+    EXPECT_TRUE(timings.empty());
+}
+
+TEST_F(AGpuTimerQueries, reportsNothingForFrameWithoutRendering)
+{
+    GpuTimerQueries queries(device);
+    EXPECT_CALL(device, issueGpuTimestamp(_)).Times(0);
+    queries.finishFrame();
+
+    GpuTimings timings;
+    queries.collectTimings(timings);
+    EXPECT_TRUE(timings.empty());
+}
+
+TEST_F(AGpuTimerQueries, startsFrameIntervalWhenFrameBegins)
+{
+    GpuTimerQueries queries(device);
+    queries.beginFrame();
+    // beginning frame again before it is finished keeps its start
+    queries.beginFrame();
+    renderSceneWithTwoPasses(queries);
+    queries.finishFrame();
+
+    GpuTimings timings;
+    queries.collectTimings(timings);
+    // timestamps: frame 1, scene 2, pass1 3-4, pass2 5-6, scene 7, frame 8 - repeated begin of frame issues nothing
+    ASSERT_EQ(4u, timings.size());
+    EXPECT_FALSE(timings[0].sceneId.isValid());
+    EXPECT_EQ(7000000u, timings[0].durationNs);
+    EXPECT_EQ(5000000u, timings[1].durationNs);
+}
+
+TEST_F(AGpuTimerQueries, reportsFrameTimeOfBegunFrameWithoutScenes)
+{
+    GpuTimerQueries queries(device);
+    queries.beginFrame();
+    queries.finishFrame();
+
+    GpuTimings timings;
+    queries.collectTimings(timings);
+    ASSERT_EQ(1u, timings.size());
+    EXPECT_FALSE(timings[0].sceneId.isValid());
+    EXPECT_EQ(1000000u, timings[0].durationNs);
+}
+
+TEST_F(AGpuTimerQueries, doesNotMeasureScenesOutsideOfBegunFrame)
+{
+    GpuTimerQueries queries(device);
+    EXPECT_CALL(device, issueGpuTimestamp(_)).Times(0);
+    renderSceneWithTwoPasses(queries);
+    queries.finishFrame();
+
+    GpuTimings timings;
+    queries.collectTimings(timings);
+    EXPECT_TRUE(timings.empty());
+}
+
+TEST_F(AGpuTimerQueries, reusesReadBackBufferOfCollectedFrames)
+{
+    GpuTimerQueries queries(device);
+    for (UInt32 i = 0u; i < 2u * GpuTimerQueries::NumFramesInFlight; ++i)
+        renderFrameWithSceneWithTwoPasses(queries);
+
+    GpuTimings timings;
+    queries.collectTimings(timings);
+    EXPECT_EQ(2u * GpuTimerQueries::NumFramesInFlight * 4u, timings.size());
+    for (UInt32 i = 0u; i < timings.size(); i += 4u)
+    {
+        EXPECT_EQ(7000000u, timings[i].durationNs);
+        EXPECT_EQ(1000000u, timings[i + 3u].durationNs);
+    }
+}
+
+TEST_F(AGpuTimerQueries, collectsResultsLaterWithoutWaitingIfNotAvailableYet)
+{
+    GpuTimerQueries queries(device);
+    resultsAvailable = false;
+    renderFrameWithSceneWithTwoPasses(queries);
+    renderFrameWithSceneWithTwoPasses(queries);
+
+    GpuTimings timings;
+    queries.collectTimings(timings);
+    EXPECT_TRUE(timings.empty());
+
+    resultsAvailable = true;
+    queries.finishFrame();
+    queries.collectTimings(timings);
+    EXPECT_EQ(8u, timings.size());
+    EXPECT_EQ(0u, queries.getNumberOfDroppedFrames());
+}
+
+TEST_F(AGpuTimerQueries, dropsFramesWhoseResultsAreNotAvailableWhenQueriesAreReused)
+{
+    GpuTimerQueries queries(device);
+    resultsAvailable = false;
+    for (UInt32 i = 0u; i < GpuTimerQueries::NumFramesInFlight + 2u; ++i)
+        renderFrameWithSceneWithTwoPasses(queries);
+    EXPECT_EQ(3u, queries.getNumberOfDroppedFrames());
+
+    resultsAvailable = true;
+    queries.finishFrame();
+    GpuTimings timings;
+    queries.collectTimings(timings);
+    EXPECT_EQ((GpuTimerQueries::NumFramesInFlight - 1u) * 4u, timings.size());
+}
+
+TEST_F(AGpuTimerQueries, reusesQueriesOfCollectedFrames)
+{
+    GpuTimerQueries queries(device);
+    for (UInt32 i = 0u; i < 3u * GpuTimerQueries::NumFramesInFlight; ++i)
+        renderFrameWithSceneWithTwoPasses(queries);
+    // every frame uses 8 queries which are allocated only once per frame slot
+    EXPECT_EQ(8u * GpuTimerQueries::NumFramesInFlight, numQueriesAllocated);
+}
+
+TEST_F(AGpuTimerQueries, dropsFramesInFlightOnDisjointOperation)
+{
+    GpuTimerQueries queries(device);
+    resultsAvailable = false;
+    renderFrameWithSceneWithTwoPasses(queries);
+
+    resultsAvailable = true;
+    EXPECT_CALL(device, checkAndResetGpuTimerDisjoint()).WillOnce(Return(true));
+    renderFrameWithSceneWithTwoPasses(queries);
+
+    GpuTimings timings;
+    queries.collectTimings(timings);
+    EXPECT_TRUE(timings.empty());
+    EXPECT_EQ(2u, queries.getNumberOfDroppedFrames());
+}
+
+TEST_F(AGpuTimerQueries, ignoresRenderPassOutsideOfScene)
+{
+    GpuTimerQueries queries(device);
+    queries.beginFrame();
+    queries.beginRenderPass(pass1);
+    queries.endRenderPass();
+    queries.finishFrame();
+
+    GpuTimings timings;
+    queries.collectTimings(timings);
+    // only frame itself is measured
+    ASSERT_EQ(1u, timings.size());
+    EXPECT_FALSE(timings[0].sceneId.isValid());
+    EXPECT_FALSE(timings[0].renderPass.isValid());
+}
+
+TEST_F(AGpuTimerQueries, limitsNumberOfMeasuredIntervalsPerFrame)
+{
+    GpuTimerQueries queries(device);
+    queries.beginFrame();
+    for (UInt32 i = 0u; i < GpuTimerQueries::MaximumIntervalsPerFrame; ++i)
+    {
+        queries.beginScene(sceneId);
+        queries.endScene();
+    }
+    queries.finishFrame();
+
+    GpuTimings timings;
+    queries.collectTimings(timings);
+    // frame itself occupies one interval
+    EXPECT_EQ(GpuTimerQueries::MaximumIntervalsPerFrame, timings.size());
+}
+
+TEST_F(AGpuTimerQueries, deletesAllocatedQueriesOnDestruction)
+{
+    {
+        GpuTimerQueries queries(device);
+        renderFrameWithSceneWithTwoPasses(queries);
+        EXPECT_CALL(device, deleteGpuTimerQuery(_)).Times(8u);
+    }
+    Mock::VerifyAndClearExpectations(&device);
+}
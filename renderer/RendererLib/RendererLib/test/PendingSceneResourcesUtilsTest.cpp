@@ -13,6 +13,7 @@
 #include "Scene/Scene.h"
 #include "SceneAllocateHelper.h"
 #include "SceneUtils/ResourceUtils.h"
+#include <array>
 
 namespace ramses_internal {
 using namespace testing;
@@ -153,6 +154,29 @@ TEST_F(APendingSceneResourcesUtils, getsSceneResourcesFromSceneAndApliesThem)
     PendingSceneResourcesUtils::ApplySceneResourceActions(actions, scene, resourceManager);
 }
 
+TEST_F(APendingSceneResourcesUtils, updatesOnlyDirtyRegionsOfTextureBuffer)
+{
+    const std::array<Byte, 16> mip0Data{ 0u, 1u, 2u, 3u, 4u, 5u, 6u, 7u, 8u, 9u, 10u, 11u, 12u, 13u, 14u, 15u };
+    const Byte mip2Data = 42u;
+    scene.updateTextureBuffer(textureBufferHandle, 0u, 0u, 0u, 4u, 4u, mip0Data.data());
+    scene.updateTextureBuffer(textureBufferHandle, 2u, 0u, 0u, 1u, 1u, &mip2Data);
+
+    TextureBufferDirtyRegions dirtyRegions;
+    dirtyRegions.put(textureBufferHandle, { { 1, 1, 2, 2 }, {}, { 0, 0, 1, 1 } });
+
+    SceneResourceActionVector actions;
+    actions.push_back(SceneResourceAction(textureBufferHandle.asMemoryHandle(), ESceneResourceAction_UpdateTextureBuffer));
+
+    std::vector<Byte> uploadedMip0Region;
+    EXPECT_CALL(resourceManager, updateTextureBuffer(textureBufferHandle, 0u, 1u, 1u, 2u, 2u, _, sceneID)).WillOnce(Invoke([&](auto, auto, auto, auto, auto, auto, const Byte* data, auto)
+    {
+        uploadedMip0Region.assign(data, data + 4u);
+    }));
+    EXPECT_CALL(resourceManager, updateTextureBuffer(textureBufferHandle, 2u, 0u, 0u, 1u, 1u, Pointee(mip2Data), sceneID));
+    PendingSceneResourcesUtils::ApplySceneResourceActions(actions, scene, resourceManager, nullptr, &dirtyRegions);
+    EXPECT_EQ(std::vector<Byte>({ 5u, 6u, 9u, 10u }), uploadedMip0Region);
+}
+
 TEST_F(APendingSceneResourcesUtils, cancelsOutCreateAndDeleteDuringConsolidation)
 {
     for (const auto& crateDestroyPair : TestSceneResourceActions)
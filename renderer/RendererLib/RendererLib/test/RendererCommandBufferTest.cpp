@@ -41,6 +41,20 @@ TEST_F(ARendererCommandBuffer, gracefullyHandlesSceneActionsArrivingAfterUnsubsc
     queue.enqueueActionsForScene(sceneId, std::move(update));
 }
 
+TEST_F(ARendererCommandBuffer, notifiesListenerAboutEnqueuedSceneUpdates)
+{
+    std::vector<SceneId> notifiedScenes;
+    queue.setSceneUpdateListener([&](SceneId sceneId) { notifiedScenes.push_back(sceneId); });
+
+    queue.enqueueActionsForScene(SceneId{ 12u }, SceneUpdate{});
+    queue.enqueueActionsForScene(SceneId{ 13u }, SceneUpdate{});
+    EXPECT_EQ(std::vector<SceneId>({ SceneId{ 12u }, SceneId{ 13u } }), notifiedScenes);
+
+    queue.setSceneUpdateListener(nullptr);
+    queue.enqueueActionsForScene(SceneId{ 14u }, SceneUpdate{});
+    EXPECT_EQ(2u, notifiedScenes.size());
+}
+
 TEST_F(ARendererCommandBuffer, parsesCommandsForScreenshotPrintingWithFilename)
 {
     String in("screenshot -filename bla");
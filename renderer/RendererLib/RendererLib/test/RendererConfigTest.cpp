@@ -22,6 +22,8 @@ TEST(AInternalRendererConfig, hasDefaultValues)
     EXPECT_STREQ("", config.getKPIFileName().c_str());
     EXPECT_EQ(std::chrono::microseconds{10000u}, config.getFrameCallbackMaxPollTime());
     EXPECT_STREQ("", config.getWaylandDisplayForSystemCompositorController().c_str());
+    EXPECT_EQ(0u, config.getSceneUpdateThreadCount());
+    EXPECT_FALSE(config.getDeadlineFrameSchedulingEnabled());
 }
 
 TEST(AInternalRendererConfig, canEnableSystemCompositorControl)
@@ -86,6 +88,24 @@ TEST(AInternalRendererConfig, canSetGetWaylandDisplayForSystemCompositorControll
     EXPECT_STREQ("ramses wd", config.getWaylandDisplayForSystemCompositorController().c_str());
 }
 
+TEST(AInternalRendererConfig, canSetGetSceneUpdateThreadCount)
+{
+    ramses_internal::RendererConfig config;
+
+    config.setSceneUpdateThreadCount(3u);
+    EXPECT_EQ(3u, config.getSceneUpdateThreadCount());
+}
+
+TEST(AInternalRendererConfig, canEnableDeadlineFrameScheduling)
+{
+    ramses_internal::RendererConfig config;
+
+    config.setDeadlineFrameSchedulingEnabled(true);
+    EXPECT_TRUE(config.getDeadlineFrameSchedulingEnabled());
+    config.setDeadlineFrameSchedulingEnabled(false);
+    EXPECT_FALSE(config.getDeadlineFrameSchedulingEnabled());
+}
+
 TEST(AInternalRendererConfig, getsValuesAssignedFromCommandLine)
 {
     static const ramses_internal::Char* args[] =
@@ -93,7 +113,9 @@ TEST(AInternalRendererConfig, getsValuesAssignedFromCommandLine)
         "app",
         "-wse", "wse",
         "-wsegn", "wsegn",
-        "-kpi", "filename"
+        "-kpi", "filename",
+        "-sut", "4",
+        "-dfs"
     };
     ramses_internal::CommandLineParser parser(sizeof(args) / sizeof(ramses_internal::Char*), args);
 
@@ -103,4 +125,6 @@ TEST(AInternalRendererConfig, getsValuesAssignedFromCommandLine)
     EXPECT_STREQ("wse", config.getWaylandSocketEmbedded().c_str());
     EXPECT_STREQ("wsegn", config.getWaylandSocketEmbeddedGroup().c_str());
     EXPECT_STREQ("filename", config.getKPIFileName().c_str());
+    EXPECT_EQ(4u, config.getSceneUpdateThreadCount());
+    EXPECT_TRUE(config.getDeadlineFrameSchedulingEnabled());
 }
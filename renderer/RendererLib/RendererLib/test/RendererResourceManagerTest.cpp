@@ -11,8 +11,10 @@
 #include "RendererLib/ResourceUploader.h"
 #include "RendererLib/FrameTimer.h"
 #include "RendererLib/RendererStatistics.h"
+#include "Collections/StringOutputStream.h"
 #include "SceneAPI/RenderBuffer.h"
 #include "SceneAPI/EDataBufferType.h"
+#include "Scene/Scene.h"
 #include "ResourceDeviceHandleAccessorMock.h"
 #include "RendererResourceCacheMock.h"
 #include "RendererResourceCacheFake.h"
@@ -464,6 +466,69 @@ TEST_F(ARendererResourceManager, canUploadAndUnloadRenderTargetWithBuffers)
     resourceManager.unloadRenderTarget(targetHandle, fakeSceneId);
 }
 
+TEST_F(ARendererResourceManager, sharesStorageOfTransientRenderBuffersBetweenScenes)
+{
+    const SceneId otherSceneId(67u);
+    Scene scene{ SceneInfo(fakeSceneId) };
+    Scene otherScene{ SceneInfo(otherSceneId) };
+    const RenderBuffer depthBuffer(800u, 600u, ERenderBufferType_DepthBuffer, ETextureFormat::Depth24, ERenderBufferAccessMode_WriteOnly, 0u);
+    const RenderBufferHandle bufferHandle = scene.allocateRenderBuffer(depthBuffer);
+    const RenderTargetHandle targetHandle = scene.allocateRenderTarget();
+    scene.addRenderTargetRenderBuffer(targetHandle, bufferHandle);
+    otherScene.allocateRenderBuffer(depthBuffer, bufferHandle);
+    otherScene.allocateRenderTarget(targetHandle);
+    otherScene.addRenderTargetRenderBuffer(targetHandle, bufferHandle);
+
+    const DeviceResourceHandle ownBufferDeviceHandle(301u);
+    const DeviceResourceHandle otherOwnBufferDeviceHandle(302u);
+    const DeviceResourceHandle sharedBufferDeviceHandle(303u);
+    const UInt64 bufferSize = 800u * 600u * 3u;
+    EXPECT_CALL(renderer.deviceMock, uploadRenderBuffer(Eq(depthBuffer))).WillOnce(Return(ownBufferDeviceHandle)).WillOnce(Return(otherOwnBufferDeviceHandle));
+    EXPECT_CALL(renderer.deviceMock, uploadRenderTarget(_)).Times(2u);
+    resourceManager.uploadRenderTargetBuffer(bufferHandle, fakeSceneId, depthBuffer);
+    resourceManager.uploadRenderTarget(targetHandle, { bufferHandle }, fakeSceneId);
+    resourceManager.uploadRenderTargetBuffer(bufferHandle, otherSceneId, depthBuffer);
+    resourceManager.uploadRenderTarget(targetHandle, { bufferHandle }, otherSceneId);
+    EXPECT_EQ(2u * bufferSize, resourceManager.getRenderTargetMemorySize());
+
+    // first scene moves buffer to new shared storage and re-creates render target using it
+    EXPECT_CALL(renderer.deviceMock, uploadRenderBuffer(Eq(depthBuffer))).WillOnce(Return(sharedBufferDeviceHandle));
+    EXPECT_CALL(renderer.deviceMock, deleteRenderBuffer(ownBufferDeviceHandle));
+    EXPECT_CALL(renderer.deviceMock, deleteRenderTarget(_));
+    EXPECT_CALL(renderer.deviceMock, uploadRenderTarget(DeviceHandleVector{ sharedBufferDeviceHandle }));
+    EXPECT_TRUE(resourceManager.updateTransientRenderBuffers(scene, { bufferHandle }));
+    EXPECT_EQ(sharedBufferDeviceHandle, resourceManager.getRenderTargetBufferDeviceHandle(bufferHandle, fakeSceneId));
+    EXPECT_EQ(2u * bufferSize, resourceManager.getRenderTargetMemorySize());
+
+    // other scene uses same storage
+    EXPECT_CALL(renderer.deviceMock, deleteRenderBuffer(otherOwnBufferDeviceHandle));
+    EXPECT_CALL(renderer.deviceMock, deleteRenderTarget(_));
+    EXPECT_CALL(renderer.deviceMock, uploadRenderTarget(DeviceHandleVector{ sharedBufferDeviceHandle }));
+    EXPECT_TRUE(resourceManager.updateTransientRenderBuffers(otherScene, { bufferHandle }));
+    EXPECT_EQ(sharedBufferDeviceHandle, resourceManager.getRenderTargetBufferDeviceHandle(bufferHandle, otherSceneId));
+    EXPECT_FALSE(resourceManager.updateTransientRenderBuffers(otherScene, { bufferHandle }));
+    EXPECT_EQ(bufferSize, resourceManager.getRenderTargetMemorySize());
+
+    // buffer which is not transient anymore gets own storage again
+    EXPECT_CALL(renderer.deviceMock, uploadRenderBuffer(Eq(depthBuffer))).WillOnce(Return(otherOwnBufferDeviceHandle));
+    EXPECT_CALL(renderer.deviceMock, deleteRenderTarget(_));
+    EXPECT_CALL(renderer.deviceMock, uploadRenderTarget(DeviceHandleVector{ otherOwnBufferDeviceHandle }));
+    EXPECT_TRUE(resourceManager.updateTransientRenderBuffers(otherScene, {}));
+    EXPECT_EQ(otherOwnBufferDeviceHandle, resourceManager.getRenderTargetBufferDeviceHandle(bufferHandle, otherSceneId));
+    EXPECT_EQ(2u * bufferSize, resourceManager.getRenderTargetMemorySize());
+
+    EXPECT_CALL(renderer.deviceMock, deleteRenderBuffer(otherOwnBufferDeviceHandle));
+    EXPECT_CALL(renderer.deviceMock, deleteRenderTarget(_));
+    resourceManager.unloadAllSceneResourcesForScene(otherSceneId);
+    EXPECT_EQ(bufferSize, resourceManager.getRenderTargetMemorySize());
+
+    // shared storage is deleted with its last user
+    EXPECT_CALL(renderer.deviceMock, deleteRenderBuffer(sharedBufferDeviceHandle));
+    EXPECT_CALL(renderer.deviceMock, deleteRenderTarget(_));
+    resourceManager.unloadAllSceneResourcesForScene(fakeSceneId);
+    EXPECT_EQ(0u, resourceManager.getRenderTargetMemorySize());
+}
+
 TEST_F(ARendererResourceManager, GetsInvalidDeviceHandleForUnknownOffscreenBuffer)
 {
     const OffscreenBufferHandle bufferHandle(1u);
@@ -613,6 +678,59 @@ TEST_F(ARendererResourceManager, CanUnloadDoubleBufferedOffscreenBuffer)
     EXPECT_FALSE(resourceManager.getOffscreenBufferDeviceHandle(bufferHandle).isValid());
 }
 
+TEST_F(ARendererResourceManager, SharesDepthBufferBetweenOffscreenBuffersOfSameSize)
+{
+    constexpr OffscreenBufferHandle obHandle{ 1u };
+    constexpr OffscreenBufferHandle obHandle2{ 2u };
+    constexpr OffscreenBufferHandle obHandle3{ 3u };
+    const RenderBuffer colorBuffer(1u, 1u, ERenderBufferType_ColorBuffer, ETextureFormat::RGBA8, ERenderBufferAccessMode_ReadWrite, 0u);
+    const RenderBuffer depthBuffer(1u, 1u, ERenderBufferType_DepthStencilBuffer, ETextureFormat::Depth24_Stencil8, ERenderBufferAccessMode_WriteOnly, 0u);
+    const RenderBuffer largerColorBuffer(2u, 2u, ERenderBufferType_ColorBuffer, ETextureFormat::RGBA8, ERenderBufferAccessMode_ReadWrite, 0u);
+    const RenderBuffer largerDepthBuffer(2u, 2u, ERenderBufferType_DepthStencilBuffer, ETextureFormat::Depth24_Stencil8, ERenderBufferAccessMode_WriteOnly, 0u);
+    const DeviceResourceHandle colorBufferDeviceHandle(301u);
+    const DeviceResourceHandle colorBufferDeviceHandle2(302u);
+    const DeviceResourceHandle depthBufferDeviceHandle(303u);
+    const DeviceResourceHandle colorBufferDeviceHandle3(304u);
+    const DeviceResourceHandle depthBufferDeviceHandle3(305u);
+
+    EXPECT_CALL(renderer.deviceMock, uploadRenderBuffer(Eq(colorBuffer))).WillOnce(Return(colorBufferDeviceHandle)).WillOnce(Return(colorBufferDeviceHandle2));
+    EXPECT_CALL(renderer.deviceMock, uploadRenderBuffer(Eq(depthBuffer))).WillOnce(Return(depthBufferDeviceHandle));
+    EXPECT_CALL(renderer.deviceMock, uploadRenderBuffer(Eq(largerColorBuffer))).WillOnce(Return(colorBufferDeviceHandle3));
+    EXPECT_CALL(renderer.deviceMock, uploadRenderBuffer(Eq(largerDepthBuffer))).WillOnce(Return(depthBufferDeviceHandle3));
+    EXPECT_CALL(renderer.deviceMock, uploadRenderTarget(DeviceHandleVector{ colorBufferDeviceHandle, depthBufferDeviceHandle }));
+    EXPECT_CALL(renderer.deviceMock, uploadRenderTarget(DeviceHandleVector{ colorBufferDeviceHandle2, depthBufferDeviceHandle }));
+    EXPECT_CALL(renderer.deviceMock, uploadRenderTarget(DeviceHandleVector{ colorBufferDeviceHandle3, depthBufferDeviceHandle3 }));
+    EXPECT_CALL(renderer.deviceMock, activateRenderTarget(_)).Times(3u);
+    EXPECT_CALL(renderer.deviceMock, colorMask(true, true, true, true)).Times(3u);
+    EXPECT_CALL(renderer.deviceMock, clearColor(Vector4{ 0.f, 0.f, 0.f, 1.f })).Times(3u);
+    EXPECT_CALL(renderer.deviceMock, depthWrite(EDepthWrite::Enabled)).Times(3u);
+    EXPECT_CALL(renderer.deviceMock, scissorTest(EScissorTest::Disabled, RenderState::ScissorRegion{})).Times(3u);
+    EXPECT_CALL(renderer.deviceMock, clear(_)).Times(3u);
+    resourceManager.uploadOffscreenBuffer(obHandle, 1u, 1u, 0u, false);
+    resourceManager.uploadOffscreenBuffer(obHandle2, 1u, 1u, 0u, false);
+    resourceManager.uploadOffscreenBuffer(obHandle3, 2u, 2u, 0u, false);
+    // shared depth buffer is counted once
+    EXPECT_EQ(4u + 4u + 4u + 16u + 16u, resourceManager.getRenderTargetMemorySize());
+
+    EXPECT_CALL(renderer.deviceMock, deleteRenderTarget(_));
+    EXPECT_CALL(renderer.deviceMock, deleteRenderBuffer(colorBufferDeviceHandle));
+    resourceManager.unloadOffscreenBuffer(obHandle);
+    EXPECT_EQ(4u + 4u + 16u + 16u, resourceManager.getRenderTargetMemorySize());
+
+    // shared depth buffer is deleted with last offscreen buffer using it
+    EXPECT_CALL(renderer.deviceMock, deleteRenderTarget(_));
+    EXPECT_CALL(renderer.deviceMock, deleteRenderBuffer(colorBufferDeviceHandle2));
+    EXPECT_CALL(renderer.deviceMock, deleteRenderBuffer(depthBufferDeviceHandle));
+    resourceManager.unloadOffscreenBuffer(obHandle2);
+    EXPECT_EQ(16u + 16u, resourceManager.getRenderTargetMemorySize());
+
+    EXPECT_CALL(renderer.deviceMock, deleteRenderTarget(_));
+    EXPECT_CALL(renderer.deviceMock, deleteRenderBuffer(colorBufferDeviceHandle3));
+    EXPECT_CALL(renderer.deviceMock, deleteRenderBuffer(depthBufferDeviceHandle3));
+    resourceManager.unloadOffscreenBuffer(obHandle3);
+    EXPECT_EQ(0u, resourceManager.getRenderTargetMemorySize());
+}
+
 TEST_F(ARendererResourceManager, UploadsAndUnloadsStreamBuffers)
 {
     constexpr StreamBufferHandle sbHandle1{ 1u };
@@ -643,7 +761,8 @@ TEST_F(ARendererResourceManager, UploadAndDeleteValidShader)
     referenceResource(resource, fakeSceneId);
     resourceManager.provideResourceData(MockResourceHash::GetManagedResource(resource));
     EXPECT_TRUE(resourceManager.hasResourcesToBeUploaded());
-    EXPECT_CALL(renderer.deviceMock, uploadShader(_));
+    EXPECT_CALL(renderer.deviceMock, startShaderUpload(_));
+    EXPECT_CALL(renderer.deviceMock, getShaderUploadStatus(_));
     resourceManager.uploadAndUnloadPendingResources();
 
     EXPECT_EQ(EResourceStatus::Uploaded, resourceManager.getResourceStatus(resource));
@@ -661,7 +780,7 @@ TEST_F(ARendererResourceManager, UploadInvalidShaderResultsInBrokenResource)
     referenceResource(resource, fakeSceneId);
     resourceManager.provideResourceData(MockResourceHash::GetManagedResource(resource));
     EXPECT_TRUE(resourceManager.hasResourcesToBeUploaded());
-    EXPECT_CALL(renderer.deviceMock, uploadShader(_)).WillRepeatedly(Return(DeviceResourceHandle::Invalid()));
+    EXPECT_CALL(renderer.deviceMock, startShaderUpload(_)).WillRepeatedly(Return(DeviceResourceHandle::Invalid()));
     resourceManager.uploadAndUnloadPendingResources();
 
     // resource must be broken
@@ -691,7 +810,8 @@ TEST_F(ARendererResourceManagerWithDisabledEffectDeletion, DeletesEffectOnlyWhen
     referenceResource(resource, fakeSceneId);
     resourceManager.provideResourceData(MockResourceHash::GetManagedResource(resource));
     EXPECT_TRUE(resourceManager.hasResourcesToBeUploaded());
-    EXPECT_CALL(renderer.deviceMock, uploadShader(_));
+    EXPECT_CALL(renderer.deviceMock, startShaderUpload(_));
+    EXPECT_CALL(renderer.deviceMock, getShaderUploadStatus(_));
     resourceManager.uploadAndUnloadPendingResources();
     EXPECT_EQ(EResourceStatus::Uploaded, resourceManager.getResourceStatus(resource));
 
@@ -827,7 +947,8 @@ TEST_F(ARendererResourceManager, providingResourceDataWhenAlreadyUploadedIsNoop)
     EXPECT_EQ(EResourceStatus::Provided, resourceManager.getResourceStatus(MockResourceHash::EffectHash));
 
     // upload the resource
-    EXPECT_CALL(renderer.deviceMock, uploadShader(_));
+    EXPECT_CALL(renderer.deviceMock, startShaderUpload(_));
+    EXPECT_CALL(renderer.deviceMock, getShaderUploadStatus(_));
     resourceManager.uploadAndUnloadPendingResources();
     EXPECT_EQ(EResourceStatus::Uploaded, resourceManager.getResourceStatus(MockResourceHash::EffectHash));
     EXPECT_TRUE(resourceManager.getResourceDeviceHandle(MockResourceHash::EffectHash).isValid());
@@ -853,7 +974,8 @@ TEST_F(ARendererResourceManagerWithDisabledEffectDeletion, rereferencingResource
     EXPECT_EQ(EResourceStatus::Provided, resourceManager.getResourceStatus(MockResourceHash::EffectHash));
 
     // upload the resource
-    EXPECT_CALL(renderer.deviceMock, uploadShader(_));
+    EXPECT_CALL(renderer.deviceMock, startShaderUpload(_));
+    EXPECT_CALL(renderer.deviceMock, getShaderUploadStatus(_));
     resourceManager.uploadAndUnloadPendingResources();
     EXPECT_EQ(EResourceStatus::Uploaded, resourceManager.getResourceStatus(MockResourceHash::EffectHash));
     EXPECT_TRUE(resourceManager.getResourceDeviceHandle(MockResourceHash::EffectHash).isValid());
@@ -870,6 +992,11 @@ TEST_F(ARendererResourceManagerWithDisabledEffectDeletion, rereferencingResource
 
     resourceManager.unreferenceAllResourcesForScene(fakeSceneId);
     EXPECT_CALL(renderer.deviceMock, deleteShader(_));
+
+    stats.frameFinished(0u);
+    StringOutputStream statsLog;
+    stats.writeStatsToStream(statsLog);
+    EXPECT_TRUE(statsLog.release().find("resCache hits 1 misses 1") >= 0);
 }
 
 TEST_F(ARendererResourceManager, UnloadsAllRemainingOffscreenBuffersAndStreamBuffersAtDestruction)
@@ -878,7 +1005,8 @@ TEST_F(ARendererResourceManager, UnloadsAllRemainingOffscreenBuffersAndStreamBuf
     constexpr OffscreenBufferHandle obHandle{ 1u };
     constexpr OffscreenBufferHandle obHandle2{ 2u };
     EXPECT_CALL(renderer.deviceMock, uploadRenderTarget(_)).Times(2u);
-    EXPECT_CALL(renderer.deviceMock, uploadRenderBuffer(_)).Times(4u);
+    // depth buffer is shared
+    EXPECT_CALL(renderer.deviceMock, uploadRenderBuffer(_)).Times(3u);
     EXPECT_CALL(renderer.deviceMock, activateRenderTarget(_)).Times(2u);
     EXPECT_CALL(renderer.deviceMock, colorMask(true, true, true, true)).Times(2u);
     EXPECT_CALL(renderer.deviceMock, clearColor(Vector4{ 0.f, 0.f, 0.f, 1.f })).Times(2u);
@@ -900,7 +1028,7 @@ TEST_F(ARendererResourceManager, UnloadsAllRemainingOffscreenBuffersAndStreamBuf
 
     // will destroy OBs directly on device
     EXPECT_CALL(renderer.deviceMock, deleteRenderTarget(_)).Times(2u);
-    EXPECT_CALL(renderer.deviceMock, deleteRenderBuffer(_)).Times(4u);
+    EXPECT_CALL(renderer.deviceMock, deleteRenderBuffer(_)).Times(3u);
 
     // will destroy SBs via EC manager
     EXPECT_CALL(embeddedCompositingManager, unrefStream(sbSrc1));
@@ -644,6 +644,30 @@ protected:
         performFlush(sceneIndex);
     }
 
+    RenderBufferHandle createRenderTargetWithTransientBuffer(UInt32 sceneIndex = 0u)
+    {
+        IScene& scene = *stagingScene[sceneIndex];
+        const RenderBufferHandle depthBuffer = scene.allocateRenderBuffer({ 16u, 16u, ERenderBufferType_DepthBuffer, ETextureFormat::Depth24, ERenderBufferAccessMode_WriteOnly, 0u });
+        const RenderTargetHandle renderTarget = scene.allocateRenderTarget();
+        scene.addRenderTargetRenderBuffer(renderTarget, depthBuffer);
+        const RenderPassHandle renderPass = scene.allocateRenderPass();
+        scene.setRenderPassRenderTarget(renderPass, renderTarget);
+        performFlush(sceneIndex);
+
+        expectContextEnable();
+        EXPECT_CALL(*rendererSceneUpdater->m_resourceManagerMocks[DisplayHandle1], uploadRenderTargetBuffer(depthBuffer, getSceneId(sceneIndex), _));
+        EXPECT_CALL(*rendererSceneUpdater->m_resourceManagerMocks[DisplayHandle1], uploadRenderTarget(renderTarget, _, getSceneId(sceneIndex)));
+        expectTransientRenderBuffersUpdated({ depthBuffer });
+        update();
+
+        return depthBuffer;
+    }
+
+    void expectTransientRenderBuffersUpdated(const RenderBufferHandleVector& transientBuffers)
+    {
+        EXPECT_CALL(*rendererSceneUpdater->m_resourceManagerMocks[DisplayHandle1], updateTransientRenderBuffers(_, transientBuffers)).WillOnce(Return(true));
+    }
+
     void expectRenderTargetUploaded(DisplayHandle display = DisplayHandle1, UInt32 sceneIdx = 0u)
     {
         EXPECT_CALL(*rendererSceneUpdater->m_resourceManagerMocks[display], uploadRenderTargetBuffer(_, getSceneId(sceneIdx), _)).Times(2);
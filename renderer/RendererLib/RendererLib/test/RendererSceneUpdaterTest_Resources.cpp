@@ -932,6 +932,51 @@ TEST_F(ARendererSceneUpdater, renderTargetIsUnloadedOnlyAfterPendingFlushApplied
     destroyDisplay();
 }
 
+TEST_F(ARendererSceneUpdater, updatesTransientRenderBuffersWhenFlushApplied)
+{
+    createDisplayAndExpectSuccess();
+    createPublishAndSubscribeScene();
+    mapScene();
+    createRenderTargetWithTransientBuffer();
+
+    // render pass does not clear depth anymore, buffer content is kept from previous frame
+    stagingScene[0]->setRenderPassClearFlag(RenderPassHandle{ 0u }, EClearFlags_Color);
+    performFlush();
+    expectContextEnable();
+    expectTransientRenderBuffersUpdated({});
+    update();
+
+    unmapScene();
+    destroyDisplay();
+}
+
+TEST_F(ARendererSceneUpdater, doesNotShareRenderBuffersOfSceneAssignedToInterruptibleOffscreenBuffer)
+{
+    createDisplayAndExpectSuccess();
+    createPublishAndSubscribeScene();
+    mapScene();
+    const RenderBufferHandle depthBuffer = createRenderTargetWithTransientBuffer();
+
+    const OffscreenBufferHandle buffer(1u);
+    expectContextEnable();
+    expectOffscreenBufferUploaded(buffer, DisplayHandle1, DeviceMock::FakeRenderTargetDeviceHandle, true);
+    EXPECT_TRUE(rendererSceneUpdater->handleBufferCreateRequest(buffer, DisplayHandle1, 1u, 1u, 0u, true));
+
+    expectContextEnable();
+    expectTransientRenderBuffersUpdated({});
+    EXPECT_TRUE(assignSceneToDisplayBuffer(0u, buffer));
+
+    expectContextEnable();
+    expectTransientRenderBuffersUpdated({ depthBuffer });
+    EXPECT_TRUE(assignSceneToDisplayBuffer(0u));
+
+    unmapScene();
+    expectContextEnable();
+    expectOffscreenBufferDeleted(buffer);
+    EXPECT_TRUE(rendererSceneUpdater->handleBufferDestroyRequest(buffer, DisplayHandle1));
+    destroyDisplay();
+}
+
 TEST_F(ARendererSceneUpdater, renderTargetIsUploadedOnceWhenMappedIfCreatedBeforeMapping)
 {
     createDisplayAndExpectSuccess();
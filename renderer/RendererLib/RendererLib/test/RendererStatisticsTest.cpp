@@ -290,6 +290,26 @@ TEST_F(ARendererStatistics, tracksResourceUploads)
     EXPECT_FALSE(logOutputContains("resUploaded"));
 }
 
+TEST_F(ARendererStatistics, tracksResourceCacheHitsMissesAndEvictions)
+{
+    stats.resourceUploaded(2u);
+    stats.resourceResidencyHit();
+    stats.frameFinished(0u);
+    EXPECT_TRUE(logOutputContains("resCache hits 1 misses 1 evicted 0 (0 B)"));
+
+    stats.reset();
+    EXPECT_FALSE(logOutputContains("resCache"));
+
+    stats.resourceUploaded(2u);
+    stats.resourceEvicted(10u);
+    stats.resourceEvicted(20u);
+    stats.frameFinished(0u);
+    EXPECT_TRUE(logOutputContains("resCache hits 0 misses 1 evicted 2 (30 B)"));
+
+    stats.reset();
+    EXPECT_FALSE(logOutputContains("resCache"));
+}
+
 TEST_F(ARendererStatistics, tracksSceneResourceUploads)
 {
     stats.sceneResourceUploaded(sceneId1, 2u);
@@ -391,3 +411,37 @@ TEST_F(ARendererStatistics, confidenceTest_fullLogOutput)
         stats.reset();
     }
 }
+
+TEST_F(ARendererStatistics, tracksGpuTimesOfFramesScenesAndMostExpensiveRenderPass)
+{
+    stats.frameFinished(0u);
+    stats.gpuTimingsCollected(disp1, {
+        { SceneId::Invalid(), RenderPassHandle::Invalid(), 3000000u },
+        { sceneId1, RenderPassHandle::Invalid(), 2000000u },
+        { sceneId1, RenderPassHandle{ 4u }, 500000u },
+        { sceneId1, RenderPassHandle{ 5u }, 1500000u } });
+    stats.gpuTimingsCollected(disp1, {
+        { SceneId::Invalid(), RenderPassHandle::Invalid(), 1000000u },
+        { sceneId1, RenderPassHandle::Invalid(), 1000000u },
+        { sceneId1, RenderPassHandle{ 4u }, 1000000u } });
+    stats.framebufferSwapped(disp1);
+    stats.frameFinished(0u);
+
+    EXPECT_TRUE(logOutputContains("FB1: 1 (gpuFrameTime us 1000/3000/2000)"));
+    EXPECT_TRUE(logOutputContains("gpuTime us (1000/2000/1500), maxGpuRP 5 (1500 us)"));
+
+    stats.reset();
+    EXPECT_FALSE(logOutputContains("gpu"));
+}
+
+TEST_F(ARendererStatistics, tracksFlushArrivalToSwapLatency)
+{
+    stats.flushPresented(sceneId1, std::chrono::microseconds{ 3000u });
+    stats.flushPresented(sceneId1, std::chrono::microseconds{ 1000u });
+    stats.frameFinished(0u);
+
+    EXPECT_TRUE(logOutputContains("arrivalToSwap us (1000/3000/2000)"));
+
+    stats.reset();
+    EXPECT_FALSE(logOutputContains("arrivalToSwap"));
+}
@@ -49,11 +49,10 @@ public:
             expirationMonitor.onDestroyed(sceneIt.key);
     }
 
-    DisplayHandle addDisplayController()
+    DisplayHandle addDisplayController(const DisplayConfig& displayConfig = DisplayConfig())
     {
-        static const DisplayConfig dummyConfig;
         const DisplayHandle handle(static_cast<UInt32>(createdDisplays.size()));
-        renderer.createDisplayContext(dummyConfig, handle);
+        renderer.createDisplayContext(displayConfig, handle);
         renderer.getDisplayController(handle).getRenderBackend();
         createdDisplays.emplace(handle, 0);
 
@@ -126,6 +125,7 @@ public:
         if (withContextEnable)
             EXPECT_CALL(*displayMock.m_displayController, enableContext()).InSequence(SeqRender);
         EXPECT_CALL(*displayMock.m_displayController, swapBuffers()).InSequence(SeqRender);
+        EXPECT_CALL(*displayMock.m_displayController, collectGpuTimings(_)).InSequence(SeqRender);
         EXPECT_CALL(*displayMock.m_displayController, getEmbeddedCompositingManager()).InSequence(SeqRender);
         EXPECT_CALL(*displayMock.m_embeddedCompositingManager, notifyClients()).InSequence(SeqRender);
     }
@@ -220,6 +220,42 @@ public:
         }
     }
 
+    void createFramebufferRenderPass(IScene& scene, const Viewport& viewport)
+    {
+        SceneAllocateHelper sceneAllocator(scene);
+        const auto dataLayout = sceneAllocator.allocateDataLayout({ DataFieldInfo{EDataType::DataReference}, DataFieldInfo{EDataType::DataReference} }, {});
+        const auto dataInstance = sceneAllocator.allocateDataInstance(dataLayout);
+        const auto vpDataRefLayout = sceneAllocator.allocateDataLayout({ DataFieldInfo{EDataType::Vector2I} }, {});
+        const auto vpOffsetInstance = sceneAllocator.allocateDataInstance(vpDataRefLayout);
+        const auto vpSizeInstance = sceneAllocator.allocateDataInstance(vpDataRefLayout);
+        scene.setDataReference(dataInstance, Camera::ViewportOffsetField, vpOffsetInstance);
+        scene.setDataReference(dataInstance, Camera::ViewportSizeField, vpSizeInstance);
+        scene.setDataSingleVector2i(vpOffsetInstance, DataFieldHandle{ 0 }, { viewport.posX, viewport.posY });
+        scene.setDataSingleVector2i(vpSizeInstance, DataFieldHandle{ 0 }, { Int32(viewport.width), Int32(viewport.height) });
+
+        const auto camera = sceneAllocator.allocateCamera(ECameraProjectionType::Orthographic, sceneAllocator.allocateNode(), dataInstance);
+        const auto pass = sceneAllocator.allocateRenderPass();
+        scene.setRenderPassCamera(pass, camera);
+        scene.setRenderPassEnabled(pass, true);
+    }
+
+    void expectFrameBufferDamageUpdate(DisplayHandle display, UInt32 bufferAge, bool fullyDamaged = false)
+    {
+        DisplayStrictMockInfo& displayMock = renderer.getDisplayMock(display);
+        if (!fullyDamaged)
+            EXPECT_CALL(*displayMock.m_displayController, isWarpingEnabled()).WillOnce(Return(false));
+        EXPECT_CALL(*displayMock.m_displayController, getDisplayBufferAge()).WillOnce(Return(bufferAge));
+    }
+
+    void expectSwapBuffersWithDamage(const Viewport& damage, DisplayHandle display = DisplayHandle(0u))
+    {
+        DisplayStrictMockInfo& displayMock = renderer.getDisplayMock(display);
+        EXPECT_CALL(*displayMock.m_displayController, swapBuffersWithDamage(damage)).InSequence(SeqRender);
+        EXPECT_CALL(*displayMock.m_displayController, collectGpuTimings(_)).InSequence(SeqRender);
+        EXPECT_CALL(*displayMock.m_displayController, getEmbeddedCompositingManager()).InSequence(SeqRender);
+        EXPECT_CALL(*displayMock.m_embeddedCompositingManager, notifyClients()).InSequence(SeqRender);
+    }
+
     void scheduleScreenshot(const DisplayHandle displayHandle, const DeviceResourceHandle bufferHandle, uint32_t x, uint32_t y, uint32_t width, uint32_t height)
     {
         ScreenshotInfo screenshot;
@@ -1785,6 +1821,82 @@ TEST_P(ARenderer, rerendersFramebufferIfWarpingDataChanged)
     doOneRendererLoop();
 }
 
+TEST_P(ARenderer, repaintsAndPresentsOnlyDamagedRegionOfFramebufferIfPartialUpdateEnabled)
+{
+    DisplayConfig displayConfig;
+    displayConfig.setPartialFramebufferUpdateEnabled(true);
+    const DisplayHandle displayHandle = addDisplayController(displayConfig);
+    DisplayStrictMockInfo& displayMock = renderer.getDisplayMock(displayHandle);
+
+    const SceneId sceneId1(12u);
+    const SceneId sceneId2(13u);
+    createFramebufferRenderPass(createScene(sceneId1), { 10, 20, 30, 40 });
+    createFramebufferRenderPass(createScene(sceneId2), { 100, 100, 10, 10 });
+    assignSceneToDisplayBuffer(sceneId1, displayHandle, 0);
+    assignSceneToDisplayBuffer(sceneId2, displayHandle, 1);
+    showScene(sceneId1);
+    showScene(sceneId2);
+
+    // first frame has no valid content to reuse
+    expectFrameBufferDamageUpdate(displayHandle, 0u, true);
+    expectSceneRendered(displayHandle, sceneId1);
+    expectSceneRendered(displayHandle, sceneId2);
+    expectFrameBufferRendered(displayHandle);
+    expectSwapBuffers(displayHandle);
+    doOneRendererLoop();
+
+    // back buffer is last presented frame, only modified scene repainted
+    renderer.markBufferWithSceneAsModified(sceneId1);
+    expectFrameBufferDamageUpdate(displayHandle, 1u);
+    EXPECT_CALL(*displayMock.m_displayController, setDisplayBufferRepaintRegion(Viewport(10, 20, 30, 40)));
+    expectSceneRendered(displayHandle, sceneId1);
+    expectSceneRendered(displayHandle, sceneId2);
+    expectFrameBufferRendered(displayHandle);
+    expectSwapBuffersWithDamage({ 10, 20, 30, 40 }, displayHandle);
+    doOneRendererLoop();
+
+    // back buffer content is two frames old, damage of previous frame has to be repainted too
+    renderer.markBufferWithSceneAsModified(sceneId2);
+    expectFrameBufferDamageUpdate(displayHandle, 2u);
+    EXPECT_CALL(*displayMock.m_displayController, setDisplayBufferRepaintRegion(Viewport(10, 20, 100, 90)));
+    expectSceneRendered(displayHandle, sceneId1);
+    expectSceneRendered(displayHandle, sceneId2);
+    expectFrameBufferRendered(displayHandle);
+    expectSwapBuffersWithDamage({ 100, 100, 10, 10 }, displayHandle);
+    doOneRendererLoop();
+
+    // back buffer content is from first frame which was fully repainted, fully repainted again but presented damage still valid
+    hideScene(sceneId2);
+    expectFrameBufferDamageUpdate(displayHandle, 4u);
+    expectSceneRendered(displayHandle, sceneId1);
+    expectFrameBufferRendered(displayHandle);
+    expectSwapBuffersWithDamage({ 100, 100, 10, 10 }, displayHandle);
+    doOneRendererLoop();
+
+    hideScene(sceneId1);
+    unassignScene(sceneId1);
+    unassignScene(sceneId2);
+}
+
+TEST_P(ARenderer, presentsFullFramebufferIfPartialUpdateEnabledAndClearColorChanged)
+{
+    DisplayConfig displayConfig;
+    displayConfig.setPartialFramebufferUpdateEnabled(true);
+    const DisplayHandle displayHandle = addDisplayController(displayConfig);
+
+    expectFrameBufferDamageUpdate(displayHandle, 0u, true);
+    expectFrameBufferRendered(displayHandle);
+    expectSwapBuffers(displayHandle);
+    doOneRendererLoop();
+
+    const Vector4 clearColor(1.f, 0.f, 0.f, 1.f);
+    renderer.setClearColor(displayHandle, DisplayControllerMock::FakeFrameBufferHandle, clearColor);
+    expectFrameBufferDamageUpdate(displayHandle, 1u, true);
+    expectFrameBufferRendered(displayHandle, true, true, clearColor);
+    expectSwapBuffers(displayHandle);
+    doOneRendererLoop();
+}
+
 TEST_P(ARenderer, rendersScenesToFBAndOBWithNoInterruption)
 {
     const DisplayHandle displayHandle = addDisplayController();
@@ -1142,4 +1142,25 @@ namespace ramses_internal
         scene.updateRenderableResources(sceneHelper.resourceManager, sceneHelper.embeddedCompositingManager);
         expectRenderableResourcesClean(renderable);
     }
+
+    TEST_F(AResourceCachedScene, tracksUpdatedRegionsOfTextureBufferMipLevels)
+    {
+        const TextureBufferHandle buffer = sceneAllocator.allocateTextureBuffer(ETextureFormat::R8, { { 8u, 8u }, { 4u, 4u } });
+        const std::vector<Quad>* regions = scene.getTextureBufferDirtyRegions().get(buffer);
+        ASSERT_TRUE(regions != nullptr);
+        EXPECT_EQ(std::vector<Quad>({ { 0, 0, 8, 8 }, { 0, 0, 4, 4 } }), *regions);
+
+        scene.clearTextureBufferDirtyRegions();
+        EXPECT_TRUE(scene.getTextureBufferDirtyRegions().get(buffer) == nullptr);
+
+        const std::array<Byte, 4> data{};
+        scene.updateTextureBuffer(buffer, 0u, 1u, 2u, 2u, 1u, data.data());
+        scene.updateTextureBuffer(buffer, 0u, 4u, 4u, 1u, 1u, data.data());
+        regions = scene.getTextureBufferDirtyRegions().get(buffer);
+        ASSERT_TRUE(regions != nullptr);
+        EXPECT_EQ(std::vector<Quad>({ { 1, 2, 4, 3 }, {} }), *regions);
+
+        scene.releaseTextureBuffer(buffer);
+        EXPECT_TRUE(scene.getTextureBufferDirtyRegions().get(buffer) == nullptr);
+    }
 }
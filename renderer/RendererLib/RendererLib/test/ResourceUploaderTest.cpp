@@ -110,6 +110,27 @@ TEST_F(AResourceUploader, uploadsVertexArrayResource)
     EXPECT_CALL(renderer.deviceMock, uploadVertexBufferData(DeviceResourceHandle(123), res.getResourceData().data(), res.getDecompressedDataSize()));
     EXPECT_EQ(123u, uploader.uploadResource(renderer, resourceObject, vramSize));
     EXPECT_EQ(res.getDecompressedDataSize(), vramSize);
+
+    EXPECT_CALL(renderer.deviceMock, getShaderUploadStatus(DeviceResourceHandle(123)));
+    EXPECT_EQ(EShaderUploadStatus::Uploaded, uploader.getEffectUploadStatus(renderer, res.getHash(), DeviceResourceHandle(123)));
+}
+
+TEST_F(AResourceUploader, reportsPendingEffectUploadUntilDeviceFinishedCompilation)
+{
+    EffectResource res("", "", "", EffectInputInformationVector(), EffectInputInformationVector(), "", ResourceCacheFlag_DoNotCache);
+    ManagedResource managedRes{ &res, dummyManagedResourceCallback };
+    ResourceDescriptor resourceObject;
+    resourceObject.resource = managedRes;
+    EXPECT_CALL(managedResourceDeleter, managedResourceDeleted(Ref(res))).Times(1);
+
+    const DeviceResourceHandle handle(123);
+    EXPECT_CALL(renderer.deviceMock, startShaderUpload(_)).WillOnce(Return(handle));
+    EXPECT_EQ(handle, uploader.uploadResource(renderer, resourceObject, vramSize));
+
+    EXPECT_CALL(renderer.deviceMock, getShaderUploadStatus(handle)).WillOnce(Return(EShaderUploadStatus::Pending));
+    EXPECT_EQ(EShaderUploadStatus::Pending, uploader.getEffectUploadStatus(renderer, res.getHash(), handle));
+    EXPECT_CALL(renderer.deviceMock, getShaderUploadStatus(handle)).WillOnce(Return(EShaderUploadStatus::Failed));
+    EXPECT_EQ(EShaderUploadStatus::Failed, uploader.getEffectUploadStatus(renderer, res.getHash(), handle));
 }
 
 TEST_F(AResourceUploader, uploadsIndexArrayResource16)
@@ -258,7 +279,7 @@ TEST_F(AResourceUploader, uploadsEffectResourceWithoutBinaryShaderCache)
     resourceObject.resource = managedRes;
     EXPECT_CALL(managedResourceDeleter, managedResourceDeleted(Ref(res))).Times(1);
 
-    EXPECT_CALL(renderer.deviceMock, uploadShader(_)).WillOnce(Return(DeviceResourceHandle(123)));
+    EXPECT_CALL(renderer.deviceMock, startShaderUpload(_)).WillOnce(Return(DeviceResourceHandle(123)));
     EXPECT_EQ(123u, uploader.uploadResource(renderer, resourceObject, vramSize));
     EXPECT_EQ(res.getDecompressedDataSize(), vramSize);
 }
@@ -275,7 +296,7 @@ TEST_F(AResourceUploader, ifShaderShouldNotBeCachedNoDownloadWillHappen)
     EXPECT_CALL(binaryShaderProvider, hasBinaryShader(res.getHash()));
     EXPECT_CALL(binaryShaderProvider, shouldBinaryShaderBeCached(res.getHash(),_)).WillOnce(Return(false));
     EXPECT_CALL(binaryShaderProvider, storeBinaryShader(_, _, _, _, _)).Times(0);
-    EXPECT_CALL(renderer.deviceMock, uploadShader(_)).WillOnce(Return(DeviceResourceHandle(123)));
+    EXPECT_CALL(renderer.deviceMock, startShaderUpload(_)).WillOnce(Return(DeviceResourceHandle(123)));
     EXPECT_CALL(renderer.deviceMock, getBinaryShader(_, _, _)).Times(0);
     EXPECT_CALL(binaryShaderProvider, binaryShaderUploaded(_, _)).Times(0); // This should only be called when attempting to upload from cache
 
@@ -283,6 +304,9 @@ TEST_F(AResourceUploader, ifShaderShouldNotBeCachedNoDownloadWillHappen)
     ResourceDescriptor resourceObject;
     resourceObject.resource = managedRes;
     EXPECT_EQ(123u, uploaderWithBinaryProvider.uploadResource(renderer, resourceObject, vramSize));
+
+    EXPECT_CALL(renderer.deviceMock, getShaderUploadStatus(DeviceResourceHandle(123)));
+    EXPECT_EQ(EShaderUploadStatus::Uploaded, uploaderWithBinaryProvider.getEffectUploadStatus(renderer, res.getHash(), DeviceResourceHandle(123)));
 }
 
 TEST_F(AResourceUploader, uploadsEffectResourceWithBinaryShaderCacheWhenCacheMissingAndCachingSupported)
@@ -295,17 +319,48 @@ TEST_F(AResourceUploader, uploadsEffectResourceWithBinaryShaderCacheWhenCacheMis
 
     EXPECT_CALL(binaryShaderProvider, deviceSupportsBinaryShaderFormats(std::vector<BinaryShaderFormatID>{ DeviceMock::FakeSupportedBinaryShaderFormat }));
     EXPECT_CALL(binaryShaderProvider, hasBinaryShader(res.getHash()));
+    EXPECT_CALL(renderer.deviceMock, startShaderUpload(_)).WillOnce(Return(DeviceResourceHandle(123)));
+    EXPECT_CALL(binaryShaderProvider, binaryShaderUploaded(_, _)).Times(0); // This should only be called when attempting to upload from cache
+
+    ManagedResource managedRes{ &res, dummyManagedResourceCallback };
+    ResourceDescriptor resourceObject;
+    resourceObject.resource = managedRes;
+    EXPECT_EQ(123u, uploaderWithBinaryProvider.uploadResource(renderer, resourceObject, vramSize));
+
+    // binary shader can only be retrieved once compilation is finished
+    EXPECT_CALL(renderer.deviceMock, getShaderUploadStatus(DeviceResourceHandle(123))).WillOnce(Return(EShaderUploadStatus::Pending));
+    EXPECT_EQ(EShaderUploadStatus::Pending, uploaderWithBinaryProvider.getEffectUploadStatus(renderer, res.getHash(), DeviceResourceHandle(123)));
+
+    EXPECT_CALL(renderer.deviceMock, getShaderUploadStatus(DeviceResourceHandle(123))).WillOnce(Return(EShaderUploadStatus::Uploaded));
     EXPECT_CALL(binaryShaderProvider, shouldBinaryShaderBeCached(res.getHash(),_)).WillOnce(Return(true));
-    EXPECT_CALL(binaryShaderProvider, storeBinaryShader(res.getHash(), _, _, _, _));
-    EXPECT_CALL(renderer.deviceMock, uploadShader(_)).WillOnce(Return(DeviceResourceHandle(123)));
     EXPECT_CALL(renderer.deviceMock, getBinaryShader(_, _, _)).
         WillOnce(DoAll(SetArgReferee<1>(std::vector<UInt8>(1)), Return(true)));
-    EXPECT_CALL(binaryShaderProvider, binaryShaderUploaded(_, _)).Times(0); // This should only be called when attempting to upload from cache
+    EXPECT_CALL(binaryShaderProvider, storeBinaryShader(res.getHash(), _, _, _, _));
+    EXPECT_EQ(EShaderUploadStatus::Uploaded, uploaderWithBinaryProvider.getEffectUploadStatus(renderer, res.getHash(), DeviceResourceHandle(123)));
+}
+
+TEST_F(AResourceUploader, doesNotStoreBinaryShaderIfEffectFailedToCompile)
+{
+    BinaryShaderProviderFake binaryShaderProvider;
+    ResourceUploader uploaderWithBinaryProvider(stats, &binaryShaderProvider);
+
+    EffectResource res("", "", "", EffectInputInformationVector(), EffectInputInformationVector(), "", ResourceCacheFlag_DoNotCache);
+    EXPECT_CALL(managedResourceDeleter, managedResourceDeleted(Ref(res))).Times(1);
+
+    EXPECT_CALL(binaryShaderProvider, deviceSupportsBinaryShaderFormats(std::vector<BinaryShaderFormatID>{ DeviceMock::FakeSupportedBinaryShaderFormat }));
+    EXPECT_CALL(binaryShaderProvider, hasBinaryShader(res.getHash()));
+    EXPECT_CALL(renderer.deviceMock, startShaderUpload(_)).WillOnce(Return(DeviceResourceHandle(123)));
 
     ManagedResource managedRes{ &res, dummyManagedResourceCallback };
     ResourceDescriptor resourceObject;
     resourceObject.resource = managedRes;
     EXPECT_EQ(123u, uploaderWithBinaryProvider.uploadResource(renderer, resourceObject, vramSize));
+
+    EXPECT_CALL(renderer.deviceMock, getShaderUploadStatus(DeviceResourceHandle(123))).WillOnce(Return(EShaderUploadStatus::Failed));
+    EXPECT_CALL(binaryShaderProvider, shouldBinaryShaderBeCached(_, _)).Times(0);
+    EXPECT_CALL(renderer.deviceMock, getBinaryShader(_, _, _)).Times(0);
+    EXPECT_CALL(binaryShaderProvider, storeBinaryShader(_, _, _, _, _)).Times(0);
+    EXPECT_EQ(EShaderUploadStatus::Failed, uploaderWithBinaryProvider.getEffectUploadStatus(renderer, res.getHash(), DeviceResourceHandle(123)));
 }
 
 TEST_F(AResourceUploader, uploadsEffectResourceWithBinaryShaderCacheWhenCacheHit)
@@ -336,6 +391,9 @@ TEST_F(AResourceUploader, uploadsEffectResourceWithBinaryShaderCacheWhenCacheHit
     ResourceDescriptor resourceObject;
     resourceObject.resource = managedRes;
     EXPECT_EQ(123u, uploaderWithBinaryProvider.uploadResource(renderer, resourceObject, vramSize));
+
+    EXPECT_CALL(renderer.deviceMock, getShaderUploadStatus(DeviceResourceHandle(123)));
+    EXPECT_EQ(EShaderUploadStatus::Uploaded, uploaderWithBinaryProvider.getEffectUploadStatus(renderer, res.getHash(), DeviceResourceHandle(123)));
 }
 
 TEST_F(AResourceUploader, uploadsEffectResourceWithBrokenBinaryShaderCache)
@@ -366,7 +424,7 @@ TEST_F(AResourceUploader, uploadsEffectResourceWithBrokenBinaryShaderCache)
     EXPECT_CALL(binaryShaderProvider, binaryShaderUploaded(_, false)).Times(1);
 
     // Expect fallback to compiling from source and storing in the cache
-    EXPECT_CALL(renderer.deviceMock, uploadShader(_)).WillOnce(Return(DeviceResourceHandle(123)));
+    EXPECT_CALL(renderer.deviceMock, startShaderUpload(_)).WillOnce(Return(DeviceResourceHandle(123)));
     EXPECT_CALL(binaryShaderProvider, shouldBinaryShaderBeCached(_, sceneUsingResource));
     EXPECT_CALL(renderer.deviceMock, getBinaryShader(_, _, _)).WillOnce(DoAll(SetArgReferee<1>(UInt8Vector(10)), Return(true)));
     EXPECT_CALL(binaryShaderProvider, storeBinaryShader(_, sceneUsingResource, _, _, _)).Times(1);
@@ -376,6 +434,9 @@ TEST_F(AResourceUploader, uploadsEffectResourceWithBrokenBinaryShaderCache)
     resourceObject.resource = managedRes;
     resourceObject.sceneUsage = { sceneUsingResource };
     EXPECT_EQ(123u, uploaderWithBinaryProvider.uploadResource(renderer, resourceObject, vramSize));
+
+    EXPECT_CALL(renderer.deviceMock, getShaderUploadStatus(DeviceResourceHandle(123)));
+    EXPECT_EQ(EShaderUploadStatus::Uploaded, uploaderWithBinaryProvider.getEffectUploadStatus(renderer, res.getHash(), DeviceResourceHandle(123)));
 }
 
 TEST_F(AResourceUploader, doesNotTryToGetBinaryShaderFromDeviceIfEffectDidNotCompile)
@@ -388,11 +449,11 @@ TEST_F(AResourceUploader, doesNotTryToGetBinaryShaderFromDeviceIfEffectDidNotCom
     EXPECT_CALL(binaryShaderProvider, deviceSupportsBinaryShaderFormats(std::vector<BinaryShaderFormatID>{ DeviceMock::FakeSupportedBinaryShaderFormat }));
     EXPECT_CALL(managedResourceDeleter, managedResourceDeleted(Ref(res))).Times(1);
     EXPECT_CALL(binaryShaderProvider, hasBinaryShader(res.getHash())).Times(1);
-    EXPECT_CALL(renderer.deviceMock, uploadShader(_)).Times(1);
+    EXPECT_CALL(renderer.deviceMock, startShaderUpload(_)).Times(1);
     EXPECT_CALL(binaryShaderProvider, binaryShaderUploaded(_, _)).Times(0);
 
     ON_CALL(binaryShaderProvider, hasBinaryShader(_)).WillByDefault(Return(false));
-    ON_CALL(renderer.deviceMock, uploadShader(_)).WillByDefault(Return(DeviceResourceHandle::Invalid()));
+    ON_CALL(renderer.deviceMock, startShaderUpload(_)).WillByDefault(Return(DeviceResourceHandle::Invalid()));
 
     ResourceUploader uploaderWithBinaryProvider(stats, &binaryShaderProvider);
     ResourceDescriptor resourceObject;
@@ -412,7 +473,7 @@ TEST_F(AResourceUploader, providesSupportedBinaryShaderFormatsOnlyOnce)
 
     EXPECT_CALL(binaryShaderProvider, hasBinaryShader(res.getHash())).Times(3);
     EXPECT_CALL(binaryShaderProvider, shouldBinaryShaderBeCached(res.getHash(), _)).Times(3).WillRepeatedly(Return(false));
-    EXPECT_CALL(renderer.deviceMock, uploadShader(_)).Times(3).WillRepeatedly(Return(DeviceResourceHandle(123)));
+    EXPECT_CALL(renderer.deviceMock, startShaderUpload(_)).Times(3).WillRepeatedly(Return(DeviceResourceHandle(123)));
 
     ResourceDescriptor resourceObject1;
     resourceObject1.resource = ManagedResource{ &res, dummyManagedResourceCallback };
@@ -422,9 +483,13 @@ TEST_F(AResourceUploader, providesSupportedBinaryShaderFormatsOnlyOnce)
     ResourceDescriptor resourceObject3 = resourceObject1;
     resourceObject3.resource = ManagedResource{ &res, dummyManagedResourceCallback };
 
+    EXPECT_CALL(renderer.deviceMock, getShaderUploadStatus(DeviceResourceHandle(123))).Times(3);
     EXPECT_EQ(123u, uploaderWithBinaryProvider.uploadResource(renderer, resourceObject1, vramSize));
+    EXPECT_EQ(EShaderUploadStatus::Uploaded, uploaderWithBinaryProvider.getEffectUploadStatus(renderer, res.getHash(), DeviceResourceHandle(123)));
     EXPECT_EQ(123u, uploaderWithBinaryProvider.uploadResource(renderer, resourceObject2, vramSize));
+    EXPECT_EQ(EShaderUploadStatus::Uploaded, uploaderWithBinaryProvider.getEffectUploadStatus(renderer, res.getHash(), DeviceResourceHandle(123)));
     EXPECT_EQ(123u, uploaderWithBinaryProvider.uploadResource(renderer, resourceObject3, vramSize));
+    EXPECT_EQ(EShaderUploadStatus::Uploaded, uploaderWithBinaryProvider.getEffectUploadStatus(renderer, res.getHash(), DeviceResourceHandle(123)));
 }
 
 TEST_F(AResourceUploader, unloadsVertexArrayResource)
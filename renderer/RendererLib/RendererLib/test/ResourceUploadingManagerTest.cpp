@@ -11,6 +11,7 @@
 #include "RendererLib/RendererResourceRegistry.h"
 #include "RendererLib/FrameTimer.h"
 #include "RendererLib/RendererStatistics.h"
+#include "Collections/StringOutputStream.h"
 #include "Resource/ArrayResource.h"
 #include "Resource/EffectResource.h"
 #include "ResourceUploaderMock.h"
@@ -191,6 +192,79 @@ TEST_F(AResourceUploadingManager, setsBrokenStatusForResourceFailedToUpload)
     makeResourceUnused(res);
 }
 
+TEST_F(AResourceUploadingManager, keepsEffectProvidedWhileCompilingAndMarksUploadedWhenCompiled)
+{
+    const ResourceContentHash res(1234u, 0u);
+    registerAndProvideResource(res, true);
+
+    EXPECT_CALL(uploader, uploadResource(_, _, _));
+    EXPECT_CALL(uploader, getEffectUploadStatus(_, res, ResourceUploaderMock::FakeResourceDeviceHandle)).WillOnce(Return(EShaderUploadStatus::Pending));
+    rendererResourceUploader.uploadAndUnloadPendingResources();
+    expectResourceStatus(res, EResourceStatus::Provided);
+    EXPECT_TRUE(rendererResourceUploader.hasAnythingToUpload());
+
+    // not uploaded again while compiling
+    EXPECT_CALL(uploader, uploadResource(_, _, _)).Times(0);
+    EXPECT_CALL(uploader, getEffectUploadStatus(_, res, ResourceUploaderMock::FakeResourceDeviceHandle)).WillOnce(Return(EShaderUploadStatus::Pending));
+    rendererResourceUploader.uploadAndUnloadPendingResources();
+    expectResourceStatus(res, EResourceStatus::Provided);
+
+    EXPECT_CALL(uploader, getEffectUploadStatus(_, res, ResourceUploaderMock::FakeResourceDeviceHandle)).WillOnce(Return(EShaderUploadStatus::Uploaded));
+    rendererResourceUploader.uploadAndUnloadPendingResources();
+    expectResourceUploaded(res);
+
+    EXPECT_CALL(uploader, unloadResource(_, EResourceType_Effect, res, ResourceUploaderMock::FakeResourceDeviceHandle));
+    makeResourceUnused(res);
+}
+
+TEST_F(AResourceUploadingManager, setsBrokenStatusForEffectFailedToCompile)
+{
+    const ResourceContentHash res(1234u, 0u);
+    registerAndProvideResource(res, true);
+
+    EXPECT_CALL(uploader, uploadResource(_, _, _));
+    EXPECT_CALL(uploader, getEffectUploadStatus(_, res, _)).WillOnce(Return(EShaderUploadStatus::Pending));
+    rendererResourceUploader.uploadAndUnloadPendingResources();
+    expectResourceStatus(res, EResourceStatus::Provided);
+
+    EXPECT_CALL(uploader, getEffectUploadStatus(_, res, _)).WillOnce(Return(EShaderUploadStatus::Failed));
+    rendererResourceUploader.uploadAndUnloadPendingResources();
+    expectResourceUploadFailed(res);
+
+    makeResourceUnused(res);
+}
+
+TEST_F(AResourceUploadingManager, unloadsEffectWhichGotUnusedWhileCompiling)
+{
+    const ResourceContentHash res(1234u, 0u);
+    registerAndProvideResource(res, true);
+
+    EXPECT_CALL(uploader, uploadResource(_, _, _));
+    EXPECT_CALL(uploader, getEffectUploadStatus(_, res, _)).WillOnce(Return(EShaderUploadStatus::Pending));
+    rendererResourceUploader.uploadAndUnloadPendingResources();
+
+    makeResourceUnused(res);
+    expectResourceUnloaded(res);
+
+    EXPECT_CALL(uploader, getEffectUploadStatus(_, _, _)).Times(0);
+    EXPECT_CALL(uploader, unloadResource(_, EResourceType_Effect, res, ResourceUploaderMock::FakeResourceDeviceHandle));
+    rendererResourceUploader.uploadAndUnloadPendingResources();
+    EXPECT_FALSE(rendererResourceUploader.hasAnythingToUpload());
+}
+
+TEST_F(AResourceUploadingManager, unloadsEffectStillCompilingWhenDestructed)
+{
+    const ResourceContentHash res(1234u, 0u);
+    registerAndProvideResource(res, true);
+
+    EXPECT_CALL(uploader, uploadResource(_, _, _));
+    EXPECT_CALL(uploader, getEffectUploadStatus(_, res, _)).WillOnce(Return(EShaderUploadStatus::Pending));
+    rendererResourceUploader.uploadAndUnloadPendingResources();
+    Mock::VerifyAndClearExpectations(&uploader);
+
+    EXPECT_CALL(uploader, unloadResource(_, EResourceType_Effect, res, ResourceUploaderMock::FakeResourceDeviceHandle));
+}
+
 TEST_F(AResourceUploadingManager, uploadsAllProvidedResourcesInOneUpdate_defaultUploadStrategy)
 {
     const ResourceContentHash res1(1234u, 0u);
@@ -660,4 +734,120 @@ TEST_F(AResourceUploadingManager_WithVRAMCache, willUnloadResourcesOfSameOrGreat
     // destructor will unload kept resources
     EXPECT_CALL(uploader, unloadResource(_, _, _, _)).Times(3u);
 }
+TEST_F(AResourceUploadingManager_WithVRAMCache, unloadsLeastRecentlyUsedResourceFirst)
+{
+    // test resource has size of 10 bytes
+    // cache is set to 30 bytes
+
+    const ResourceContentHash res1(1234u, 0u);
+    const ResourceContentHash res2(1235u, 0u);
+    const ResourceContentHash res3(1236u, 0u);
+    const ResourceContentHash res4(1237u, 0u);
+
+    registerAndProvideResource(res1);
+    registerAndProvideResource(res2);
+    registerAndProvideResource(res3);
+
+    EXPECT_CALL(uploader, uploadResource(_, _, _)).Times(3u);
+    rendererResourceUploader.uploadAndUnloadPendingResources();
+
+    // res2 becomes unused before res1, res1 is re-used and becomes unused again later
+    makeResourceUnused(res1);
+    makeResourceUnused(res2);
+    resourceRegistry.addResourceRef(res1, sceneId);
+    makeResourceUnused(res1);
+
+    // cache is full, least recently used res2 has to make space for res4
+    registerAndProvideResource(res4);
+    EXPECT_CALL(uploader, unloadResource(_, _, _, _));
+    EXPECT_CALL(uploader, uploadResource(_, _, _));
+    rendererResourceUploader.uploadAndUnloadPendingResources();
+    Mock::VerifyAndClearExpectations(&uploader);
+
+    expectResourceUnloaded(res2);
+    expectResourceUploaded(res1);
+    expectResourceUploaded(res3);
+    expectResourceUploaded(res4);
+
+    stats.frameFinished(0u);
+    StringOutputStream statsLog;
+    stats.writeStatsToStream(statsLog);
+    EXPECT_TRUE(statsLog.release().find("evicted 1 (10 B)") >= 0);
+
+    makeResourceUnused(res3);
+    makeResourceUnused(res4);
+
+    // destructor will unload kept resources
+    EXPECT_CALL(uploader, unloadResource(_, _, _, _)).Times(3u);
+}
+
+TEST_F(AResourceUploadingManager_WithVRAMCache, accountsGPUMemorySizeReportedByUploader)
+{
+    // cache is set to 30 bytes
+
+    const ResourceContentHash res1(1234u, 0u);
+    const ResourceContentHash res2(1235u, 0u);
+    const ResourceContentHash res3(1236u, 0u);
+
+    registerAndProvideResource(res1);
+    registerAndProvideResource(res2);
+
+    // resources take more GPU memory than their data size (eg. texture with mip chain)
+    EXPECT_CALL(uploader, uploadResource(_, _, _)).Times(2u).WillRepeatedly(DoAll(SetArgReferee<2>(15u), Return(ResourceUploaderMock::FakeResourceDeviceHandle)));
+    rendererResourceUploader.uploadAndUnloadPendingResources();
+    Mock::VerifyAndClearExpectations(&uploader);
+
+    makeResourceUnused(res1);
+    makeResourceUnused(res2);
+
+    // cache is full with 30/30, 10 bytes needed and one unused resource of 15 bytes freed
+    registerAndProvideResource(res3);
+    EXPECT_CALL(uploader, unloadResource(_, _, _, _));
+    EXPECT_CALL(uploader, uploadResource(_, _, _));
+    rendererResourceUploader.uploadAndUnloadPendingResources();
+    Mock::VerifyAndClearExpectations(&uploader);
+
+    expectResourceUnloaded(res1);
+    expectResourceUploaded(res2);
+    expectResourceUploaded(res3);
+
+    makeResourceUnused(res3);
+
+    // destructor will unload kept resources
+    EXPECT_CALL(uploader, unloadResource(_, _, _, _)).Times(2u);
+}
+
+TEST_F(AResourceUploadingManager_WithVRAMCache, countsRenderTargetMemoryAgainstCacheSize)
+{
+    // test resource has size of 10 bytes
+    // cache is set to 30 bytes
+
+    const ResourceContentHash res1(1234u, 0u);
+    const ResourceContentHash res2(1235u, 0u);
+
+    rendererResourceUploader.addRenderTargetMemory(20u);
+
+    registerAndProvideResource(res1);
+    EXPECT_CALL(uploader, uploadResource(_, _, _));
+    rendererResourceUploader.uploadAndUnloadPendingResources();
+    makeResourceUnused(res1);
+
+    // cache is full with 20/30 render targets and 10/30 unused resource
+    registerAndProvideResource(res2);
+    EXPECT_CALL(uploader, unloadResource(_, _, _, _));
+    EXPECT_CALL(uploader, uploadResource(_, _, _));
+    rendererResourceUploader.uploadAndUnloadPendingResources();
+    Mock::VerifyAndClearExpectations(&uploader);
+    expectResourceUnloaded(res1);
+    expectResourceUploaded(res2);
+
+    // with render targets gone there is space for unused resource to stay
+    rendererResourceUploader.removeRenderTargetMemory(20u);
+    makeResourceUnused(res2);
+    rendererResourceUploader.uploadAndUnloadPendingResources();
+    expectResourceUploaded(res2);
+
+    // destructor will unload kept resources
+    EXPECT_CALL(uploader, unloadResource(_, _, _, _));
+}
 }
@@ -314,6 +314,29 @@ TEST_F(ASceneDependencyChecker, canRemoveSingleDependentSceneWithDependenciesFro
     EXPECT_TRUE(dependencyChecker.isEmpty());
 }
 
+TEST_F(ASceneDependencyChecker, providesProvidersOfConsumerScene)
+{
+    const SceneId provider1(1u);
+    const SceneId provider2(2u);
+    const SceneId consumer(3u);
+
+    EXPECT_EQ(nullptr, dependencyChecker.getProviderScenes(consumer));
+
+    EXPECT_TRUE(dependencyChecker.addDependency(provider1, consumer));
+    EXPECT_TRUE(dependencyChecker.addDependency(provider2, consumer));
+
+    ASSERT_NE(nullptr, dependencyChecker.getProviderScenes(consumer));
+    EXPECT_EQ(SceneIdVector({ provider1, provider2 }), *dependencyChecker.getProviderScenes(consumer));
+    EXPECT_EQ(nullptr, dependencyChecker.getProviderScenes(provider1));
+
+    dependencyChecker.removeDependency(provider1, consumer);
+    ASSERT_NE(nullptr, dependencyChecker.getProviderScenes(consumer));
+    EXPECT_EQ(SceneIdVector({ provider2 }), *dependencyChecker.getProviderScenes(consumer));
+
+    dependencyChecker.removeDependency(provider2, consumer);
+    EXPECT_EQ(nullptr, dependencyChecker.getProviderScenes(consumer));
+}
+
 TEST_F(ASceneDependencyChecker, canRemoveDependencyAddedTwiceWithTwoRemovalsOnly)
 {
     SceneId scene1(3u);
@@ -0,0 +1,160 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2020 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "renderer_common_gmock_header.h"
+#include "gtest/gtest.h"
+#include "RendererLib/SceneUpdateScheduler.h"
+#include <mutex>
+#include <atomic>
+#include <thread>
+
+using namespace testing;
+using namespace ramses_internal;
+
+class ASceneUpdateScheduler : public ::testing::TestWithParam<UInt32>
+{
+public:
+    ASceneUpdateScheduler()
+        : scheduler(GetParam())
+    {
+    }
+
+protected:
+    SceneUpdateScheduler::UpdateFunction recordingUpdate()
+    {
+        return [this](SceneId sceneId)
+        {
+            std::lock_guard<std::mutex> guard(lock);
+            updatedScenes.push_back(sceneId);
+        };
+    }
+
+    bool updatedBefore(SceneId first, SceneId second) const
+    {
+        const auto firstIt = std::find(updatedScenes.cbegin(), updatedScenes.cend(), first);
+        const auto secondIt = std::find(updatedScenes.cbegin(), updatedScenes.cend(), second);
+        return firstIt != updatedScenes.cend() && secondIt != updatedScenes.cend() && firstIt < secondIt;
+    }
+
+    SceneUpdateScheduler scheduler;
+    std::mutex lock;
+    SceneIdVector updatedScenes;
+};
+
+INSTANTIATE_TEST_CASE_P(, ASceneUpdateScheduler, ::testing::Values(0u, 1u, 4u));
+
+TEST_P(ASceneUpdateScheduler, reportsThreadCount)
+{
+    EXPECT_EQ(GetParam(), scheduler.getThreadCount());
+}
+
+TEST_P(ASceneUpdateScheduler, doesNothingWithoutScenes)
+{
+    scheduler.execute(recordingUpdate());
+    EXPECT_TRUE(updatedScenes.empty());
+}
+
+TEST_P(ASceneUpdateScheduler, updatesEveryAddedSceneExactlyOnce)
+{
+    for (UInt64 i = 1u; i <= 20u; ++i)
+        scheduler.addScene(SceneId(i));
+    scheduler.execute(recordingUpdate());
+
+    ASSERT_EQ(20u, updatedScenes.size());
+    for (UInt64 i = 1u; i <= 20u; ++i)
+        EXPECT_EQ(1, std::count(updatedScenes.cbegin(), updatedScenes.cend(), SceneId(i)));
+}
+
+TEST_P(ASceneUpdateScheduler, clearsScenesAfterExecution)
+{
+    scheduler.addScene(SceneId(1u));
+    scheduler.addScene(SceneId(2u));
+    scheduler.execute(recordingUpdate());
+    EXPECT_EQ(2u, updatedScenes.size());
+
+    updatedScenes.clear();
+    scheduler.execute(recordingUpdate());
+    EXPECT_TRUE(updatedScenes.empty());
+
+    // same scenes can be added again
+    scheduler.addScene(SceneId(2u));
+    scheduler.addScene(SceneId(1u));
+    scheduler.execute(recordingUpdate());
+    EXPECT_EQ(2u, updatedScenes.size());
+}
+
+TEST_P(ASceneUpdateScheduler, updatesScenesInAddedOrderWhenChainedByDependencies)
+{
+    for (UInt64 i = 1u; i <= 10u; ++i)
+    {
+        scheduler.addScene(SceneId(i));
+        if (i > 1u)
+            scheduler.addDependency(SceneId(i - 1u), SceneId(i));
+    }
+    scheduler.execute(recordingUpdate());
+
+    ASSERT_EQ(10u, updatedScenes.size());
+    for (UInt64 i = 1u; i <= 10u; ++i)
+        EXPECT_EQ(SceneId(i), updatedScenes[i - 1u]);
+}
+
+TEST_P(ASceneUpdateScheduler, updatesConsumerAfterAllItsProviders)
+{
+    const SceneId provider1(1u);
+    const SceneId provider2(2u);
+    const SceneId consumer(3u);
+    const SceneId consumerOfConsumer(4u);
+    const SceneId independentScene(5u);
+
+    // repeat to give concurrent execution the chance to violate order
+    for (int i = 0; i < 50; ++i)
+    {
+        scheduler.addScene(provider1);
+        scheduler.addScene(provider2);
+        scheduler.addScene(consumer);
+        scheduler.addScene(consumerOfConsumer);
+        scheduler.addScene(independentScene);
+        scheduler.addDependency(provider1, consumer);
+        scheduler.addDependency(provider2, consumer);
+        scheduler.addDependency(consumer, consumerOfConsumer);
+        scheduler.addDependency(provider1, consumerOfConsumer);
+
+        updatedScenes.clear();
+        scheduler.execute(recordingUpdate());
+
+        ASSERT_EQ(5u, updatedScenes.size());
+        EXPECT_TRUE(updatedBefore(provider1, consumer));
+        EXPECT_TRUE(updatedBefore(provider2, consumer));
+        EXPECT_TRUE(updatedBefore(consumer, consumerOfConsumer));
+    }
+}
+
+TEST_P(ASceneUpdateScheduler, updatesIndependentScenesConcurrentlyWhenHavingWorkerThreads)
+{
+    if (GetParam() < 2u)
+        return;
+
+    // every scene waits (up to a timeout) until another scene is being updated at the same time
+    std::atomic<UInt32> scenesRunning{ 0u };
+    std::atomic<UInt32> maxScenesRunning{ 0u };
+    scheduler.addScene(SceneId(1u));
+    scheduler.addScene(SceneId(2u));
+    scheduler.execute([&](SceneId)
+    {
+        const UInt32 running = ++scenesRunning;
+        UInt32 maxRunning = maxScenesRunning;
+        while (running > maxRunning && !maxScenesRunning.compare_exchange_weak(maxRunning, running))
+        {
+        }
+        for (int i = 0; i < 1000 && maxScenesRunning < 2u; ++i)
+            std::this_thread::sleep_for(std::chrono::milliseconds{ 1 });
+        --scenesRunning;
+    });
+
+    EXPECT_EQ(2u, maxScenesRunning);
+}
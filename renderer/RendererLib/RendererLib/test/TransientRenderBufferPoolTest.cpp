@@ -0,0 +1,83 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2020 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "renderer_common_gmock_header.h"
+#include "gtest/gtest.h"
+#include "RendererLib/TransientRenderBufferPool.h"
+
+using namespace testing;
+using namespace ramses_internal;
+
+class ATransientRenderBufferPool : public ::testing::Test
+{
+protected:
+    const RenderBuffer depthBuffer{ 800u, 600u, ERenderBufferType_DepthBuffer, ETextureFormat::Depth24, ERenderBufferAccessMode_WriteOnly, 0u };
+    const DeviceResourceHandle deviceHandle{ 11u };
+    const UInt32 byteSize = 800u * 600u * 3u;
+    TransientRenderBufferPool pool;
+};
+
+TEST_F(ATransientRenderBufferPool, hasNoStorageInitially)
+{
+    EXPECT_FALSE(pool.acquire(depthBuffer, 1u).isValid());
+    EXPECT_FALSE(pool.contains(deviceHandle));
+    EXPECT_EQ(0u, pool.getSavedMemory());
+}
+
+TEST_F(ATransientRenderBufferPool, sharesStorageBetweenOwners)
+{
+    pool.add(depthBuffer, deviceHandle, byteSize, 1u);
+    EXPECT_TRUE(pool.contains(deviceHandle));
+    EXPECT_EQ(0u, pool.getSavedMemory());
+
+    EXPECT_EQ(deviceHandle, pool.acquire(depthBuffer, 2u));
+    EXPECT_EQ(deviceHandle, pool.acquire(depthBuffer, 3u));
+    EXPECT_EQ(3u, pool.getUserCount(deviceHandle));
+    EXPECT_EQ(byteSize, pool.getByteSize(deviceHandle));
+    EXPECT_EQ(2u * byteSize, pool.getSavedMemory());
+}
+
+TEST_F(ATransientRenderBufferPool, neverSharesStorageWithSameOwner)
+{
+    pool.add(depthBuffer, deviceHandle, byteSize, 1u);
+    EXPECT_FALSE(pool.acquire(depthBuffer, 1u).isValid());
+    EXPECT_EQ(1u, pool.getUserCount(deviceHandle));
+}
+
+TEST_F(ATransientRenderBufferPool, sharesStorageOnlyForSameBufferProperties)
+{
+    pool.add(depthBuffer, deviceHandle, byteSize, 1u);
+
+    RenderBuffer otherBuffer = depthBuffer;
+    otherBuffer.width = 640u;
+    EXPECT_FALSE(pool.acquire(otherBuffer, 2u).isValid());
+    otherBuffer = depthBuffer;
+    otherBuffer.format = ETextureFormat::Depth24_Stencil8;
+    EXPECT_FALSE(pool.acquire(otherBuffer, 2u).isValid());
+    otherBuffer = depthBuffer;
+    otherBuffer.sampleCount = 4u;
+    EXPECT_FALSE(pool.acquire(otherBuffer, 2u).isValid());
+}
+
+TEST_F(ATransientRenderBufferPool, storageCanBeDeletedWhenLastUserReleasesIt)
+{
+    pool.add(depthBuffer, deviceHandle, byteSize, 1u);
+    pool.acquire(depthBuffer, 2u);
+
+    EXPECT_FALSE(pool.release(deviceHandle, 1u));
+    EXPECT_TRUE(pool.contains(deviceHandle));
+    EXPECT_EQ(0u, pool.getSavedMemory());
+
+    // released owner can use storage again
+    EXPECT_EQ(deviceHandle, pool.acquire(depthBuffer, 1u));
+    EXPECT_FALSE(pool.release(deviceHandle, 1u));
+
+    EXPECT_TRUE(pool.release(deviceHandle, 2u));
+    EXPECT_FALSE(pool.contains(deviceHandle));
+    EXPECT_FALSE(pool.acquire(depthBuffer, 1u).isValid());
+}
@@ -0,0 +1,101 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2020 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "renderer_common_gmock_header.h"
+#include "gtest/gtest.h"
+#include "RendererLib/TransientRenderBufferUtils.h"
+#include "Scene/Scene.h"
+
+using namespace testing;
+using namespace ramses_internal;
+
+class ATransientRenderBufferUtils : public ::testing::Test
+{
+public:
+    ATransientRenderBufferUtils()
+    {
+        colorBuffer = scene.allocateRenderBuffer({ 16u, 16u, ERenderBufferType_ColorBuffer, ETextureFormat::RGBA8, ERenderBufferAccessMode_WriteOnly, 0u });
+        depthBuffer = scene.allocateRenderBuffer({ 16u, 16u, ERenderBufferType_DepthStencilBuffer, ETextureFormat::Depth24_Stencil8, ERenderBufferAccessMode_WriteOnly, 0u });
+        renderTarget = scene.allocateRenderTarget();
+        scene.addRenderTargetRenderBuffer(renderTarget, colorBuffer);
+        scene.addRenderTargetRenderBuffer(renderTarget, depthBuffer);
+        renderPass = scene.allocateRenderPass();
+        scene.setRenderPassRenderTarget(renderPass, renderTarget);
+    }
+
+protected:
+    RenderBufferHandleVector getTransientBuffers() const
+    {
+        RenderBufferHandleVector transientBuffers;
+        TransientRenderBufferUtils::GetTransientRenderBuffers(scene, transientBuffers);
+        return transientBuffers;
+    }
+
+    Scene scene;
+    RenderBufferHandle colorBuffer;
+    RenderBufferHandle depthBuffer;
+    RenderTargetHandle renderTarget;
+    RenderPassHandle renderPass;
+};
+
+TEST_F(ATransientRenderBufferUtils, findsWriteOnlyBuffersClearedByFirstRenderPass)
+{
+    EXPECT_TRUE(TransientRenderBufferUtils::HasWriteOnlyRenderBuffers(scene));
+    EXPECT_EQ(RenderBufferHandleVector({ colorBuffer, depthBuffer }), getTransientBuffers());
+}
+
+TEST_F(ATransientRenderBufferUtils, ignoresReadWriteBuffers)
+{
+    scene.allocateRenderBuffer({ 16u, 16u, ERenderBufferType_ColorBuffer, ETextureFormat::RGBA8, ERenderBufferAccessMode_ReadWrite, 0u });
+    EXPECT_EQ(RenderBufferHandleVector({ colorBuffer, depthBuffer }), getTransientBuffers());
+
+    Scene otherScene;
+    otherScene.allocateRenderBuffer({ 16u, 16u, ERenderBufferType_ColorBuffer, ETextureFormat::RGBA8, ERenderBufferAccessMode_ReadWrite, 0u });
+    EXPECT_FALSE(TransientRenderBufferUtils::HasWriteOnlyRenderBuffers(otherScene));
+}
+
+TEST_F(ATransientRenderBufferUtils, excludesBuffersNotClearedByFirstRenderPass)
+{
+    scene.setRenderPassClearFlag(renderPass, EClearFlags_Color | EClearFlags_Depth);
+    EXPECT_EQ(RenderBufferHandleVector({ colorBuffer }), getTransientBuffers());
+
+    scene.setRenderPassClearFlag(renderPass, EClearFlags_All);
+    const RenderPassHandle firstPass = scene.allocateRenderPass();
+    scene.setRenderPassRenderTarget(firstPass, renderTarget);
+    scene.setRenderPassRenderOrder(firstPass, -1);
+    scene.setRenderPassClearFlag(firstPass, EClearFlags_Depth | EClearFlags_Stencil);
+    EXPECT_EQ(RenderBufferHandleVector({ depthBuffer }), getTransientBuffers());
+
+    // disabled pass is not rendered
+    scene.setRenderPassEnabled(firstPass, false);
+    EXPECT_EQ(RenderBufferHandleVector({ colorBuffer, depthBuffer }), getTransientBuffers());
+}
+
+TEST_F(ATransientRenderBufferUtils, requiresAllFirstRenderPassesWithSameRenderOrderToClear)
+{
+    const RenderPassHandle otherPass = scene.allocateRenderPass();
+    scene.setRenderPassRenderTarget(otherPass, renderTarget);
+    scene.setRenderPassClearFlag(otherPass, EClearFlags_None);
+    EXPECT_TRUE(getTransientBuffers().empty());
+
+    scene.setRenderPassRenderOrder(otherPass, 1);
+    EXPECT_EQ(RenderBufferHandleVector({ colorBuffer, depthBuffer }), getTransientBuffers());
+}
+
+TEST_F(ATransientRenderBufferUtils, excludesBuffersOfRenderTargetRenderedOnce)
+{
+    scene.setRenderPassRenderOnce(renderPass, true);
+    EXPECT_TRUE(getTransientBuffers().empty());
+}
+
+TEST_F(ATransientRenderBufferUtils, excludesBuffersUsedInBlitPass)
+{
+    const RenderBufferHandle blitDestination = scene.allocateRenderBuffer({ 16u, 16u, ERenderBufferType_ColorBuffer, ETextureFormat::RGBA8, ERenderBufferAccessMode_WriteOnly, 0u });
+    scene.allocateBlitPass(colorBuffer, blitDestination);
+    EXPECT_EQ(RenderBufferHandleVector({ depthBuffer }), getTransientBuffers());
+}
@@ -13,6 +13,7 @@
 #include "gmock/gmock.h"
 #include "RendererAPI/IContext.h"
 #include "Platform_Base/DeviceResourceMapper.h"
+#include "SceneAPI/Viewport.h"
 
 
 namespace ramses_internal
@@ -28,6 +29,9 @@ namespace ramses_internal
         MOCK_METHOD(bool,  swapBuffers, (), (override));
         MOCK_METHOD(bool,  enable, (), (override));
         MOCK_METHOD(bool,  disable, (), (override));
+        MOCK_METHOD(UInt32, getBufferAge, (), (const, override));
+        MOCK_METHOD(bool,  setDamageRegion, (const Viewport&), (override));
+        MOCK_METHOD(bool,  swapBuffersWithDamage, (const Viewport&), (override));
 
         MOCK_METHOD(DeviceResourceMapper&, getResources, (), (override));
         MOCK_METHOD(void*, getProcAddress, (const Char*), (const, override));
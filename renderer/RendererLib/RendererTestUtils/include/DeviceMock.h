@@ -79,6 +79,8 @@ namespace ramses_internal
         MOCK_METHOD(Bool, getBinaryShader, (DeviceResourceHandle, UInt8Vector&, BinaryShaderFormatID&), (override));
         MOCK_METHOD(void, deleteShader, (DeviceResourceHandle), (override));
         MOCK_METHOD(void, activateShader, (DeviceResourceHandle), (override));
+        MOCK_METHOD(DeviceResourceHandle, startShaderUpload, (const EffectResource&), (override));
+        MOCK_METHOD(EShaderUploadStatus, getShaderUploadStatus, (DeviceResourceHandle), (override));
 
         MOCK_METHOD(DeviceResourceHandle, allocateTexture2D, (UInt32 width, UInt32 height, ETextureFormat textureFormat, const TextureSwizzleArray& swizzle, UInt32 mipLevelCount, UInt32 totalSizeInBytes), (override));
         MOCK_METHOD(DeviceResourceHandle, allocateTexture3D, (UInt32 width, UInt32 height, UInt32 depth, ETextureFormat textureFormat, UInt32 mipLevelCount, UInt32 totalSizeInBytes), (override));
@@ -107,6 +109,13 @@ namespace ramses_internal
 
         MOCK_METHOD(void, readPixels, (UInt8*, UInt32, UInt32, UInt32, UInt32), (override));
 
+        MOCK_METHOD(Bool, isGpuTimerQuerySupported, (), (const, override));
+        MOCK_METHOD(DeviceResourceHandle, allocateGpuTimerQuery, (), (override));
+        MOCK_METHOD(void, deleteGpuTimerQuery, (DeviceResourceHandle), (override));
+        MOCK_METHOD(void, issueGpuTimestamp, (DeviceResourceHandle), (override));
+        MOCK_METHOD(Bool, getGpuTimestamp, (DeviceResourceHandle, UInt64&), (override));
+        MOCK_METHOD(Bool, checkAndResetGpuTimerDisjoint, (), (override));
+
         MOCK_METHOD(UInt32, getTotalGpuMemoryUsageInKB, (), (const, override));
         MOCK_METHOD(UInt32, getDrawCallCount, (), (const, override));
         MOCK_METHOD(void, resetDrawCallCount, (), (override));
@@ -18,6 +18,7 @@
 #include "RendererLib/WarpingMeshData.h"
 #include "RendererLib/RendererLogContext.h"
 #include "RendererAPI/IEmbeddedCompositingManager.h"
+#include "RendererLib/GpuTimerQueries.h"
 
 namespace ramses_internal{
 
@@ -34,7 +35,10 @@ public:
     MOCK_METHOD(bool, canRenderNewFrame, (), (const, override));
     MOCK_METHOD(void, enableContext, (), (override));
     MOCK_METHOD(void, swapBuffers, (), (override));
+    MOCK_METHOD(void, swapBuffersWithDamage, (const Viewport&), (override));
     MOCK_METHOD(void, clearBuffer, (DeviceResourceHandle, const Vector4&), (override));
+    MOCK_METHOD(UInt32, getDisplayBufferAge, (), (const, override));
+    MOCK_METHOD(void, setDisplayBufferRepaintRegion, (const Viewport&), (override));
     MOCK_METHOD(SceneRenderExecutionIterator, renderScene, (const RendererCachedScene&, DeviceResourceHandle, const Viewport&, const SceneRenderExecutionIterator&, const FrameTimer*), (override));
     MOCK_METHOD(void, executePostProcessing, (), (override));
     MOCK_METHOD(DeviceResourceHandle, getDisplayBuffer, (), (const, override));
@@ -46,6 +50,7 @@ public:
     MOCK_METHOD(IRenderBackend&, getRenderBackend, (), (const, override));
     MOCK_METHOD(IEmbeddedCompositingManager&, getEmbeddedCompositingManager, (), (override));
     MOCK_METHOD(void, validateRenderingStatusHealthy, (), (const, override));
+    MOCK_METHOD(void, collectGpuTimings, (GpuTimings&), (override));
 };
 }
 #endif
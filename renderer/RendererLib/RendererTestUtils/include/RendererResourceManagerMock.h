@@ -43,6 +43,7 @@ public:
     MOCK_METHOD(EResourceType, getResourceType, (const ResourceContentHash& hash), (const, override));
     MOCK_METHOD(void, referenceResourcesForScene, (SceneId sceneId, const ResourceContentHashVector& resources), (override));
     MOCK_METHOD(void, unreferenceResourcesForScene, (SceneId sceneId, const ResourceContentHashVector& resources), (override));
+    MOCK_METHOD(Bool, updateTransientRenderBuffers, (const IScene& scene, const RenderBufferHandleVector& transientBuffers), (override));
     MOCK_METHOD(void, unloadAllSceneResourcesForScene, (SceneId sceneId), (override));
     MOCK_METHOD(void, unreferenceAllResourcesForScene, (SceneId sceneId), (override));
     MOCK_METHOD(const ResourceContentHashVector*, getResourcesInUseByScene, (SceneId sceneId), (const, override));
@@ -24,6 +24,7 @@ namespace ramses_internal
 
         MOCK_METHOD(DeviceResourceHandle, uploadResource, (IRenderBackend&, const ResourceDescriptor&, UInt32&), (override));
         MOCK_METHOD(void, unloadResource, (IRenderBackend&, EResourceType, ResourceContentHash, DeviceResourceHandle), (override));
+        MOCK_METHOD(EShaderUploadStatus, getEffectUploadStatus, (IRenderBackend&, ResourceContentHash, DeviceResourceHandle), (override));
 
         static const DeviceResourceHandle FakeResourceDeviceHandle;
     };
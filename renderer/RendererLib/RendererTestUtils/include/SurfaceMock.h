@@ -28,6 +28,9 @@ namespace ramses_internal
         MOCK_METHOD(Bool, enable, (), (override));
         MOCK_METHOD(Bool, disable, (), (override));
         MOCK_METHOD(ramses_internal::Bool, swapBuffers, (), (override));
+        MOCK_METHOD(Bool, swapBuffersWithDamage, (const Viewport&), (override));
+        MOCK_METHOD(UInt32, getBufferAge, (), (const, override));
+        MOCK_METHOD(Bool, setDamageRegion, (const Viewport&), (override));
         MOCK_METHOD(void, frameRendered, (), (override));
         MOCK_METHOD(Bool, canRenderNewFrame, (), (const, override));
 
@@ -46,12 +46,18 @@ namespace ramses_internal
         ON_CALL(*this, allocateIndexBuffer(_, _)).WillByDefault(Return(FakeIndexBufferDeviceHandle));
         ON_CALL(*this, uploadShader(_)).WillByDefault(Return(FakeShaderDeviceHandle));
         ON_CALL(*this, uploadBinaryShader(_, _, _, _)).WillByDefault(Return(FakeShaderDeviceHandle));
+        ON_CALL(*this, startShaderUpload(_)).WillByDefault(Return(FakeShaderDeviceHandle));
+        ON_CALL(*this, getShaderUploadStatus(_)).WillByDefault(Return(EShaderUploadStatus::Uploaded));
         ON_CALL(*this, allocateTexture2D(_, _, _, _, _, _)).WillByDefault(Return(FakeTextureDeviceHandle));
         ON_CALL(*this, uploadRenderBuffer(_)).WillByDefault(Return(FakeRenderBufferDeviceHandle));
         ON_CALL(*this, uploadTextureSampler(_,_,_,_,_,_)).WillByDefault(Return(FakeTextureSamplerDeviceHandle));
         ON_CALL(*this, uploadRenderTarget(_)).WillByDefault(Return(FakeRenderTargetDeviceHandle));
         ON_CALL(*this, getFramebufferRenderTarget()).WillByDefault(Return(FakeFrameBufferRenderTargetDeviceHandle));
 
+        // GPU timings are not collected unless a test enables timer query support
+        EXPECT_CALL(*this, isGpuTimerQuerySupported()).Times(AnyNumber());
+        ON_CALL(*this, isGpuTimerQuerySupported()).WillByDefault(Return(false));
+
         EXPECT_CALL(*this, getSupportedBinaryProgramFormats(_)).Times(AnyNumber());
         ON_CALL(*this, getSupportedBinaryProgramFormats(_)).WillByDefault(Invoke([](auto& formats) { formats = { FakeSupportedBinaryShaderFormat }; }));
     }
@@ -20,6 +20,7 @@ DisplayControllerMock::DisplayControllerMock()
     ON_CALL(*this, getDisplayWidth()).WillByDefault(Return(WindowMock::FakeWidth));
     ON_CALL(*this, getDisplayHeight()).WillByDefault(Return(WindowMock::FakeHeight));
     ON_CALL(*this, renderScene(_, _, _, _, _)).WillByDefault(Return(SceneRenderExecutionIterator()));
+    EXPECT_CALL(*this, collectGpuTimings(_)).Times(AnyNumber());
 }
 
 DisplayControllerMock::~DisplayControllerMock()
@@ -57,7 +57,7 @@ void RendererMockWithMockDisplay<MOCK_TYPE>::createDisplayContext(const DisplayC
     ON_CALL(*displayController, getRenderBackend()).WillByDefault(ReturnRef(*renderBackend));
     ON_CALL(*displayController, getEmbeddedCompositingManager()).WillByDefault(ReturnRef(*embeddedCompositingManager));
 
-    Renderer::addDisplayController(*displayController, displayHandle);
+    Renderer::addDisplayController(*displayController, displayHandle, displayConfig.isPartialFramebufferUpdateEnabled());
     EXPECT_TRUE(hasDisplayController(displayHandle));
 
     DisplayMockInfo<MOCK_TYPE> displayMock;
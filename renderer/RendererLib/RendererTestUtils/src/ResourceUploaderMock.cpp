@@ -17,6 +17,12 @@ namespace ramses_internal
 
     ResourceUploaderMock::ResourceUploaderMock()
     {
-        ON_CALL(*this, uploadResource(_, _, _)).WillByDefault(Return(FakeResourceDeviceHandle));
+        ON_CALL(*this, uploadResource(_, _, _)).WillByDefault(Invoke([](IRenderBackend&, const ResourceDescriptor& rd, UInt32& vramSize)
+        {
+            vramSize = rd.decompressedSize;
+            return FakeResourceDeviceHandle;
+        }));
+        EXPECT_CALL(*this, getEffectUploadStatus(_, _, _)).Times(AnyNumber());
+        ON_CALL(*this, getEffectUploadStatus(_, _, _)).WillByDefault(Return(EShaderUploadStatus::Uploaded));
     }
 };
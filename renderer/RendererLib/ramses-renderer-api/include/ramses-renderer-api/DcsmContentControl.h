@@ -103,6 +103,42 @@ namespace ramses
         */
         status_t requestContentReady(ContentID contentID, uint64_t timeOut);
 
+        /** @brief Declares the provided content as likely to be shown next so that its data is loaded in background.
+        * @details The content's scene is subscribed, mapped to the display defined in its category and its resources are uploaded
+        *          the same way as when requesting the content ready, but without any Dcsm message sent to content provider.
+        *          The content stays available and no event/callback is emitted for preloading. When the content is requested ready
+        *          later on, it only has to wait for the content provider and showing it afterwards takes effect within a frame.
+        *          Preloaded contents occupy renderer memory, therefore only a limited number of contents is kept preloaded,
+        *          see #ramses::DcsmContentControl::setContentPreloadLimit. When the limit is exceeded the content which was preloaded
+        *          least recently is unloaded again. Preloading a content again marks it as the most recently preloaded one.
+        *          Requesting the content ready, releasing it or canceling the preload ends the preload.
+        *          This call will fail right away (check return status) if the content is not known.
+        *
+        * @param contentID Content to preload.
+        * @return StatusOK for success, otherwise the returned status can be used
+        *         to resolve error message using getStatusMessage().
+        */
+        status_t preloadContent(ContentID contentID);
+
+        /** @brief Unloads a content preloaded using #ramses::DcsmContentControl::preloadContent.
+        * @details This call will fail right away (check return status) if the content is not preloaded.
+        *
+        * @param contentID Content to cancel preload for.
+        * @return StatusOK for success, otherwise the returned status can be used
+        *         to resolve error message using getStatusMessage().
+        */
+        status_t cancelContentPreload(ContentID contentID);
+
+        /** @brief Sets the maximum number of contents kept preloaded, see #ramses::DcsmContentControl::preloadContent.
+        * @details Least recently preloaded contents are unloaded right away if more contents are preloaded than the new limit allows.
+        *          Default limit is 1, a limit of 0 disables preloading.
+        *
+        * @param maxPreloadedContents Maximum number of contents preloaded at the same time.
+        * @return StatusOK for success, otherwise the returned status can be used
+        *         to resolve error message using getStatusMessage().
+        */
+        status_t setContentPreloadLimit(uint32_t maxPreloadedContents);
+
         /** @brief Shows the content. The content must be ready to be shown - see #ramses::DcsmContentControl::requestContentReady.
         * @details This involves a corresponding Dcsm message sent to content provider and also starts content's scene rendering.
         *          This call will fail right away (check return status) if transition is not valid (e.g. content is not ready).
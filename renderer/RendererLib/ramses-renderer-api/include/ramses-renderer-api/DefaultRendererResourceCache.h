@@ -85,12 +85,18 @@ namespace ramses
 
         /**
         * @brief Save current content of the cache to a file.
+        *        If the cache was loaded from the same file, resources stored since then were already appended
+        *        to it and the file is only rewritten if it contains resources which were removed from the cache.
         * @param filePath The file path to save to.
         */
         void saveToFile(const char* filePath) const;
 
         /**
-        * @brief Load all content from a file. It is assumed that the file has been created using saveToFile(...).
+        * @brief Load content from a file. It is assumed that the file has been created using saveToFile(...).
+        *        The file is mapped into memory and resource data is read from it only when requested,
+        *        therefore the file must not be modified by others while used by the cache.
+        *        Resources stored after loading are appended to the file.
+        *        If the file is truncated or corrupted at its end, all complete entries before are still loaded.
         * @param filePath The file path to load from.
         * @return true if the load was successful.
         */
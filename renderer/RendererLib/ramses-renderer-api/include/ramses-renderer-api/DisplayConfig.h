@@ -224,18 +224,38 @@ namespace ramses
         */
         status_t keepEffectsUploaded(bool enable);
 
+        /**
+        * @brief Enables partial update of the display framebuffer. Instead of repainting the whole
+        *        framebuffer whenever any scene shown on it changes, only the region covered by
+        *        viewports of the scenes which changed is cleared and re-rendered, the rest of the
+        *        framebuffer content is kept. This requires the platform to report the age of the
+        *        back buffer content (EGL_EXT_buffer_age), if not available or if warping is enabled
+        *        the display falls back to full repaint. If supported, the changed region is also passed
+        *        to the platform when presenting (EGL_KHR_swap_buffers_with_damage, EGL_KHR_partial_update).
+        *        Note that content rendered by a scene has to stay within viewports of its cameras
+        *        used for rendering to framebuffer, otherwise it might not be updated properly.
+        *        Disabled by default.
+        *
+        * @param[in] enable Set to true to repaint only changed regions of framebuffer
+        * @return StatusOK on success, otherwise the returned status can be used
+        *         to resolve error message using getStatusMessage().
+        */
+        status_t enablePartialFramebufferUpdate(bool enable);
+
         /**
         * @brief Set the amount of GPU memory in bytes that will be used as cache for resources.
         *        Uploaded resources are kept in GPU memory even if not in use by any scene anymore.
         *        They are only freed from memory in order to make space for new resources to be uploaded
         *        which would not fit in the cache otherwise.
-        *        First in first out method is used when deciding which unused resource to remove from cache.
+        *        Least recently used unused resource is removed from cache first, regardless of which scene used it.
+        *        Resources are accounted with their estimated GPU memory footprint (eg. including texture mip chains).
         *
         *        Note that the cache size does not act as hard limit, the renderer can still upload
         *        resources taking up more space. As long as cache limit is exceeded, newly unused resources are unloaded
         *        immediately.
         *
-        *        Only client resources are considered for this cache, not scene resources (eg. render targets/render buffers).
+        *        Only client resources can be removed from cache, however the memory used by render buffers
+        *        and offscreen buffers is counted against the cache size as well.
         *        Cache is disabled by default (size is 0).
         *
         * @param[in] size GPU resource cache size in bytes. Disabled if 0 (default)
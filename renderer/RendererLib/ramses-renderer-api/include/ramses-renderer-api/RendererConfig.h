@@ -227,6 +227,47 @@ namespace ramses
         */
         std::chrono::milliseconds getRenderThreadLoopTimingReportingPeriod() const;
 
+        /**
+        * @brief Set the number of worker threads used to update scenes every frame
+        *        Scenes which are not linked to each other have their animations, transformations
+        *        and resource caches updated concurrently, linked scenes are updated provider before consumer.
+        *        A value of zero updates all scenes on the render thread and is the default.
+        *
+        * @param[in] threadCount Number of worker threads
+        * @return StatusOK on success, otherwise the returned status can be used
+        *         to resolve error message using getStatusMessage().
+        */
+        status_t setSceneUpdateThreadCount(uint32_t threadCount);
+
+        /**
+        * @brief Get the number of worker threads used to update scenes
+        *
+        * @return Number of scene update worker threads
+        */
+        uint32_t getSceneUpdateThreadCount() const;
+
+        /**
+        * @brief Enable or disable deadline driven frame scheduling of the renderer thread
+        *        Instead of sleeping the remainder of the frame after rendering, the renderer thread
+        *        plans every frame to start as late as possible before its presentation deadline
+        *        (given by maximum framerate) and wakes up earlier when flushes for shown scenes arrive.
+        *        This reduces the latency between flush and its presentation without raising the framerate.
+        *        Latency between arrival of flush and swap is reported in renderer statistics log.
+        *        Disabled by default. Only has effect when renderer runs in its own thread.
+        *
+        * @param[in] enable Enable deadline driven frame scheduling if true, disable otherwise
+        * @return StatusOK on success, otherwise the returned status can be used
+        *         to resolve error message using getStatusMessage().
+        */
+        status_t enableDeadlineFrameScheduling(bool enable);
+
+        /**
+        * @brief Get whether deadline driven frame scheduling is enabled
+        *
+        * @return True if deadline driven frame scheduling is enabled
+        */
+        bool isDeadlineFrameSchedulingEnabled() const;
+
         /**
         * Stores internal data for implementation specifics of RendererConfig.
         */
@@ -37,6 +37,9 @@ namespace ramses
         status_t addContentCategory(Category category, displayId_t display, const CategoryInfoUpdate& categoryInformation);
         status_t removeContentCategory(Category category);
         status_t requestContentReady(ContentID contentID, uint64_t timeOut);
+        status_t preloadContent(ContentID contentID);
+        status_t cancelContentPreload(ContentID contentID);
+        status_t setContentPreloadLimit(uint32_t maxPreloadedContents);
         status_t showContent(ContentID contentID, AnimationInformation timingInfo);
         status_t hideContent(ContentID contentID, AnimationInformation timingInfo);
         status_t releaseContent(ContentID contentID, AnimationInformation timingInfo);
@@ -87,6 +90,9 @@ namespace ramses
         void scheduleSceneStateChange(ContentID contentThatTrigerredChange, RendererSceneState sceneState, uint64_t ts);
         ContentState getCurrentState(ContentID contentID) const;
         void processTimedOutRequests();
+        bool isContentPreloaded(ContentID contentID) const;
+        void endContentPreload(ContentID contentID);
+        void enforceContentPreloadLimit();
 
         sceneId_t findSceneAssociatedWithContent(ContentID contentID) const;
         std::vector<ContentID> findContentsAssociatingScene(sceneId_t sceneId) const;
@@ -124,6 +130,10 @@ namespace ramses
         };
         std::vector<OfferedContents> m_offeredContentsForOtherCategories;
 
+        // contents whose scene is made ready without Dcsm ready request, least recently preloaded first
+        std::vector<ContentID> m_preloadedContents;
+        uint32_t m_maxPreloadedContents = 1u;
+
         struct SceneInfo
         {
             SharedSceneState sharedState;
@@ -13,13 +13,18 @@
 #include "RendererAPI/Types.h"
 #include "ramses-renderer-api/Types.h"
 #include "ramses-renderer-api/IRendererResourceCache.h"
-#include <deque>
+#include "Utils/MemoryMappedFile.h"
+#include <list>
+#include <unordered_map>
 #include <memory>
+#include <string>
 
 namespace ramses
 {
-    class IDataFunctor;
-
+    // Cache file consists of file header followed by entries, each entry is an entry header directly followed by its data.
+    // Loading the file only maps it into memory and builds an index of the entries, data is read on demand.
+    // Entries stored after loading are kept in memory and appended to the loaded file on save, whole file is only rewritten
+    // on save if the file content got outdated (eg. entries were removed from cache or file had a corrupted tail).
     class DefaultRendererResourceCacheImpl : public IRendererResourceCache
     {
     public:
@@ -36,33 +41,82 @@ namespace ramses
 
         struct FileHeader
         {
-            uint32_t fileSize;
+            uint32_t magic;
+            uint32_t formatVersion;
             uint32_t transportVersion;
             uint32_t checksum;
         };
 
-    private:
+        struct EntryHeader
+        {
+            uint64_t resourceIdLowPart;
+            uint64_t resourceIdHighPart;
+            uint32_t dataSize;
+            uint32_t dataChecksum;
+            uint32_t checksum;
+            uint32_t reserved;
+        };
 
-        typedef std::vector<uint8_t> ByteVector;
+        static const uint32_t FileMagic = 0x46435252u; // "RRCF"
+        static const uint32_t FileFormatVersion = 2u;
 
-        bool storeResourceInternal(rendererResourceId_t resourceId, ByteVector& data);
-        void clear();
-        void makeSpaceForNewItem(uint32_t newItemSizeInBytes);
-        void removeOldestItem();
+    private:
 
-        void iterateDataToSave(IDataFunctor& functor) const;
+        typedef std::vector<uint8_t> ByteVector;
 
         struct ResourceData
         {
             rendererResourceId_t resourceId;
-            ByteVector data;
+            uint32_t dataSize = 0u;
+            uint32_t dataChecksum = 0u;
+            // data loaded from file is verified only when used
+            bool loadedFromFile = false;
+            // entry is part of the loaded cache file (loaded from it or appended on save)
+            mutable bool inFile = false;
+            // points into mapped cache file for entries loaded from file, otherwise data is owned by entry,
+            // mutable as mapping must be released when replacing cache file on platforms not supporting replacing mapped files
+            mutable const uint8_t* mappedData = nullptr;
+            mutable ByteVector data;
         };
 
-        using ResourceDataTable = std::deque<ResourceData>;
+        struct ResourceIdHash
+        {
+            size_t operator()(const rendererResourceId_t& id) const
+            {
+                // resource ids are content hashes, low part is distributed well enough
+                return static_cast<size_t>(id.lowPart);
+            }
+        };
+
+        // ordered from oldest to newest
+        using ResourceDataList = std::list<ResourceData>;
+        using ResourceDataIndex = std::unordered_map<rendererResourceId_t, ResourceDataList::iterator, ResourceIdHash>;
+
+        bool storeResourceInternal(ResourceData&& resourceData);
+        void clear();
+        void makeSpaceForNewItem(uint32_t newItemSizeInBytes);
+        void removeOldestItem();
+
+        bool loadIndexFromMappedFile();
+        bool appendToFile() const;
+        bool writeToFile(const std::string& filePath) const;
+        void releaseMappedFile() const;
 
-        ResourceDataTable m_resourceData;
+        static EntryHeader CreateEntryHeader(const ResourceData& resourceData);
+        static const uint8_t* GetData(const ResourceData& resourceData);
+
+        ResourceDataList m_resourceData;
+        ResourceDataIndex m_resourceIndex;
         uint32_t m_maxCacheSizeInBytes;
         uint32_t m_currentCacheSizeInBytes;
+
+        // file the cache was loaded from, entries stored afterwards are appended to it on save
+        std::string m_filePath;
+        mutable std::unique_ptr<ramses_internal::MemoryMappedFile> m_mappedFile;
+        // size of valid content of cache file, ie. where next entry will be appended
+        mutable uint64_t m_fileSize = 0u;
+        // set if file contains entries not in cache anymore or misses some, whole file is rewritten on save then
+        mutable bool m_fileOutdated = false;
     };
 }
 
@@ -41,6 +41,7 @@ namespace ramses
         status_t setWindowIviVisible(bool visible);
         status_t setResizable(bool resizable);
         status_t keepEffectsUploaded(bool enable);
+        status_t enablePartialFramebufferUpdate(bool enable);
         status_t setGPUMemoryCacheSize(uint64_t size);
         status_t setClearColor(float red, float green, float blue, float alpha);
         status_t setOffscreen(bool offscreenFlag);
@@ -53,6 +53,12 @@ namespace ramses
         status_t setRenderThreadLoopTimingReportingPeriod(std::chrono::milliseconds period);
         std::chrono::milliseconds getRenderThreadLoopTimingReportingPeriod() const;
 
+        status_t setSceneUpdateThreadCount(uint32_t threadCount);
+        uint32_t getSceneUpdateThreadCount() const;
+
+        status_t enableDeadlineFrameScheduling(bool enable);
+        bool isDeadlineFrameSchedulingEnabled() const;
+
         //impl methods
         const ramses_internal::RendererConfig& getInternalRendererConfig() const;
 
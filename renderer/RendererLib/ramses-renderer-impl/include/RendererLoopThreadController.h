@@ -10,19 +10,23 @@
 #define RAMSES_RENDERERLOOPTHREADCONTROLLER_H
 
 #include "RendererAPI/ELoopMode.h"
+#include "RendererLib/FrameDeadlineScheduler.h"
+#include "SceneAPI/SceneId.h"
 #include "PlatformAbstraction/PlatformThread.h"
 #include <mutex>
 #include <condition_variable>
+#include <vector>
 
 namespace ramses_internal
 {
     class PlatformWatchdog;
     class WindowedRenderer;
+    class RendererCommandBuffer;
 
     class RendererLoopThreadController : public Runnable
     {
     public:
-        RendererLoopThreadController(WindowedRenderer& windowedRenderer, PlatformWatchdog& watchdog, std::chrono::milliseconds loopCountPeriod);
+        RendererLoopThreadController(WindowedRenderer& windowedRenderer, PlatformWatchdog& watchdog, std::chrono::milliseconds loopCountPeriod, Bool deadlineFrameScheduling = false);
         ~RendererLoopThreadController();
 
         Bool startRendering();
@@ -37,11 +41,28 @@ namespace ramses_internal
     private:
         virtual void run() override;
 
+        // returns loop end time
+        UInt64 renderFrame(ELoopMode loopMode, std::chrono::microseconds sleepTime);
         void calculateLooptimeAverage(const std::chrono::microseconds loopDuration, const uint64_t loopEndTime);
 
         std::chrono::milliseconds sleepToControlFramerate(std::chrono::microseconds loopDuration, std::chrono::microseconds minimumFrameDuration);
 
+        // deadline frame scheduling: sleeps until planned frame start or until flush for shown scene arrives,
+        // returns false if woken up because rendering was stopped, renderer destroyed or thread cancelled
+        Bool sleepUntilFrameStart(std::chrono::microseconds& sleepTime);
+        Bool hasPendingFlushForShownScene() const;
+
+        void sceneUpdateArrived(SceneId sceneId);
+        void reportFlushArrivalToSwapLatency(UInt64 swapTime);
+
+        struct FlushArrival
+        {
+            SceneId sceneId;
+            UInt64 arrivalTime;
+        };
+
         WindowedRenderer* m_windowedRenderer;
+        RendererCommandBuffer& m_rendererCommandBuffer;
         PlatformWatchdog& m_watchdog;
         PlatformThread m_thread;
         mutable std::mutex m_lock;
@@ -57,6 +78,12 @@ namespace ramses_internal
         std::chrono::microseconds m_maximumLoopTimeInPeriod{ 0 };
         uint64_t m_numberOfLoopsInPeriod{ 0 };
         std::chrono::microseconds m_sumOfLoopTimeInPeriod{ 0 };
+
+        const Bool m_deadlineFrameScheduling;
+        FrameDeadlineScheduler m_frameDeadlineScheduler;
+        // first not yet rendered flush arrival per scene, guarded by m_lock
+        std::vector<FlushArrival> m_pendingFlushArrivals;
+        std::vector<FlushArrival> m_frameFlushArrivals;
     };
 }
 
@@ -47,6 +47,27 @@ namespace ramses
         return status;
     }
 
+    status_t DcsmContentControl::preloadContent(ContentID contentID)
+    {
+        const auto status = m_impl.preloadContent(contentID);
+        LOG_HL_RENDERER_API1(status, contentID);
+        return status;
+    }
+
+    status_t DcsmContentControl::cancelContentPreload(ContentID contentID)
+    {
+        const auto status = m_impl.cancelContentPreload(contentID);
+        LOG_HL_RENDERER_API1(status, contentID);
+        return status;
+    }
+
+    status_t DcsmContentControl::setContentPreloadLimit(uint32_t maxPreloadedContents)
+    {
+        const auto status = m_impl.setContentPreloadLimit(maxPreloadedContents);
+        LOG_HL_RENDERER_API1(status, maxPreloadedContents);
+        return status;
+    }
+
     status_t DcsmContentControl::showContent(ContentID contentID, AnimationInformation timingInfo)
     {
         const auto status = m_impl.showContent(contentID, timingInfo);
@@ -100,6 +100,8 @@ namespace ramses
         switch (currState)
         {
         case ContentState::Available:
+            // preloaded content's scene might be ready already, from now on it is kept ready by the ready request
+            endContentPreload(contentID);
             contentInfo.readyRequested = true;
             contentInfo.readyRequestTimeOut = (timeOut > 0 ? m_timeStampNow + timeOut : std::numeric_limits<uint64_t>::max());
             // send DCSM ready request
@@ -121,6 +123,62 @@ namespace ramses
         return StatusOK;
     }
 
+    status_t DcsmContentControlImpl::preloadContent(ContentID contentID)
+    {
+        LOG_INFO(ramses_internal::CONTEXT_RENDERER, "DcsmContentControl:preloadContent: content " << contentID);
+        const auto contentIt = m_contents.find(contentID);
+        if (contentIt == m_contents.cend())
+            return addErrorEntry("DcsmContentControl: cannot preload unknown content");
+
+        if (contentIt->second.contentType == ETechnicalContentType::WaylandIviSurfaceID)
+            return addErrorEntry("DcsmContentControl: Content of type WaylandIviSurfaceID can currently not be controlled with DcsmContentControl, use DcsmConsumer directly");
+
+        if (contentIt->second.readyRequested || getCurrentState(contentID) != ContentState::Available)
+        {
+            LOG_INFO(ramses_internal::CONTEXT_RENDERER, "DcsmContentControl:preloadContent: content " << contentID << " is already requested ready or ready, nothing to preload");
+            return StatusOK;
+        }
+
+        if (m_maxPreloadedContents == 0u)
+        {
+            LOG_INFO(ramses_internal::CONTEXT_RENDERER, "DcsmContentControl:preloadContent: preloading disabled by limit, ignoring preload of content " << contentID);
+            return StatusOK;
+        }
+
+        // preloading again only refreshes the content's position in eviction order
+        const auto preloadedIt = std::find(m_preloadedContents.begin(), m_preloadedContents.end(), contentID);
+        if (preloadedIt != m_preloadedContents.end())
+            m_preloadedContents.erase(preloadedIt);
+        m_preloadedContents.push_back(contentID);
+
+        // scene ready request only, content stays available until content provider is requested ready as well
+        requestSceneState(contentID, RendererSceneState::Ready);
+        enforceContentPreloadLimit();
+
+        return StatusOK;
+    }
+
+    status_t DcsmContentControlImpl::cancelContentPreload(ContentID contentID)
+    {
+        LOG_INFO(ramses_internal::CONTEXT_RENDERER, "DcsmContentControl:cancelContentPreload: content " << contentID);
+        if (!isContentPreloaded(contentID))
+            return addErrorEntry("DcsmContentControl: cannot cancel preload of content which is not preloaded");
+
+        endContentPreload(contentID);
+        requestSceneState(contentID, RendererSceneState::Available);
+
+        return StatusOK;
+    }
+
+    status_t DcsmContentControlImpl::setContentPreloadLimit(uint32_t maxPreloadedContents)
+    {
+        LOG_INFO(ramses_internal::CONTEXT_RENDERER, "DcsmContentControl:setContentPreloadLimit: " << maxPreloadedContents);
+        m_maxPreloadedContents = maxPreloadedContents;
+        enforceContentPreloadLimit();
+
+        return StatusOK;
+    }
+
     status_t DcsmContentControlImpl::showContent(ContentID contentID, AnimationInformation timingInfo)
     {
         LOG_INFO(ramses_internal::CONTEXT_RENDERER, "DcsmContentControl:showContent: content " << contentID << " timing <" << timingInfo.startTime << ";" << timingInfo.finishTime << ">");
@@ -196,6 +254,7 @@ namespace ramses
         CHECK_RETURN_ERR(m_dcsmConsumer.contentStateChange(contentID, EDcsmState::Assigned, timingInfo));
         contentIt->second.dcsmReady = false;
         contentIt->second.readyRequested = false;
+        endContentPreload(contentID);
 
         scheduleSceneStateChange(contentID, RendererSceneState::Available, timingInfo.finishTime);
         handleContentStateChange(contentID, lastState);
@@ -244,6 +303,7 @@ namespace ramses
 
         contentIt->second.dcsmReady = false;
         contentIt->second.readyRequested = false;
+        endContentPreload(contentID);
         scheduleSceneStateChange(contentID, RendererSceneState::Available, timingInfo.finishTime);
 
         Command cmd{ CommandType::RemoveContent, timingInfo.finishTime };
@@ -431,8 +491,8 @@ namespace ramses
             {
             case ETechnicalContentType::RamsesSceneID:
                 m_scenes[sceneId_t{ contentDescriptor.getValue() }].associatedContents.insert(contentID);
-                // already ready requested and just waiting for sceneid?
-                if (contentIt->second.readyRequested)
+                // already ready requested or preloaded and just waiting for sceneid?
+                if (contentIt->second.readyRequested || isContentPreloaded(contentID))
                 {
                     requestSceneState(contentID, RendererSceneState::Ready);
                 }
@@ -529,7 +589,7 @@ namespace ramses
         auto& sceneInfo = m_scenes[sceneId];
         if (sceneInfo.sharedState.getActualState() < RendererSceneState::Ready && state == RendererSceneState::Ready)
         {
-            if (std::none_of(sceneInfo.associatedContents.cbegin(), sceneInfo.associatedContents.cend(), [&](ContentID contentID) { return m_contents.find(contentID)->second.readyRequested; }))
+            if (std::none_of(sceneInfo.associatedContents.cbegin(), sceneInfo.associatedContents.cend(), [&](ContentID contentID) { return m_contents.find(contentID)->second.readyRequested || isContentPreloaded(contentID); }))
             {
                 LOG_INFO(ramses_internal::CONTEXT_RENDERER, "DcsmContentControl: scene " << sceneId << " changed state from "
                     << EnumToString(sceneInfo.sharedState.getActualState())
@@ -1049,6 +1109,7 @@ namespace ramses
     {
         LOG_INFO(ramses_internal::CONTEXT_RENDERER, "DcsmContentControl: removing content " << contentID << " and any pending commands associated with it");
         m_contents.erase(contentID);
+        endContentPreload(contentID);
         for (auto& catIt : m_categories)
             catIt.second.assignedContentIds.erase(contentID);
         for (auto& sceneIt : m_scenes)
@@ -1132,6 +1193,29 @@ namespace ramses
         }
     }
 
+    bool DcsmContentControlImpl::isContentPreloaded(ContentID contentID) const
+    {
+        return std::find(m_preloadedContents.cbegin(), m_preloadedContents.cend(), contentID) != m_preloadedContents.cend();
+    }
+
+    void DcsmContentControlImpl::endContentPreload(ContentID contentID)
+    {
+        const auto it = std::find(m_preloadedContents.begin(), m_preloadedContents.end(), contentID);
+        if (it != m_preloadedContents.end())
+            m_preloadedContents.erase(it);
+    }
+
+    void DcsmContentControlImpl::enforceContentPreloadLimit()
+    {
+        while (m_preloadedContents.size() > m_maxPreloadedContents)
+        {
+            const ContentID contentID = m_preloadedContents.front();
+            LOG_INFO(ramses_internal::CONTEXT_RENDERER, "DcsmContentControl: preload limit " << m_maxPreloadedContents << " exceeded, unloading least recently preloaded content " << contentID);
+            endContentPreload(contentID);
+            requestSceneState(contentID, RendererSceneState::Available);
+        }
+    }
+
     sceneId_t DcsmContentControlImpl::findSceneAssociatedWithContent(ContentID contentID) const
     {
         const auto sceneIt = std::find_if(m_scenes.cbegin(), m_scenes.cend(), [contentID](const auto& s)
@@ -9,55 +9,38 @@
 #include "DefaultRendererResourceCacheImpl.h"
 #include "Utils/File.h"
 #include "Utils/LogMacros.h"
-#include "Utils/BinaryFileInputStream.h"
 #include "Utils/BinaryFileOutputStream.h"
 #include "Utils/Adler32Checksum.h"
 #include "PlatformAbstraction/PlatformMemory.h"
 #include "TransportCommon/RamsesTransportProtocolVersion.h"
+#include <algorithm>
 #include <cassert>
+#include <cstddef>
 
 namespace ramses
 {
-    class IDataFunctor
-    {
-    public:
-        virtual ~IDataFunctor() {}
-        virtual void addData(const void* data, uint32_t size) = 0;
-    };
-
-    class ChecksumDataFunctor : public IDataFunctor
-    {
-    public:
-        ChecksumDataFunctor()
-            : m_totalSize(0)
-        {
-        }
-
-        virtual void addData(const void* data, uint32_t size) override
-        {
-            m_checksum.addData(reinterpret_cast<const uint8_t*>(data), size);
-            m_totalSize += size;
-        }
-
-        ramses_internal::Adler32Checksum m_checksum;
-        uint32_t                         m_totalSize;
-    };
+    static_assert(sizeof(DefaultRendererResourceCacheImpl::FileHeader) == 16u, "File header must not contain padding");
+    static_assert(sizeof(DefaultRendererResourceCacheImpl::EntryHeader) == 32u, "Entry header must not contain padding");
 
-    class SaveDataFunctor : public IDataFunctor
+    namespace
     {
-    public:
-        explicit SaveDataFunctor(ramses_internal::IOutputStream& outputStream)
-            : m_outputStream(outputStream)
+        uint32_t CalculateChecksum(const void* data, uint32_t size)
         {
+            ramses_internal::Adler32Checksum checksum;
+            checksum.addData(static_cast<const ramses_internal::Byte*>(data), size);
+            return checksum.getResult();
         }
 
-        virtual void addData(const void* data, uint32_t size) override
+        DefaultRendererResourceCacheImpl::FileHeader CreateFileHeader()
         {
-            m_outputStream.write(data, size);
+            DefaultRendererResourceCacheImpl::FileHeader header = {};
+            header.magic            = DefaultRendererResourceCacheImpl::FileMagic;
+            header.formatVersion    = DefaultRendererResourceCacheImpl::FileFormatVersion;
+            header.transportVersion = RAMSES_TRANSPORT_PROTOCOL_VERSION_MAJOR;
+            header.checksum         = CalculateChecksum(&header, offsetof(DefaultRendererResourceCacheImpl::FileHeader, checksum));
+            return header;
         }
-
-        ramses_internal::IOutputStream& m_outputStream;
-    };
+    }
 
     DefaultRendererResourceCacheImpl::DefaultRendererResourceCacheImpl(uint32_t maxCacheSizeInBytes)
         : m_maxCacheSizeInBytes(maxCacheSizeInBytes)
@@ -73,19 +56,24 @@ namespace ramses
 
     void DefaultRendererResourceCacheImpl::clear()
     {
+        m_resourceIndex.clear();
         m_resourceData.clear();
         m_currentCacheSizeInBytes = 0;
+
+        // entries pointing to mapped data are gone, file can be unmapped
+        m_mappedFile.reset();
+        m_filePath.clear();
+        m_fileSize = 0u;
+        m_fileOutdated = false;
     }
 
     bool DefaultRendererResourceCacheImpl::hasResource(rendererResourceId_t resourceId, uint32_t& size) const
     {
-        for (const auto &it : m_resourceData)
+        const auto it = m_resourceIndex.find(resourceId);
+        if (it != m_resourceIndex.cend())
         {
-            if (it.resourceId == resourceId)
-            {
-                size = static_cast<uint32_t>(it.data.size());
-                return true;
-            }
+            size = it->second->dataSize;
+            return true;
         }
 
         size = 0;
@@ -94,22 +82,30 @@ namespace ramses
 
     bool DefaultRendererResourceCacheImpl::getResourceData(rendererResourceId_t resourceId, uint8_t* buffer, uint32_t bufferSize) const
     {
-        for (const auto &it : m_resourceData)
+        const auto it = m_resourceIndex.find(resourceId);
+        if (it == m_resourceIndex.cend())
         {
-            if (it.resourceId == resourceId)
-            {
-                if (bufferSize < it.data.size())
-                {
-                    return false;
-                }
+            assert(false);
+            return false;
+        }
 
-                ramses_internal::PlatformMemory::Copy(buffer, it.data.data(), it.data.size());
-                return true;
-            }
+        const ResourceData& resourceData = *it->second;
+        if (bufferSize < resourceData.dataSize)
+        {
+            return false;
         }
 
-        assert(false);
-        return false;
+        ramses_internal::PlatformMemory::Copy(buffer, GetData(resourceData), resourceData.dataSize);
+
+        // data from file is verified only when actually used
+        if (resourceData.loadedFromFile && CalculateChecksum(buffer, resourceData.dataSize) != resourceData.dataChecksum)
+        {
+            LOG_WARN(ramses_internal::CONTEXT_RENDERER, "DefaultRendererResourceCacheImpl::getResourceData: Checksum was wrong for resource "
+                << resourceId.lowPart << ":" << resourceId.highPart << ", file is corrupt - cache needs to be repopulated and saved again");
+            return false;
+        }
+
+        return true;
     }
 
     bool DefaultRendererResourceCacheImpl::shouldResourceBeCached(rendererResourceId_t resourceId, uint32_t resourceDataSize, resourceCacheFlag_t cacheFlag, sceneId_t sceneId) const
@@ -132,41 +128,41 @@ namespace ramses
         UNUSED(cacheFlag);
         UNUSED(sceneId);
 
-        ByteVector data;
-        data.resize(resourceDataSize);
-        ramses_internal::PlatformMemory::Copy(data.data(), resourceData, resourceDataSize);
+        ResourceData newData;
+        newData.resourceId = resourceId;
+        newData.dataSize = resourceDataSize;
+        newData.dataChecksum = CalculateChecksum(resourceData, resourceDataSize);
+        newData.data.resize(resourceDataSize);
+        ramses_internal::PlatformMemory::Copy(newData.data.data(), resourceData, resourceDataSize);
 
-        const bool storingSuccessful = storeResourceInternal(resourceId, data);
+        // stored in memory only, called from render thread and application decides whether to save at all
+        const bool storingSuccessful = storeResourceInternal(std::move(newData));
         assert(storingSuccessful);
         UNUSED(storingSuccessful);
     }
 
-    bool DefaultRendererResourceCacheImpl::storeResourceInternal(rendererResourceId_t resourceId, ByteVector& data)
+    bool DefaultRendererResourceCacheImpl::storeResourceInternal(ResourceData&& resourceData)
     {
-        uint32_t tempSize;
-        if (hasResource(resourceId, tempSize))
+        if (m_resourceIndex.count(resourceData.resourceId) != 0u)
         {
             return false;
         }
-        UNUSED(tempSize);
 
-        if (data.size() > m_maxCacheSizeInBytes || data.empty())
+        if (resourceData.dataSize > m_maxCacheSizeInBytes || resourceData.dataSize == 0u)
         {
             return false;
         }
 
-        makeSpaceForNewItem(static_cast<uint32_t>(data.size()));
-        if (m_currentCacheSizeInBytes + data.size() > m_maxCacheSizeInBytes)
+        makeSpaceForNewItem(resourceData.dataSize);
+        if (m_currentCacheSizeInBytes + resourceData.dataSize > m_maxCacheSizeInBytes)
         {
             return false;
         }
 
-        ResourceData newData;
-        newData.data.swap(data);
-        newData.resourceId = resourceId;
-
-        m_resourceData.push_back(newData);
-        m_currentCacheSizeInBytes += static_cast<uint32_t>(newData.data.size());
+        m_currentCacheSizeInBytes += resourceData.dataSize;
+        const rendererResourceId_t resourceId = resourceData.resourceId;
+        m_resourceData.push_back(std::move(resourceData));
+        m_resourceIndex.insert({ resourceId, std::prev(m_resourceData.end()) });
 
         return m_currentCacheSizeInBytes <= m_maxCacheSizeInBytes;
     }
@@ -184,49 +180,147 @@ namespace ramses
     void DefaultRendererResourceCacheImpl::removeOldestItem()
     {
         assert(!m_resourceData.empty());
-        m_currentCacheSizeInBytes -= static_cast<uint32_t>(m_resourceData[0].data.size());
+        const ResourceData& oldestItem = m_resourceData.front();
+        m_currentCacheSizeInBytes -= oldestItem.dataSize;
+        m_resourceIndex.erase(oldestItem.resourceId);
         m_resourceData.pop_front();
+
+        // removed entry stays in file until it is rewritten
+        if (!m_filePath.empty())
+            m_fileOutdated = true;
+    }
+
+    DefaultRendererResourceCacheImpl::EntryHeader DefaultRendererResourceCacheImpl::CreateEntryHeader(const ResourceData& resourceData)
+    {
+        EntryHeader header = {};
+        header.resourceIdLowPart  = resourceData.resourceId.lowPart;
+        header.resourceIdHighPart = resourceData.resourceId.highPart;
+        header.dataSize           = resourceData.dataSize;
+        header.dataChecksum       = resourceData.dataChecksum;
+        header.checksum           = CalculateChecksum(&header, offsetof(EntryHeader, checksum));
+        return header;
+    }
+
+    const uint8_t* DefaultRendererResourceCacheImpl::GetData(const ResourceData& resourceData)
+    {
+        return resourceData.mappedData != nullptr ? resourceData.mappedData : resourceData.data.data();
     }
 
-    void DefaultRendererResourceCacheImpl::iterateDataToSave(IDataFunctor& functor) const
+    bool DefaultRendererResourceCacheImpl::appendToFile() const
     {
-        const uint32_t numberOfEntries = static_cast<uint32_t>(m_resourceData.size());
-        functor.addData(&numberOfEntries, sizeof(numberOfEntries));
+        if (std::all_of(m_resourceData.cbegin(), m_resourceData.cend(), [](const ResourceData& resourceData) { return resourceData.inFile; }))
+            return true;
 
-        for (const auto &it : m_resourceData)
+        ramses_internal::File file(m_filePath.c_str());
+
+        // do not append if file was modified externally or has invalid content at its end
+        size_t actualFileSize = 0u;
+        if (!file.getSizeInBytes(actualFileSize) || actualFileSize != m_fileSize)
         {
-            const uint32_t dataSize = static_cast<uint32_t>(it.data.size());
+            LOG_INFO(ramses_internal::CONTEXT_RENDERER, "DefaultRendererResourceCacheImpl::appendToFile: Cannot append to " << m_filePath << ", file will be rewritten");
+            return false;
+        }
 
-            functor.addData(&it.resourceId, sizeof(it.resourceId));
-            functor.addData(&dataSize, sizeof(dataSize));
-            functor.addData(it.data.data(), dataSize);
+        if (!file.open(ramses_internal::File::Mode::WriteExistingBinary) ||
+            !file.seek(static_cast<std::intptr_t>(m_fileSize), ramses_internal::File::SeekOrigin::BeginningOfFile))
+        {
+            LOG_WARN(ramses_internal::CONTEXT_RENDERER, "DefaultRendererResourceCacheImpl::appendToFile: Failed to open " << m_filePath);
+            return false;
         }
+
+        // entries not in file yet are the newest ones, append them in cache order
+        for (const auto& resourceData : m_resourceData)
+        {
+            if (resourceData.inFile)
+                continue;
+
+            const EntryHeader header = CreateEntryHeader(resourceData);
+            if (!file.write(&header, sizeof(header)) ||
+                !file.write(GetData(resourceData), resourceData.dataSize))
+            {
+                LOG_WARN(ramses_internal::CONTEXT_RENDERER, "DefaultRendererResourceCacheImpl::appendToFile: Failed to append to " << m_filePath);
+                return false;
+            }
+            m_fileSize += sizeof(header) + resourceData.dataSize;
+            resourceData.inFile = true;
+        }
+
+        return file.flush();
     }
 
-    void DefaultRendererResourceCacheImpl::saveToFile(const char* filePath) const
+    bool DefaultRendererResourceCacheImpl::writeToFile(const std::string& filePath) const
     {
-        ramses_internal::File file(filePath);
+        ramses_internal::File file(filePath.c_str());
         ramses_internal::BinaryFileOutputStream outputStream(file);
 
         if (outputStream.getState() != ramses_internal::EStatus::Ok)
         {
-            LOG_WARN(ramses_internal::CONTEXT_RENDERER, "BinaryShaderCacheImpl::saveToFile: Failed to open for writing " << filePath);
-            file.close();
+            LOG_WARN(ramses_internal::CONTEXT_RENDERER, "DefaultRendererResourceCacheImpl::saveToFile: Failed to open for writing " << filePath);
+            return false;
+        }
+
+        const FileHeader fileHeader = CreateFileHeader();
+        outputStream.write(&fileHeader, sizeof(fileHeader));
+
+        for (const auto& resourceData : m_resourceData)
+        {
+            const EntryHeader entryHeader = CreateEntryHeader(resourceData);
+            outputStream.write(&entryHeader, sizeof(entryHeader));
+            outputStream.write(GetData(resourceData), resourceData.dataSize);
+        }
+
+        return outputStream.getState() == ramses_internal::EStatus::Ok;
+    }
+
+    void DefaultRendererResourceCacheImpl::saveToFile(const char* filePath) const
+    {
+        const std::string path(filePath);
+        if (path != m_filePath)
+        {
+            writeToFile(path);
             return;
         }
 
-        ChecksumDataFunctor checksumFunctor;
-        iterateDataToSave(checksumFunctor);
+        // file cache was loaded from is still valid, only new entries need to be appended
+        if (!m_fileOutdated && appendToFile())
+            return;
+
+        // data of loaded entries is still read from mapped file, write to temporary file and atomically replace original file with it,
+        // where supported existing mapping keeps referring to the original content
+        const std::string tempPath = path + ".tmp";
+        if (!writeToFile(tempPath))
+            return;
+
+        if (!ramses_internal::MemoryMappedFile::CanBeReplacedWhileMapped)
+            releaseMappedFile();
 
-        FileHeader header       = {};
-        header.fileSize         = static_cast<uint32_t>(checksumFunctor.m_totalSize + sizeof(header));
-        header.transportVersion = RAMSES_TRANSPORT_PROTOCOL_VERSION_MAJOR;
-        header.checksum         = checksumFunctor.m_checksum.getResult();
+        ramses_internal::File tempFile(tempPath.c_str());
+        if (!tempFile.renameTo(path.c_str()))
+        {
+            LOG_WARN(ramses_internal::CONTEXT_RENDERER, "DefaultRendererResourceCacheImpl::saveToFile: Failed to replace " << path);
+            tempFile.remove();
+            return;
+        }
 
-        outputStream.write(&header, sizeof(header));
+        size_t newFileSize = 0u;
+        ramses_internal::File file(path.c_str());
+        m_fileSize = file.getSizeInBytes(newFileSize) ? newFileSize : 0u;
+        m_fileOutdated = false;
+        for (const auto& resourceData : m_resourceData)
+            resourceData.inFile = true;
+    }
 
-        SaveDataFunctor saveFunctor(outputStream);
-        iterateDataToSave(saveFunctor);
+    void DefaultRendererResourceCacheImpl::releaseMappedFile() const
+    {
+        for (const auto& resourceData : m_resourceData)
+        {
+            if (resourceData.mappedData != nullptr)
+            {
+                resourceData.data.assign(resourceData.mappedData, resourceData.mappedData + resourceData.dataSize);
+                resourceData.mappedData = nullptr;
+            }
+        }
+        m_mappedFile.reset();
     }
 
     bool DefaultRendererResourceCacheImpl::loadFromFile(const char* filePath)
@@ -234,42 +328,52 @@ namespace ramses
         clear();
 
         ramses_internal::File file(filePath);
-
         if (!file.exists())
         {
             LOG_WARN(ramses_internal::CONTEXT_RENDERER, "DefaultRendererResourceCacheImpl::loadFromFile: file does not exist: " << filePath);
             return false;
         }
 
-        ramses_internal::BinaryFileInputStream inputStream(file);
-        if (inputStream.getState() != ramses_internal::EStatus::Ok)
+        m_mappedFile.reset(new ramses_internal::MemoryMappedFile(filePath));
+        if (!m_mappedFile->map())
         {
-            LOG_WARN(ramses_internal::CONTEXT_RENDERER, "DefaultRendererResourceCacheImpl::loadFromFile: failed to load file: " << filePath << " errorstate: " << inputStream.getState());
+            LOG_WARN(ramses_internal::CONTEXT_RENDERER, "DefaultRendererResourceCacheImpl::loadFromFile: failed to map file: " << filePath);
+            m_mappedFile.reset();
             return false;
         }
 
-        FileHeader fileHeader;
+        m_filePath = filePath;
+        if (!loadIndexFromMappedFile())
+        {
+            clear();
+            return false;
+        }
+
+        return true;
+    }
+
+    bool DefaultRendererResourceCacheImpl::loadIndexFromMappedFile()
+    {
+        const uint8_t* fileData = m_mappedFile->getData();
+        const size_t actualFileSize = m_mappedFile->getSize();
 
-        ramses_internal::UInt actualFileSize = 0;
-        if (!file.getSizeInBytes(actualFileSize) || actualFileSize < sizeof(FileHeader))
+        FileHeader fileHeader;
+        if (actualFileSize < sizeof(FileHeader))
         {
             LOG_WARN(ramses_internal::CONTEXT_RENDERER,
                      "DefaultRendererResourceCacheImpl::loadFromFile: Invalid file size, file is corrupt - cache needs to be repopulated and saved again");
             return false;
         }
+        ramses_internal::PlatformMemory::Copy(&fileHeader, fileData, sizeof(fileHeader));
 
-        inputStream >> fileHeader.fileSize;
-
-        if (actualFileSize != fileHeader.fileSize)
+        if (fileHeader.magic != FileMagic || fileHeader.formatVersion != FileFormatVersion ||
+            fileHeader.checksum != CalculateChecksum(&fileHeader, offsetof(FileHeader, checksum)))
         {
             LOG_WARN(ramses_internal::CONTEXT_RENDERER,
-                     "DefaultRendererResourceCacheImpl::loadFromFile: File did not match the size stored in the file header, file "
-                     "is corrupt - cache needs to be repopulated and saved again");
+                     "DefaultRendererResourceCacheImpl::loadFromFile: Invalid file header, file is corrupt or of unsupported format - cache needs to be repopulated and saved again");
             return false;
         }
 
-        inputStream >> fileHeader.transportVersion;
-
         if (fileHeader.transportVersion != RAMSES_TRANSPORT_PROTOCOL_VERSION_MAJOR)
         {
             LOG_WARN(ramses_internal::CONTEXT_RENDERER,
@@ -280,70 +384,58 @@ namespace ramses
             return false;
         }
 
-        ramses_internal::Adler32Checksum calculatedChecksum;
-
-        inputStream >> fileHeader.checksum;
-
-        uint32_t itemCount = 0;
-        inputStream >> itemCount;
-        calculatedChecksum.addData(reinterpret_cast<ramses_internal::Byte*>(&itemCount), sizeof(itemCount));
-
-        for (uint32_t i = 0; i < itemCount; i++)
+        // only entry headers are read here, entry data is read from mapped file on demand
+        size_t offset = sizeof(FileHeader);
+        while (offset < actualFileSize)
         {
-            uint64_t resIdLowPart = 0;
-            inputStream >> resIdLowPart;
-            calculatedChecksum.addData(reinterpret_cast<ramses_internal::Byte*>(&resIdLowPart), sizeof(resIdLowPart));
-
-            uint64_t resIdHighPart = 0;
-            inputStream >> resIdHighPart;
-            calculatedChecksum.addData(reinterpret_cast<ramses_internal::Byte*>(&resIdHighPart), sizeof(resIdHighPart));
-
-            uint32_t resourceSize = 0;
-            inputStream >> resourceSize;
-            calculatedChecksum.addData(reinterpret_cast<ramses_internal::Byte*>(&resourceSize), sizeof(resourceSize));
-
-            if (resourceSize > actualFileSize)
+            EntryHeader entryHeader;
+            if (actualFileSize - offset < sizeof(EntryHeader))
             {
-                // resourceSize is larger than whole file size, so it must be wrong
-                LOG_WARN(ramses_internal::CONTEXT_RENDERER,
-                    "DefaultRendererResourceCacheImpl::loadFromFile: Wrong resourceSize: " << resourceSize <<
-                    ", file is corrupt - cache needs to be repopulated and saved again");
-                clear();
-                return false;
+                LOG_WARN(ramses_internal::CONTEXT_RENDERER, "DefaultRendererResourceCacheImpl::loadFromFile: File is truncated, ignoring incomplete entry at its end");
+                break;
             }
+            ramses_internal::PlatformMemory::Copy(&entryHeader, fileData + offset, sizeof(entryHeader));
 
-            ByteVector data;
-            data.resize(resourceSize);
-            inputStream.read(reinterpret_cast<ramses_internal::Char*>(data.data()), resourceSize);
-            calculatedChecksum.addData(data.data(), resourceSize);
+            if (entryHeader.checksum != CalculateChecksum(&entryHeader, offsetof(EntryHeader, checksum)))
+            {
+                LOG_WARN(ramses_internal::CONTEXT_RENDERER, "DefaultRendererResourceCacheImpl::loadFromFile: Checksum of entry header was wrong, ignoring rest of file");
+                break;
+            }
 
-            if (!storeResourceInternal(rendererResourceId_t(resIdLowPart, resIdHighPart), data))
+            if (entryHeader.dataSize > actualFileSize - offset - sizeof(EntryHeader))
             {
-                LOG_WARN(ramses_internal::CONTEXT_RENDERER, "DefaultRendererResourceCacheImpl::loadFromFile: storeResourceInternal failed"
-                                << ", either file is corrupt or cache size too small  - cache needs to be repopulated and saved again");
-                clear();
-                return false;
+                LOG_WARN(ramses_internal::CONTEXT_RENDERER, "DefaultRendererResourceCacheImpl::loadFromFile: File is truncated, ignoring incomplete entry at its end");
+                break;
             }
 
-            if (inputStream.getState() != ramses_internal::EStatus::Ok)
+            ResourceData resourceData;
+            resourceData.resourceId = rendererResourceId_t(entryHeader.resourceIdLowPart, entryHeader.resourceIdHighPart);
+            resourceData.dataSize = entryHeader.dataSize;
+            resourceData.dataChecksum = entryHeader.dataChecksum;
+            resourceData.loadedFromFile = true;
+            resourceData.inFile = true;
+            resourceData.mappedData = fileData + offset + sizeof(EntryHeader);
+            offset += sizeof(EntryHeader) + entryHeader.dataSize;
+
+            // file might contain entries which did not fit into cache or older copies of same resource,
+            // keep newest entries fitting into cache same as when they were stored
+            const auto existingEntry = m_resourceIndex.find(resourceData.resourceId);
+            if (existingEntry != m_resourceIndex.end())
             {
-                LOG_WARN(ramses_internal::CONTEXT_RENDERER,
-                         "DefaultRendererResourceCacheImpl::loadFromFile: Reading failed, file is corrupt - cache "
-                         "needs to be repopulated and saved again");
-                clear();
-                return false;
+                m_currentCacheSizeInBytes -= existingEntry->second->dataSize;
+                m_resourceData.erase(existingEntry->second);
+                m_resourceIndex.erase(existingEntry);
+                m_fileOutdated = true;
             }
-        }
 
-        if (calculatedChecksum.getResult() != fileHeader.checksum)
-        {
-            LOG_WARN(ramses_internal::CONTEXT_RENDERER,
-                     "DefaultRendererResourceCacheImpl::loadFromFile: Checksum was wrong, file is corrupt - cache "
-                     "needs to be repopulated and saved again");
-            clear();
-            return false;
+            if (!storeResourceInternal(std::move(resourceData)))
+                m_fileOutdated = true;
         }
 
+        m_fileSize = offset;
+        if (m_fileSize != actualFileSize)
+            m_fileOutdated = true;
+
         return true;
     }
 }
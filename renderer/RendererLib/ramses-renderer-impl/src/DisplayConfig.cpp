@@ -156,6 +156,13 @@ namespace ramses
         return status;
     }
 
+    status_t DisplayConfig::enablePartialFramebufferUpdate(bool enable)
+    {
+        const status_t status = impl.enablePartialFramebufferUpdate(enable);
+        LOG_HL_RENDERER_API1(status, enable);
+        return status;
+    }
+
     status_t DisplayConfig::setGPUMemoryCacheSize(uint64_t size)
     {
         const status_t status = impl.setGPUMemoryCacheSize(size);
@@ -162,6 +162,12 @@ namespace ramses
         return StatusOK;
     }
 
+    status_t DisplayConfigImpl::enablePartialFramebufferUpdate(bool enable)
+    {
+        m_internalConfig.setPartialFramebufferUpdateEnabled(enable);
+        return StatusOK;
+    }
+
     status_t DisplayConfigImpl::setGPUMemoryCacheSize(uint64_t size)
     {
         m_internalConfig.setGPUMemoryCacheSize(size);
@@ -47,11 +47,11 @@ namespace ramses
         , m_rendererFrameworkLogic(framework.getScenegraphComponent(), m_rendererCommandBuffer, framework.getFrameworkLock())
         , m_platform(platform != nullptr ? platform : ramses_internal::Platform_Base::CreatePlatform(m_internalConfig))
         , m_resourceUploader(m_rendererStatistics, m_binaryShaderCache.get())
-        , m_renderer(new ramses_internal::WindowedRenderer(m_rendererCommandBuffer, m_rendererFrameworkLogic, *m_platform, m_rendererStatistics, m_internalConfig.getKPIFileName()))
+        , m_renderer(new ramses_internal::WindowedRenderer(m_rendererCommandBuffer, m_rendererFrameworkLogic, *m_platform, m_rendererStatistics, m_internalConfig.getKPIFileName(), m_internalConfig.getSceneUpdateThreadCount()))
         , m_systemCompositorEnabled(m_internalConfig.getSystemCompositorControlEnabled())
         , m_loopMode(ramses_internal::ELoopMode::UpdateAndRender)
         , m_rendererLoopThreadWatchdog(framework.getThreadWatchdogConfig().getWatchdogNotificationInterval(ERamsesThreadIdentifier_Renderer), ERamsesThreadIdentifier_Renderer, framework.getThreadWatchdogConfig().getCallBack())
-        , m_rendererLoopThreadController(*m_renderer, m_rendererLoopThreadWatchdog, m_internalConfig.getRenderThreadLoopTimingReportingPeriod())
+        , m_rendererLoopThreadController(*m_renderer, m_rendererLoopThreadWatchdog, m_internalConfig.getRenderThreadLoopTimingReportingPeriod(), m_internalConfig.getDeadlineFrameSchedulingEnabled())
         , m_rendererLoopThreadType(ERendererLoopThreadType_Undefined)
         , m_periodicLogSupplier(framework.getPeriodicLogger(), m_rendererCommandBuffer)
     {
@@ -121,4 +121,28 @@ namespace ramses
         return impl.getRenderThreadLoopTimingReportingPeriod();
     }
 
+    status_t RendererConfig::setSceneUpdateThreadCount(uint32_t threadCount)
+    {
+        const status_t status = impl.setSceneUpdateThreadCount(threadCount);
+        LOG_HL_RENDERER_API1(status, threadCount);
+        return status;
+    }
+
+    uint32_t RendererConfig::getSceneUpdateThreadCount() const
+    {
+        return impl.getSceneUpdateThreadCount();
+    }
+
+    status_t RendererConfig::enableDeadlineFrameScheduling(bool enable)
+    {
+        const status_t status = impl.enableDeadlineFrameScheduling(enable);
+        LOG_HL_RENDERER_API1(status, enable);
+        return status;
+    }
+
+    bool RendererConfig::isDeadlineFrameSchedulingEnabled() const
+    {
+        return impl.isDeadlineFrameSchedulingEnabled();
+    }
+
 }
@@ -121,6 +121,30 @@ namespace ramses
         return m_internalConfig.getRenderThreadLoopTimingReportingPeriod();
     }
 
+    status_t RendererConfigImpl::setSceneUpdateThreadCount(uint32_t threadCount)
+    {
+        if (threadCount > std::numeric_limits<uint16_t>::max())
+            return addErrorEntry("RendererConfig::setSceneUpdateThreadCount failed - thread count too high");
+        m_internalConfig.setSceneUpdateThreadCount(threadCount);
+        return StatusOK;
+    }
+
+    uint32_t RendererConfigImpl::getSceneUpdateThreadCount() const
+    {
+        return m_internalConfig.getSceneUpdateThreadCount();
+    }
+
+    status_t RendererConfigImpl::enableDeadlineFrameScheduling(bool enable)
+    {
+        m_internalConfig.setDeadlineFrameSchedulingEnabled(enable);
+        return StatusOK;
+    }
+
+    bool RendererConfigImpl::isDeadlineFrameSchedulingEnabled() const
+    {
+        return m_internalConfig.getDeadlineFrameSchedulingEnabled();
+    }
+
     const ramses_internal::RendererConfig& RendererConfigImpl::getInternalRendererConfig() const
     {
         return m_internalConfig;
@@ -12,11 +12,14 @@
 #include "Watchdog/PlatformWatchdog.h"
 #include "RamsesRendererUtils.h"
 #include "RendererLib/WindowedRenderer.h"
+#include "RendererLib/RendererCommandBuffer.h"
+#include <algorithm>
 
 namespace ramses_internal
 {
-    RendererLoopThreadController::RendererLoopThreadController(WindowedRenderer& windowedRenderer, PlatformWatchdog& watchdog, std::chrono::milliseconds loopCountPeriod)
+    RendererLoopThreadController::RendererLoopThreadController(WindowedRenderer& windowedRenderer, PlatformWatchdog& watchdog, std::chrono::milliseconds loopCountPeriod, Bool deadlineFrameScheduling)
         : m_windowedRenderer(&windowedRenderer)
+        , m_rendererCommandBuffer(windowedRenderer.getRendererCommandBuffer())
         , m_watchdog(watchdog)
         , m_thread("R_RendererThrd")
         , m_lock()
@@ -25,11 +28,15 @@ namespace ramses_internal
         , m_threadStarted(false)
         , m_destroyRenderer(false)
         , m_loopCountPeriod(loopCountPeriod)
+        , m_deadlineFrameScheduling(deadlineFrameScheduling)
     {
+        // command buffer is owned by renderer API object and outlives windowed renderer deleted in render thread
+        m_rendererCommandBuffer.setSceneUpdateListener([this](SceneId sceneId) { sceneUpdateArrived(sceneId); });
     }
 
     RendererLoopThreadController::~RendererLoopThreadController()
     {
+        m_rendererCommandBuffer.setSceneUpdateListener(nullptr);
         if (m_threadStarted)
         {
             m_thread.cancel();
@@ -81,7 +88,7 @@ namespace ramses_internal
     void RendererLoopThreadController::run()
     {
         UInt64 loopStartTime = PlatformTime::GetMicrosecondsMonotonic();
-        std::chrono::milliseconds lastLoopSleepTime{ 0u };
+        std::chrono::microseconds lastLoopSleepTime{ 0u };
 
         while (!isCancelRequested())
         {
@@ -110,12 +117,23 @@ namespace ramses_internal
                 std::unique_lock<std::mutex> l(m_lock);
                 m_sleepConditionVar.wait_for(l, std::chrono::milliseconds{m_watchdog.calculateTimeout()});
             }
+            else if (m_deadlineFrameScheduling)
+            {
+                m_frameDeadlineScheduler.setFrameDuration(minimumFrameDuration);
+                // state may change while waiting for frame start, it is re-evaluated before rendering then
+                if (sleepUntilFrameStart(lastLoopSleepTime))
+                {
+                    loopStartTime = PlatformTime::GetMicrosecondsMonotonic();
+                    m_frameDeadlineScheduler.frameStarted(loopStartTime);
+                    const UInt64 loopEndTime = renderFrame(loopMode, lastLoopSleepTime);
+                    m_frameDeadlineScheduler.frameFinished(loopEndTime);
+                    // sleep time was spent before this loop
+                    calculateLooptimeAverage(std::chrono::microseconds{ loopEndTime - loopStartTime } + lastLoopSleepTime, loopEndTime);
+                }
+            }
             else
             {
-                assert(m_windowedRenderer != nullptr);
-                m_windowedRenderer->doOneLoop(loopMode, lastLoopSleepTime);
-
-                const UInt64 loopEndTime = PlatformTime::GetMicrosecondsMonotonic();
+                const UInt64 loopEndTime = renderFrame(loopMode, lastLoopSleepTime);
                 assert(loopEndTime >= loopStartTime);
                 const std::chrono::microseconds currentLoopDuration{ loopEndTime - loopStartTime };
                 lastLoopSleepTime = sleepToControlFramerate(currentLoopDuration, minimumFrameDuration);
@@ -127,6 +145,22 @@ namespace ramses_internal
         }
     }
 
+    UInt64 RendererLoopThreadController::renderFrame(ELoopMode loopMode, std::chrono::microseconds sleepTime)
+    {
+        assert(m_windowedRenderer != nullptr);
+        {
+            // flushes arriving from now on are not guaranteed to be applied in this frame
+            std::lock_guard<std::mutex> guard(m_lock);
+            m_frameFlushArrivals.swap(m_pendingFlushArrivals);
+            m_pendingFlushArrivals.clear();
+        }
+        m_windowedRenderer->doOneLoop(loopMode, sleepTime);
+
+        const UInt64 loopEndTime = PlatformTime::GetMicrosecondsMonotonic();
+        reportFlushArrivalToSwapLatency(loopEndTime);
+        return loopEndTime;
+    }
+
     void RendererLoopThreadController::calculateLooptimeAverage(const std::chrono::microseconds currentLoopDuration, const uint64_t loopEndTime)
     {
         if (m_loopCountPeriod.count() > 0)
@@ -164,6 +198,70 @@ namespace ramses_internal
         return std::chrono::milliseconds{ 0u };
     }
 
+    Bool RendererLoopThreadController::sleepUntilFrameStart(std::chrono::microseconds& sleepTime)
+    {
+        const UInt64 sleepStartTime = PlatformTime::GetMicrosecondsMonotonic();
+        UInt64 now = sleepStartTime;
+        Bool startFrame = false;
+        {
+            std::unique_lock<std::mutex> l(m_lock);
+            while (!isCancelRequested() && m_doRendering && !m_destroyRenderer)
+            {
+                // flush for shown scene may be rendered as soon as frame slot opens, otherwise render just in time for deadline
+                const UInt64 frameStartTime = hasPendingFlushForShownScene() ? m_frameDeadlineScheduler.getEarliestFrameStart() : m_frameDeadlineScheduler.getPlannedFrameStart();
+                now = PlatformTime::GetMicrosecondsMonotonic();
+                if (now >= frameStartTime)
+                {
+                    startFrame = true;
+                    break;
+                }
+
+                // condition variable wait has microsecond resolution, unlike PlatformThread::Sleep
+                m_sleepConditionVar.wait_for(l, std::chrono::microseconds{ frameStartTime - now });
+                now = PlatformTime::GetMicrosecondsMonotonic();
+            }
+        }
+
+        sleepTime = std::chrono::microseconds{ now - sleepStartTime };
+        return startFrame;
+    }
+
+    Bool RendererLoopThreadController::hasPendingFlushForShownScene() const
+    {
+        // scene states are only modified by render thread, which is the caller
+        const auto& sceneStateExecutor = m_windowedRenderer->getSceneStateExecutor();
+        return std::any_of(m_pendingFlushArrivals.cbegin(), m_pendingFlushArrivals.cend(), [&](const FlushArrival& arrival) {
+            return sceneStateExecutor.getSceneState(arrival.sceneId) == ESceneState::Rendered;
+        });
+    }
+
+    void RendererLoopThreadController::sceneUpdateArrived(SceneId sceneId)
+    {
+        const UInt64 arrivalTime = PlatformTime::GetMicrosecondsMonotonic();
+        {
+            std::lock_guard<std::mutex> guard(m_lock);
+            const auto it = std::find_if(m_pendingFlushArrivals.cbegin(), m_pendingFlushArrivals.cend(), [sceneId](const FlushArrival& arrival) { return arrival.sceneId == sceneId; });
+            if (it != m_pendingFlushArrivals.cend())
+                return;
+            m_pendingFlushArrivals.push_back({ sceneId, arrivalTime });
+        }
+
+        if (m_deadlineFrameScheduling)
+            m_sleepConditionVar.notify_one();
+    }
+
+    void RendererLoopThreadController::reportFlushArrivalToSwapLatency(UInt64 swapTime)
+    {
+        const auto& sceneStateExecutor = m_windowedRenderer->getSceneStateExecutor();
+        auto& statistics = m_windowedRenderer->getRenderer().getStatistics();
+        for (const auto& arrival : m_frameFlushArrivals)
+        {
+            if (sceneStateExecutor.getSceneState(arrival.sceneId) == ESceneState::Rendered && swapTime >= arrival.arrivalTime)
+                statistics.flushPresented(arrival.sceneId, std::chrono::microseconds{ swapTime - arrival.arrivalTime });
+        }
+        m_frameFlushArrivals.clear();
+    }
+
     void RendererLoopThreadController::setMaximumFramerate(Float maximumFramerate)
     {
         std::lock_guard<std::mutex> guard(m_lock);
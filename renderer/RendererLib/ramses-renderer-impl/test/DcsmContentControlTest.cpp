@@ -127,6 +127,19 @@ public:
         update(m_lastUpdateTS);
     }
 
+    void makeDcsmContentAvailable(ContentID contentID, Category categoryID, sceneId_t sceneId)
+    {
+        EXPECT_CALL(m_eventHandlerMock, contentAvailable(contentID, categoryID));
+        EXPECT_CALL(m_dcsmConsumerMock, assignContentToConsumer(contentID, _));
+        m_dcsmHandler.contentOffered(contentID, categoryID, ETechnicalContentType::RamsesSceneID);
+        update(m_lastUpdateTS);
+
+        EXPECT_CALL(m_sceneControlMock, setSceneState(sceneId, RendererSceneState::Available));
+        m_dcsmHandler.contentDescription(contentID, TechnicalContentDescriptor{ sceneId.getValue() });
+        m_sceneControlHandler.sceneStateChanged(sceneId, RendererSceneState::Available);
+        update(m_lastUpdateTS);
+    }
+
 protected:
     static constexpr sceneId_t SceneId1{ 33 };
     static constexpr sceneId_t SceneId2{ 34 };
@@ -507,6 +520,122 @@ TEST_F(ADcsmContentControl, handlesContentAndSceneReadyForMultipleContentsSharin
     update();
 }
 
+TEST_F(ADcsmContentControl, preloadsContentSceneWithoutRequestingReadyFromProvider)
+{
+    makeDcsmContentAvailable(m_contentID1, m_categoryID1, SceneId1);
+
+    EXPECT_CALL(m_sceneControlMock, setSceneMapping(SceneId1, m_displayId));
+    EXPECT_CALL(m_sceneControlMock, setSceneState(SceneId1, RendererSceneState::Ready));
+    EXPECT_EQ(StatusOK, m_dcsmContentControl.preloadContent(m_contentID1));
+    update();
+
+    // preloaded scene ready does not make content ready
+    m_sceneControlHandler.sceneStateChanged(SceneId1, RendererSceneState::Ready);
+    update();
+
+    // ready request only waits for provider
+    EXPECT_CALL(m_dcsmConsumerMock, contentStateChange(m_contentID1, EDcsmState::Ready, AnimationInformation{ 0, 0 }));
+    EXPECT_EQ(StatusOK, m_dcsmContentControl.requestContentReady(m_contentID1, 0));
+    update();
+
+    m_dcsmHandler.contentReady(m_contentID1);
+    EXPECT_CALL(m_eventHandlerMock, contentReady(m_contentID1, DcsmContentControlEventResult::OK));
+    update();
+
+    // no longer preloaded
+    EXPECT_NE(StatusOK, m_dcsmContentControl.cancelContentPreload(m_contentID1));
+}
+
+TEST_F(ADcsmContentControl, preloadsContentSceneOnceDescriptionComes)
+{
+    EXPECT_CALL(m_eventHandlerMock, contentAvailable(m_contentID1, m_categoryID1));
+    EXPECT_CALL(m_dcsmConsumerMock, assignContentToConsumer(m_contentID1, _));
+    m_dcsmHandler.contentOffered(m_contentID1, m_categoryID1, ETechnicalContentType::RamsesSceneID);
+    update();
+
+    EXPECT_EQ(StatusOK, m_dcsmContentControl.preloadContent(m_contentID1));
+    update();
+
+    EXPECT_CALL(m_sceneControlMock, setSceneMapping(SceneId1, m_displayId));
+    EXPECT_CALL(m_sceneControlMock, setSceneState(SceneId1, RendererSceneState::Ready));
+    m_dcsmHandler.contentDescription(m_contentID1, TechnicalContentDescriptor{ SceneId1.getValue() });
+    update();
+}
+
+TEST_F(ADcsmContentControl, unloadsLeastRecentlyPreloadedContentWhenPreloadLimitExceeded)
+{
+    makeDcsmContentAvailable(m_contentID1, m_categoryID1, SceneId1);
+    makeDcsmContentAvailable(m_contentID2, m_categoryID2, SceneId2);
+
+    EXPECT_CALL(m_sceneControlMock, setSceneMapping(SceneId1, m_displayId));
+    EXPECT_CALL(m_sceneControlMock, setSceneState(SceneId1, RendererSceneState::Ready));
+    EXPECT_EQ(StatusOK, m_dcsmContentControl.preloadContent(m_contentID1));
+    m_sceneControlHandler.sceneStateChanged(SceneId1, RendererSceneState::Ready);
+    update();
+
+    // default limit is single content
+    EXPECT_CALL(m_sceneControlMock, setSceneMapping(SceneId2, m_displayId));
+    EXPECT_CALL(m_sceneControlMock, setSceneState(SceneId2, RendererSceneState::Ready));
+    EXPECT_CALL(m_sceneControlMock, setSceneState(SceneId1, RendererSceneState::Available));
+    EXPECT_EQ(StatusOK, m_dcsmContentControl.preloadContent(m_contentID2));
+    m_sceneControlHandler.sceneStateChanged(SceneId1, RendererSceneState::Available);
+    m_sceneControlHandler.sceneStateChanged(SceneId2, RendererSceneState::Ready);
+    update();
+
+    EXPECT_EQ(StatusOK, m_dcsmContentControl.setContentPreloadLimit(2u));
+    EXPECT_CALL(m_sceneControlMock, setSceneMapping(SceneId1, m_displayId));
+    EXPECT_CALL(m_sceneControlMock, setSceneState(SceneId1, RendererSceneState::Ready));
+    EXPECT_EQ(StatusOK, m_dcsmContentControl.preloadContent(m_contentID1));
+    m_sceneControlHandler.sceneStateChanged(SceneId1, RendererSceneState::Ready);
+    update();
+
+    // content2 is least recently preloaded now
+    EXPECT_CALL(m_sceneControlMock, setSceneState(SceneId2, RendererSceneState::Available));
+    EXPECT_EQ(StatusOK, m_dcsmContentControl.setContentPreloadLimit(1u));
+    m_sceneControlHandler.sceneStateChanged(SceneId2, RendererSceneState::Available);
+    update();
+
+    EXPECT_CALL(m_sceneControlMock, setSceneState(SceneId1, RendererSceneState::Available));
+    EXPECT_EQ(StatusOK, m_dcsmContentControl.setContentPreloadLimit(0u));
+    m_sceneControlHandler.sceneStateChanged(SceneId1, RendererSceneState::Available);
+    update();
+
+    // preloading disabled
+    EXPECT_EQ(StatusOK, m_dcsmContentControl.preloadContent(m_contentID1));
+    update();
+}
+
+TEST_F(ADcsmContentControl, canCancelContentPreload)
+{
+    makeDcsmContentAvailable(m_contentID1, m_categoryID1, SceneId1);
+    EXPECT_NE(StatusOK, m_dcsmContentControl.cancelContentPreload(m_contentID1));
+
+    EXPECT_CALL(m_sceneControlMock, setSceneMapping(SceneId1, m_displayId));
+    EXPECT_CALL(m_sceneControlMock, setSceneState(SceneId1, RendererSceneState::Ready));
+    EXPECT_EQ(StatusOK, m_dcsmContentControl.preloadContent(m_contentID1));
+    m_sceneControlHandler.sceneStateChanged(SceneId1, RendererSceneState::Ready);
+    update();
+
+    EXPECT_CALL(m_sceneControlMock, setSceneState(SceneId1, RendererSceneState::Available));
+    EXPECT_EQ(StatusOK, m_dcsmContentControl.cancelContentPreload(m_contentID1));
+    update();
+
+    EXPECT_NE(StatusOK, m_dcsmContentControl.cancelContentPreload(m_contentID1));
+}
+
+TEST_F(ADcsmContentControl, failsToPreloadUnknownContent)
+{
+    EXPECT_NE(StatusOK, m_dcsmContentControl.preloadContent(m_contentID1));
+}
+
+TEST_F(ADcsmContentControl, doesNotPreloadContentAlreadyRequestedReady)
+{
+    makeDcsmContentReady(m_contentID1, m_categoryID1);
+    EXPECT_EQ(StatusOK, m_dcsmContentControl.preloadContent(m_contentID1));
+    update();
+    EXPECT_NE(StatusOK, m_dcsmContentControl.cancelContentPreload(m_contentID1));
+}
+
 TEST_F(ADcsmContentControl, failsUpdateIfTimeNotContinuous)
 {
     EXPECT_CALL(m_dcsmConsumerMock, dispatchEvents(_)).Times(4);
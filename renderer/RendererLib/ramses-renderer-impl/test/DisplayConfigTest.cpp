@@ -34,6 +34,7 @@ TEST_F(ADisplayConfig, hasDefaultValuesUponConstruction)
     EXPECT_EQ(defaultDisplayConfig.getBorderlessState(), displayConfig.getBorderlessState());
     EXPECT_EQ(defaultDisplayConfig.isWarpingEnabled(), displayConfig.isWarpingEnabled());
     EXPECT_EQ(defaultDisplayConfig.getKeepEffectsUploaded(), displayConfig.getKeepEffectsUploaded());
+    EXPECT_EQ(defaultDisplayConfig.isPartialFramebufferUpdateEnabled(), displayConfig.isPartialFramebufferUpdateEnabled());
 
     EXPECT_EQ(defaultDisplayConfig.getAntialiasingMethod(), displayConfig.getAntialiasingMethod());
     EXPECT_EQ(defaultDisplayConfig.getAntialiasingSampleCount(), displayConfig.getAntialiasingSampleCount());
@@ -130,6 +131,13 @@ TEST_F(ADisplayConfig, disablesKeepingOfEffectsInVRAM)
     EXPECT_FALSE(config.impl.getInternalDisplayConfig().getKeepEffectsUploaded());
 }
 
+TEST_F(ADisplayConfig, enablesPartialFramebufferUpdate)
+{
+    EXPECT_FALSE(config.impl.getInternalDisplayConfig().isPartialFramebufferUpdateEnabled());
+    EXPECT_EQ(ramses::StatusOK, config.enablePartialFramebufferUpdate(true));
+    EXPECT_TRUE(config.impl.getInternalDisplayConfig().isPartialFramebufferUpdateEnabled());
+}
+
 TEST_F(ADisplayConfig, setsNativeDisplayID)
 {
     EXPECT_EQ(ramses::StatusOK, config.setIntegrityRGLDeviceUnit(2u));
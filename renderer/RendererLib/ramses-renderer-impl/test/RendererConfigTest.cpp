@@ -119,3 +119,25 @@ TEST(ARendererConfig, setsAndGetsLoopCountPeriod)
     EXPECT_EQ(ramses::StatusOK, config.setRenderThreadLoopTimingReportingPeriod(std::chrono::milliseconds(1234)));
     EXPECT_EQ(std::chrono::milliseconds(1234), config.getRenderThreadLoopTimingReportingPeriod());
 }
+
+TEST(ARendererConfig, setsAndGetsSceneUpdateThreadCount)
+{
+    ramses::RendererConfig config;
+    EXPECT_EQ(0u, config.getSceneUpdateThreadCount());
+    EXPECT_EQ(ramses::StatusOK, config.setSceneUpdateThreadCount(4u));
+    EXPECT_EQ(4u, config.getSceneUpdateThreadCount());
+    EXPECT_EQ(4u, config.impl.getInternalRendererConfig().getSceneUpdateThreadCount());
+    EXPECT_NE(ramses::StatusOK, config.setSceneUpdateThreadCount(100000u));
+    EXPECT_EQ(4u, config.getSceneUpdateThreadCount());
+}
+
+TEST(ARendererConfig, enablesAndDisablesDeadlineFrameScheduling)
+{
+    ramses::RendererConfig config;
+    EXPECT_FALSE(config.isDeadlineFrameSchedulingEnabled());
+    EXPECT_EQ(ramses::StatusOK, config.enableDeadlineFrameScheduling(true));
+    EXPECT_TRUE(config.isDeadlineFrameSchedulingEnabled());
+    EXPECT_TRUE(config.impl.getInternalRendererConfig().getDeadlineFrameSchedulingEnabled());
+    EXPECT_EQ(ramses::StatusOK, config.enableDeadlineFrameScheduling(false));
+    EXPECT_FALSE(config.isDeadlineFrameSchedulingEnabled());
+}